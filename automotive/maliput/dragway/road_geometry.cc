@@ -87,42 +87,47 @@ bool RoadGeometry::IsGeoPositionOnDragway(const api::GeoPosition& geo_pos)
 
 int RoadGeometry::GetLaneIndex(const api::GeoPosition& geo_pos) const {
   DRAKE_ASSERT(IsGeoPositionOnDragway(geo_pos));
-  bool lane_found{false};
-  int result{0};
-  for (int i = 0; !lane_found && i < junction_.segment(0)->num_lanes(); ++i) {
-    const Lane* lane = dynamic_cast<const Lane*>(junction_.segment(0)->lane(i));
+  const api::Segment* segment = junction_.segment(0);
+  const int num_lanes = segment->num_lanes();
+  // Returns the y coordinate of the left edge of the i-th lane.
+  auto lane_max_y = [segment](int i) {
+    const Lane* lane = dynamic_cast<const Lane*>(segment->lane(i));
     DRAKE_ASSERT(lane != nullptr);
-    if (geo_pos.y() <= lane->y_offset() + lane->lane_bounds(0).max()) {
-      result = i;
-      lane_found = true;
-    }
-
-    // Checks whether `geo_pos` is on the right shoulder. If it is, save the
-    // index of the right-most lane in `result`.
-    if (lane->to_right() == nullptr) {
-      if (geo_pos.y() <= lane->y_offset() + lane->lane_bounds(0).min() &&
-          geo_pos.y() >= lane->y_offset() + lane->driveable_bounds(0).min()) {
-        result = i;
-        lane_found = true;
-      }
-    }
-
-    // Checks whether `geo_pos` is on the left shoulder. If it is, save the
-    // index of the left-most lane in `result`.
-    if (lane->to_left() == nullptr) {
-      if (geo_pos.y() >= lane->y_offset() + lane->lane_bounds(0).max() &&
-          geo_pos.y() <= lane->y_offset() + lane->driveable_bounds(0).max()) {
-        result = i;
-        lane_found = true;
-      }
-    }
+    return lane->y_offset() + lane->lane_bounds(0).max();
+  };
+
+  // The result is the first lane whose left edge is not to the right of
+  // `geo_pos`.  All lanes have the same width, so it can be computed directly;
+  // the guess is then adjusted against the lanes' actual bounds, in case
+  // round-off placed it off by one.
+  const Lane* first_lane = dynamic_cast<const Lane*>(segment->lane(0));
+  DRAKE_ASSERT(first_lane != nullptr);
+  const double lane_width = first_lane->lane_bounds(0).max() -
+                            first_lane->lane_bounds(0).min();
+  const double guess = std::ceil((geo_pos.y() - lane_max_y(0)) / lane_width);
+  int result = static_cast<int>(
+      math::saturate(guess, 0., static_cast<double>(num_lanes - 1)));
+  while (result > 0 && geo_pos.y() <= lane_max_y(result - 1)) {
+    --result;
+  }
+  while (result < num_lanes - 1 && geo_pos.y() > lane_max_y(result)) {
+    ++result;
+  }
+  if (geo_pos.y() <= lane_max_y(result)) {
+    return result;
   }
-  if (!lane_found) {
-    throw std::runtime_error("dragway::RoadGeometry::GetLaneIndex: Failed to "
-        "find lane for geo_pos (" + std::to_string(geo_pos.x()) + ", " +
-        std::to_string(geo_pos.y()) + ").");
+
+  // Checks whether `geo_pos` is on the left shoulder. If it is, return the
+  // index of the left-most lane.
+  const Lane* lane = dynamic_cast<const Lane*>(segment->lane(result));
+  DRAKE_ASSERT(lane != nullptr);
+  if (lane->to_left() == nullptr &&
+      geo_pos.y() <= lane->y_offset() + lane->driveable_bounds(0).max()) {
+    return result;
   }
-  return result;
+  throw std::runtime_error("dragway::RoadGeometry::GetLaneIndex: Failed to "
+      "find lane for geo_pos (" + std::to_string(geo_pos.x()) + ", " +
+      std::to_string(geo_pos.y()) + ").");
 }
 
 api::RoadPosition RoadGeometry::DoToRoadPosition(
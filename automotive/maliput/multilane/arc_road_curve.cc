@@ -1,7 +1,9 @@
 #include "drake/automotive/maliput/multilane/arc_road_curve.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <utility>
 
 #include "drake/common/unused.h"
 #include "drake/math/saturate.h"
@@ -10,6 +12,25 @@ namespace drake {
 namespace maliput {
 namespace multilane {
 
+std::pair<Vector2<double>, Vector2<double>> ArcRoadCurve::xy_bounds() const {
+  Vector2<double> xy_min = xy_of_p(0.).cwiseMin(xy_of_p(1.));
+  Vector2<double> xy_max = xy_of_p(0.).cwiseMax(xy_of_p(1.));
+  // The arc reaches its extreme x and y values at every multiple of π/2 that
+  // lies within its angular span.
+  const double theta_min = std::min(theta0_, theta0_ + d_theta_);
+  const double theta_max = std::max(theta0_, theta0_ + d_theta_);
+  const double kQuarterTurn = M_PI / 2.;
+  for (double k = std::ceil(theta_min / kQuarterTurn);
+       k * kQuarterTurn <= theta_max; k += 1.) {
+    const Vector2<double> xy =
+        center_ + radius_ * Vector2<double>(std::cos(k * kQuarterTurn),
+                                            std::sin(k * kQuarterTurn));
+    xy_min = xy_min.cwiseMin(xy);
+    xy_max = xy_max.cwiseMax(xy);
+  }
+  return {xy_min, xy_max};
+}
+
 double ArcRoadCurve::FastCalcPFromS(double s, double r) const {
   const double effective_radius = offset_radius(r);
   const double elevation_domain = effective_radius / radius_;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <utility>
 
 #include "drake/automotive/maliput/multilane/road_curve.h"
 #include "drake/common/drake_copyable.h"
@@ -106,6 +107,8 @@ class ArcRoadCurve : public RoadCurve {
 
   double l_max() const override { return radius_ * std::abs(d_theta_); }
 
+  std::pair<Vector2<double>, Vector2<double>> xy_bounds() const override;
+
   Vector3<double> ToCurveFrame(
       const Vector3<double>& geo_coordinate,
       double r_min, double r_max,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 
 #include "drake/automotive/maliput/api/branch_point.h"
 #include "drake/automotive/maliput/api/lane.h"
@@ -82,6 +83,17 @@ class Lane : public api::Lane {
 
   double r0() const { return r0_; }
 
+  /// Returns an axis-aligned box, in the world frame, that contains the whole
+  /// volume of this Lane (i.e. its driveable bounds and elevation bounds along
+  /// its entire length).  The GeoPosition of any LanePosition returned by
+  /// ToLanePosition() lies within this box.
+  /// @return A pair with the minimum and maximum corners of the box.
+  std::pair<V3, V3> CalcBoundingBox() const {
+    return road_curve_->CalcBoundingBox(driveable_bounds_.min() + r0_,
+                                        driveable_bounds_.max() + r0_,
+                                        elevation_bounds_);
+  }
+
   void SetStartBp(BranchPoint* bp) { start_bp_ = bp; }
   void SetEndBp(BranchPoint* bp) { end_bp_ = bp; }
 
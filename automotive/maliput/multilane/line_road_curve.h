@@ -75,6 +75,11 @@ class LineRoadCurve : public RoadCurve {
 
   double l_max() const override { return dp_.norm(); }
 
+  std::pair<Vector2<double>, Vector2<double>> xy_bounds() const override {
+    const Vector2<double> p1 = p0_ + dp_;
+    return {p0_.cwiseMin(p1), p0_.cwiseMax(p1)};
+  }
+
   Vector3<double> ToCurveFrame(
       const Vector3<double>& geo_coordinate,
       double r_min, double r_max,
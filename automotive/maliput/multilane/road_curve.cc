@@ -1,6 +1,7 @@
 #include "drake/automotive/maliput/multilane/road_curve.h"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 
 #include "drake/common/drake_throw.h"
@@ -236,6 +237,50 @@ double RoadCurve::CalcGPrimeAsUsedForCalcSFromP(double p) const {
   return elevation().f_dot_p(p);
 }
 
+std::pair<Vector3<double>, Vector3<double>> RoadCurve::CalcBoundingBox(
+    double r_min, double r_max, const api::HBounds& height_bounds) const {
+  DRAKE_DEMAND(r_min <= r_max);
+  // The (0, r, h) offset is rotated by Rabg, which preserves its norm, so it
+  // displaces points by at most the norm of the farthest (r, h) corner.
+  double offset{0.};
+  for (double r : {r_min, r_max}) {
+    for (double h : {height_bounds.min(), height_bounds.max()}) {
+      offset = std::max(offset, std::sqrt(r * r + h * h));
+    }
+  }
+  // Extremes of the elevation cubic in [0; 1] are either at the ends of the
+  // interval or at roots of its derivative b + 2cp + 3dp².
+  double z_min = std::min(elevation().f_p(0.), elevation().f_p(1.));
+  double z_max = std::max(elevation().f_p(0.), elevation().f_p(1.));
+  auto update_z = [&](double p) {
+    if (p > 0. && p < 1.) {
+      z_min = std::min(z_min, elevation().f_p(p));
+      z_max = std::max(z_max, elevation().f_p(p));
+    }
+  };
+  const double b = elevation().b();
+  const double c = 2. * elevation().c();
+  const double a = 3. * elevation().d();
+  if (a != 0.) {
+    const double discriminant = c * c - 4. * a * b;
+    if (discriminant >= 0.) {
+      update_z((-c + std::sqrt(discriminant)) / (2. * a));
+      update_z((-c - std::sqrt(discriminant)) / (2. * a));
+    }
+  } else if (c != 0.) {
+    update_z(-b / c);
+  }
+
+  const std::pair<Vector2<double>, Vector2<double>> xy = xy_bounds();
+  // Pads the box by the linear tolerance to absorb the round-off incurred when
+  // mapping between the p and s parameterizations.
+  const double margin = offset + linear_tolerance();
+  return {Vector3<double>(xy.first.x() - margin, xy.first.y() - margin,
+                          z_min * l_max() - margin),
+          Vector3<double>(xy.second.x() + margin, xy.second.y() + margin,
+                          z_max * l_max() + margin)};
+}
+
 Vector3<double> RoadCurve::W_of_prh(double p, double r, double h) const {
   // Calculates z (elevation) of (p,0,0).
   const double z = elevation().f_p(p) * l_max();
@@ -176,6 +176,11 @@ class RoadCurve {
   /// @return The total path length of the reference curve.
   virtual double l_max() const = 0;
 
+  /// Computes the axis-aligned bounding box of the reference curve G(p) in
+  /// the xy plane, for the whole [0; 1] interval of p.
+  /// @return A pair with the minimum and maximum corners of the box.
+  virtual std::pair<Vector2<double>, Vector2<double>> xy_bounds() const = 0;
+
   /// Converts a @p geo_coordinate in the world frame to the composed curve
   /// frame, i.e., the superposition of the reference curve, elevation and
   /// superelevation polynomials. The resulting coordinates [p, r, h] are
@@ -213,6 +218,23 @@ class RoadCurve {
   virtual bool IsValid(double r_min, double r_max,
                        const api::HBounds& height_bounds) const = 0;
 
+  /// Computes an axis-aligned box that contains the volume created by
+  /// applying the constant @p r_min, @p r_max and @p height_bounds to the
+  /// RoadCurve, i.e. the image of W_of_prh() for p in [0; 1], r in
+  /// [@p r_min; @p r_max] and h in @p height_bounds.
+  ///
+  /// The box is conservative rather than tight: superelevation and elevation
+  /// slope may rotate the (r, h) offset in any direction orthogonal to the
+  /// reference curve, so the box is the bounding box of the reference curve
+  /// inflated by the largest such offset.
+  /// @param r_min Minimum lateral distance from the composed curve.
+  /// @param r_max Maximum lateral distance from the composed curve.
+  /// @param height_bounds An api::HBounds object that represents the elevation
+  /// bounds of the surface mapping.
+  /// @return A pair with the minimum and maximum corners of the box.
+  std::pair<Vector3<double>, Vector3<double>> CalcBoundingBox(
+      double r_min, double r_max, const api::HBounds& height_bounds) const;
+
   /// Returns W, the world function evaluated at @p p, @p r, @p h.
   Vector3<double> W_of_prh(double p, double r, double h) const;
 
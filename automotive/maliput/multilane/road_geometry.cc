@@ -1,9 +1,17 @@
 #include "drake/automotive/maliput/multilane/road_geometry.h"
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <utility>
+
 #include "drake/automotive/maliput/api/junction.h"
 #include "drake/automotive/maliput/api/lane.h"
 #include "drake/automotive/maliput/api/lane_data.h"
 #include "drake/automotive/maliput/api/segment.h"
+#include "drake/automotive/maliput/multilane/lane.h"
 #include "drake/common/drake_assert.h"
 
 namespace drake {
@@ -12,9 +20,26 @@ namespace multilane {
 
 namespace {
 
+// The result of calling ToLanePosition() on `lane`.
+struct LaneQuery {
+  const api::Lane* lane{};
+  api::LanePosition lane_position;
+  api::GeoPosition nearest_position;
+  double distance{};
+};
+
+LaneQuery EvalLane(const api::GeoPosition& geo_position,
+                   const api::Lane* const lane) {
+  DRAKE_DEMAND(lane != nullptr);
+  LaneQuery query;
+  query.lane = lane;
+  query.lane_position = lane->ToLanePosition(
+      geo_position, &query.nearest_position, &query.distance);
+  return query;
+}
+
 // Updates `road_position`, `distance` and `nearest_position` (when it's
-// not nullptr) after computing ToLanePosition on the `lane` with `geo_position`
-// when:
+// not nullptr) with the result of a ToLanePosition `query` when:
 //
 // - The new computed distance is smaller than `*distance` by
 // `linear_tolerance`.
@@ -26,32 +51,31 @@ namespace {
 // falls within `linear_tolerance`) and the new LanePosition falls within lane's
 // lane bounds but `road_position->pos` does not.
 //
+// In particular, `query` is always discarded when its distance exceeds
+// `*distance` by more than `linear_tolerance`.
+//
 // The following preconditions should be met:
 //
-// `lane` must not be nullptr.
 // `road_position` must not be nullptr.
 // `distance` must not be nullptr.
-void GetPositionIfSmallerDistance(const api::GeoPosition& geo_position,
-                                  const double linear_tolerance,
-                                  const api::Lane* const lane,
-                                  api::RoadPosition* const road_position,
-                                  double* const distance,
-                                  api::GeoPosition* const nearest_position) {
-  DRAKE_DEMAND(lane != nullptr);
+void UpdateIfSmallerDistance(const LaneQuery& query,
+                             const double linear_tolerance,
+                             api::RoadPosition* const road_position,
+                             double* const distance,
+                             api::GeoPosition* const nearest_position) {
   DRAKE_DEMAND(road_position != nullptr);
   DRAKE_DEMAND(distance != nullptr);
 
-  double new_distance{};
-  api::GeoPosition new_nearest_position{};
-  const api::LanePosition lane_position =
-      lane->ToLanePosition(geo_position, &new_nearest_position, &new_distance);
+  const api::Lane* const lane = query.lane;
+  const api::LanePosition& lane_position = query.lane_position;
+  const double new_distance = query.distance;
 
   // Replaces return values.
   auto replace_values = [&]() {
     *distance = new_distance;
     *road_position = api::RoadPosition{lane, lane_position};
     if (nearest_position != nullptr) {
-      *nearest_position = new_nearest_position;
+      *nearest_position = query.nearest_position;
     }
   };
 
@@ -96,14 +120,194 @@ void GetPositionIfSmallerDistance(const api::GeoPosition& geo_position,
   }
 }
 
+// Computes ToLanePosition on the `lane` with `geo_position` and updates
+// `road_position`, `distance` and `nearest_position` (when it's not nullptr)
+// as UpdateIfSmallerDistance() does.
+//
+// The following preconditions should be met:
+//
+// `lane` must not be nullptr.
+// `road_position` must not be nullptr.
+// `distance` must not be nullptr.
+void GetPositionIfSmallerDistance(const api::GeoPosition& geo_position,
+                                  const double linear_tolerance,
+                                  const api::Lane* const lane,
+                                  api::RoadPosition* const road_position,
+                                  double* const distance,
+                                  api::GeoPosition* const nearest_position) {
+  UpdateIfSmallerDistance(EvalLane(geo_position, lane), linear_tolerance,
+                          road_position, distance, nearest_position);
+}
+
 }  // namespace
 
+// A bounding volume hierarchy over the axis-aligned bounding boxes of all the
+// lanes of a RoadGeometry.  Lanes are identified by their position in the
+// junction, segment and lane ordering used by the exhaustive search.
+class RoadGeometry::LaneIndex {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LaneIndex)
+
+  explicit LaneIndex(const RoadGeometry& road_geometry) {
+    for (int i = 0; i < road_geometry.num_junctions(); ++i) {
+      const api::Junction* junction = road_geometry.junction(i);
+      for (int j = 0; j < junction->num_segments(); ++j) {
+        const api::Segment* segment = junction->segment(j);
+        for (int k = 0; k < segment->num_lanes(); ++k) {
+          const Lane* lane = dynamic_cast<const Lane*>(segment->lane(k));
+          DRAKE_DEMAND(lane != nullptr);
+          const std::pair<V3, V3> box = lane->CalcBoundingBox();
+          lanes_.push_back(lane);
+          boxes_.push_back({box.first, box.second});
+        }
+      }
+    }
+    order_.resize(lanes_.size());
+    std::iota(order_.begin(), order_.end(), 0);
+    if (!lanes_.empty()) {
+      nodes_.reserve(2 * lanes_.size());
+      Build(0, num_lanes());
+    }
+  }
+
+  int num_lanes() const { return static_cast<int>(lanes_.size()); }
+
+  const api::Lane* lane(int index) const { return lanes_[index]; }
+
+  // Returns a lower bound on the distance between `xyz` and any position in
+  // the lane at `index`.
+  double LowerBoundDistance(int index, const V3& xyz) const {
+    return boxes_[index].Distance(xyz);
+  }
+
+  // Returns the index of the lane whose box is closest to `xyz`.
+  int FindNearestBox(const V3& xyz) const {
+    DRAKE_DEMAND(!nodes_.empty());
+    // Best-first traversal, ordered by the distance to the nodes' boxes.
+    using Entry = std::pair<double, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    queue.emplace(nodes_[0].box.Distance(xyz), 0);
+    int nearest{-1};
+    double nearest_distance = std::numeric_limits<double>::infinity();
+    while (!queue.empty() && queue.top().first < nearest_distance) {
+      const Node& node = nodes_[queue.top().second];
+      queue.pop();
+      if (node.is_leaf()) {
+        for (int i = node.begin; i < node.end; ++i) {
+          const double distance = boxes_[order_[i]].Distance(xyz);
+          if (distance < nearest_distance) {
+            nearest_distance = distance;
+            nearest = order_[i];
+          }
+        }
+      } else {
+        for (int child : {node.left, node.right}) {
+          queue.emplace(nodes_[child].box.Distance(xyz), child);
+        }
+      }
+    }
+    DRAKE_DEMAND(nearest >= 0);
+    return nearest;
+  }
+
+  // Returns, in increasing order, the indices of all the lanes whose boxes
+  // are within `max_distance` of `xyz`.
+  std::vector<int> FindWithin(const V3& xyz, double max_distance) const {
+    std::vector<int> result;
+    if (nodes_.empty()) return result;
+    std::vector<int> stack{0};
+    while (!stack.empty()) {
+      const Node& node = nodes_[stack.back()];
+      stack.pop_back();
+      if (node.box.Distance(xyz) > max_distance) continue;
+      if (node.is_leaf()) {
+        for (int i = node.begin; i < node.end; ++i) {
+          if (boxes_[order_[i]].Distance(xyz) <= max_distance) {
+            result.push_back(order_[i]);
+          }
+        }
+      } else {
+        stack.push_back(node.left);
+        stack.push_back(node.right);
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+ private:
+  // Maximum number of lanes in a leaf node.
+  static constexpr int kLeafSize{4};
+
+  struct Box {
+    // Returns the distance from `xyz` to this box, or zero if it is inside.
+    double Distance(const V3& xyz) const {
+      return (min - xyz).cwiseMax(xyz - max).cwiseMax(0.).norm();
+    }
+
+    V3 min;
+    V3 max;
+  };
+
+  struct Node {
+    bool is_leaf() const { return left < 0; }
+
+    Box box;
+    // Children indices into nodes_, or -1 for leaves.
+    int left{-1};
+    int right{-1};
+    // The lanes below this node are order_[begin, end).
+    int begin{};
+    int end{};
+  };
+
+  // Builds the subtree for order_[begin, end), splitting at the median of the
+  // box centers along the longest axis, and returns its index into nodes_.
+  int Build(int begin, int end) {
+    Node node;
+    node.begin = begin;
+    node.end = end;
+    node.box = boxes_[order_[begin]];
+    for (int i = begin + 1; i < end; ++i) {
+      node.box.min = node.box.min.cwiseMin(boxes_[order_[i]].min);
+      node.box.max = node.box.max.cwiseMax(boxes_[order_[i]].max);
+    }
+    const int index = static_cast<int>(nodes_.size());
+    nodes_.push_back(node);
+    if (end - begin > kLeafSize) {
+      int axis{};
+      (node.box.max - node.box.min).maxCoeff(&axis);
+      const int middle = begin + (end - begin) / 2;
+      std::nth_element(order_.begin() + begin, order_.begin() + middle,
+                       order_.begin() + end, [&](int a, int b) {
+                         return boxes_[a].min(axis) + boxes_[a].max(axis) <
+                                boxes_[b].min(axis) + boxes_[b].max(axis);
+                       });
+      const int left = Build(begin, middle);
+      const int right = Build(middle, end);
+      nodes_[index].left = left;
+      nodes_[index].right = right;
+    }
+    return index;
+  }
+
+  std::vector<const api::Lane*> lanes_;
+  std::vector<Box> boxes_;
+  std::vector<int> order_;
+  std::vector<Node> nodes_;
+};
+
+
 Junction* RoadGeometry::NewJunction(api::JunctionId id) {
   namespace sp = std::placeholders;
   junctions_.push_back(std::make_unique<Junction>(
       id, this,
       [this](auto segment) { id_index_.AddSegment(segment); },
-      [this](auto lane) { id_index_.AddLane(lane); }));
+      [this](auto lane) {
+        id_index_.AddLane(lane);
+        std::lock_guard<std::mutex> lock(lane_index_mutex_);
+        lane_index_.reset();
+      }));
   Junction* junction = junctions_.back().get();
   id_index_.AddJunction(junction);
   return junction;
@@ -155,26 +359,132 @@ api::RoadPosition RoadGeometry::DoToRoadPosition(
         }
       }
     }
+    if (distance != nullptr) *distance = min_distance;
+    return road_position;
+  }
 
-  } else {
-    // No `hint` supplied.  Search exhaustively through all of the lanes to find
-    // the position associated with the first found containing lane or the
-    // distance-minimizing position.
-    DRAKE_DEMAND(num_junctions() > 0);
-    DRAKE_DEMAND(junction(0)->num_segments() > 0);
-    DRAKE_DEMAND(junction(0)->segment(0)->num_lanes() > 0);
-    const api::Lane* lane = this->junction(0)->segment(0)->lane(0);
-    road_position = {lane, lane->ToLanePosition(geo_position, nearest_position,
-                                                &min_distance)};
-    for (int i = 0; i < num_junctions(); ++i) {
-      const api::Junction* junction = this->junction(i);
-      for (int j = 0; j < junction->num_segments(); ++j) {
-        const api::Segment* segment = junction->segment(j);
-        for (int k = 0; k < segment->num_lanes(); ++k) {
-          GetPositionIfSmallerDistance(geo_position, linear_tolerance_,
-                                       segment->lane(k), &road_position,
-                                       &min_distance, nearest_position);
-        }
+  // No `hint` supplied.  Find the same position that the exhaustive search
+  // would, visiting as few lanes as possible.
+  DRAKE_DEMAND(num_junctions() > 0);
+  DRAKE_DEMAND(junction(0)->num_segments() > 0);
+  DRAKE_DEMAND(junction(0)->segment(0)->num_lanes() > 0);
+  std::shared_ptr<const LaneIndex> index;
+  {
+    std::lock_guard<std::mutex> lock(lane_index_mutex_);
+    if (lane_index_ == nullptr) {
+      lane_index_ = std::make_shared<const LaneIndex>(*this);
+    }
+    index = lane_index_;
+  }
+  const Vector3<double>& xyz = geo_position.xyz();
+  const double tolerance = linear_tolerance_;
+
+  // The exhaustive search starts from the first lane, then visits every lane
+  // in order with UpdateIfSmallerDistance().  Each visit may only change the
+  // result if the lane's distance is within `tolerance` of (or smaller than)
+  // the distance found so far; in particular, a lane whose bounding box is
+  // farther than that can be skipped without altering the result.
+  //
+  // We first find an upper bound on the minimum distance from the first lane
+  // and the lane with the nearest bounding box.  All lanes whose boxes are
+  // within `threshold` of `geo_position` become candidates, and are evaluated
+  // exactly; any other lane is farther than `threshold`.
+  const LaneQuery first = EvalLane(geo_position, index->lane(0));
+  const int nearest_box = index->FindNearestBox(xyz);
+  const double threshold =
+      std::min(first.distance,
+               EvalLane(geo_position, index->lane(nearest_box)).distance) +
+      2. * tolerance;
+  const std::vector<int> candidates = index->FindWithin(xyz, threshold);
+  DRAKE_DEMAND(!candidates.empty());
+  std::vector<LaneQuery> queries;
+  queries.reserve(candidates.size());
+  for (int lane_index : candidates) {
+    queries.push_back(lane_index == 0
+                          ? first
+                          : EvalLane(geo_position, index->lane(lane_index)));
+  }
+
+  // Finds the earliest candidate at the minimum distance.
+  int best = 0;
+  for (int i = 1; i < static_cast<int>(queries.size()); ++i) {
+    if (queries[i].distance < queries[best].distance) best = i;
+  }
+  const double best_distance = queries[best].distance;
+
+  // When every lane visited before the `best` candidate is farther from
+  // `geo_position` than `best_distance + tolerance`, the exhaustive search
+  // must replace its result with the `best` candidate upon visiting it,
+  // regardless of what it found up to that point.  We can then start from
+  // there; otherwise, start from the beginning.
+  bool start_from_best = first.distance > best_distance + tolerance;
+  for (int i = 0; start_from_best && i < best; ++i) {
+    start_from_best = queries[i].distance > best_distance + tolerance;
+  }
+  const LaneQuery& start = start_from_best ? queries[best] : first;
+  road_position = {start.lane, start.lane_position};
+  min_distance = start.distance;
+  api::GeoPosition nearest = start.nearest_position;
+  int next_candidate = start_from_best ? best + 1 : 0;
+  int next_lane = start_from_best ? candidates[best] + 1 : 0;
+
+  // Visits the candidates in order for as long as the distance found so far
+  // guarantees that all other lanes are skipped by the exhaustive search.
+  while (min_distance + tolerance <= threshold &&
+         next_candidate < static_cast<int>(candidates.size())) {
+    UpdateIfSmallerDistance(queries[next_candidate], tolerance, &road_position,
+                            &min_distance, &nearest);
+    next_lane = candidates[next_candidate] + 1;
+    ++next_candidate;
+  }
+  if (next_candidate < static_cast<int>(candidates.size()) ||
+      min_distance + tolerance > threshold) {
+    // The distance found so far grew past the point where non-candidate lanes
+    // may be skipped unconditionally (this requires several lanes within
+    // `tolerance` of each other).  Visit the remaining lanes one by one,
+    // pruning by their bounding boxes.
+    for (int i = next_lane; i < index->num_lanes(); ++i) {
+      if (index->LowerBoundDistance(i, xyz) > min_distance + tolerance) {
+        continue;
+      }
+      const auto it = std::lower_bound(candidates.begin(), candidates.end(), i);
+      if (it != candidates.end() && *it == i) {
+        UpdateIfSmallerDistance(queries[it - candidates.begin()], tolerance,
+                                &road_position, &min_distance, &nearest);
+      } else {
+        GetPositionIfSmallerDistance(geo_position, tolerance, index->lane(i),
+                                     &road_position, &min_distance, &nearest);
+      }
+    }
+  }
+
+  if (nearest_position != nullptr) *nearest_position = nearest;
+  if (distance != nullptr) *distance = min_distance;
+  return road_position;
+}
+
+api::RoadPosition RoadGeometry::ToRoadPositionByExhaustiveSearch(
+    const api::GeoPosition& geo_position, api::GeoPosition* nearest_position,
+    double* distance) const {
+  // Search exhaustively through all of the lanes to find the position
+  // associated with the first found containing lane or the
+  // distance-minimizing position.
+  DRAKE_DEMAND(num_junctions() > 0);
+  DRAKE_DEMAND(junction(0)->num_segments() > 0);
+  DRAKE_DEMAND(junction(0)->segment(0)->num_lanes() > 0);
+  double min_distance{};
+  const api::Lane* lane = this->junction(0)->segment(0)->lane(0);
+  api::RoadPosition road_position{
+      lane, lane->ToLanePosition(geo_position, nearest_position,
+                                 &min_distance)};
+  for (int i = 0; i < num_junctions(); ++i) {
+    const api::Junction* junction = this->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        GetPositionIfSmallerDistance(geo_position, linear_tolerance_,
+                                     segment->lane(k), &road_position,
+                                     &min_distance, nearest_position);
       }
     }
   }
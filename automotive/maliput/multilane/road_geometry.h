@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "drake/automotive/maliput/api/basic_id_index.h"
@@ -60,6 +61,11 @@ class RoadGeometry : public api::RoadGeometry {
   // words, for the lane whose LanePosition makes the r coordinate be the
   // smallest. If `hint` is non-null, then the search is restricted to the
   // `hint->lane` and lanes adjacent to `hint->lane`.
+  //
+  // Without a `hint`, the result is the same as that of an exhaustive search
+  // over all lanes (see ToRoadPositionByExhaustiveSearch()), but a bounding
+  // volume hierarchy over the lanes is used to avoid calling
+  // Lane::ToLanePosition() on lanes that cannot affect the result.
   // TODO(agalbachicar) Take into account `h` coordinate to return by minimum
   //                    `h` and then minimum `r`.
   api::RoadPosition DoToRoadPosition(
@@ -68,6 +74,13 @@ class RoadGeometry : public api::RoadGeometry {
       api::GeoPosition* nearest_position,
       double* distance) const override;
 
+  // Implements DoToRoadPosition() without a `hint` by visiting every lane, in
+  // junction, segment and lane order.
+  api::RoadPosition ToRoadPositionByExhaustiveSearch(
+      const api::GeoPosition& geo_position,
+      api::GeoPosition* nearest_position,
+      double* distance) const;
+
   double do_linear_tolerance() const override { return linear_tolerance_; }
 
   double do_angular_tolerance() const override { return angular_tolerance_; }
@@ -84,6 +97,13 @@ class RoadGeometry : public api::RoadGeometry {
   std::vector<std::unique_ptr<Junction>> junctions_;
   std::vector<std::unique_ptr<BranchPoint>> branch_points_;
   api::BasicIdIndex id_index_;
+
+  // Bounding volume hierarchy over all the lanes, built on first use by
+  // DoToRoadPosition() and discarded whenever a lane is added.
+  class LaneIndex;
+  friend class RoadGeometryLaneIndexTester;
+  mutable std::mutex lane_index_mutex_;
+  mutable std::shared_ptr<const LaneIndex> lane_index_;
 };
 
 }  // namespace multilane
@@ -0,0 +1,93 @@
+/// @file benchmark_to_road_position.cc
+///
+/// Compares the time taken by multilane::RoadGeometry::ToRoadPosition()
+/// without a hint against the exhaustive search over all lanes, on synthetic
+/// grid road networks of increasing size.
+///
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/automotive/maliput/multilane/test_utilities/multilane_grid_road.h"
+#include "drake/common/test_utilities/measure_execution.h"
+
+DEFINE_int32(num_queries, 1000, "Number of random queries per road network");
+DEFINE_int32(num_lanes, 3, "Number of lanes per segment");
+
+namespace drake {
+namespace maliput {
+namespace multilane {
+namespace {
+
+using common::test::MeasureExecutionTime;
+
+void Benchmark(int grid_size) {
+  std::unique_ptr<const api::RoadGeometry> rg =
+      test::MakeGridRoadGeometry(grid_size, grid_size, FLAGS_num_lanes);
+
+  // Draws random queries over the grid's extent.
+  std::mt19937 generator;
+  std::uniform_real_distribution<double> x(-20., grid_size * 60.);
+  std::uniform_real_distribution<double> y(-20., grid_size * 50.);
+  std::uniform_real_distribution<double> z(-1., 3.);
+  std::vector<api::GeoPosition> points;
+  for (int i = 0; i < FLAGS_num_queries; ++i) {
+    points.emplace_back(x(generator), y(generator), z(generator));
+  }
+
+  // The first indexed query builds the index; time it separately.
+  const double build_time = MeasureExecutionTime([&]() {
+    rg->ToRoadPosition(points[0], nullptr, nullptr, nullptr);
+  });
+  int num_mismatches{0};
+  const double indexed_time = MeasureExecutionTime([&]() {
+    for (const api::GeoPosition& point : points) {
+      rg->ToRoadPosition(point, nullptr, nullptr, nullptr);
+    }
+  });
+  const double exhaustive_time = MeasureExecutionTime([&]() {
+    for (const api::GeoPosition& point : points) {
+      RoadGeometryLaneIndexTester::ToRoadPositionByExhaustiveSearch(
+          *rg, point, nullptr, nullptr);
+    }
+  });
+  for (const api::GeoPosition& point : points) {
+    const api::RoadPosition indexed =
+        rg->ToRoadPosition(point, nullptr, nullptr, nullptr);
+    const api::RoadPosition exhaustive =
+        RoadGeometryLaneIndexTester::ToRoadPositionByExhaustiveSearch(
+            *rg, point, nullptr, nullptr);
+    if (indexed.lane != exhaustive.lane ||
+        indexed.pos.srh() != exhaustive.pos.srh()) {
+      ++num_mismatches;
+    }
+  }
+
+  const int num_lanes = grid_size * grid_size * FLAGS_num_lanes;
+  std::cout << num_lanes << " lanes: index built in " << build_time * 1e3
+            << " ms; per query, indexed " << indexed_time / points.size() * 1e6
+            << " us vs exhaustive " << exhaustive_time / points.size() * 1e6
+            << " us (speedup " << exhaustive_time / indexed_time << "x, "
+            << num_mismatches << " mismatches)" << std::endl;
+}
+
+int do_main() {
+  for (int grid_size : {4, 8, 16, 32}) {
+    Benchmark(grid_size);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace multilane
+}  // namespace maliput
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::maliput::multilane::do_main();
+}
@@ -6,11 +6,14 @@
 #include <map>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/automotive/maliput/api/test_utilities/maliput_types_compare.h"
 #include "drake/automotive/maliput/multilane/builder.h"
+#include "drake/automotive/maliput/multilane/lane.h"
+#include "drake/automotive/maliput/multilane/test_utilities/multilane_grid_road.h"
 
 namespace drake {
 namespace maliput {
@@ -600,6 +603,67 @@ GTEST_TEST(MultilaneLanesTest, OverlappingLaneBounds) {
   EXPECT_NEAR(distance, 0., kLinearTolerance);
 }
 
+// Checks that DoToRoadPosition() without a hint, which prunes lanes using a
+// spatial index, yields exactly the same results as the exhaustive search.
+GTEST_TEST(MultilaneLanesTest, IndexedToRoadPositionMatchesExhaustiveSearch) {
+  const int kNumRows{4};
+  const int kNumColumns{5};
+  const int kNumLanes{3};
+  std::unique_ptr<const api::RoadGeometry> rg =
+      test::MakeGridRoadGeometry(kNumRows, kNumColumns, kNumLanes);
+
+  // Every lane's volume lies within its bounding box.
+  for (int i = 0; i < rg->num_junctions(); ++i) {
+    const api::Segment* segment = rg->junction(i)->segment(0);
+    for (int j = 0; j < segment->num_lanes(); ++j) {
+      const Lane* lane = dynamic_cast<const Lane*>(segment->lane(j));
+      ASSERT_NE(lane, nullptr);
+      const std::pair<V3, V3> box = lane->CalcBoundingBox();
+      for (double s : {0., 0.3 * lane->length(), lane->length()}) {
+        const api::RBounds bounds = lane->driveable_bounds(s);
+        for (double r : {bounds.min(), bounds.max()}) {
+          for (double h : {0., kHeight}) {
+            const V3 xyz = lane->ToGeoPosition({s, r, h}).xyz();
+            EXPECT_TRUE((xyz.array() >= box.first.array()).all());
+            EXPECT_TRUE((xyz.array() <= box.second.array()).all());
+          }
+        }
+      }
+    }
+  }
+
+  // Samples points all over (and around) the grid, including points at the
+  // seams between adjacent lanes where the results are decided by ties.
+  std::vector<api::GeoPosition> points;
+  for (double x = -20.; x <= 320.; x += 7.3) {
+    for (double y = -30.; y <= 220.; y += 3.1) {
+      points.emplace_back(x, y, std::fmod(x + y, 4.) - 1.);
+    }
+  }
+  for (double x = 0.; x <= 40.; x += 5.) {
+    for (double y = -1.; y <= 9.; y += 2.) {
+      points.emplace_back(x, y, 0.);
+    }
+  }
+
+  for (const api::GeoPosition& point : points) {
+    api::GeoPosition expected_nearest;
+    double expected_distance{};
+    const api::RoadPosition expected =
+        RoadGeometryLaneIndexTester::ToRoadPositionByExhaustiveSearch(
+            *rg, point, &expected_nearest, &expected_distance);
+    api::GeoPosition nearest;
+    double distance{};
+    const api::RoadPosition result =
+        rg->ToRoadPosition(point, nullptr, &nearest, &distance);
+    ASSERT_EQ(result.lane->id(), expected.lane->id())
+        << "at (" << point.x() << ", " << point.y() << ", " << point.z() << ")";
+    EXPECT_EQ(result.pos.srh(), expected.pos.srh());
+    EXPECT_EQ(nearest.xyz(), expected_nearest.xyz());
+    EXPECT_EQ(distance, expected_distance);
+  }
+}
+
 }  // namespace
 }  // namespace multilane
 }  // namespace maliput
@@ -0,0 +1,72 @@
+#include "drake/automotive/maliput/multilane/test_utilities/multilane_grid_road.h"
+
+#include <string>
+
+#include "drake/automotive/maliput/multilane/builder.h"
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace maliput {
+namespace multilane {
+
+api::RoadPosition RoadGeometryLaneIndexTester::ToRoadPositionByExhaustiveSearch(
+    const api::RoadGeometry& road_geometry,
+    const api::GeoPosition& geo_position, api::GeoPosition* nearest_position,
+    double* distance) {
+  const RoadGeometry* multilane_road_geometry =
+      dynamic_cast<const RoadGeometry*>(&road_geometry);
+  DRAKE_DEMAND(multilane_road_geometry != nullptr);
+  return multilane_road_geometry->ToRoadPositionByExhaustiveSearch(
+      geo_position, nearest_position, distance);
+}
+
+namespace test {
+
+std::unique_ptr<const api::RoadGeometry> MakeGridRoadGeometry(
+    int num_rows, int num_columns, int num_lanes) {
+  DRAKE_DEMAND(num_rows > 0);
+  DRAKE_DEMAND(num_columns > 0);
+  DRAKE_DEMAND(num_lanes > 0);
+  const double kLaneWidth{4.};
+  const double kShoulder{1.};
+  const double kLength{40.};
+  const double kArcRadius{25.};
+  const double kArcDeltaTheta{M_PI / 3.};
+  // Rows are spaced so that adjacent rows' driveable surfaces never overlap.
+  const double kRowSpacing{kArcRadius + num_lanes * kLaneWidth + 10.};
+  const double kColumnSpacing{kLength + 20.};
+  const double kRowElevation{0.5};
+
+  auto builder = BuilderFactory().Make(
+      kLaneWidth, api::HBounds(0., 5.), 0.01 /* linear_tolerance */,
+      0.01 * M_PI /* angular_tolerance */, 1. /* scale_length */,
+      ComputationPolicy::kPreferAccuracy);
+  const LaneLayout layout(kShoulder, kShoulder, num_lanes, 0 /* ref_lane */,
+                          0. /* ref_r0 */);
+  for (int row = 0; row < num_rows; ++row) {
+    const EndpointZ flat_z(row * kRowElevation, 0., 0., 0.);
+    for (int column = 0; column < num_columns; ++column) {
+      const std::string id =
+          "c_" + std::to_string(row) + "_" + std::to_string(column);
+      const Endpoint start(
+          EndpointXy(column * kColumnSpacing, row * kRowSpacing, 0.), flat_z);
+      if ((row + column) % 2 == 0) {
+        builder->Connect(id, layout,
+                         StartReference().at(start, Direction::kForward),
+                         LineOffset(kLength),
+                         EndReference().z_at(flat_z, Direction::kForward));
+      } else {
+        builder->Connect(id, layout,
+                         StartReference().at(start, Direction::kForward),
+                         ArcOffset(kArcRadius, kArcDeltaTheta),
+                         EndReference().z_at(flat_z, Direction::kForward));
+      }
+    }
+  }
+  return builder->Build(api::RoadGeometryId("grid"));
+}
+
+}  // namespace test
+}  // namespace multilane
+}  // namespace maliput
+}  // namespace drake
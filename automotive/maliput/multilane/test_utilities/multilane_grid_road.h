@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/automotive/maliput/api/lane_data.h"
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/automotive/maliput/multilane/road_geometry.h"
+
+namespace drake {
+namespace maliput {
+namespace multilane {
+
+// Provides access to RoadGeometry internals for testing and benchmarking.
+class RoadGeometryLaneIndexTester {
+ public:
+  // Calls RoadGeometry::ToRoadPositionByExhaustiveSearch() on
+  // @p road_geometry, which must be a multilane::RoadGeometry.
+  static api::RoadPosition ToRoadPositionByExhaustiveSearch(
+      const api::RoadGeometry& road_geometry,
+      const api::GeoPosition& geo_position,
+      api::GeoPosition* nearest_position, double* distance);
+};
+
+namespace test {
+
+// Builds a synthetic road network laid out as a regular grid with
+// @p num_rows rows and @p num_columns columns of independent connections,
+// which alternate between straight lines and arcs.  Each connection has
+// @p num_lanes lanes, and each row sits at a different (constant) elevation.
+// The road has num_rows * num_columns segments and
+// num_rows * num_columns * num_lanes lanes.
+std::unique_ptr<const api::RoadGeometry> MakeGridRoadGeometry(
+    int num_rows, int num_columns, int num_lanes);
+
+}  // namespace test
+}  // namespace multilane
+}  // namespace maliput
+}  // namespace drake
@@ -133,6 +133,7 @@ class MaliputRailcar final : public systems::LeafSystem<T> {
   void DoCalcNextUpdateTime(const systems::Context<T>& context,
                             systems::CompositeEventCollection<T>*,
                             T* time) const override;
+  bool DoIsNextUpdateTimePeriodic() const override { return false; }
   void DoCalcUnrestrictedUpdate(
       const systems::Context<T>& context,
       const std::vector<const systems::UnrestrictedUpdateEvent<T>*>&,
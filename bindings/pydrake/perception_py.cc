@@ -123,11 +123,11 @@ void init_perception(py::module m) {
     py::class_<Class, LeafSystem<double>>(
         m, "DepthImageToPointCloud", cls_doc.doc)
         .def(py::init<const CameraInfo&, PixelType, float,
-                 pc_flags::BaseFieldT>(),
+                 pc_flags::BaseFieldT, int>(),
             py::arg("camera_info"),
             py::arg("pixel_type") = PixelType::kDepth32F,
             py::arg("scale") = 1.0, py::arg("fields") = pc_flags::kXYZs,
-            cls_doc.ctor.doc)
+            py::arg("num_threads") = 1, cls_doc.ctor.doc)
         .def("depth_image_input_port", &Class::depth_image_input_port,
             py_reference_internal, cls_doc.depth_image_input_port.doc)
         .def("color_image_input_port", &Class::color_image_input_port,
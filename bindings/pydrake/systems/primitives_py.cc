@@ -173,8 +173,9 @@ PYBIND11_MODULE(primitives, m) {
 
     DefineTemplateClassWithDefault<SignalLogger<T>, LeafSystem<T>>(
         m, "SignalLogger", GetPyParam<T>(), doc.SignalLogger.doc)
-        .def(py::init<int, int>(), py::arg("input_size"),
-            py::arg("batch_allocation_size") = 1000, doc.SignalLogger.ctor.doc)
+        .def(py::init<int, int, optional<int>>(), py::arg("input_size"),
+            py::arg("batch_allocation_size") = 1000,
+            py::arg("max_num_samples") = nullopt, doc.SignalLogger.ctor.doc)
         .def("set_publish_period", &SignalLogger<T>::set_publish_period,
             py::arg("period"), doc.SignalLogger.set_publish_period.doc)
         .def("set_forced_publish_only",
@@ -183,6 +184,8 @@ PYBIND11_MODULE(primitives, m) {
         .def("sample_times", &SignalLogger<T>::sample_times,
             doc.SignalLogger.sample_times.doc)
         .def("data", &SignalLogger<T>::data, doc.SignalLogger.data.doc)
+        .def("max_num_samples", &SignalLogger<T>::max_num_samples,
+            doc.SignalLogger.max_num_samples.doc)
         .def("reset", &SignalLogger<T>::reset, doc.SignalLogger.reset.doc);
 
     DefineTemplateClassWithDefault<WrapToSystem<T>, LeafSystem<T>>(
@@ -89,8 +89,10 @@ PYBIND11_MODULE(trajectories, m) {
           py::arg("breaks"), py::arg("knots"), py::arg("periodic_end"),
           doc.PiecewisePolynomial.Cubic
               .doc_3args_breaks_knots_periodic_end_condition)
-      .def("value", &PiecewisePolynomial<T>::value,
-          doc.PiecewisePolynomial.value.doc)
+      .def("value",
+          py::overload_cast<double>(
+              &PiecewisePolynomial<T>::value, py::const_),
+          doc.PiecewisePolynomial.value.doc_1args_t)
       .def("derivative", &PiecewisePolynomial<T>::derivative,
           doc.PiecewisePolynomial.derivative.doc)
       .def("rows", &PiecewisePolynomial<T>::rows,
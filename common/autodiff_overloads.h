@@ -149,6 +149,21 @@ pow(const Eigen::AutoDiffScalar<DerTypeA>& base,
       x_to_the_y * log(x) * ygrad);
 }
 
+/// Overloads atan2 for fixed-size AutoDiffScalars, for which Eigen's
+/// implementation would return (and allocate) dynamic-size derivatives.
+template <int num_vars>
+AutoDiffScalar<Matrix<double, num_vars, 1>> atan2(
+    const AutoDiffScalar<Matrix<double, num_vars, 1>>& a,
+    const AutoDiffScalar<Matrix<double, num_vars, 1>>& b) {
+  using std::atan2;
+  const double squared_hypot = a.value() * a.value() + b.value() * b.value();
+  // If squared_hypot is zero, the derivatives are undefined, and are NaN.
+  return AutoDiffScalar<Matrix<double, num_vars, 1>>(
+      atan2(a.value(), b.value()),
+      (a.derivatives() * b.value() - a.value() * b.derivatives()) /
+          squared_hypot);
+}
+
 }  // namespace Eigen
 
 namespace drake {
@@ -83,3 +83,40 @@ extern template SomeType<::drake::symbolic::Expression>;
       SomeType) \
 extern template SomeType<double>; \
 extern template SomeType<::drake::AutoDiffXd>;
+
+/// A macro that defines explicit class template instantiations for the
+/// fixed-size autodiff scalar types, which are an opt-in addition to the
+/// default scalars for code whose derivatives are few and known in advance
+/// (e.g., linearizing a small system), where drake::AutoDiffXd would
+/// heap-allocate the derivatives of every intermediate value.  This macro
+/// should only be used in .cc files, never in .h files.
+///
+/// Currently the supported types are:
+///
+/// - drake::AutoDiffd<4>
+/// - drake::AutoDiffd<8>
+/// - drake::AutoDiffd<16>
+///
+/// A problem with fewer derivatives than one of these sizes uses the next
+/// larger one, leaving the extra derivatives zero.  A System that uses this
+/// macro should also opt in to scalar conversion to these types; see
+/// systems::scalar_conversion::FixedSizeAutoDiffTraits.
+#define \
+  DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS( \
+      SomeType) \
+template SomeType<::drake::AutoDiffd<4>>; \
+template SomeType<::drake::AutoDiffd<8>>; \
+template SomeType<::drake::AutoDiffd<16>>;
+
+/// A macro that declares that an explicit class instantiation exists in the
+/// same library for the fixed-size autodiff scalar types (having been defined
+/// by
+/// DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS
+/// in a .cc file).  This macro should only be used in .h files, never in .cc
+/// files.
+#define \
+  DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS( \
+      SomeType) \
+extern template SomeType<::drake::AutoDiffd<4>>; \
+extern template SomeType<::drake::AutoDiffd<8>>; \
+extern template SomeType<::drake::AutoDiffd<16>>;
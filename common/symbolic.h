@@ -43,5 +43,7 @@
 #include "drake/common/symbolic_formula_visitor.h"
 #include "drake/common/symbolic_simplification.h"
 #include "drake/common/symbolic_codegen.h"
+#include "drake/common/symbolic_expression_tape.h"
+#include "drake/common/symbolic_expression_dag.h"
 // clang-format on
 #undef DRAKE_COMMON_SYMBOLIC_HEADER
@@ -0,0 +1,618 @@
+// NOLINTNEXTLINE(build/include): Its header file is included in symbolic.h.
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/hash.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::runtime_error;
+using NodeId = ExpressionDag::NodeId;
+
+ExpressionDag::ExpressionDag() : table_(64, -1) {}
+
+bool ExpressionDag::Equal(const Node& x, const Node& y) {
+  return x.op == y.op && x.a == y.a && x.b == y.b && x.c == y.c;
+}
+
+size_t ExpressionDag::Hash(const Node& node) {
+  DefaultHasher hasher;
+  using drake::hash_append;
+  hash_append(hasher, node.op);
+  hash_append(hasher, node.a);
+  hash_append(hasher, node.b);
+  hash_append(hasher, node.c);
+  return static_cast<size_t>(hasher);
+}
+
+NodeId ExpressionDag::Intern(const Node& node) {
+  const size_t mask = table_.size() - 1;
+  size_t i = Hash(node) & mask;
+  while (table_[i] >= 0) {
+    if (Equal(nodes_[table_[i]], node)) {
+      return table_[i];
+    }
+    i = (i + 1) & mask;
+  }
+  const NodeId id = num_nodes();
+  nodes_.push_back(node);
+  table_[i] = id;
+  // Keep the table at most half full, so that probe sequences stay short.
+  if (2 * nodes_.size() > table_.size()) {
+    GrowTable();
+  }
+  return id;
+}
+
+void ExpressionDag::GrowTable() {
+  table_.assign(2 * table_.size(), -1);
+  const size_t mask = table_.size() - 1;
+  for (NodeId id = 0; id < num_nodes(); ++id) {
+    size_t i = Hash(nodes_[id]) & mask;
+    while (table_[i] >= 0) {
+      i = (i + 1) & mask;
+    }
+    table_[i] = id;
+  }
+}
+
+NodeId ExpressionDag::Constant(double value) {
+  if (std::isnan(value)) {
+    throw runtime_error("ExpressionDag: NaN is detected in a constant.");
+  }
+  Node node;
+  node.op = Op::kConstant;
+  // Don't tell -0.0 from 0.0.
+  node.c = (value == 0.0) ? 0.0 : value;
+  return Intern(node);
+}
+
+NodeId ExpressionDag::Var(const Variable& var) {
+  const auto inserted = variable_indices_.emplace(
+      var.get_id(), static_cast<int>(variables_.size()));
+  if (inserted.second) {
+    variables_.push_back(var);
+  }
+  Node node;
+  node.op = Op::kVariable;
+  node.a = inserted.first->second;
+  return Intern(node);
+}
+
+NodeId ExpressionDag::Build(Op op, NodeId a, NodeId b, double c) {
+  DRAKE_DEMAND(a >= 0 && a < num_nodes());
+  DRAKE_DEMAND(b >= -1 && b < num_nodes());
+  if (IsConstant(a) && (b < 0 || IsConstant(b))) {
+    const double value = internal::EvaluateTapeInstruction(
+        Node{op, a, b, c}, nodes_[a].c, (b >= 0) ? nodes_[b].c : 0.0);
+    if (!std::isnan(value)) {
+      return Constant(value);
+    }
+  }
+  const bool commutative = op == Op::kMul || op == Op::kMin ||
+                           op == Op::kMax ||
+                           (op == Op::kAddScaled && c == 1.0);
+  if (commutative && b < a) {
+    std::swap(a, b);
+  }
+  return Intern(Node{op, a, b, c});
+}
+
+NodeId ExpressionDag::Scale(NodeId a, double c) {
+  if (c == 1.0) return a;
+  if (c == 0.0) return Constant(0.0);
+  return Build(Op::kScale, a, -1, c);
+}
+
+NodeId ExpressionDag::AddScaled(NodeId a, NodeId b, double c) {
+  if (c == 0.0 || IsConstant(b, 0.0)) return a;
+  if (IsConstant(a, 0.0)) return Scale(b, c);
+  // Fold a scaling of b into this addition.
+  if (nodes_[b].op == Op::kScale) {
+    return Build(Op::kAddScaled, a, nodes_[b].a, c * nodes_[b].c);
+  }
+  // For a sum, fold a scaling of a instead.
+  if (c == 1.0 && nodes_[a].op == Op::kScale) {
+    return Build(Op::kAddScaled, b, nodes_[a].a, nodes_[a].c);
+  }
+  return Build(Op::kAddScaled, a, b, c);
+}
+
+NodeId ExpressionDag::PowConst(NodeId a, double c) {
+  if (c == 1.0) return a;
+  if (c == 0.0) return Constant(1.0);
+  return Build(Op::kPowConst, a, -1, c);
+}
+
+NodeId ExpressionDag::Add(NodeId a, NodeId b) { return AddScaled(a, b, 1.0); }
+
+NodeId ExpressionDag::Sub(NodeId a, NodeId b) {
+  return AddScaled(a, b, -1.0);
+}
+
+NodeId ExpressionDag::Mul(NodeId a, NodeId b) {
+  if (IsConstant(a)) return Scale(b, nodes_[a].c);
+  if (IsConstant(b)) return Scale(a, nodes_[b].c);
+  return Build(Op::kMul, a, b);
+}
+
+NodeId ExpressionDag::Div(NodeId a, NodeId b) {
+  if (IsConstant(b, 1.0)) return a;
+  return Build(Op::kDiv, a, b);
+}
+
+NodeId ExpressionDag::Neg(NodeId a) { return Scale(a, -1.0); }
+
+NodeId ExpressionDag::Pow(NodeId a, NodeId b) {
+  if (IsConstant(b)) return PowConst(a, nodes_[b].c);
+  return Build(Op::kPow, a, b);
+}
+
+NodeId ExpressionDag::Abs(NodeId a) { return Build(Op::kAbs, a); }
+
+NodeId ExpressionDag::Log(NodeId a) { return Build(Op::kLog, a); }
+
+NodeId ExpressionDag::Exp(NodeId a) { return Build(Op::kExp, a); }
+
+NodeId ExpressionDag::Sqrt(NodeId a) { return Build(Op::kSqrt, a); }
+
+NodeId ExpressionDag::Sin(NodeId a) { return Build(Op::kSin, a); }
+
+NodeId ExpressionDag::Cos(NodeId a) { return Build(Op::kCos, a); }
+
+NodeId ExpressionDag::Tan(NodeId a) { return Build(Op::kTan, a); }
+
+NodeId ExpressionDag::Asin(NodeId a) { return Build(Op::kAsin, a); }
+
+NodeId ExpressionDag::Acos(NodeId a) { return Build(Op::kAcos, a); }
+
+NodeId ExpressionDag::Atan(NodeId a) { return Build(Op::kAtan, a); }
+
+NodeId ExpressionDag::Atan2(NodeId a, NodeId b) {
+  return Build(Op::kAtan2, a, b);
+}
+
+NodeId ExpressionDag::Sinh(NodeId a) { return Build(Op::kSinh, a); }
+
+NodeId ExpressionDag::Cosh(NodeId a) { return Build(Op::kCosh, a); }
+
+NodeId ExpressionDag::Tanh(NodeId a) { return Build(Op::kTanh, a); }
+
+NodeId ExpressionDag::Min(NodeId a, NodeId b) {
+  return Build(Op::kMin, a, b);
+}
+
+NodeId ExpressionDag::Max(NodeId a, NodeId b) {
+  return Build(Op::kMax, a, b);
+}
+
+NodeId ExpressionDag::Ceil(NodeId a) { return Build(Op::kCeil, a); }
+
+NodeId ExpressionDag::Floor(NodeId a) { return Build(Op::kFloor, a); }
+
+NodeId ExpressionDag::Rebuild(const Node& node, NodeId a, NodeId b) {
+  switch (node.op) {
+    case Op::kScale: return Scale(a, node.c);
+    case Op::kAddScaled: return AddScaled(a, b, node.c);
+    case Op::kMul: return Mul(a, b);
+    case Op::kDiv: return Div(a, b);
+    case Op::kPowConst: return PowConst(a, node.c);
+    case Op::kPow: return Pow(a, b);
+    case Op::kConstant:
+    case Op::kVariable:
+      DRAKE_UNREACHABLE();
+    default:
+      return Build(node.op, a, b, node.c);
+  }
+}
+
+NodeId ExpressionDag::Insert(const Expression& e) {
+  std::unordered_map<Expression, NodeId> memo;
+  return Insert(e, &memo);
+}
+
+NodeId ExpressionDag::Insert(const Expression& e,
+                             std::unordered_map<Expression, NodeId>* memo) {
+  const auto it = memo->find(e);
+  if (it != memo->end()) {
+    return it->second;
+  }
+
+  auto argument = [this, &e, memo]() { return Insert(get_argument(e), memo); };
+  auto first = [this, &e, memo]() {
+    return Insert(get_first_argument(e), memo);
+  };
+  auto second = [this, &e, memo]() {
+    return Insert(get_second_argument(e), memo);
+  };
+
+  NodeId node{-1};
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+      node = Constant(get_constant_value(e));
+      break;
+    case ExpressionKind::Var:
+      node = Var(get_variable(e));
+      break;
+    case ExpressionKind::Add:
+      // c₀ + ∑ cᵢ eᵢ, as a chain of scaled additions.
+      node = Constant(get_constant_in_addition(e));
+      for (const auto& item : get_expr_to_coeff_map_in_addition(e)) {
+        node = AddScaled(node, Insert(item.first, memo), item.second);
+      }
+      break;
+    case ExpressionKind::Mul:
+      // c ∏ bᵢ^eᵢ, as a scaled chain of multiplications.
+      for (const auto& item : get_base_to_exponent_map_in_multiplication(e)) {
+        const NodeId base = Insert(item.first, memo);
+        const NodeId factor = Pow(base, Insert(item.second, memo));
+        node = (node >= 0) ? Mul(node, factor) : factor;
+      }
+      DRAKE_DEMAND(node >= 0);
+      node = Scale(node, get_constant_in_multiplication(e));
+      break;
+    case ExpressionKind::Div: {
+      const NodeId a = first();
+      node = Div(a, second());
+      break;
+    }
+    case ExpressionKind::Pow: {
+      const NodeId a = first();
+      node = Pow(a, second());
+      break;
+    }
+    case ExpressionKind::Atan2: {
+      const NodeId a = first();
+      node = Atan2(a, second());
+      break;
+    }
+    case ExpressionKind::Min: {
+      const NodeId a = first();
+      node = Min(a, second());
+      break;
+    }
+    case ExpressionKind::Max: {
+      const NodeId a = first();
+      node = Max(a, second());
+      break;
+    }
+    case ExpressionKind::Log: node = Log(argument()); break;
+    case ExpressionKind::Abs: node = Abs(argument()); break;
+    case ExpressionKind::Exp: node = Exp(argument()); break;
+    case ExpressionKind::Sqrt: node = Sqrt(argument()); break;
+    case ExpressionKind::Sin: node = Sin(argument()); break;
+    case ExpressionKind::Cos: node = Cos(argument()); break;
+    case ExpressionKind::Tan: node = Tan(argument()); break;
+    case ExpressionKind::Asin: node = Asin(argument()); break;
+    case ExpressionKind::Acos: node = Acos(argument()); break;
+    case ExpressionKind::Atan: node = Atan(argument()); break;
+    case ExpressionKind::Sinh: node = Sinh(argument()); break;
+    case ExpressionKind::Cosh: node = Cosh(argument()); break;
+    case ExpressionKind::Tanh: node = Tanh(argument()); break;
+    case ExpressionKind::Ceil: node = Ceil(argument()); break;
+    case ExpressionKind::Floor: node = Floor(argument()); break;
+    case ExpressionKind::NaN:
+      throw runtime_error("ExpressionDag: NaN is detected in an expression.");
+    case ExpressionKind::IfThenElse:
+      throw runtime_error(
+          "ExpressionDag does not support if-then-else expressions.");
+    case ExpressionKind::UninterpretedFunction:
+      throw runtime_error(
+          "ExpressionDag does not support uninterpreted functions.");
+  }
+  DRAKE_DEMAND(node >= 0);
+  memo->emplace(e, node);
+  return node;
+}
+
+Expression ExpressionDag::ToExpression(NodeId node) const {
+  const std::vector<NodeId> order = Reachable({node});
+  // The expression of node `id` is expressions[position[id]].
+  std::vector<int> position(node + 1, -1);
+  std::vector<Expression> expressions;
+  expressions.reserve(order.size());
+  for (const NodeId id : order) {
+    const Node& n = nodes_[id];
+    auto a = [&]() -> const Expression& { return expressions[position[n.a]]; };
+    auto b = [&]() -> const Expression& { return expressions[position[n.b]]; };
+    position[id] = static_cast<int>(expressions.size());
+    switch (n.op) {
+      case Op::kConstant: expressions.emplace_back(n.c); break;
+      case Op::kVariable: expressions.emplace_back(variables_[n.a]); break;
+      case Op::kScale: expressions.push_back(n.c * a()); break;
+      case Op::kAddScaled: expressions.push_back(a() + n.c * b()); break;
+      case Op::kMul: expressions.push_back(a() * b()); break;
+      case Op::kDiv: expressions.push_back(a() / b()); break;
+      case Op::kPowConst: expressions.push_back(pow(a(), n.c)); break;
+      case Op::kPow: expressions.push_back(pow(a(), b())); break;
+      case Op::kAbs: expressions.push_back(abs(a())); break;
+      case Op::kLog: expressions.push_back(log(a())); break;
+      case Op::kExp: expressions.push_back(exp(a())); break;
+      case Op::kSqrt: expressions.push_back(sqrt(a())); break;
+      case Op::kSin: expressions.push_back(sin(a())); break;
+      case Op::kCos: expressions.push_back(cos(a())); break;
+      case Op::kTan: expressions.push_back(tan(a())); break;
+      case Op::kAsin: expressions.push_back(asin(a())); break;
+      case Op::kAcos: expressions.push_back(acos(a())); break;
+      case Op::kAtan: expressions.push_back(atan(a())); break;
+      case Op::kAtan2: expressions.push_back(atan2(a(), b())); break;
+      case Op::kSinh: expressions.push_back(sinh(a())); break;
+      case Op::kCosh: expressions.push_back(cosh(a())); break;
+      case Op::kTanh: expressions.push_back(tanh(a())); break;
+      case Op::kMin: expressions.push_back(min(a(), b())); break;
+      case Op::kMax: expressions.push_back(max(a(), b())); break;
+      case Op::kCeil: expressions.push_back(ceil(a())); break;
+      case Op::kFloor: expressions.push_back(floor(a())); break;
+    }
+  }
+  return expressions.back();
+}
+
+std::vector<NodeId> ExpressionDag::Reachable(
+    const std::vector<NodeId>& roots) const {
+  std::vector<bool> visited(nodes_.size(), false);
+  std::vector<NodeId> result;
+  auto visit = [&visited, &result](NodeId id) {
+    if (!visited[id]) {
+      visited[id] = true;
+      result.push_back(id);
+    }
+  };
+  for (const NodeId root : roots) {
+    DRAKE_DEMAND(root >= 0 && root < num_nodes());
+    visit(root);
+  }
+  // N.B. `result` doubles as the work list: the operands of the nodes from
+  // `next` on are yet to be visited.
+  for (size_t next = 0; next < result.size(); ++next) {
+    const Node& node = nodes_[result[next]];
+    if (node.op == Op::kVariable) continue;
+    if (node.a >= 0) visit(node.a);
+    if (node.b >= 0) visit(node.b);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+double ExpressionDag::EvaluateNode(const Node& node,
+                                  const std::vector<double>& values,
+                                  const Environment& env) const {
+  switch (node.op) {
+    case Op::kConstant:
+      return node.c;
+    case Op::kVariable: {
+      const Variable& var = variables_[node.a];
+      const Environment::const_iterator it = env.find(var);
+      if (it == env.cend()) {
+        std::ostringstream oss;
+        oss << "The following environment does not have an entry for the "
+               "variable "
+            << var << std::endl;
+        oss << env << std::endl;
+        throw runtime_error(oss.str());
+      }
+      return it->second;
+    }
+    default:
+      return internal::EvaluateTapeInstruction(
+          node, values[node.a], (node.b >= 0) ? values[node.b] : 0.0);
+  }
+}
+
+double ExpressionDag::Evaluate(NodeId node, const Environment& env) const {
+  return Evaluate(std::vector<NodeId>{node}, env)[0];
+}
+
+Eigen::VectorXd ExpressionDag::Evaluate(const std::vector<NodeId>& nodes,
+                                        const Environment& env) const {
+  const std::vector<NodeId> order = Reachable(nodes);
+  std::vector<double> values(order.empty() ? 0 : order.back() + 1);
+  for (const NodeId id : order) {
+    values[id] = EvaluateNode(nodes_[id], values, env);
+  }
+  Eigen::VectorXd result(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    result[i] = values[nodes[i]];
+  }
+  return result;
+}
+
+ExpressionTape ExpressionDag::ToTape(
+    const std::vector<NodeId>& nodes,
+    const Eigen::Ref<const VectorX<Variable>>& variables) const {
+  // The input slot of each variable, by its index in variables_.
+  std::vector<int> inputs(variables_.size(), -1);
+  for (int i = 0; i < variables.size(); ++i) {
+    const auto it = variable_indices_.find(variables(i).get_id());
+    if (it == variable_indices_.end()) continue;
+    if (inputs[it->second] >= 0) {
+      throw runtime_error("ExpressionDag: the variable " +
+                          variables(i).get_name() + " is repeated.");
+    }
+    inputs[it->second] = i;
+  }
+
+  // The slot of each node in `order`. The operands of the nodes are remapped
+  // to slots, so that each node becomes an instruction of the tape.
+  const int num_variables = variables.size();
+  const std::vector<NodeId> order = Reachable(nodes);
+  std::vector<int> slots(order.empty() ? 0 : order.back() + 1, -1);
+  std::vector<internal::TapeInstruction> tape;
+  for (const NodeId id : order) {
+    Node instruction = nodes_[id];
+    if (instruction.op == Op::kVariable) {
+      slots[id] = inputs[instruction.a];
+      if (slots[id] < 0) {
+        throw runtime_error("ExpressionDag: the variable " +
+                            variables_[instruction.a].get_name() +
+                            " is not one of the tape's variables.");
+      }
+      continue;
+    }
+    if (instruction.a >= 0) instruction.a = slots[instruction.a];
+    if (instruction.b >= 0) instruction.b = slots[instruction.b];
+    slots[id] = num_variables + static_cast<int>(tape.size());
+    tape.push_back(instruction);
+  }
+  std::vector<int> outputs(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    outputs[i] = slots[nodes[i]];
+  }
+  return ExpressionTape(num_variables, std::move(tape), std::move(outputs));
+}
+
+NodeId ExpressionDag::DifferentiateNode(
+    NodeId id, const std::vector<NodeId>& derivatives, const Variable& x) {
+  // N.B. Building nodes may reallocate nodes_, so copy this one.
+  const Node node = nodes_[id];
+  const NodeId zero = Constant(0.0);
+  switch (node.op) {
+    case Op::kConstant:
+      return zero;
+    case Op::kVariable:
+      return variables_[node.a].equal_to(x) ? Constant(1.0) : zero;
+    default:
+      break;
+  }
+  const NodeId a = node.a;
+  const NodeId b = node.b;
+  const double c = node.c;
+  const NodeId da = derivatives[a];
+  const NodeId db = (b >= 0) ? derivatives[b] : zero;
+  if (da == zero && db == zero) {
+    return zero;
+  }
+  const NodeId one = Constant(1.0);
+  switch (node.op) {
+    case Op::kScale:
+      return Scale(da, c);
+    case Op::kAddScaled:
+      return AddScaled(da, db, c);
+    case Op::kMul:
+      return Add(Mul(da, b), Mul(a, db));
+    case Op::kDiv:
+      // ∂(a / b) = (∂a - (a / b) ∂b) / b.
+      return Div(Sub(da, Mul(id, db)), b);
+    case Op::kPowConst:
+      return Mul(Scale(PowConst(a, c - 1), c), da);
+    case Op::kPow: {
+      // ∂(aᵇ) = b aᵇ⁻¹ ∂a + aᵇ log(a) ∂b.
+      const NodeId result = Mul(Mul(b, Pow(a, Sub(b, one))), da);
+      return (db == zero) ? result : Add(result, Mul(Mul(id, Log(a)), db));
+    }
+    case Op::kLog:
+      return Div(da, a);
+    case Op::kExp:
+      return Mul(id, da);
+    case Op::kSqrt:
+      return Div(da, Scale(id, 2.0));
+    case Op::kSin:
+      return Mul(Cos(a), da);
+    case Op::kCos:
+      return Neg(Mul(Sin(a), da));
+    case Op::kTan:
+      return Div(da, PowConst(Cos(a), 2.0));
+    case Op::kAsin:
+      return Div(da, Sqrt(Sub(one, PowConst(a, 2.0))));
+    case Op::kAcos:
+      return Neg(Div(da, Sqrt(Sub(one, PowConst(a, 2.0)))));
+    case Op::kAtan:
+      return Div(da, Add(one, PowConst(a, 2.0)));
+    case Op::kAtan2:
+      // ∂atan2(a, b) = (b ∂a - a ∂b) / (a² + b²).
+      return Div(Sub(Mul(b, da), Mul(a, db)),
+                 Add(PowConst(a, 2.0), PowConst(b, 2.0)));
+    case Op::kSinh:
+      return Mul(Cosh(a), da);
+    case Op::kCosh:
+      return Mul(Sinh(a), da);
+    case Op::kTanh:
+      return Div(da, PowConst(Cosh(a), 2.0));
+    case Op::kAbs:
+    case Op::kMin:
+    case Op::kMax:
+    case Op::kCeil:
+    case Op::kFloor: {
+      std::ostringstream oss;
+      oss << ToExpression(id) << " is not differentiable with respect to "
+          << x << ".";
+      throw runtime_error(oss.str());
+    }
+    case Op::kConstant:
+    case Op::kVariable:
+      break;
+  }
+  DRAKE_UNREACHABLE();
+}
+
+NodeId ExpressionDag::Differentiate(NodeId node, const Variable& x) {
+  return Jacobian({node}, {x})(0, 0);
+}
+
+Eigen::Matrix<NodeId, Eigen::Dynamic, Eigen::Dynamic> ExpressionDag::Jacobian(
+    const std::vector<NodeId>& nodes, const std::vector<Variable>& vars) {
+  const std::vector<NodeId> order = Reachable(nodes);
+  // The derivative of each node in `order`, with respect to the current
+  // variable. (The nodes built along the way aren't in `order`.)
+  std::vector<NodeId> derivatives(order.empty() ? 0 : order.back() + 1, -1);
+  Eigen::Matrix<NodeId, Eigen::Dynamic, Eigen::Dynamic> result(nodes.size(),
+                                                               vars.size());
+  for (size_t j = 0; j < vars.size(); ++j) {
+    for (const NodeId id : order) {
+      derivatives[id] = DifferentiateNode(id, derivatives, vars[j]);
+    }
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      result(i, j) = derivatives[nodes[i]];
+    }
+  }
+  return result;
+}
+
+NodeId ExpressionDag::Substitute(
+    NodeId node, const std::unordered_map<Variable, NodeId>& substitution) {
+  return Substitute(std::vector<NodeId>{node}, substitution)[0];
+}
+
+std::vector<NodeId> ExpressionDag::Substitute(
+    const std::vector<NodeId>& nodes,
+    const std::unordered_map<Variable, NodeId>& substitution) {
+  for (const auto& item : substitution) {
+    DRAKE_DEMAND(item.second >= 0 && item.second < num_nodes());
+  }
+  const std::vector<NodeId> order = Reachable(nodes);
+  std::vector<NodeId> substituted(order.empty() ? 0 : order.back() + 1, -1);
+  for (const NodeId id : order) {
+    // N.B. Building nodes may reallocate nodes_, so copy this one.
+    const Node node = nodes_[id];
+    switch (node.op) {
+      case Op::kConstant:
+        substituted[id] = id;
+        break;
+      case Op::kVariable: {
+        const auto it = substitution.find(variables_[node.a]);
+        substituted[id] = (it != substitution.end()) ? it->second : id;
+        break;
+      }
+      default: {
+        const NodeId a = substituted[node.a];
+        const NodeId b = (node.b >= 0) ? substituted[node.b] : -1;
+        substituted[id] =
+            (a == node.a && b == node.b) ? id : Rebuild(node, a, b);
+      }
+    }
+  }
+  std::vector<NodeId> result(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    result[i] = substituted[nodes[i]];
+  }
+  return result;
+}
+
+}  // namespace symbolic
+}  // namespace drake
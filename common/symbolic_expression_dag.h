@@ -0,0 +1,213 @@
+#pragma once
+
+#ifndef DRAKE_COMMON_SYMBOLIC_HEADER
+#warning Do not directly include this file. Include "drake/common/symbolic.h".
+#endif
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/// A builder and store of symbolic expressions as a hash-consed directed
+/// acyclic graph (DAG), for workloads that build large expressions with much
+/// shared structure, e.g., the dynamics of a multibody system.
+///
+/// Unlike an Expression, whose every operation allocates a reference-counted
+/// cell on the heap, a node of the DAG is a small value in a contiguous arena
+/// that is owned by the ExpressionDag, and is referred to by its NodeId. Nodes
+/// are hash-consed: building a node that is structurally equal to an existing
+/// one (the same operation on the same operands) returns the existing node, so
+/// every distinct subexpression is stored, evaluated, differentiated and
+/// substituted into only once.
+///
+/// The nodes are the instructions of an ExpressionTape, whose operands are
+/// other nodes: e.g., a product with a constant is a scaling, a sum with a
+/// scaled node is a scaled addition, and a power with a constant exponent has
+/// its own operation. The nodes are therefore evaluated exactly like a tape,
+/// and ToTape() compiles them into one without going through an Expression.
+///
+/// Nodes are added but never removed, and an operand always has a smaller
+/// NodeId than the nodes that use it. The builder performs only local
+/// simplifications: constant folding, `x + 0 = x`, `x * 1 = x`, `x * 0 = 0`,
+/// `x / 1 = x`, `x ^ 1 = x` and `x ^ 0 = 1`; addition, multiplication, min and
+/// max are treated as commutative, but not as associative.
+///
+/// Expressions are converted to and from the DAG with Insert() and
+/// ToExpression(). Evaluation follows IEEE 754 semantics, as in
+/// ExpressionTape, rather than throwing on a domain error like
+/// Expression::Evaluate() does.
+///
+/// If-then-else expressions and uninterpreted functions are not supported.
+class ExpressionDag {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ExpressionDag)
+
+  /// Identifies a node of the DAG; the nodes of a DAG are numbered
+  /// consecutively from 0.
+  using NodeId = int;
+
+  ExpressionDag();
+
+  /// Returns the number of (distinct) nodes in the DAG.
+  int num_nodes() const { return static_cast<int>(nodes_.size()); }
+
+  /// @name Building nodes
+  /// Each of these returns the node computing the named function of the given
+  /// node(s), creating it if it doesn't already exist.
+  //@{
+
+  /// @throws std::runtime_error if @p value is NaN.
+  NodeId Constant(double value);
+  NodeId Var(const Variable& var);
+  NodeId Add(NodeId a, NodeId b);
+  NodeId Sub(NodeId a, NodeId b);
+  NodeId Mul(NodeId a, NodeId b);
+  NodeId Div(NodeId a, NodeId b);
+  NodeId Neg(NodeId a);
+  NodeId Pow(NodeId a, NodeId b);
+  NodeId Abs(NodeId a);
+  NodeId Log(NodeId a);
+  NodeId Exp(NodeId a);
+  NodeId Sqrt(NodeId a);
+  NodeId Sin(NodeId a);
+  NodeId Cos(NodeId a);
+  NodeId Tan(NodeId a);
+  NodeId Asin(NodeId a);
+  NodeId Acos(NodeId a);
+  NodeId Atan(NodeId a);
+  NodeId Atan2(NodeId a, NodeId b);
+  NodeId Sinh(NodeId a);
+  NodeId Cosh(NodeId a);
+  NodeId Tanh(NodeId a);
+  NodeId Min(NodeId a, NodeId b);
+  NodeId Max(NodeId a, NodeId b);
+  NodeId Ceil(NodeId a);
+  NodeId Floor(NodeId a);
+  //@}
+
+  /// Adds the expression @p e to the DAG, and returns its root node.
+  /// @throws std::runtime_error if @p e includes NaN, an if-then-else
+  /// expression, or an uninterpreted function.
+  NodeId Insert(const Expression& e);
+
+  /// Returns the expression computed by node @p node. The returned expression
+  /// shares the cells of its common subexpressions.
+  Expression ToExpression(NodeId node) const;
+
+  /// Evaluates node @p node, using the values of the variables in @p env.
+  /// @throws std::runtime_error if a variable is not in @p env.
+  double Evaluate(NodeId node, const Environment& env) const;
+
+  /// Evaluates the nodes @p nodes, using the values of the variables in
+  /// @p env. Each node that they share is evaluated once.
+  /// @throws std::runtime_error if a variable is not in @p env.
+  Eigen::VectorXd Evaluate(const std::vector<NodeId>& nodes,
+                           const Environment& env) const;
+
+  /// Returns an ExpressionTape that evaluates the nodes @p nodes, where the
+  /// i-th input of the tape is @p variables(i). Each node that they share is
+  /// evaluated once.
+  /// @throws std::runtime_error if a variable of the nodes is not in
+  /// @p variables, or if @p variables has repeated entries.
+  ExpressionTape ToTape(
+      const std::vector<NodeId>& nodes,
+      const Eigen::Ref<const VectorX<Variable>>& variables) const;
+
+  /// Returns the node computing the derivative of node @p node with respect
+  /// to @p x.
+  /// @throws std::runtime_error if @p node applies abs, min, max, ceil, or
+  /// floor to a subexpression that depends on @p x, which (as in
+  /// Expression::Differentiate()) are deemed not differentiable.
+  NodeId Differentiate(NodeId node, const Variable& x);
+
+  /// Returns the Jacobian matrix of the nodes @p nodes with respect to the
+  /// variables @p vars, i.e., the node computing ∂nodes[i]/∂vars[j] in row i
+  /// and column j.
+  /// @throws std::runtime_error under the same conditions as Differentiate().
+  Eigen::Matrix<NodeId, Eigen::Dynamic, Eigen::Dynamic> Jacobian(
+      const std::vector<NodeId>& nodes, const std::vector<Variable>& vars);
+
+  /// Returns the node computing node @p node, with each variable in
+  /// @p substitution replaced by the corresponding node.
+  NodeId Substitute(NodeId node,
+                    const std::unordered_map<Variable, NodeId>& substitution);
+
+  /// Returns the nodes computing the nodes @p nodes, with each variable in
+  /// @p substitution replaced by the corresponding node. Each node that they
+  /// share is substituted into once.
+  std::vector<NodeId> Substitute(
+      const std::vector<NodeId>& nodes,
+      const std::unordered_map<Variable, NodeId>& substitution);
+
+ private:
+  using Op = internal::TapeOp;
+  // A node of the DAG. Operands `a` and `b` are node ids, or -1 when unused,
+  // except for a variable node (Op::kVariable), whose `a` is its index in
+  // variables_.
+  using Node = internal::TapeInstruction;
+
+  static bool Equal(const Node& x, const Node& y);
+  static std::size_t Hash(const Node& node);
+
+  // Returns the node equal to `node`, after adding it if there's none.
+  NodeId Intern(const Node& node);
+  // Doubles the capacity of table_ and reinserts all of the nodes.
+  void GrowTable();
+
+  // Returns the node computing `op` on the given operands, after folding it
+  // to a constant if they are all constant, and ordering the operands of a
+  // commutative operation.
+  NodeId Build(Op op, NodeId a, NodeId b = -1, double c = 0.0);
+  // Return the nodes computing c * a, a + c * b and a ^ c.
+  NodeId Scale(NodeId a, double c);
+  NodeId AddScaled(NodeId a, NodeId b, double c);
+  NodeId PowConst(NodeId a, double c);
+  // Returns the node computing the operation of `node` on the operands `a`
+  // and `b`, with the simplifications of the builder.
+  NodeId Rebuild(const Node& node, NodeId a, NodeId b);
+
+  // Implements Insert(); the memo maps the subexpressions of `e` that were
+  // already inserted to their nodes.
+  NodeId Insert(const Expression& e,
+                std::unordered_map<Expression, NodeId>* memo);
+
+  bool IsConstant(NodeId node) const {
+    return nodes_[node].op == Op::kConstant;
+  }
+  bool IsConstant(NodeId node, double value) const {
+    return IsConstant(node) && nodes_[node].c == value;
+  }
+
+  // Returns, in increasing order, the nodes that `roots` depend on
+  // (including themselves); operands come before the nodes that use them.
+  std::vector<NodeId> Reachable(const std::vector<NodeId>& roots) const;
+
+  // Returns the value of `node`, given the values of its operands.
+  double EvaluateNode(const Node& node, const std::vector<double>& values,
+                      const Environment& env) const;
+
+  // Returns the node computing the derivative of `node`, given the nodes
+  // computing the derivatives of its operands.
+  NodeId DifferentiateNode(NodeId node, const std::vector<NodeId>& derivatives,
+                           const Variable& x);
+
+  // The arena of nodes, in order of creation.
+  std::vector<Node> nodes_;
+  // The variables of the variable nodes, and their indices in variables_.
+  std::vector<Variable> variables_;
+  std::unordered_map<Variable::Id, int> variable_indices_;
+  // An open-addressing hash table of node ids (or -1 for an empty entry),
+  // whose size is a power of two.
+  std::vector<NodeId> table_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
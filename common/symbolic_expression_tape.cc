@@ -0,0 +1,476 @@
+// NOLINTNEXTLINE(build/include): Its header file is included in symbolic.h.
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::runtime_error;
+
+namespace internal {
+
+double EvaluateTapeInstruction(const TapeInstruction& instruction, double a,
+                               double b) {
+  const double c = instruction.c;
+  switch (instruction.op) {
+    case TapeOp::kConstant: return c;
+    case TapeOp::kVariable: break;
+    case TapeOp::kScale: return c * a;
+    case TapeOp::kAddScaled: return a + c * b;
+    case TapeOp::kMul: return a * b;
+    case TapeOp::kDiv: return a / b;
+    case TapeOp::kPowConst: return std::pow(a, c);
+    case TapeOp::kPow: return std::pow(a, b);
+    case TapeOp::kAbs: return std::abs(a);
+    case TapeOp::kLog: return std::log(a);
+    case TapeOp::kExp: return std::exp(a);
+    case TapeOp::kSqrt: return std::sqrt(a);
+    case TapeOp::kSin: return std::sin(a);
+    case TapeOp::kCos: return std::cos(a);
+    case TapeOp::kTan: return std::tan(a);
+    case TapeOp::kAsin: return std::asin(a);
+    case TapeOp::kAcos: return std::acos(a);
+    case TapeOp::kAtan: return std::atan(a);
+    case TapeOp::kAtan2: return std::atan2(a, b);
+    case TapeOp::kSinh: return std::sinh(a);
+    case TapeOp::kCosh: return std::cosh(a);
+    case TapeOp::kTanh: return std::tanh(a);
+    case TapeOp::kMin: return (a < b) ? a : b;
+    case TapeOp::kMax: return (a < b) ? b : a;
+    case TapeOp::kCeil: return std::ceil(a);
+    case TapeOp::kFloor: return std::floor(a);
+  }
+  DRAKE_UNREACHABLE();
+}
+
+}  // namespace internal
+
+ExpressionTape::ExpressionTape(int num_variables,
+                               std::vector<Instruction> tape,
+                               std::vector<int> outputs)
+    : num_variables_(num_variables),
+      tape_(std::move(tape)),
+      outputs_(std::move(outputs)) {}
+
+ExpressionTape::ExpressionTape(
+    const Eigen::Ref<const VectorX<Expression>>& expressions,
+    const Eigen::Ref<const VectorX<Variable>>& variables)
+    : num_variables_(variables.size()) {
+  Memo memo;
+  for (int i = 0; i < num_variables_; ++i) {
+    const bool inserted = memo.emplace(Expression{variables(i)}, i).second;
+    if (!inserted) {
+      throw runtime_error("ExpressionTape: the variable " +
+                          variables(i).get_name() + " is repeated.");
+    }
+  }
+  outputs_.reserve(expressions.size());
+  for (int i = 0; i < expressions.size(); ++i) {
+    outputs_.push_back(Compile(expressions(i), &memo));
+  }
+}
+
+bool ExpressionTape::IsSupported(
+    const Eigen::Ref<const VectorX<Expression>>& expressions,
+    const Eigen::Ref<const VectorX<Variable>>& variables) {
+  Variables distinct_variables;
+  for (int i = 0; i < variables.size(); ++i) {
+    if (distinct_variables.include(variables(i))) {
+      return false;
+    }
+    distinct_variables.insert(variables(i));
+  }
+  std::unordered_set<Expression> visited;
+  for (int i = 0; i < expressions.size(); ++i) {
+    if (!IsSupported(expressions(i), distinct_variables, &visited)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ExpressionTape::IsSupported(const Expression& e,
+                                 const Variables& variables,
+                                 std::unordered_set<Expression>* visited) {
+  if (visited->count(e) > 0) {
+    return true;
+  }
+  bool supported{false};
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+      supported = true;
+      break;
+    case ExpressionKind::Var:
+      supported = variables.include(get_variable(e));
+      break;
+    case ExpressionKind::Add:
+      supported = true;
+      for (const auto& item : get_expr_to_coeff_map_in_addition(e)) {
+        supported = supported && IsSupported(item.first, variables, visited);
+      }
+      break;
+    case ExpressionKind::Mul:
+      supported = true;
+      for (const auto& item : get_base_to_exponent_map_in_multiplication(e)) {
+        supported = supported && IsSupported(item.first, variables, visited) &&
+                    IsSupported(item.second, variables, visited);
+      }
+      break;
+    case ExpressionKind::Log:
+    case ExpressionKind::Abs:
+    case ExpressionKind::Exp:
+    case ExpressionKind::Sqrt:
+    case ExpressionKind::Sin:
+    case ExpressionKind::Cos:
+    case ExpressionKind::Tan:
+    case ExpressionKind::Asin:
+    case ExpressionKind::Acos:
+    case ExpressionKind::Atan:
+    case ExpressionKind::Sinh:
+    case ExpressionKind::Cosh:
+    case ExpressionKind::Tanh:
+    case ExpressionKind::Ceil:
+    case ExpressionKind::Floor:
+      supported = IsSupported(get_argument(e), variables, visited);
+      break;
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max:
+      supported = IsSupported(get_first_argument(e), variables, visited) &&
+                  IsSupported(get_second_argument(e), variables, visited);
+      break;
+    case ExpressionKind::NaN:
+    case ExpressionKind::IfThenElse:
+    case ExpressionKind::UninterpretedFunction:
+      supported = false;
+      break;
+  }
+  if (supported) {
+    visited->insert(e);
+  }
+  return supported;
+}
+
+int ExpressionTape::Emit(Op op, int a, int b, double c) {
+  tape_.push_back(Instruction{op, a, b, c});
+  return num_variables_ + static_cast<int>(tape_.size()) - 1;
+}
+
+int ExpressionTape::Compile(const Expression& e, Memo* memo) {
+  const auto it = memo->find(e);
+  if (it != memo->end()) {
+    return it->second;
+  }
+
+  // Compiles the argument(s) of a unary (or binary) function `e` and emits
+  // the instruction computing `op` on them.
+  auto unary = [this, &e, memo](Op op) {
+    return Emit(op, Compile(get_argument(e), memo));
+  };
+  auto binary = [this, &e, memo](Op op) {
+    const int a = Compile(get_first_argument(e), memo);
+    const int b = Compile(get_second_argument(e), memo);
+    return Emit(op, a, b);
+  };
+
+  int slot{-1};
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+      slot = Emit(Op::kConstant, -1, -1, get_constant_value(e));
+      break;
+    case ExpressionKind::Var:
+      // All of the variables are in the memo.
+      throw runtime_error("ExpressionTape: the variable " +
+                          get_variable(e).get_name() +
+                          " is not one of the tape's variables.");
+    case ExpressionKind::Add:
+      slot = CompileAddition(e, memo);
+      break;
+    case ExpressionKind::Mul:
+      slot = CompileMultiplication(e, memo);
+      break;
+    case ExpressionKind::Div:
+      slot = binary(Op::kDiv);
+      break;
+    case ExpressionKind::Log:
+      slot = unary(Op::kLog);
+      break;
+    case ExpressionKind::Abs:
+      slot = unary(Op::kAbs);
+      break;
+    case ExpressionKind::Exp:
+      slot = unary(Op::kExp);
+      break;
+    case ExpressionKind::Sqrt:
+      slot = unary(Op::kSqrt);
+      break;
+    case ExpressionKind::Pow: {
+      const Expression& exponent = get_second_argument(e);
+      if (is_constant(exponent)) {
+        slot = Emit(Op::kPowConst, Compile(get_first_argument(e), memo), -1,
+                    get_constant_value(exponent));
+      } else {
+        slot = binary(Op::kPow);
+      }
+      break;
+    }
+    case ExpressionKind::Sin:
+      slot = unary(Op::kSin);
+      break;
+    case ExpressionKind::Cos:
+      slot = unary(Op::kCos);
+      break;
+    case ExpressionKind::Tan:
+      slot = unary(Op::kTan);
+      break;
+    case ExpressionKind::Asin:
+      slot = unary(Op::kAsin);
+      break;
+    case ExpressionKind::Acos:
+      slot = unary(Op::kAcos);
+      break;
+    case ExpressionKind::Atan:
+      slot = unary(Op::kAtan);
+      break;
+    case ExpressionKind::Atan2:
+      slot = binary(Op::kAtan2);
+      break;
+    case ExpressionKind::Sinh:
+      slot = unary(Op::kSinh);
+      break;
+    case ExpressionKind::Cosh:
+      slot = unary(Op::kCosh);
+      break;
+    case ExpressionKind::Tanh:
+      slot = unary(Op::kTanh);
+      break;
+    case ExpressionKind::Min:
+      slot = binary(Op::kMin);
+      break;
+    case ExpressionKind::Max:
+      slot = binary(Op::kMax);
+      break;
+    case ExpressionKind::Ceil:
+      slot = unary(Op::kCeil);
+      break;
+    case ExpressionKind::Floor:
+      slot = unary(Op::kFloor);
+      break;
+    case ExpressionKind::NaN:
+      throw runtime_error("ExpressionTape: NaN is detected in an expression.");
+    case ExpressionKind::IfThenElse:
+      throw runtime_error(
+          "ExpressionTape does not support if-then-else expressions.");
+    case ExpressionKind::UninterpretedFunction:
+      throw runtime_error(
+          "ExpressionTape does not support uninterpreted functions.");
+  }
+  DRAKE_DEMAND(slot >= 0);
+  memo->emplace(e, slot);
+  return slot;
+}
+
+// Compiles c₀ + ∑ cᵢ eᵢ as a chain of scaled additions.
+int ExpressionTape::CompileAddition(const Expression& e, Memo* memo) {
+  const double c0{get_constant_in_addition(e)};
+  int sum{-1};
+  if (c0 != 0.0) {
+    sum = Compile(Expression{c0}, memo);
+  }
+  for (const auto& item : get_expr_to_coeff_map_in_addition(e)) {
+    const int term = Compile(item.first, memo);
+    const double coeff = item.second;
+    if (sum >= 0) {
+      sum = Emit(Op::kAddScaled, sum, term, coeff);
+    } else {
+      sum = (coeff == 1.0) ? term : Emit(Op::kScale, term, -1, coeff);
+    }
+  }
+  DRAKE_DEMAND(sum >= 0);
+  return sum;
+}
+
+// Compiles c * ∏ bᵢ^eᵢ as a chain of multiplications.
+int ExpressionTape::CompileMultiplication(const Expression& e, Memo* memo) {
+  int product{-1};
+  for (const auto& item : get_base_to_exponent_map_in_multiplication(e)) {
+    const Expression& base = item.first;
+    const Expression& exponent = item.second;
+    int factor{-1};
+    if (is_one(exponent)) {
+      factor = Compile(base, memo);
+    } else {
+      factor = Compile(pow(base, exponent), memo);
+    }
+    product = (product >= 0) ? Emit(Op::kMul, product, factor) : factor;
+  }
+  DRAKE_DEMAND(product >= 0);
+  const double c{get_constant_in_multiplication(e)};
+  if (c != 1.0) {
+    product = Emit(Op::kScale, product, -1, c);
+  }
+  return product;
+}
+
+void ExpressionTape::Evaluate(const Eigen::Ref<const Eigen::VectorXd>& x,
+                              Eigen::VectorXd* y) const {
+  DRAKE_DEMAND(x.size() == num_variables_);
+  DRAKE_DEMAND(y != nullptr);
+  Eigen::VectorXd values(num_variables_ + num_instructions());
+  values.head(num_variables_) = x;
+  for (int k = 0; k < num_instructions(); ++k) {
+    values[num_variables_ + k] = EvaluateInstruction(tape_[k], values.data());
+  }
+  y->resize(num_outputs());
+  for (int i = 0; i < num_outputs(); ++i) {
+    (*y)[i] = values[outputs_[i]];
+  }
+}
+
+void ExpressionTape::Evaluate(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::MatrixXd>& x_gradient, Eigen::VectorXd* y,
+    Eigen::MatrixXd* y_gradient) const {
+  DRAKE_DEMAND(x.size() == num_variables_);
+  DRAKE_DEMAND(x_gradient.rows() == num_variables_);
+  DRAKE_DEMAND(y != nullptr);
+  DRAKE_DEMAND(y_gradient != nullptr);
+
+  // The gradient of each slot is a row of `gradients`; row-major storage
+  // keeps each one contiguous.
+  const int num_slots = num_variables_ + num_instructions();
+  const int nz = x_gradient.cols();
+  Eigen::VectorXd values(num_slots);
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+      gradients(num_slots, nz);
+  values.head(num_variables_) = x;
+  gradients.topRows(num_variables_) = x_gradient;
+
+  for (int k = 0; k < num_instructions(); ++k) {
+    const Instruction& instruction = tape_[k];
+    const int slot = num_variables_ + k;
+    const double value = EvaluateInstruction(instruction, values.data());
+    values[slot] = value;
+
+    auto grad = gradients.row(slot);
+    if (instruction.op == Op::kConstant) {
+      grad.setZero();
+      continue;
+    }
+    const double a = values[instruction.a];
+    const auto grad_a = gradients.row(instruction.a);
+    const double c = instruction.c;
+    switch (instruction.op) {
+      case Op::kConstant:
+      case Op::kVariable:
+        DRAKE_UNREACHABLE();
+      case Op::kScale:
+        grad = c * grad_a;
+        continue;
+      case Op::kPowConst:
+        grad = (c * std::pow(a, c - 1)) * grad_a;
+        continue;
+      case Op::kAbs:
+        grad = (a < 0) ? (-grad_a).eval() : grad_a.eval();
+        continue;
+      case Op::kLog:
+        grad = grad_a / a;
+        continue;
+      case Op::kExp:
+        grad = value * grad_a;
+        continue;
+      case Op::kSqrt:
+        grad = grad_a / (2 * value);
+        continue;
+      case Op::kSin:
+        grad = std::cos(a) * grad_a;
+        continue;
+      case Op::kCos:
+        grad = -std::sin(a) * grad_a;
+        continue;
+      case Op::kTan:
+        grad = grad_a / (std::cos(a) * std::cos(a));
+        continue;
+      case Op::kAsin:
+        grad = grad_a / std::sqrt(1 - a * a);
+        continue;
+      case Op::kAcos:
+        grad = -grad_a / std::sqrt(1 - a * a);
+        continue;
+      case Op::kAtan:
+        grad = grad_a / (1 + a * a);
+        continue;
+      case Op::kSinh:
+        grad = std::cosh(a) * grad_a;
+        continue;
+      case Op::kCosh:
+        grad = std::sinh(a) * grad_a;
+        continue;
+      case Op::kTanh:
+        grad = (1 - value * value) * grad_a;
+        continue;
+      case Op::kCeil:
+      case Op::kFloor:
+        grad.setZero();
+        continue;
+      case Op::kAddScaled:
+      case Op::kMul:
+      case Op::kDiv:
+      case Op::kPow:
+      case Op::kAtan2:
+      case Op::kMin:
+      case Op::kMax:
+        // Binary operations are handled below.
+        break;
+    }
+
+    const double b = values[instruction.b];
+    const auto grad_b = gradients.row(instruction.b);
+    switch (instruction.op) {
+      case Op::kAddScaled:
+        grad = grad_a + c * grad_b;
+        break;
+      case Op::kMul:
+        grad = b * grad_a + a * grad_b;
+        break;
+      case Op::kDiv:
+        grad = (grad_a - value * grad_b) / b;
+        break;
+      case Op::kPow:
+        // ∂(aᵇ) = b aᵇ⁻¹ ∂a + aᵇ log(a) ∂b.
+        grad = (b * std::pow(a, b - 1)) * grad_a;
+        if (!grad_b.isZero(0.0)) {
+          grad += (value * std::log(a)) * grad_b;
+        }
+        break;
+      case Op::kAtan2:
+        grad = (b * grad_a - a * grad_b) / (a * a + b * b);
+        break;
+      case Op::kMin:
+        grad = (a < b) ? grad_a : grad_b;
+        break;
+      case Op::kMax:
+        grad = (a < b) ? grad_b : grad_a;
+        break;
+      default:
+        DRAKE_UNREACHABLE();
+    }
+  }
+
+  y->resize(num_outputs());
+  y_gradient->resize(num_outputs(), nz);
+  for (int i = 0; i < num_outputs(); ++i) {
+    (*y)[i] = values[outputs_[i]];
+    y_gradient->row(i) = gradients.row(outputs_[i]);
+  }
+}
+
+}  // namespace symbolic
+}  // namespace drake
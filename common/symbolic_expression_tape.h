@@ -0,0 +1,177 @@
+#pragma once
+
+#ifndef DRAKE_COMMON_SYMBOLIC_HEADER
+#warning Do not directly include this file. Include "drake/common/symbolic.h".
+#endif
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+namespace internal {
+// The operations of the instructions of an ExpressionTape, which are also the
+// operations of the nodes of an ExpressionDag. See TapeInstruction for the
+// meaning of their operands.
+enum class TapeOp : std::uint8_t {
+  kConstant,   // c
+  kVariable,   // The a-th variable of an ExpressionDag; not on a tape.
+  kScale,      // c * a
+  kAddScaled,  // a + c * b
+  kMul,        // a * b
+  kDiv,        // a / b
+  kPowConst,   // a ^ c
+  kPow,        // a ^ b
+  kAbs,
+  kLog,
+  kExp,
+  kSqrt,
+  kSin,
+  kCos,
+  kTan,
+  kAsin,
+  kAcos,
+  kAtan,
+  kAtan2,      // atan2(a, b)
+  kSinh,
+  kCosh,
+  kTanh,
+  kMin,
+  kMax,
+  kCeil,
+  kFloor,
+};
+
+// A single instruction. Operands `a` and `b` refer to the values the
+// instruction is computed from (slots of an ExpressionTape, nodes of an
+// ExpressionDag); unused operands are -1.
+struct TapeInstruction {
+  TapeOp op{};
+  int a{-1};
+  int b{-1};
+  double c{0.0};
+};
+
+// Returns the value of `instruction`, given the values `a` and `b` of its
+// operands (which are ignored when unused), following IEEE 754 semantics.
+// @pre `instruction.op` is not TapeOp::kVariable.
+double EvaluateTapeInstruction(const TapeInstruction& instruction, double a,
+                               double b);
+}  // namespace internal
+
+/// Compiles a vector of symbolic expressions into a flat tape of instructions
+/// over an ordered list of variables, so that the expressions can be evaluated
+/// repeatedly without walking their expression trees or building an
+/// Environment.
+///
+/// Structurally equal subexpressions (within and across the expressions) are
+/// evaluated only once. Besides plain evaluation, the tape supports
+/// forward-mode propagation of gradients, which is how the Jacobian of the
+/// expressions (or any chain rule product with it) is computed.
+///
+/// Unlike Expression::Evaluate(), evaluating a tape follows IEEE 754 semantics
+/// and never throws: e.g., division by zero yields ±∞ and the logarithm of a
+/// negative number yields NaN.
+///
+/// The derivative of a non-differentiable function is taken from one side:
+/// `abs(x)` has derivative 1 at 0, `min` and `max` propagate the gradient of
+/// the argument they select, and `ceil` and `floor` have derivative 0.
+class ExpressionTape {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ExpressionTape)
+
+  /// Compiles @p expressions, where the i-th input of the tape is
+  /// @p variables(i).
+  ///
+  /// @throws std::runtime_error if any expression includes a variable that is
+  /// not in @p variables, or includes an if-then-else expression or an
+  /// uninterpreted function, which are not supported.
+  /// @see IsSupported()
+  ExpressionTape(const Eigen::Ref<const VectorX<Expression>>& expressions,
+                 const Eigen::Ref<const VectorX<Variable>>& variables);
+
+  /// Returns true iff a tape of @p expressions over @p variables can be
+  /// constructed, i.e., iff the constructor would not throw.
+  static bool IsSupported(
+      const Eigen::Ref<const VectorX<Expression>>& expressions,
+      const Eigen::Ref<const VectorX<Variable>>& variables);
+
+  /// Returns the number of input variables.
+  int num_variables() const { return num_variables_; }
+
+  /// Returns the number of expressions (i.e., outputs).
+  int num_outputs() const { return static_cast<int>(outputs_.size()); }
+
+  /// Returns the number of instructions on the tape.
+  int num_instructions() const { return static_cast<int>(tape_.size()); }
+
+  /// Evaluates the expressions at the values @p x of the variables, writing
+  /// the results to @p y, which is resized as necessary.
+  /// @pre `x.size() == num_variables()`.
+  void Evaluate(const Eigen::Ref<const Eigen::VectorXd>& x,
+                Eigen::VectorXd* y) const;
+
+  /// Evaluates the expressions at the values @p x of the variables, along
+  /// with their gradients. Given the gradient @p x_gradient of the variables
+  /// with respect to some parameters z (i.e., ∂x/∂z, of size
+  /// `num_variables() × nz`), computes `y_gradient` = ∂y/∂z = ∂y/∂x ∂x/∂z,
+  /// of size `num_outputs() × nz`. Passing the identity for @p x_gradient
+  /// yields the Jacobian ∂y/∂x. @p y and @p y_gradient are resized as
+  /// necessary.
+  /// @pre `x.size() == num_variables()` and
+  ///      `x_gradient.rows() == num_variables()`.
+  void Evaluate(const Eigen::Ref<const Eigen::VectorXd>& x,
+                const Eigen::Ref<const Eigen::MatrixXd>& x_gradient,
+                Eigen::VectorXd* y, Eigen::MatrixXd* y_gradient) const;
+
+ private:
+  friend class ExpressionDag;
+
+  using Op = internal::TapeOp;
+  // The operands of an instruction on the tape are slot indices: slots
+  // [0, num_variables_) hold the variables, and slot num_variables_ + k holds
+  // the result of the k-th instruction.
+  using Instruction = internal::TapeInstruction;
+
+  // Constructs a tape from its instructions, for ExpressionDag::ToTape().
+  ExpressionTape(int num_variables, std::vector<Instruction> tape,
+                 std::vector<int> outputs);
+
+  // Helpers for building the tape. The memo maps each variable and each
+  // compiled subexpression to its slot.
+  using Memo = std::unordered_map<Expression, int>;
+  int Compile(const Expression& e, Memo* memo);
+  int CompileAddition(const Expression& e, Memo* memo);
+  int CompileMultiplication(const Expression& e, Memo* memo);
+  int Emit(Op op, int a = -1, int b = -1, double c = 0.0);
+
+  // Helper for IsSupported(). The visited set holds the subexpressions that
+  // are already known to be supported.
+  static bool IsSupported(const Expression& e, const Variables& variables,
+                          std::unordered_set<Expression>* visited);
+
+  // Returns the value of `instruction`, given the current slot values.
+  static double EvaluateInstruction(const Instruction& instruction,
+                                    const double* values) {
+    return internal::EvaluateTapeInstruction(
+        instruction, (instruction.a >= 0) ? values[instruction.a] : 0.0,
+        (instruction.b >= 0) ? values[instruction.b] : 0.0);
+  }
+
+  int num_variables_{0};
+  std::vector<Instruction> tape_;
+  // The slot holding the value of each expression.
+  std::vector<int> outputs_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,191 @@
+/// @file benchmark_symbolic_expression_dag.cc
+///
+/// Compares the time and the heap usage of building, differentiating,
+/// substituting into and evaluating the kinematics of an n-link planar
+/// pendulum with symbolic::Expression and with symbolic::ExpressionDag.
+///
+/// The workload computes the position of the end of each link, the Jacobian J
+/// of those positions with respect to the joint angles q, and the matrix
+/// M = Jᵀ J (the mass matrix, for unit point masses at the ends of the links).
+/// Heap usage counts the allocations through operator new, which excludes the
+/// storage of Eigen matrices.
+///
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/measure_execution.h"
+
+DEFINE_int32(num_links, 20, "Number of links of the pendulum");
+DEFINE_int32(num_evaluations, 10, "Number of evaluations per measurement");
+
+namespace {
+
+// The number and the total size of the heap allocations so far.
+std::atomic<int64_t> g_num_allocations{0};
+std::atomic<int64_t> g_num_allocated_bytes{0};
+
+}  // namespace
+
+// Count every heap allocation of the program.
+void* operator new(std::size_t size) {
+  ++g_num_allocations;
+  g_num_allocated_bytes += size;
+  void* const result = std::malloc(size > 0 ? size : 1);
+  if (result == nullptr) {
+    throw std::bad_alloc();
+  }
+  return result;
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using common::test::MeasureExecutionTime;
+using NodeId = ExpressionDag::NodeId;
+
+// Runs `func`, and reports its time and heap allocations under `name`, per
+// each of the `num_repetitions` that `func` makes.
+template <typename F>
+void Measure(const std::string& name, F func, int num_repetitions = 1) {
+  const int64_t num_allocations = g_num_allocations;
+  const int64_t num_allocated_bytes = g_num_allocated_bytes;
+  const double time = MeasureExecutionTime(func);
+  std::cout << "  " << name << ": " << time / num_repetitions * 1e3 << " ms, "
+            << (g_num_allocations - num_allocations) / num_repetitions
+            << " allocations, "
+            << (g_num_allocated_bytes - num_allocated_bytes) /
+                   num_repetitions / 1024
+            << " KiB" << std::endl;
+}
+
+int do_main() {
+  const int n = FLAGS_num_links;
+  std::vector<Variable> q;
+  Environment env;
+  for (int i = 0; i < n; ++i) {
+    q.emplace_back("q" + std::to_string(i));
+    env.insert(q.back(), 0.1 * (i + 1));
+  }
+  const double q0_value = 0.5;
+  std::cout << n << " links, " << 2 * n << " positions, " << n * n
+            << " mass matrix entries:\n";
+
+  std::cout << "Expression\n";
+  VectorX<Expression> positions(2 * n);
+  MatrixX<Expression> M;
+  MatrixX<Expression> M_substituted;
+  Eigen::MatrixXd M_expression_value(n, n);
+  Measure("build positions", [&]() {
+    Expression angle{0.0};
+    Expression x{0.0};
+    Expression y{0.0};
+    for (int i = 0; i < n; ++i) {
+      angle += q[i];
+      x += cos(angle);
+      y += sin(angle);
+      positions(2 * i) = x;
+      positions(2 * i + 1) = y;
+    }
+  });
+  Measure("jacobian and mass matrix", [&]() {
+    const MatrixX<Expression> J = Jacobian(positions, q);
+    M = J.transpose() * J;
+  });
+  Measure("substitute q0", [&]() {
+    M_substituted = M.unaryExpr([&](const Expression& e) {
+      return e.Substitute(q[0], q0_value);
+    });
+  });
+  Measure("evaluate", [&]() {
+    for (int k = 0; k < FLAGS_num_evaluations; ++k) {
+      M_expression_value = Evaluate(M, env);
+    }
+  }, FLAGS_num_evaluations);
+
+  std::cout << "ExpressionDag\n";
+  ExpressionDag dag;
+  std::vector<NodeId> dag_positions(2 * n);
+  std::vector<NodeId> dag_M(n * n);
+  std::vector<NodeId> dag_M_substituted;
+  Eigen::VectorXd M_dag_value;
+  Measure("build positions", [&]() {
+    NodeId angle = dag.Constant(0.0);
+    NodeId x = dag.Constant(0.0);
+    NodeId y = dag.Constant(0.0);
+    for (int i = 0; i < n; ++i) {
+      angle = dag.Add(angle, dag.Var(q[i]));
+      x = dag.Add(x, dag.Cos(angle));
+      y = dag.Add(y, dag.Sin(angle));
+      dag_positions[2 * i] = x;
+      dag_positions[2 * i + 1] = y;
+    }
+  });
+  Measure("jacobian and mass matrix", [&]() {
+    const auto J = dag.Jacobian(dag_positions, q);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        NodeId sum = dag.Constant(0.0);
+        for (int k = 0; k < 2 * n; ++k) {
+          sum = dag.Add(sum, dag.Mul(J(k, i), J(k, j)));
+        }
+        dag_M[i * n + j] = sum;
+      }
+    }
+  });
+  Measure("substitute q0", [&]() {
+    dag_M_substituted =
+        dag.Substitute(dag_M, {{q[0], dag.Constant(q0_value)}});
+  });
+  Measure("evaluate", [&]() {
+    for (int k = 0; k < FLAGS_num_evaluations; ++k) {
+      M_dag_value = dag.Evaluate(dag_M, env);
+    }
+  }, FLAGS_num_evaluations);
+  std::cout << "  " << dag.num_nodes() << " nodes\n";
+
+  // Check that both agree.
+  double max_error = 0;
+  Environment substituted_env = env;
+  substituted_env[q[0]] = q0_value;
+  const Eigen::VectorXd M_dag_substituted_value =
+      dag.Evaluate(dag_M_substituted, substituted_env);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      max_error = std::max(max_error, std::abs(M_dag_value[i * n + j] -
+                                               M_expression_value(i, j)));
+      max_error = std::max(
+          max_error,
+          std::abs(M_dag_substituted_value[i * n + j] -
+                   M_substituted(i, j).Evaluate(substituted_env)));
+    }
+  }
+  std::cout << "Max |difference| " << max_error << std::endl;
+  return 0;
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::symbolic::do_main();
+}
@@ -0,0 +1,230 @@
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/symbolic_test_util.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using NodeId = ExpressionDag::NodeId;
+using test::ExprEqual;
+
+class SymbolicExpressionDagTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    env_.insert(x_, 0.3);
+    env_.insert(y_, -1.2);
+    env_.insert(z_, 2.5);
+  }
+
+  // Checks that the DAG of @p f reproduces the value of f, and of its
+  // derivatives with respect to x, y and z, at env_.
+  void CheckExpression(const Expression& f) {
+    ExpressionDag dag;
+    const NodeId node = dag.Insert(f);
+    EXPECT_NEAR(dag.Evaluate(node, env_), f.Evaluate(env_), kTol);
+    EXPECT_NEAR(dag.ToExpression(node).Evaluate(env_), f.Evaluate(env_),
+                kTol);
+    for (const Variable& var : {x_, y_, z_}) {
+      const NodeId derivative = dag.Differentiate(node, var);
+      EXPECT_NEAR(dag.Evaluate(derivative, env_),
+                  f.Differentiate(var).Evaluate(env_), kTol)
+          << f << " with respect to " << var;
+    }
+  }
+
+  const double kTol{1e-12};
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  Environment env_;
+};
+
+TEST_F(SymbolicExpressionDagTest, HashConsing) {
+  ExpressionDag dag;
+  const NodeId x = dag.Var(x_);
+  const NodeId y = dag.Var(y_);
+  EXPECT_EQ(dag.Var(x_), x);
+  EXPECT_EQ(dag.Constant(2.0), dag.Constant(2.0));
+  EXPECT_EQ(dag.Constant(0.0), dag.Constant(-0.0));
+
+  // Building the same expression twice creates no new nodes, and commutative
+  // operations don't depend on the order of their operands.
+  const NodeId sum = dag.Add(dag.Sin(x), dag.Mul(x, y));
+  const int num_nodes = dag.num_nodes();
+  EXPECT_EQ(dag.Add(dag.Mul(y, x), dag.Sin(x)), sum);
+  EXPECT_EQ(dag.num_nodes(), num_nodes);
+  EXPECT_NE(dag.Div(x, y), dag.Div(y, x));
+
+  // A deep chain of repeated squaring is a linear number of nodes, whereas
+  // its expression tree would be exponentially large.
+  const int num_nodes_before_chain = dag.num_nodes();
+  NodeId e = dag.Add(x, y);
+  for (int i = 0; i < 50; ++i) {
+    e = dag.Mul(e, e);
+  }
+  EXPECT_EQ(dag.num_nodes(), num_nodes_before_chain + 1 + 50);
+}
+
+TEST_F(SymbolicExpressionDagTest, Simplification) {
+  ExpressionDag dag;
+  const NodeId x = dag.Var(x_);
+  const NodeId zero = dag.Constant(0.0);
+  const NodeId one = dag.Constant(1.0);
+  EXPECT_EQ(dag.Add(x, zero), x);
+  EXPECT_EQ(dag.Add(zero, x), x);
+  EXPECT_EQ(dag.Mul(one, x), x);
+  EXPECT_EQ(dag.Mul(x, zero), zero);
+  EXPECT_EQ(dag.Div(x, one), x);
+  EXPECT_EQ(dag.Pow(x, one), x);
+  EXPECT_EQ(dag.Pow(x, zero), one);
+  EXPECT_EQ(dag.Sub(x, x), dag.Add(x, dag.Neg(x)));
+  EXPECT_EQ(dag.Cos(zero), one);
+  EXPECT_EQ(dag.Add(dag.Constant(2.0), dag.Constant(3.0)), dag.Constant(5.0));
+  // A constant that folds to NaN is left as is; it evaluates to NaN.
+  const NodeId log_minus_one = dag.Log(dag.Constant(-1.0));
+  EXPECT_TRUE(std::isnan(dag.Evaluate(log_minus_one, env_)));
+  EXPECT_THROW(dag.Constant(NAN), std::runtime_error);
+}
+
+TEST_F(SymbolicExpressionDagTest, ExpressionRoundTrip) {
+  const Expression e = 3 * x_ * y_ + 2 * pow(x_, 2) / z_ - 1;
+  ExpressionDag dag;
+  const NodeId node = dag.Insert(e);
+  EXPECT_PRED2(ExprEqual, dag.ToExpression(node).Expand(), e.Expand());
+  // Inserting it again finds all of its nodes.
+  const int num_nodes = dag.num_nodes();
+  EXPECT_EQ(dag.Insert(e), node);
+  EXPECT_EQ(dag.num_nodes(), num_nodes);
+
+  EXPECT_THROW(dag.Insert(if_then_else(x_ > y_, x_, y_)), std::runtime_error);
+  EXPECT_THROW(dag.Insert(uninterpreted_function("f", {x_})),
+               std::runtime_error);
+}
+
+TEST_F(SymbolicExpressionDagTest, EvaluateAndDifferentiate) {
+  CheckExpression(x_ * y_ + z_);
+  CheckExpression(x_ / y_ - 3 * z_);
+  CheckExpression(pow(x_, 3) * pow(z_, y_));
+  CheckExpression(pow(z_, x_ * y_));
+  CheckExpression(log(z_) + exp(x_ * y_) + sqrt(z_));
+  CheckExpression(sin(x_ * y_) * cos(z_) + tan(x_));
+  CheckExpression(asin(x_) + acos(x_ * x_) + atan(y_ * z_));
+  CheckExpression(atan2(x_ + y_, z_));
+  CheckExpression(sinh(x_) + cosh(y_) * tanh(z_));
+}
+
+TEST_F(SymbolicExpressionDagTest, NotDifferentiable) {
+  const Expression f =
+      (abs(z_) + min(z_, 3.0) + max(z_, 3.0) + ceil(z_) + floor(z_)) * x_;
+  ExpressionDag dag;
+  const NodeId node = dag.Insert(f);
+  EXPECT_NEAR(dag.Evaluate(node, env_), f.Evaluate(env_), kTol);
+  EXPECT_NEAR(dag.Evaluate(dag.Differentiate(node, x_), env_),
+              f.Differentiate(x_).Evaluate(env_), kTol);
+  EXPECT_EQ(dag.Differentiate(node, y_), dag.Constant(0.0));
+  EXPECT_THROW(dag.Differentiate(node, z_), std::runtime_error);
+}
+
+TEST_F(SymbolicExpressionDagTest, MissingVariable) {
+  ExpressionDag dag;
+  const NodeId e = dag.Insert(x_ + Variable("w"));
+  EXPECT_THROW(dag.Evaluate(e, env_), std::runtime_error);
+}
+
+TEST_F(SymbolicExpressionDagTest, Jacobian) {
+  ExpressionDag dag;
+  const std::vector<NodeId> f{dag.Insert(x_ * y_ * z_),
+                              dag.Insert(sin(x_) + y_),
+                              dag.Insert(z_ * z_)};
+  const auto J = dag.Jacobian(f, {x_, y_, z_});
+  ASSERT_EQ(J.rows(), 3);
+  ASSERT_EQ(J.cols(), 3);
+  const std::vector<Expression> expressions{x_ * y_ * z_, sin(x_) + y_,
+                                            z_ * z_};
+  const std::vector<Variable> vars{x_, y_, z_};
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_NEAR(dag.Evaluate(J(i, j), env_),
+                  expressions[i].Differentiate(vars[j]).Evaluate(env_), kTol);
+    }
+  }
+  // Structural zeros are recognized.
+  EXPECT_EQ(J(2, 0), dag.Constant(0.0));
+  EXPECT_EQ(J(1, 2), dag.Constant(0.0));
+
+  const Eigen::VectorXd values = dag.Evaluate(f, env_);
+  ASSERT_EQ(values.size(), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(values[i], expressions[i].Evaluate(env_), kTol);
+  }
+}
+
+TEST_F(SymbolicExpressionDagTest, ToTape) {
+  ExpressionDag dag;
+  const std::vector<NodeId> f{
+      dag.Insert(x_ * y_ * z_ + 2.0 * sin(x_)),
+      dag.Insert(pow(z_, 3.0) / (1.0 + x_ * x_) - 4.0 * y_),
+      dag.Insert(exp(y_) * atan2(x_, z_)), dag.Var(y_), dag.Constant(1.5)};
+  // The inputs of the tape are in a different order from the variables of
+  // the DAG.
+  const Vector3<Variable> vars(z_, x_, y_);
+  const ExpressionTape tape = dag.ToTape(f, vars);
+  EXPECT_EQ(tape.num_variables(), 3);
+  EXPECT_EQ(tape.num_outputs(), 5);
+
+  const Eigen::Vector3d v(2.5, 0.3, -1.2);
+  Eigen::VectorXd y;
+  Eigen::MatrixXd y_gradient;
+  tape.Evaluate(v, Eigen::Matrix3d::Identity(), &y, &y_gradient);
+  const Eigen::VectorXd expected = dag.Evaluate(f, env_);
+  const auto J = dag.Jacobian(f, {z_, x_, y_});
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_NEAR(y[i], expected[i], kTol);
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_NEAR(y_gradient(i, j), dag.Evaluate(J(i, j), env_), kTol);
+    }
+  }
+
+  // Every variable of the nodes must be an input, and only once.
+  EXPECT_THROW(dag.ToTape(f, Vector2<Variable>(x_, y_)), std::runtime_error);
+  EXPECT_THROW(dag.ToTape(f, Vector4<Variable>(x_, y_, z_, x_)),
+               std::runtime_error);
+  // Other variables are allowed, but unused.
+  const Variable w{"w"};
+  EXPECT_EQ(dag.ToTape(f, Vector4<Variable>(w, z_, x_, y_)).num_variables(),
+            4);
+}
+
+TEST_F(SymbolicExpressionDagTest, Substitute) {
+  ExpressionDag dag;
+  const NodeId x = dag.Var(x_);
+  const NodeId y = dag.Var(y_);
+  const NodeId f = dag.Add(dag.Sin(x), dag.Mul(x, y));
+  const NodeId g = dag.Cos(y);
+
+  // Substituting x := 2y in f yields the same node as building it directly.
+  const NodeId two_y = dag.Mul(dag.Constant(2.0), y);
+  const std::unordered_map<Variable, NodeId> substitution{{x_, two_y}};
+  EXPECT_EQ(dag.Substitute(f, substitution),
+            dag.Add(dag.Sin(two_y), dag.Mul(two_y, y)));
+  // Nodes that don't depend on x are left as they are.
+  const std::vector<NodeId> substituted = dag.Substitute({f, g}, substitution);
+  EXPECT_EQ(substituted[1], g);
+  EXPECT_EQ(dag.Substitute(f, {}), f);
+
+  // Substituting constants for all the variables folds to a constant.
+  const NodeId folded = dag.Substitute(
+      f, {{x_, dag.Constant(0.3)}, {y_, dag.Constant(-1.2)}});
+  EXPECT_EQ(folded, dag.Constant(dag.Evaluate(f, env_)));
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,174 @@
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+class SymbolicExpressionTapeTest : public ::testing::Test {
+ protected:
+  // Checks that the values and the Jacobian computed by a tape of @p f agree
+  // with Expression::Evaluate() and symbolic differentiation at @p x.
+  void CheckTape(const VectorX<Expression>& f, const Vector3d& x) {
+    const ExpressionTape dut(f, vars_);
+    EXPECT_EQ(dut.num_variables(), 3);
+    EXPECT_EQ(dut.num_outputs(), f.size());
+
+    Environment env;
+    for (int i = 0; i < 3; ++i) {
+      env.insert(vars_(i), x(i));
+    }
+    VectorXd y_expected(f.size());
+    for (int i = 0; i < f.size(); ++i) {
+      y_expected(i) = f(i).Evaluate(env);
+    }
+    const MatrixXd J_expected = Evaluate(Jacobian(f, vars_), env);
+
+    VectorXd y;
+    dut.Evaluate(x, &y);
+    EXPECT_TRUE(CompareMatrices(y, y_expected, kTol));
+
+    VectorXd y2;
+    MatrixXd J;
+    dut.Evaluate(x, MatrixXd::Identity(3, 3), &y2, &J);
+    EXPECT_TRUE(CompareMatrices(y2, y_expected, kTol));
+    EXPECT_TRUE(CompareMatrices(J, J_expected, kTol));
+
+    // The chain rule through an arbitrary ∂x/∂z.
+    MatrixXd x_gradient(3, 2);
+    x_gradient << 1, 2, 3, 4, 5, 6;
+    MatrixXd y_gradient;
+    dut.Evaluate(x, x_gradient, &y2, &y_gradient);
+    EXPECT_TRUE(CompareMatrices(y_gradient, J_expected * x_gradient, kTol));
+  }
+
+  const double kTol{1e-12};
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  const Vector3<Variable> vars_{x_, y_, z_};
+};
+
+TEST_F(SymbolicExpressionTapeTest, Polynomial) {
+  VectorX<Expression> f(4);
+  f << 2 * x_ + 3 * y_ - 4 * z_ + 5, x_ * y_ * z_, pow(x_, 3) * y_ / 7.0,
+      x_ * x_ + 2 * x_ * y_ + y_ * y_;
+  CheckTape(f, Vector3d(0.3, -1.2, 2.5));
+}
+
+TEST_F(SymbolicExpressionTapeTest, Constant) {
+  VectorX<Expression> f(2);
+  f << 3.0, 0.0;
+  CheckTape(f, Vector3d(0.3, -1.2, 2.5));
+}
+
+TEST_F(SymbolicExpressionTapeTest, UnaryFunctions) {
+  VectorX<Expression> f(12);
+  f << log(z_), exp(x_ * y_), sqrt(z_ + x_), sin(x_ * z_), cos(y_), tan(x_),
+      asin(x_), acos(x_ * 2), atan(y_ * z_), sinh(y_), cosh(x_ + z_),
+      tanh(y_);
+  CheckTape(f, Vector3d(0.3, -1.2, 2.5));
+}
+
+TEST_F(SymbolicExpressionTapeTest, BinaryFunctions) {
+  VectorX<Expression> f(4);
+  f << x_ / y_, (x_ + 1) / (y_ * z_), atan2(x_, y_ * z_), pow(z_, x_ * y_);
+  CheckTape(f, Vector3d(0.3, -1.2, 2.5));
+  CheckTape(f, Vector3d(-0.7, 2.2, 0.5));
+}
+
+TEST_F(SymbolicExpressionTapeTest, ConstantExponents) {
+  VectorX<Expression> f(3);
+  f << pow(z_, 2.5), pow(x_ + z_, -1.5), pow(sin(y_), 2) * pow(x_, 4);
+  CheckTape(f, Vector3d(0.3, -1.2, 2.5));
+}
+
+// Symbolic differentiation does not support these functions, so the expected
+// gradients are written out by hand.
+TEST_F(SymbolicExpressionTapeTest, NonSmoothFunctions) {
+  VectorX<Expression> f(5);
+  f << abs(x_ - y_), min(x_, y_) * z_, max(x_ * y_, z_), ceil(z_) * x_,
+      floor(y_) * z_;
+  const ExpressionTape dut(f, vars_);
+  const Vector3d x(0.3, -1.2, 2.5);
+  VectorXd y;
+  MatrixXd J;
+  dut.Evaluate(x, MatrixXd::Identity(3, 3), &y, &J);
+
+  VectorXd y_expected(5);
+  y_expected << 1.5, -3.0, 2.5, 0.9, -5.0;
+  MatrixXd J_expected(5, 3);
+  // clang-format off
+  J_expected <<
+      1, -1,    0,
+      0,  2.5, -1.2,
+      0,  0,    1,
+      3,  0,    0,
+      0,  0,   -2;
+  // clang-format on
+  EXPECT_TRUE(CompareMatrices(y, y_expected, kTol));
+  EXPECT_TRUE(CompareMatrices(J, J_expected, kTol));
+}
+
+TEST_F(SymbolicExpressionTapeTest, SharedSubexpressions) {
+  // sin(x * y) is computed only once. The tape holds x * y, sin(x * y), the
+  // product with z, and the two scalings.
+  const Expression s = sin(x_ * y_);
+  VectorX<Expression> f(2);
+  f << 2 * s, s * 3 * z_;
+  const ExpressionTape dut(f, vars_);
+  EXPECT_EQ(dut.num_instructions(), 5);
+  CheckTape(f, Vector3d(0.3, -1.2, 2.5));
+}
+
+TEST_F(SymbolicExpressionTapeTest, IeeeSemantics) {
+  VectorX<Expression> f(2);
+  f << x_ / y_, log(z_);
+  const ExpressionTape dut(f, vars_);
+  VectorXd y;
+  dut.Evaluate(Vector3d(1.0, 0.0, -1.0), &y);
+  EXPECT_EQ(y(0), std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(std::isnan(y(1)));
+}
+
+TEST_F(SymbolicExpressionTapeTest, UnsupportedExpressions) {
+  const Variable w{"w"};
+  VectorX<Expression> f(1);
+  f << x_ + w;
+  EXPECT_FALSE(ExpressionTape::IsSupported(f, vars_));
+  EXPECT_THROW(ExpressionTape(f, vars_), std::runtime_error);
+  f << sin(x_ * pow(y_, w));
+  EXPECT_FALSE(ExpressionTape::IsSupported(f, vars_));
+  EXPECT_THROW(ExpressionTape(f, vars_), std::runtime_error);
+  f << if_then_else(x_ > y_, x_, y_);
+  EXPECT_FALSE(ExpressionTape::IsSupported(f, vars_));
+  EXPECT_THROW(ExpressionTape(f, vars_), std::runtime_error);
+  f << uninterpreted_function("uf", {x_});
+  EXPECT_FALSE(ExpressionTape::IsSupported(f, vars_));
+  EXPECT_THROW(ExpressionTape(f, vars_), std::runtime_error);
+  f << x_;
+  EXPECT_FALSE(ExpressionTape::IsSupported(f, Vector2<Variable>(x_, x_)));
+  EXPECT_THROW(ExpressionTape(f, Vector2<Variable>(x_, x_)),
+               std::runtime_error);
+
+  // The supported expressions are reported as such.
+  VectorX<Expression> g(3);
+  g << 2 + x_ * pow(y_, z_), atan2(sin(x_), max(y_, 1.0)), 3.0;
+  EXPECT_TRUE(ExpressionTape::IsSupported(g, vars_));
+  EXPECT_NO_THROW(ExpressionTape(g, vars_));
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
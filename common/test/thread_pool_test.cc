@@ -0,0 +1,55 @@
+#include "drake/common/thread_pool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(ThreadPoolTest, RunsEveryItemOnce) {
+  for (int num_threads : {1, 2, 4}) {
+    ThreadPool dut(num_threads);
+    EXPECT_EQ(dut.num_threads(), num_threads);
+    // Reuse the pool for several loops, including empty ones.
+    for (int n : {0, 1, 3, 100, 1000}) {
+      std::vector<std::atomic<int>> counts(n);
+      for (auto& count : counts) count = 0;
+      dut.ParallelFor(n, [&counts](int i) { ++counts[i]; });
+      for (int i = 0; i < n; ++i) {
+        EXPECT_EQ(counts[i], 1);
+      }
+    }
+  }
+}
+
+GTEST_TEST(ThreadPoolTest, RethrowsException) {
+  ThreadPool dut(3);
+  std::atomic<int> num_calls{0};
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.ParallelFor(100,
+                      [&num_calls](int i) {
+                        ++num_calls;
+                        if (i == 10) throw std::runtime_error("item 10");
+                      }),
+      std::runtime_error, "item 10");
+  EXPECT_LE(num_calls, 100);
+
+  // The pool is still usable afterwards.
+  num_calls = 0;
+  dut.ParallelFor(100, [&num_calls](int) { ++num_calls; });
+  EXPECT_EQ(num_calls, 100);
+}
+
+GTEST_TEST(ThreadPoolTest, BadNumThreads) {
+  EXPECT_THROW(ThreadPool(0), std::exception);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,97 @@
+#include "drake/common/thread_pool.h"
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace internal {
+
+ThreadPool::ThreadPool(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  workers_.reserve(num_threads - 1);
+  for (int i = 1; i < num_threads; ++i) {
+    workers_.emplace_back([this]() { WorkerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_cv_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::ParallelFor(int n, const std::function<void(int)>& body) {
+  if (n <= 0) return;
+  // Without workers, or with a single item, there is nothing to hand off.
+  if (workers_.empty() || n == 1) {
+    for (int i = 0; i < n; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> loop_lock(loop_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    body_ = &body;
+    num_items_ = n;
+    next_item_ = 0;
+    error_ = nullptr;
+    num_busy_workers_ = static_cast<int>(workers_.size());
+    ++generation_;
+  }
+  start_cv_.notify_all();
+
+  RunItems();
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return num_busy_workers_ == 0; });
+    body_ = nullptr;
+    error = error_;
+    error_ = nullptr;
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+void ThreadPool::WorkerLoop() {
+  uint64_t last_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_cv_.wait(lock, [this, last_generation]() {
+        return stop_ || generation_ != last_generation;
+      });
+      if (stop_) return;
+      last_generation = generation_;
+    }
+    RunItems();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--num_busy_workers_ == 0) done_cv_.notify_one();
+    }
+  }
+}
+
+void ThreadPool::RunItems() {
+  // body_ and num_items_ are only written while no loop is running, under
+  // mutex_, which every thread has acquired before getting here.
+  for (int i = next_item_++; i < num_items_; i = next_item_++) {
+    try {
+      (*body_)(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) error_ = std::current_exception();
+      // Skip the items that have not been claimed yet.
+      next_item_ = num_items_;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
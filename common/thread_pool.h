@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace internal {
+
+// A fixed set of worker threads that repeatedly run loops of independent
+// work items. The workers are created once and sleep between loops, so the
+// overhead per loop is small enough to parallelize work that is repeated many
+// times per simulation step, e.g. the evaluation of a Diagram's subsystems.
+class ThreadPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadPool)
+
+  // Creates a pool that runs loops on @p num_threads threads, which include
+  // the thread that calls ParallelFor(). That is, num_threads - 1 worker
+  // threads are started.
+  // @throws std::exception if num_threads is less than one.
+  explicit ThreadPool(int num_threads);
+
+  // Stops and joins the worker threads.
+  ~ThreadPool();
+
+  int num_threads() const { return static_cast<int>(workers_.size()) + 1; }
+
+  // Calls @p body(i) for each i in [0, n) and blocks until all calls have
+  // returned. The calls are spread dynamically over the threads of this pool,
+  // with the calling thread participating, so they may run concurrently and
+  // in any order. If any call throws, the items that have not been started
+  // are skipped and the first exception is rethrown once all running calls
+  // have returned. Concurrent calls to ParallelFor() on the same pool are
+  // serialized; @p body must not call ParallelFor() on the same pool.
+  void ParallelFor(int n, const std::function<void(int)>& body);
+
+ private:
+  // The loop run by each worker thread.
+  void WorkerLoop();
+
+  // Claims and runs items of the current loop until none are left.
+  void RunItems();
+
+  std::vector<std::thread> workers_;
+
+  // Serializes calls to ParallelFor().
+  std::mutex loop_mutex_;
+
+  // Guards the members below, except for next_item_.
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  // The current loop. Bumping generation_ tells the workers to run it.
+  const std::function<void(int)>* body_{nullptr};
+  int num_items_{0};
+  uint64_t generation_{0};
+  // The number of workers that have not yet finished the current loop.
+  int num_busy_workers_{0};
+  std::exception_ptr error_;
+  bool stop_{false};
+
+  // The index of the next unclaimed item of the current loop.
+  std::atomic<int> next_item_{0};
+};
+
+}  // namespace internal
+}  // namespace drake
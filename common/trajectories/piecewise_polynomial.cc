@@ -115,6 +115,36 @@ MatrixX<T>
 PiecewisePolynomial<T>::value(double t) const {
   int segment_index = this->get_segment_index(t);
   t = std::min(std::max(t, this->start_time()), this->end_time());
+  return SegmentValue(segment_index, t);
+}
+
+template <typename T>
+std::vector<MatrixX<T>> PiecewisePolynomial<T>::value(
+    const std::vector<double>& times) const {
+  DRAKE_THROW_UNLESS(std::is_sorted(times.begin(), times.end()));
+  std::vector<MatrixX<T>> values;
+  values.reserve(times.size());
+  if (times.empty()) return values;
+
+  const std::vector<double>& breaks = this->breaks();
+  const int num_segments = this->get_number_of_segments();
+  int segment_index = this->get_segment_index(times.front());
+  for (double t : times) {
+    t = std::min(std::max(t, this->start_time()), this->end_time());
+    // Advance to the last segment that starts at or before t; this matches
+    // the segment chosen by get_segment_index().
+    while (segment_index < num_segments - 1 &&
+           breaks[segment_index + 1] <= t) {
+      ++segment_index;
+    }
+    values.push_back(SegmentValue(segment_index, t));
+  }
+  return values;
+}
+
+template <typename T>
+MatrixX<T> PiecewisePolynomial<T>::SegmentValue(int segment_index,
+                                                double t) const {
   Eigen::Matrix<double, PolynomialMatrix::RowsAtCompileTime,
                 PolynomialMatrix::ColsAtCompileTime>
       ret(rows(), cols());
@@ -370,6 +370,19 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
    */
   MatrixX<T> value(double t) const override;
 
+  /**
+   * Evaluates the PiecewisePolynomial at each of the given \p times. Because
+   * the times must be sorted, all of them are evaluated in a single linear
+   * sweep over the segments, rather than with a segment search per time.
+   *
+   * @param times The non-decreasing times at which to evaluate the
+   * PiecewisePolynomial. Times outside [start_time(), end_time()] are clamped,
+   * as with value(double).
+   * @return The matrices of evaluated values, one per entry of \p times.
+   * @throws std::exception if \p times is not sorted in non-decreasing order.
+   */
+  std::vector<MatrixX<T>> value(const std::vector<double>& times) const;
+
   const PolynomialMatrix& getPolynomialMatrix(int segment_index) const;
 
   const PolynomialType& getPolynomial(int segment_index, Eigen::Index row = 0,
@@ -458,6 +471,10 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
   double segmentValueAtGlobalAbscissa(int segment_index, double t,
                                       Eigen::Index row, Eigen::Index col) const;
 
+  // Evaluates the polynomial matrix of the given segment at the (already
+  // clamped) time `t`.
+  MatrixX<T> SegmentValue(int segment_index, double t) const;
+
   static constexpr T kSlopeEpsilon = 1e-10;
 
   // a PolynomialMatrix for each piece (segment)
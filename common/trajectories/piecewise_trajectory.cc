@@ -78,12 +78,34 @@ int PiecewiseTrajectory<T>::GetSegmentIndexRecursive(double time, int start,
     return mid;
 }
 
+template <typename T>
+bool PiecewiseTrajectory<T>::SegmentContains(int segment_index,
+                                             double t) const {
+  const int num_segments = get_number_of_segments();
+  if (segment_index < 0 || segment_index >= num_segments) return false;
+  return breaks_[segment_index] <= t &&
+         (segment_index == num_segments - 1 || t < breaks_[segment_index + 1]);
+}
+
 template <typename T>
 int PiecewiseTrajectory<T>::get_segment_index(double t) const {
   if (breaks_.empty()) return 0;
   // clip to min/max times
   t = std::min(std::max(t, start_time()), end_time());
-  return GetSegmentIndexRecursive(t, 0, static_cast<int>(breaks_.size() - 1));
+
+  // Try the previously found segment and its neighbors before searching.
+  const int hint = segment_index_hint_.load();
+  for (const int candidate : {hint, hint + 1, hint - 1}) {
+    if (SegmentContains(candidate, t)) {
+      segment_index_hint_.store(candidate);
+      return candidate;
+    }
+  }
+
+  const int segment_index =
+      GetSegmentIndexRecursive(t, 0, static_cast<int>(breaks_.size() - 1));
+  segment_index_hint_.store(segment_index);
+  return segment_index;
 }
 
 template <typename T>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <random>
 #include <vector>
@@ -45,6 +46,16 @@ class PiecewiseTrajectory : public Trajectory<T> {
    */
   bool is_time_in_range(double t) const;
 
+  /**
+   * Returns the index of the segment containing time `t`, after clamping `t`
+   * to [start_time(), end_time()]. A time that coincides with an interior
+   * break belongs to the segment that starts there.
+   *
+   * The index found by the previous call is remembered; when `t` lies in that
+   * segment or one of its immediate neighbors (as is the case for
+   * monotonically advancing queries) the lookup is O(1). Otherwise it falls
+   * back to a binary search over the breaks.
+   */
   int get_segment_index(double t) const;
 
   const std::vector<double>& get_segment_times() const;
@@ -72,7 +83,33 @@ class PiecewiseTrajectory : public Trajectory<T> {
  private:
   int GetSegmentIndexRecursive(double time, int start, int end) const;
 
+  // Returns true iff `segment_index` is a valid segment index and (the already
+  // clamped) `t` lies in that segment, as defined by get_segment_index().
+  bool SegmentContains(int segment_index, double t) const;
+
+  // A copyable atomic integer, so that the segment index hint can be updated
+  // by concurrent (const) queries without breaking the default copy and move
+  // semantics of this class.
+  class SegmentIndexHint {
+   public:
+    SegmentIndexHint() = default;
+    SegmentIndexHint(const SegmentIndexHint& other) : value_(other.load()) {}
+    SegmentIndexHint& operator=(const SegmentIndexHint& other) {
+      store(other.load());
+      return *this;
+    }
+    int load() const { return value_.load(std::memory_order_relaxed); }
+    void store(int value) { value_.store(value, std::memory_order_relaxed); }
+
+   private:
+    std::atomic<int> value_{0};
+  };
+
   std::vector<double> breaks_;
+
+  // The segment index most recently returned by get_segment_index(). It is
+  // only a hint; it is validated against breaks_ before being used.
+  mutable SegmentIndexHint segment_index_hint_;
 };
 
 }  // namespace trajectories
@@ -1,5 +1,6 @@
 #include "drake/common/trajectories/piecewise_polynomial.h"
 
+#include <algorithm>
 #include <random>
 #include <vector>
 
@@ -240,6 +241,35 @@ GTEST_TEST(testPiecewisePolynomial, CubicSplinePeriodicBoundaryConditionTest) {
   EXPECT_TRUE(ddt_diff.template lpNorm<Eigen::Infinity>() < 1e-14);
 }
 
+// Checks that evaluating a sorted vector of times gives the same values as
+// evaluating each time individually, including times at the breaks and
+// outside of the trajectory's time range.
+GTEST_TEST(testPiecewisePolynomial, BatchValue) {
+  default_random_engine generator;
+  const vector<double> segment_times =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(20, generator);
+  const PiecewisePolynomial<double> piecewise =
+      test::MakeRandomPiecewisePolynomial<double>(2, 3, 4, segment_times);
+
+  vector<double> times(segment_times);
+  uniform_real_distribution<double> uniform(piecewise.start_time() - 0.5,
+                                            piecewise.end_time() + 0.5);
+  for (int i = 0; i < 200; ++i) {
+    times.push_back(uniform(generator));
+  }
+  std::sort(times.begin(), times.end());
+
+  const vector<Eigen::MatrixXd> values = piecewise.value(times);
+  ASSERT_EQ(values.size(), times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    EXPECT_TRUE(CompareMatrices(values[i], piecewise.value(times[i]), 0,
+                                MatrixCompareType::absolute));
+  }
+
+  EXPECT_TRUE(piecewise.value(vector<double>()).empty());
+  EXPECT_THROW(piecewise.value(vector<double>{1.0, 0.5}), std::exception);
+}
+
 GTEST_TEST(testPiecewisePolynomial, AllTests
 ) {
 testIntegralAndDerivative<double>();
@@ -1,6 +1,8 @@
 #include "drake/common/trajectories/piecewise_trajectory.h"
 
+#include <algorithm>
 #include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -94,6 +96,45 @@ GTEST_TEST(PiecewiseTrajectoryTest, RandomizedGetIndexTest) {
   TestPiecewiseTrajectoryTimeRelatedGetters(traj, time);
 }
 
+// Queries the segment index in monotonically increasing, decreasing and
+// random order (exercising both the cached segment hint and the search
+// fallback) and compares with a reference lookup.
+GTEST_TEST(PiecewiseTrajectoryTest, GetIndexOrderIndependenceTest) {
+  std::default_random_engine generator(456);
+  const std::vector<double> time =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(50, generator);
+  const PiecewiseTrajectoryTester traj(time);
+
+  auto expected_index = [&time](double t) {
+    const auto it = std::upper_bound(time.begin(), time.end() - 1, t);
+    return std::max(static_cast<int>(it - time.begin()) - 1, 0);
+  };
+
+  std::vector<double> samples(time);
+  std::uniform_real_distribution<double> uniform(time.front() - 0.1,
+                                                 time.back() + 0.1);
+  for (int i = 0; i < 1000; ++i) {
+    samples.push_back(uniform(generator));
+  }
+
+  // Random order.
+  for (double t : samples) {
+    EXPECT_EQ(traj.get_segment_index(t), expected_index(t));
+  }
+
+  // Increasing order.
+  std::sort(samples.begin(), samples.end());
+  for (double t : samples) {
+    EXPECT_EQ(traj.get_segment_index(t), expected_index(t));
+  }
+
+  // Decreasing order, on a copy (which also copies the hint).
+  const PiecewiseTrajectoryTester copy(traj);
+  for (auto it = samples.rbegin(); it != samples.rend(); ++it) {
+    EXPECT_EQ(copy.get_segment_index(*it), expected_index(*it));
+  }
+}
+
 GTEST_TEST(PiecewiseTrajectoryTest, GetIndexTest) {
   std::vector<double> time = {0, 1, 2, 3.5};
 
@@ -168,3 +168,5 @@ std::unique_ptr<systems::AffineSystem<double>> StabilizingLQRController(
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
     class ::drake::examples::quadrotor::QuadrotorPlant)
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS(
+    class ::drake::examples::quadrotor::QuadrotorPlant)
@@ -93,6 +93,11 @@ namespace scalar_conversion {
 template <>
 struct Traits<examples::quadrotor::QuadrotorPlant> : public NonSymbolicTraits {
 };
+// The QuadrotorPlant's 12 states and 4 inputs are linearized (e.g., for LQR)
+// with fixed-size autodiff scalars.
+template <>
+struct FixedSizeAutoDiffTraits<examples::quadrotor::QuadrotorPlant>
+    : std::true_type {};
 }  // namespace scalar_conversion
 }  // namespace systems
 
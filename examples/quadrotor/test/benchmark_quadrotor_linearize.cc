@@ -0,0 +1,100 @@
+/// @file benchmark_quadrotor_linearize.cc
+///
+/// Compares the time taken to evaluate the time derivatives of the quadrotor,
+/// with respect to its 12 states and 4 inputs, using the fixed-size scalar
+/// AutoDiffd<16> and the dynamic-size scalar AutoDiffXd, and the time taken by
+/// Linearize() (which picks the fixed-size scalar).
+///
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/examples/quadrotor/quadrotor_plant.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/systems/primitives/linear_system.h"
+
+DEFINE_int32(num_evaluations, 10000, "Number of evaluations per measurement");
+
+namespace drake {
+namespace examples {
+namespace quadrotor {
+namespace {
+
+using common::test::MeasureExecutionTime;
+
+const int kNumStates = 12;
+const int kNumInputs = 4;
+
+// Evaluates the time derivatives of the quadrotor `plant` on the scalar T,
+// with respect to its states and inputs at `xu0`, FLAGS_num_evaluations
+// times, and returns their gradient.
+template <typename T>
+Eigen::MatrixXd EvalDerivatives(const systems::System<T>& plant,
+                                const Eigen::VectorXd& xu0,
+                                const std::string& name) {
+  VectorX<T> xu(xu0.size());
+  math::initializeAutoDiff(xu0, xu);
+
+  auto context = plant.CreateDefaultContext();
+  auto derivatives = plant.AllocateTimeDerivatives();
+  const double time = MeasureExecutionTime([&]() {
+    for (int i = 0; i < FLAGS_num_evaluations; ++i) {
+      context->get_mutable_continuous_state_vector().SetFromVector(
+          xu.head(kNumStates));
+      context->FixInputPort(0, xu.tail(kNumInputs));
+      plant.CalcTimeDerivatives(*context, derivatives.get());
+    }
+  });
+  std::cout << "  " << name << ": "
+            << time / FLAGS_num_evaluations * 1e6 << " us" << std::endl;
+  return math::autoDiffToGradientMatrix(derivatives->CopyToVector(),
+                                        kNumStates + kNumInputs);
+}
+
+int do_main() {
+  const QuadrotorPlant<double> plant;
+  // The hovering fixed point.
+  const double hover_input = plant.m() * plant.g() / kNumInputs;
+  Eigen::VectorXd xu0 = Eigen::VectorXd::Zero(kNumStates + kNumInputs);
+  xu0.tail(kNumInputs).setConstant(hover_input);
+
+  std::cout << "CalcTimeDerivatives with derivatives:\n";
+  const auto plant_ad16 =
+      plant.get_system_scalar_converter().Convert<AutoDiffd<16>, double>(
+          plant);
+  const Eigen::MatrixXd gradient_ad16 =
+      EvalDerivatives(*plant_ad16, xu0, "AutoDiffd<16>");
+  const auto plant_adxd = plant.ToAutoDiffXd();
+  const Eigen::MatrixXd gradient_adxd =
+      EvalDerivatives(*plant_adxd, xu0, "AutoDiffXd");
+
+  auto context = plant.CreateDefaultContext();
+  context->FixInputPort(0, xu0.tail(kNumInputs));
+  std::unique_ptr<systems::LinearSystem<double>> linearized;
+  const double time = MeasureExecutionTime([&]() {
+    for (int i = 0; i < FLAGS_num_evaluations; ++i) {
+      linearized = systems::Linearize(plant, *context);
+    }
+  });
+  std::cout << "Linearize: " << time / FLAGS_num_evaluations * 1e6 << " us"
+            << std::endl;
+
+  std::cout << "Max |difference| "
+            << (gradient_ad16 - gradient_adxd).cwiseAbs().maxCoeff()
+            << std::endl;
+  return 0;
+}
+
+}  // namespace
+}  // namespace quadrotor
+}  // namespace examples
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::examples::quadrotor::do_main();
+}
@@ -0,0 +1,601 @@
+#include "drake/geometry/dev/render/render_engine_cpu.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <tiny_obj_loader.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace geometry {
+namespace dev {
+namespace render {
+
+using Eigen::Isometry3d;
+using Eigen::Vector3d;
+using Eigen::Vector3i;
+using std::make_unique;
+using systems::sensors::ColorD;
+using systems::sensors::ColorI;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::InvalidDepth;
+
+namespace {
+
+const int kNumMaxLabel = 256;
+
+// These match RenderEngineVtk.
+const double kClippingPlaneNear = 0.01;
+const double kClippingPlaneFar = 100.;
+const double kTerrainSize = 100.;
+const int kResolution = 50;
+
+// The width and height of the square tiles that the image is split into for
+// rasterization, in pixels.
+const int kTileSize = 32;
+
+// A package of data required to register a visual geometry.
+struct RegistrationData {
+  const PerceptionProperties& properties;
+  const Isometry3<double>& X_FG;
+  // False for the flat terrain, which is rendered with its unshaded color.
+  bool shaded{true};
+};
+
+// The affine function w(x, y) = a x + b y + c that is zero on the directed
+// line from one point in the image to another, and whose sign tells on which
+// side of the line (x, y) lies.
+struct EdgeFunction {
+  EdgeFunction() = default;
+
+  // Computes the coefficients with a canonical order of the points. The edge
+  // that two triangles share then has exactly opposite functions in both, so
+  // no pixel center along it is missed by both triangles due to round-off.
+  EdgeFunction(double x0, double y0, double x1, double y1) {
+    const bool flip = std::tie(x1, y1) < std::tie(x0, y0);
+    if (flip) {
+      std::swap(x0, x1);
+      std::swap(y0, y1);
+    }
+    a = y0 - y1;
+    b = x1 - x0;
+    c = x0 * y1 - x1 * y0;
+    if (flip) {
+      a = -a;
+      b = -b;
+      c = -c;
+    }
+  }
+
+  double a{}, b{}, c{};
+};
+
+// A triangle in the image. The vertices are expressed in continuous pixel
+// coordinates (pixel (i, j) spans [i, i + 1] x [j, j + 1]), ordered so that
+// the signed area is positive, and carry their inverse depth 1 / z for
+// perspective-correct interpolation.
+struct ScreenTriangle {
+  std::array<double, 3> x;
+  std::array<double, 3> y;
+  std::array<double, 3> inv_z;
+  // The edge functions of the edges opposite each vertex, which are
+  // non-negative inside the triangle and sum to area2.
+  std::array<EdgeFunction, 3> edges;
+  // Twice the area of the triangle.
+  double area2{};
+  // The range of pixels whose centers may be covered (inclusive).
+  int x_min{}, x_max{}, y_min{}, y_max{};
+  int visual{};
+  float shade{};
+};
+
+// Clips the camera-frame triangle (a, b, c) against the near clipping plane,
+// projects the resulting polygon onto the image, and appends its (one or two)
+// triangles to `triangles`.
+void ClipAndProject(const Vector3d& a, const Vector3d& b, const Vector3d& c,
+                    double focal_length, int width, int height, int visual,
+                    float shade, std::vector<ScreenTriangle>* triangles) {
+  // Sutherland-Hodgman against the single plane z = kClippingPlaneNear.
+  const std::array<const Vector3d*, 3> input{{&a, &b, &c}};
+  std::array<Vector3d, 4> polygon;
+  int num_vertices = 0;
+  for (int i = 0; i < 3; ++i) {
+    const Vector3d& p = *input[i];
+    const Vector3d& q = *input[(i + 1) % 3];
+    const bool p_inside = p.z() >= kClippingPlaneNear;
+    const bool q_inside = q.z() >= kClippingPlaneNear;
+    if (p_inside) polygon[num_vertices++] = p;
+    if (p_inside != q_inside) {
+      const double t = (kClippingPlaneNear - p.z()) / (q.z() - p.z());
+      polygon[num_vertices++] = p + t * (q - p);
+    }
+  }
+  if (num_vertices < 3) return;
+
+  std::array<double, 4> x, y, inv_z;
+  for (int i = 0; i < num_vertices; ++i) {
+    inv_z[i] = 1.0 / polygon[i].z();
+    x[i] = focal_length * polygon[i].x() * inv_z[i] + 0.5 * width;
+    y[i] = focal_length * polygon[i].y() * inv_z[i] + 0.5 * height;
+  }
+  for (int i = 2; i < num_vertices; ++i) {
+    ScreenTriangle t;
+    t.x = {{x[0], x[i - 1], x[i]}};
+    t.y = {{y[0], y[i - 1], y[i]}};
+    t.inv_z = {{inv_z[0], inv_z[i - 1], inv_z[i]}};
+    t.area2 = (t.x[1] - t.x[0]) * (t.y[2] - t.y[0]) -
+              (t.y[1] - t.y[0]) * (t.x[2] - t.x[0]);
+    if (t.area2 == 0) continue;
+    if (t.area2 < 0) {
+      std::swap(t.x[1], t.x[2]);
+      std::swap(t.y[1], t.y[2]);
+      std::swap(t.inv_z[1], t.inv_z[2]);
+      t.area2 = -t.area2;
+    }
+    for (int k = 0; k < 3; ++k) {
+      const int a = (k + 1) % 3;
+      const int b = (k + 2) % 3;
+      t.edges[k] = EdgeFunction(t.x[a], t.y[a], t.x[b], t.y[b]);
+    }
+    // Pixel i is covered if its center i + 0.5 is.
+    const auto x_range = std::minmax({t.x[0], t.x[1], t.x[2]});
+    const auto y_range = std::minmax({t.y[0], t.y[1], t.y[2]});
+    t.x_min = std::max(0, static_cast<int>(std::ceil(x_range.first - 0.5)));
+    t.x_max = std::min(width - 1,
+                       static_cast<int>(std::floor(x_range.second - 0.5)));
+    t.y_min = std::max(0, static_cast<int>(std::ceil(y_range.first - 0.5)));
+    t.y_max = std::min(height - 1,
+                       static_cast<int>(std::floor(y_range.second - 0.5)));
+    if (t.x_min > t.x_max || t.y_min > t.y_max) continue;
+    t.visual = visual;
+    t.shade = shade;
+    triangles->push_back(t);
+  }
+}
+
+ColorI ToColorI(const Eigen::Vector4d& rgba) {
+  auto channel = [](double value) {
+    return static_cast<int>(
+        std::lround(255 * std::max(0.0, std::min(1.0, value))));
+  };
+  return ColorI{channel(rgba(0)), channel(rgba(1)), channel(rgba(2))};
+}
+
+}  // namespace
+
+RenderEngineCpu::RenderEngineCpu(int num_threads)
+    : RenderEngineCpu(num_threads, nullptr) {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  if (num_threads > 1) {
+    thread_pool_ = std::make_shared<drake::internal::ThreadPool>(num_threads);
+  }
+}
+
+RenderEngineCpu::RenderEngineCpu(
+    int num_threads, std::shared_ptr<drake::internal::ThreadPool> thread_pool)
+    : color_palette_(kNumMaxLabel, RenderLabel::terrain_label(),
+                     RenderLabel::empty_label()),
+      num_threads_(num_threads),
+      thread_pool_(std::move(thread_pool)) {}
+
+std::unique_ptr<RenderEngine> RenderEngineCpu::Clone() const {
+  // NOTE: The clone shares the thread pool, whose loops are serialized.
+  std::unique_ptr<RenderEngineCpu> engine_clone(
+      new RenderEngineCpu(num_threads_, thread_pool_));
+  // NOTE: The clone shares the meshes, which are never modified.
+  engine_clone->visuals_ = visuals_;
+  engine_clone->X_WG_ = X_WG_;
+  engine_clone->X_WC_ = X_WC_;
+  return engine_clone;
+}
+
+void RenderEngineCpu::AddFlatTerrain() {
+  const ColorD terrain_color =
+      color_palette_.get_normalized_color(RenderLabel::terrain_label());
+  PerceptionProperties material;
+  material.AddGroup("label");
+  material.AddProperty("label", "id", RenderLabel::terrain_label());
+  material.AddGroup("phong");
+  material.AddProperty("phong", "diffuse",
+                       Eigen::Vector4d{terrain_color.r, terrain_color.g,
+                                       terrain_color.b, 1.0});
+  // Unlike RegisterVisual(), the terrain is not shaded.
+  const Isometry3<double> X_FG = Isometry3<double>::Identity();
+  RegistrationData data{material, X_FG, false};
+  HalfSpace().Reify(this, &data);
+}
+
+RenderIndex RenderEngineCpu::RegisterVisual(
+    const Shape& shape, const PerceptionProperties& properties,
+    const Isometry3<double>& X_FG) {
+  // Note: the user_data interface on reification requires a non-const pointer.
+  RegistrationData data{properties, X_FG};
+  shape.Reify(this, &data);
+  return RenderIndex(static_cast<int>(visuals_.size()) - 1);
+}
+
+optional<RenderIndex> RenderEngineCpu::RemoveVisual(RenderIndex index) {
+  DRAKE_DEMAND(index >= 0 && index < static_cast<int>(visuals_.size()));
+  optional<RenderIndex> moved_index{};
+  const RenderIndex last_index{static_cast<int>(visuals_.size()) - 1};
+  if (index < last_index) {
+    moved_index = last_index;
+    std::swap(visuals_[index], visuals_[last_index]);
+    std::swap(X_WG_[index], X_WG_[last_index]);
+  }
+  visuals_.pop_back();
+  X_WG_.pop_back();
+  return moved_index;
+}
+
+void RenderEngineCpu::UpdateVisualPose(const Eigen::Isometry3d& X_WG,
+                                       RenderIndex index) const {
+  X_WG_.at(index) = X_WG;
+}
+
+void RenderEngineCpu::UpdateViewpoint(const Eigen::Isometry3d& X_WR) const {
+  X_WC_ = X_WR;
+}
+
+void RenderEngineCpu::RenderColorImage(const CameraProperties& camera,
+                                       ImageRgba8U* color_image_out,
+                                       bool) const {
+  DRAKE_DEMAND(color_image_out != nullptr);
+  DRAKE_DEMAND(color_image_out->width() == camera.width &&
+               color_image_out->height() == camera.height);
+  FrameBuffer buffer;
+  Rasterize(camera, kClippingPlaneFar, &buffer);
+
+  const ColorI& sky = get_sky_color();
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      const int i = v * camera.width + u;
+      uint8_t* pixel = color_image_out->at(u, v);
+      if (buffer.visual[i] < 0) {
+        pixel[0] = sky.r;
+        pixel[1] = sky.g;
+        pixel[2] = sky.b;
+        pixel[3] = 0u;
+        continue;
+      }
+      const Visual& visual = visuals_[buffer.visual[i]];
+      const float shade = visual.shaded ? buffer.shade[i] : 1.f;
+      pixel[0] = static_cast<uint8_t>(std::lround(visual.color.r * shade));
+      pixel[1] = static_cast<uint8_t>(std::lround(visual.color.g * shade));
+      pixel[2] = static_cast<uint8_t>(std::lround(visual.color.b * shade));
+      pixel[3] = 255u;
+    }
+  }
+}
+
+void RenderEngineCpu::RenderDepthImage(const DepthCameraProperties& camera,
+                                       ImageDepth32F* depth_image_out) const {
+  DRAKE_DEMAND(depth_image_out != nullptr);
+  DRAKE_DEMAND(depth_image_out->width() == camera.width &&
+               depth_image_out->height() == camera.height);
+  FrameBuffer buffer;
+  Rasterize(camera, camera.z_far, &buffer);
+
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      const int i = v * camera.width + u;
+      float z = InvalidDepth::kTooFar;
+      if (buffer.visual[i] >= 0) {
+        z = buffer.depth[i] < camera.z_near ? InvalidDepth::kTooClose
+                                            : buffer.depth[i];
+      }
+      depth_image_out->at(u, v)[0] = z;
+    }
+  }
+}
+
+void RenderEngineCpu::RenderLabelImage(const CameraProperties& camera,
+                                       ImageLabel16I* label_image_out,
+                                       bool) const {
+  DRAKE_DEMAND(label_image_out != nullptr);
+  DRAKE_DEMAND(label_image_out->width() == camera.width &&
+               label_image_out->height() == camera.height);
+  FrameBuffer buffer;
+  Rasterize(camera, kClippingPlaneFar, &buffer);
+
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      const int i = v * camera.width + u;
+      label_image_out->at(u, v)[0] =
+          buffer.visual[i] < 0 ? RenderLabel::empty_label()
+                               : visuals_[buffer.visual[i]].label;
+    }
+  }
+}
+
+void RenderEngineCpu::ImplementGeometry(const Sphere& sphere,
+                                        void* user_data) {
+  // A UV sphere with kResolution slices around the z axis and kResolution
+  // stacks from pole to pole.
+  const double r = sphere.get_radius();
+  TriangleMesh mesh;
+  mesh.vertices.emplace_back(0, 0, r);
+  for (int j = 1; j < kResolution; ++j) {
+    const double phi = M_PI * j / kResolution;
+    for (int i = 0; i < kResolution; ++i) {
+      const double theta = 2 * M_PI * i / kResolution;
+      mesh.vertices.emplace_back(r * std::sin(phi) * std::cos(theta),
+                                 r * std::sin(phi) * std::sin(theta),
+                                 r * std::cos(phi));
+    }
+  }
+  mesh.vertices.emplace_back(0, 0, -r);
+  const int south = static_cast<int>(mesh.vertices.size()) - 1;
+  // The index of the i-th vertex of the j-th ring, j ∈ [1, kResolution).
+  auto ring = [](int j, int i) {
+    return 1 + (j - 1) * kResolution + (i % kResolution);
+  };
+  for (int i = 0; i < kResolution; ++i) {
+    mesh.triangles.emplace_back(0, ring(1, i), ring(1, i + 1));
+    for (int j = 1; j < kResolution - 1; ++j) {
+      mesh.triangles.emplace_back(ring(j, i), ring(j + 1, i),
+                                  ring(j + 1, i + 1));
+      mesh.triangles.emplace_back(ring(j, i), ring(j + 1, i + 1),
+                                  ring(j, i + 1));
+    }
+    mesh.triangles.emplace_back(south, ring(kResolution - 1, i + 1),
+                                ring(kResolution - 1, i));
+  }
+  AddVisual(std::move(mesh), user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Cylinder& cylinder,
+                                        void* user_data) {
+  // The cylinder is aligned with the z axis, with kResolution sides.
+  const double r = cylinder.get_radius();
+  const double half_length = cylinder.get_length() / 2;
+  TriangleMesh mesh;
+  mesh.vertices.emplace_back(0, 0, -half_length);
+  mesh.vertices.emplace_back(0, 0, half_length);
+  for (int i = 0; i < kResolution; ++i) {
+    const double theta = 2 * M_PI * i / kResolution;
+    mesh.vertices.emplace_back(r * std::cos(theta), r * std::sin(theta),
+                               -half_length);
+    mesh.vertices.emplace_back(r * std::cos(theta), r * std::sin(theta),
+                               half_length);
+  }
+  auto bottom = [](int i) { return 2 + 2 * (i % kResolution); };
+  auto top = [](int i) { return 3 + 2 * (i % kResolution); };
+  for (int i = 0; i < kResolution; ++i) {
+    mesh.triangles.emplace_back(0, bottom(i + 1), bottom(i));
+    mesh.triangles.emplace_back(1, top(i), top(i + 1));
+    mesh.triangles.emplace_back(bottom(i), bottom(i + 1), top(i + 1));
+    mesh.triangles.emplace_back(bottom(i), top(i + 1), top(i));
+  }
+  AddVisual(std::move(mesh), user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const HalfSpace&, void* user_data) {
+  // Like RenderEngineVtk, the half space is represented by a large square
+  // patch of its boundary plane.
+  const double half_size = kTerrainSize / 2;
+  TriangleMesh mesh;
+  mesh.vertices = {Vector3d(-half_size, -half_size, 0),
+                   Vector3d(half_size, -half_size, 0),
+                   Vector3d(half_size, half_size, 0),
+                   Vector3d(-half_size, half_size, 0)};
+  mesh.triangles = {Vector3i(0, 1, 2), Vector3i(0, 2, 3)};
+  AddVisual(std::move(mesh), user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Box& box, void* user_data) {
+  const Vector3d half_size = box.size() / 2;
+  TriangleMesh mesh;
+  for (int i = 0; i < 8; ++i) {
+    mesh.vertices.emplace_back((i & 1 ? 1 : -1) * half_size.x(),
+                               (i & 2 ? 1 : -1) * half_size.y(),
+                               (i & 4 ? 1 : -1) * half_size.z());
+  }
+  mesh.triangles = {// -x and +x.
+                    Vector3i(0, 4, 6), Vector3i(0, 6, 2), Vector3i(1, 3, 7),
+                    Vector3i(1, 7, 5),
+                    // -y and +y.
+                    Vector3i(0, 1, 5), Vector3i(0, 5, 4), Vector3i(2, 6, 7),
+                    Vector3i(2, 7, 3),
+                    // -z and +z.
+                    Vector3i(0, 2, 3), Vector3i(0, 3, 1), Vector3i(4, 5, 7),
+                    Vector3i(4, 7, 6)};
+  AddVisual(std::move(mesh), user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Mesh& mesh, void* user_data) {
+  ImplementObj(mesh.filename(), mesh.scale(), user_data);
+}
+
+void RenderEngineCpu::ImplementGeometry(const Convex& convex, void* user_data) {
+  ImplementObj(convex.filename(), convex.scale(), user_data);
+}
+
+const ColorI& RenderEngineCpu::get_sky_color() const {
+  return color_palette_.get_sky_color();
+}
+
+const ColorI& RenderEngineCpu::get_flat_terrain_color() const {
+  return color_palette_.get_terrain_color();
+}
+
+void RenderEngineCpu::ImplementObj(const std::string& file_name, double scale,
+                                   void* user_data) {
+  tinyobj::attrib_t attrib;
+  std::vector<tinyobj::shape_t> shapes;
+  std::vector<tinyobj::material_t> materials;
+  std::string err;
+  // Polygonal faces are triangulated by tinyobj.
+  const bool do_tinyobj_triangulation = true;
+  const char* mtl_basedir = nullptr;
+  const bool ret =
+      tinyobj::LoadObj(&attrib, &shapes, &materials, &err, file_name.c_str(),
+                       mtl_basedir, do_tinyobj_triangulation);
+  if (!ret || !err.empty()) {
+    throw std::runtime_error("Error parsing file '" + file_name + "' : " +
+                             err);
+  }
+
+  TriangleMesh mesh;
+  DRAKE_DEMAND(attrib.vertices.size() % 3 == 0);
+  mesh.vertices.reserve(attrib.vertices.size() / 3);
+  for (size_t i = 0; i < attrib.vertices.size(); i += 3) {
+    mesh.vertices.emplace_back(scale * attrib.vertices[i],
+                               scale * attrib.vertices[i + 1],
+                               scale * attrib.vertices[i + 2]);
+  }
+  for (const tinyobj::shape_t& shape : shapes) {
+    const std::vector<tinyobj::index_t>& indices = shape.mesh.indices;
+    DRAKE_DEMAND(indices.size() % 3 == 0);
+    for (size_t i = 0; i < indices.size(); i += 3) {
+      mesh.triangles.emplace_back(indices[i].vertex_index,
+                                  indices[i + 1].vertex_index,
+                                  indices[i + 2].vertex_index);
+    }
+  }
+  AddVisual(std::move(mesh), user_data);
+}
+
+void RenderEngineCpu::AddVisual(TriangleMesh mesh, void* user_data) {
+  DRAKE_DEMAND(user_data != nullptr);
+  const RegistrationData& data =
+      *static_cast<RegistrationData*>(user_data);
+
+  Visual visual;
+  visual.mesh = std::make_shared<const TriangleMesh>(std::move(mesh));
+  visual.label = data.properties.GetPropertyOrDefault(
+      "label", "id", RenderLabel::terrain_label());
+  // Like RenderEngineVtk, the default is an obnoxious orange to help flag
+  // un-defined values.
+  const Eigen::Vector4d default_diffuse(0.9, 0.45, 0.1, 1.0);
+  visual.color = ToColorI(data.properties.GetPropertyOrDefault(
+      "phong", "diffuse", default_diffuse));
+  visual.shaded = data.shaded;
+  visuals_.push_back(std::move(visual));
+  // For anchored geometry, X_FG is X_WG. For all other geometries, it is
+  // supplanted by the pose update.
+  X_WG_.push_back(data.X_FG);
+}
+
+void RenderEngineCpu::ParallelFor(
+    int n, const std::function<void(int)>& body) const {
+  if (thread_pool_) {
+    thread_pool_->ParallelFor(n, body);
+  } else {
+    for (int i = 0; i < n; ++i) {
+      body(i);
+    }
+  }
+}
+
+void RenderEngineCpu::Rasterize(const CameraProperties& camera, double z_far,
+                                FrameBuffer* buffer) const {
+  const int width = camera.width;
+  const int height = camera.height;
+  const double focal_length = 0.5 * height / std::tan(0.5 * camera.fov_y);
+
+  // Transforms, clips and projects the triangles of each visual.
+  const Isometry3d X_CW = X_WC_.inverse();
+  const int num_visuals = static_cast<int>(visuals_.size());
+  std::vector<std::vector<ScreenTriangle>> visual_triangles(num_visuals);
+  ParallelFor(num_visuals, [&](int v) {
+    const TriangleMesh& mesh = *visuals_[v].mesh;
+    const Isometry3d X_CG = X_CW * X_WG_[v];
+    std::vector<Vector3d> p_CVs(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+      p_CVs[i] = X_CG * mesh.vertices[i];
+    }
+    for (const Vector3i& triangle : mesh.triangles) {
+      const Vector3d& a = p_CVs[triangle(0)];
+      const Vector3d& b = p_CVs[triangle(1)];
+      const Vector3d& c = p_CVs[triangle(2)];
+      if (std::max({a.z(), b.z(), c.z()}) < kClippingPlaneNear ||
+          std::min({a.z(), b.z(), c.z()}) > z_far) {
+        continue;
+      }
+      const Vector3d normal = (b - a).cross(c - a);
+      const double norm = normal.norm();
+      if (norm == 0) continue;
+      // The cosine of the angle to the view direction (+Cz) of the camera's
+      // headlight; two-sided.
+      const float shade = static_cast<float>(std::abs(normal.z()) / norm);
+      ClipAndProject(a, b, c, focal_length, width, height, v, shade,
+                     &visual_triangles[v]);
+    }
+  });
+
+  // Bins the triangles into tiles, in order.
+  const int num_tiles_x = (width + kTileSize - 1) / kTileSize;
+  const int num_tiles_y = (height + kTileSize - 1) / kTileSize;
+  std::vector<std::vector<const ScreenTriangle*>> tiles(num_tiles_x *
+                                                        num_tiles_y);
+  for (const auto& triangles : visual_triangles) {
+    for (const ScreenTriangle& t : triangles) {
+      for (int ty = t.y_min / kTileSize; ty <= t.y_max / kTileSize; ++ty) {
+        for (int tx = t.x_min / kTileSize; tx <= t.x_max / kTileSize; ++tx) {
+          tiles[ty * num_tiles_x + tx].push_back(&t);
+        }
+      }
+    }
+  }
+
+  buffer->depth.assign(width * height, std::numeric_limits<float>::infinity());
+  buffer->visual.assign(width * height, -1);
+  buffer->shade.assign(width * height, 0.f);
+
+  // Each tile writes its own pixels only, so tiles are rasterized
+  // concurrently. Within a tile, the triangles are visited in order and only a
+  // strictly closer fragment replaces a pixel, so the result is deterministic.
+  ParallelFor(static_cast<int>(tiles.size()), [&](int tile) {
+    const int tile_x_min = (tile % num_tiles_x) * kTileSize;
+    const int tile_y_min = (tile / num_tiles_x) * kTileSize;
+    const int tile_x_max = std::min(width, tile_x_min + kTileSize) - 1;
+    const int tile_y_max = std::min(height, tile_y_min + kTileSize) - 1;
+    for (const ScreenTriangle* triangle : tiles[tile]) {
+      const ScreenTriangle& t = *triangle;
+      const int x_min = std::max(t.x_min, tile_x_min);
+      const int x_max = std::min(t.x_max, tile_x_max);
+      const int y_min = std::max(t.y_min, tile_y_min);
+      const int y_max = std::min(t.y_max, tile_y_max);
+      for (int y = y_min; y <= y_max; ++y) {
+        const double py = y + 0.5;
+        std::array<double, 3> w_row;
+        for (int k = 0; k < 3; ++k) {
+          w_row[k] = t.edges[k].b * py + t.edges[k].c;
+        }
+        for (int x = x_min; x <= x_max; ++x) {
+          const double px = x + 0.5;
+          const double w0 = t.edges[0].a * px + w_row[0];
+          const double w1 = t.edges[1].a * px + w_row[1];
+          const double w2 = t.edges[2].a * px + w_row[2];
+          if (w0 >= 0 && w1 >= 0 && w2 >= 0) {
+            const double inv_z =
+                (w0 * t.inv_z[0] + w1 * t.inv_z[1] + w2 * t.inv_z[2]) /
+                t.area2;
+            const double z = 1.0 / inv_z;
+            const int i = y * width + x;
+            if (z <= z_far && z < buffer->depth[i]) {
+              buffer->depth[i] = static_cast<float>(z);
+              buffer->visual[i] = t.visual;
+              buffer->shade[i] = t.shade;
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
+}  // namespace render
+}  // namespace dev
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/thread_pool.h"
+#include "drake/geometry/dev/render/render_engine.h"
+#include "drake/geometry/dev/render/render_label.h"
+#include "drake/systems/sensors/color_palette.h"
+
+namespace drake {
+namespace geometry {
+namespace dev {
+namespace render {
+
+/** Implementation of the RenderEngine as a software rasterizer that runs
+ entirely on the CPU. It requires no OpenGL context, so it works the same on
+ headless machines as on workstations.
+
+ Every shape is tessellated into triangles when it is registered. Each
+ rendering projects the triangles with the camera's intrinsics, bins them into
+ square tiles of the image, and rasterizes the tiles (optionally on several
+ threads) with a z-buffer. The results are deterministic: they don't depend on
+ the number of threads, and triangles of equal depth are resolved by
+ registration order.
+
+ The images follow the same conventions as RenderEngineVtk's: geometry closer
+ than a fixed near clipping plane of 1 cm is clipped, color and label images
+ are clipped at 100 m, and depth images at the camera's `z_far`. Depth pixels
+ that see nothing, or geometry beyond `z_far`, report
+ systems::sensors::InvalidDepth::kTooFar, and those that see geometry closer
+ than `z_near` report systems::sensors::InvalidDepth::kTooClose. Pixels of the
+ color image that see nothing have the sky color with zero alpha.
+
+ Color images are flat shaded: each triangle has the diffuse color of its
+ geometry, scaled by the cosine of the angle between the triangle's normal and
+ the camera's view direction (i.e., a headlight). The flat terrain added by
+ AddFlatTerrain() is not shaded; every registered visual is, whatever its
+ label.
+
+ @anchor render_engine_cpu_properties
+ <h2>Geometry perception properties</h2>
+
+ RGB images
+ | Group name | Required | Property Name |  Property Type  | Property Description |
+ | :--------: | :------: | :-----------: | :-------------: | :------------------- |
+ |    phong   | no       | diffuse       | Eigen::Vector4d | The rgba value of the object surface |
+
+ Textures (`phong/diffuse_map`) are not supported; meshes are rendered with
+ their `diffuse` value.
+
+ Depth images - no specific properties required.
+
+ Label images
+ | Group name | Required | Property Name |  Property Type  | Property Description |
+ | :--------: | :------: | :-----------: | :-------------: | :------------------- |
+ |   label    | no       | id            | RenderLabel     | The label to render into the image |
+ If no label is provided, it uses the terrain label.
+ */
+class RenderEngineCpu final : public RenderEngine {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RenderEngineCpu);
+
+  /** Constructs an engine that renders each image on (at most)
+   @p num_threads threads.
+   @throws std::exception if `num_threads` is not positive.  */
+  explicit RenderEngineCpu(int num_threads = 1);
+
+  /** Inherits RenderEngine::Clone(). The clone renders on the threads of this
+   engine; images rendered concurrently by engines that share threads are
+   rendered one after the other.  */
+  std::unique_ptr<RenderEngine> Clone() const override;
+
+  /** Inherits RenderEngine::AddFlatTerrain().  */
+  void AddFlatTerrain() override;
+
+  /** Inherits RenderEngine::RegisterVisual().  */
+  RenderIndex RegisterVisual(const Shape& shape,
+                             const PerceptionProperties& properties,
+                             const Isometry3<double>& X_FG) override;
+
+  /** Inherits RenderEngine::RemoveVisual().  */
+  optional<RenderIndex> RemoveVisual(RenderIndex index) override;
+
+  /** Inherits RenderEngine::UpdateVisualPose().  */
+  void UpdateVisualPose(const Eigen::Isometry3d& X_WG,
+                        RenderIndex index) const override;
+
+  /** Inherits RenderEngine::UpdateViewpoint().  */
+  void UpdateViewpoint(const Eigen::Isometry3d& X_WR) const override;
+
+  /** Inherits RenderEngine::RenderColorImage(). The image must already have
+   the camera's size. There is no window to show; `show_window` is ignored. */
+  void RenderColorImage(const CameraProperties& camera,
+                        systems::sensors::ImageRgba8U* color_image_out,
+                        bool show_window) const override;
+
+  /** Inherits RenderEngine::RenderDepthImage(). The image must already have
+   the camera's size.  */
+  void RenderDepthImage(
+      const DepthCameraProperties& camera,
+      systems::sensors::ImageDepth32F* depth_image_out) const override;
+
+  /** Inherits RenderEngine::RenderLabelImage(). The image must already have
+   the camera's size. There is no window to show; `show_window` is ignored. */
+  void RenderLabelImage(const CameraProperties& camera,
+                        systems::sensors::ImageLabel16I* label_image_out,
+                        bool show_window) const override;
+
+  /** @name    Shape reification  */
+  //@{
+  void ImplementGeometry(const Sphere& sphere, void* user_data) override;
+  void ImplementGeometry(const Cylinder& cylinder, void* user_data) override;
+  void ImplementGeometry(const HalfSpace& half_space, void* user_data) override;
+  void ImplementGeometry(const Box& box, void* user_data) override;
+  void ImplementGeometry(const Mesh& mesh, void* user_data) override;
+  void ImplementGeometry(const Convex& convex, void* user_data) override;
+  //@}
+
+  /** Returns the number of threads each image is rendered on.  */
+  int num_threads() const { return num_threads_; }
+
+  /** Returns the sky's color in an RGB image. */
+  const systems::sensors::ColorI& get_sky_color() const;
+
+  /** Returns flat terrain's color in an RGB image. */
+  const systems::sensors::ColorI& get_flat_terrain_color() const;
+
+ private:
+  // A triangle mesh, expressed in the frame of its geometry.
+  struct TriangleMesh {
+    std::vector<Eigen::Vector3d> vertices;
+    std::vector<Eigen::Vector3i> triangles;
+  };
+
+  // A registered geometry. The mesh is shared among clones; by design, the
+  // geometry is not deformable.
+  struct Visual {
+    std::shared_ptr<const TriangleMesh> mesh;
+    RenderLabel label;
+    systems::sensors::ColorI color;
+    // False for the flat terrain, which is rendered with its unshaded color.
+    bool shaded{true};
+  };
+
+  // The per-pixel result of rasterizing the scene, in row-major order: the
+  // depth of the nearest surface, the index into visuals_ of its geometry (or
+  // -1 if the pixel sees nothing), and its shading factor in [0, 1].
+  struct FrameBuffer {
+    std::vector<float> depth;
+    std::vector<int> visual;
+    std::vector<float> shade;
+  };
+
+  // Loads the obj file for both mesh and convex shapes.
+  void ImplementObj(const std::string& file_name, double scale,
+                    void* user_data);
+
+  // Registers the visual with the given tessellation and the properties
+  // carried by the reification user data.
+  void AddVisual(TriangleMesh mesh, void* user_data);
+
+  // Constructs an engine on the given (possibly null) thread pool.
+  RenderEngineCpu(int num_threads,
+                  std::shared_ptr<drake::internal::ThreadPool> thread_pool);
+
+  // Calls `body(i)` for every i in [0, n), on the thread pool if there is one.
+  void ParallelFor(int n, const std::function<void(int)>& body) const;
+
+  // Rasterizes all visuals for the given camera, keeping the surfaces that lie
+  // within [near clipping plane, z_far].
+  void Rasterize(const CameraProperties& camera, double z_far,
+                 FrameBuffer* buffer) const;
+
+  const systems::sensors::ColorPalette<RenderLabel> color_palette_;
+  const int num_threads_{};
+  // Null when images are rendered on a single thread. Shared with the clones
+  // of this engine.
+  std::shared_ptr<drake::internal::ThreadPool> thread_pool_;
+
+  std::vector<Visual> visuals_;
+
+  // The poses of the visuals (indexed like visuals_) and of the camera, which
+  // RenderEngine updates through const methods.
+  mutable std::vector<Eigen::Isometry3d> X_WG_;
+  mutable Eigen::Isometry3d X_WC_{Eigen::Isometry3d::Identity()};
+};
+
+}  // namespace render
+}  // namespace dev
+}  // namespace geometry
+}  // namespace drake
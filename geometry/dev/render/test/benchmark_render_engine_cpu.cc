@@ -0,0 +1,114 @@
+/// @file benchmark_render_engine_cpu.cc
+///
+/// Reports the frame rate of RenderEngineCpu, in total and per thread, for an
+/// increasing number of threads. The scene is the flat terrain under a random
+/// scattering of spheres, boxes, and cylinders, seen from above at an angle.
+///
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/geometry/dev/render/render_engine_cpu.h"
+
+DEFINE_int32(num_geometries, 100, "Number of geometries in the scene");
+DEFINE_int32(num_frames, 20, "Number of frames rendered per measurement");
+DEFINE_int32(width, 640, "Image width, in pixels");
+DEFINE_int32(height, 480, "Image height, in pixels");
+
+namespace drake {
+namespace geometry {
+namespace dev {
+namespace render {
+namespace {
+
+using common::test::MeasureExecutionTime;
+using Eigen::AngleAxisd;
+using Eigen::Isometry3d;
+using Eigen::Translation3d;
+using Eigen::Vector3d;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+
+void PopulateScene(RenderEngineCpu* renderer) {
+  renderer->AddFlatTerrain();
+  std::mt19937 generator;
+  std::uniform_real_distribution<double> coordinate(-1.5, 1.5);
+  for (int i = 0; i < FLAGS_num_geometries; ++i) {
+    PerceptionProperties material;
+    material.AddGroup("label");
+    material.AddProperty("label", "id", RenderLabel::new_label());
+    material.AddGroup("phong");
+    material.AddProperty("phong", "diffuse",
+                         Eigen::Vector4d(0.2 + 0.1 * (i % 8), 0.5, 0.7, 1.0));
+    const Isometry3d X_WG{Translation3d(coordinate(generator),
+                                        coordinate(generator), 0.2)};
+    switch (i % 3) {
+      case 0:
+        renderer->RegisterVisual(Sphere(0.1), material, X_WG);
+        break;
+      case 1:
+        renderer->RegisterVisual(Box(0.2, 0.1, 0.15), material, X_WG);
+        break;
+      default:
+        renderer->RegisterVisual(Cylinder(0.05, 0.3), material, X_WG);
+    }
+  }
+  // Looking down at the scene from 3 m away, tilted by 30°.
+  renderer->UpdateViewpoint(Translation3d(0, -1.5, 2.6) *
+                            AngleAxisd(M_PI + M_PI / 6, Vector3d::UnitX()));
+}
+
+int do_main() {
+  const DepthCameraProperties camera(FLAGS_width, FLAGS_height, M_PI_4,
+                                     Fidelity::kLow, 0.1, 10.0);
+  ImageRgba8U color(camera.width, camera.height);
+  ImageDepth32F depth(camera.width, camera.height);
+  ImageLabel16I label(camera.width, camera.height);
+
+  std::cout << FLAGS_num_geometries << " geometries, " << camera.width << "x"
+            << camera.height << " images:" << std::endl;
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    RenderEngineCpu renderer(num_threads);
+    PopulateScene(&renderer);
+    auto report = [&](const char* name, double time) {
+      const double fps = FLAGS_num_frames / time;
+      std::cout << "  " << name << ", " << num_threads << " thread(s): " << fps
+                << " fps (" << fps / num_threads << " fps per thread)"
+                << std::endl;
+    };
+    report("depth", MeasureExecutionTime([&]() {
+             for (int i = 0; i < FLAGS_num_frames; ++i) {
+               renderer.RenderDepthImage(camera, &depth);
+             }
+           }));
+    report("label", MeasureExecutionTime([&]() {
+             for (int i = 0; i < FLAGS_num_frames; ++i) {
+               renderer.RenderLabelImage(camera, &label, false);
+             }
+           }));
+    report("color", MeasureExecutionTime([&]() {
+             for (int i = 0; i < FLAGS_num_frames; ++i) {
+               renderer.RenderColorImage(camera, &color, false);
+             }
+           }));
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace render
+}  // namespace dev
+}  // namespace geometry
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::geometry::dev::render::do_main();
+}
@@ -5,10 +5,10 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
-#include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
 #include "drake/geometry/geometry_roles.h"
@@ -341,6 +341,34 @@ const IllustrationProperties* GeometryState<T>::get_illustration_properties(
   return nullptr;
 }
 
+template <typename T>
+std::vector<SignedDistancePair<double>>
+GeometryState<T>::ComputeSignedDistancePairClosestPoints(
+    const std::vector<std::pair<GeometryId, GeometryId>>& pairs,
+    double max_distance, int num_threads) const {
+  using GeometryKey = typename internal::ProximityEngine<T>::GeometryKey;
+  auto get_key = [this](GeometryId id) {
+    const internal::InternalGeometry* geometry = GetGeometry(id);
+    if (geometry == nullptr) {
+      throw std::logic_error("Can't compute the signed distance to geometry " +
+                             to_string(id) + "; it is not a valid geometry");
+    }
+    if (!geometry->has_proximity_role()) {
+      throw std::logic_error("Can't compute the signed distance to geometry " +
+                             to_string(id) +
+                             "; it does not have a proximity role");
+    }
+    return GeometryKey{geometry->proximity_index(), geometry->is_dynamic()};
+  };
+  std::vector<std::pair<GeometryKey, GeometryKey>> keys;
+  keys.reserve(pairs.size());
+  for (const auto& pair : pairs) {
+    keys.emplace_back(get_key(pair.first), get_key(pair.second));
+  }
+  return geometry_engine_->ComputeSignedDistancePairClosestPoints(
+      keys, geometry_index_to_id_map_, max_distance, num_threads);
+}
+
 template <typename T>
 bool GeometryState<T>::CollisionFiltered(GeometryId id1, GeometryId id2) const {
   std::string base_message =
@@ -615,44 +643,10 @@ bool GeometryState<T>::IsValidGeometryName(
   return NameIsUnique(frame_id, role, name);
 }
 
-namespace {
-// Small class for identifying mesh geometries.
-class MeshIdentifier final : public ShapeReifier {
- public:
-  bool is_mesh() const { return is_mesh_; }
-
-  // Implementation of ShapeReifier interface.
-  void ImplementGeometry(const Sphere&, void*) final {}
-  void ImplementGeometry(const Cylinder&, void*) final {}
-  void ImplementGeometry(const HalfSpace&, void*) final {}
-  void ImplementGeometry(const Box&, void*) final {}
-  void ImplementGeometry(const Mesh& mesh, void*) final {
-    is_mesh_ = true;
-    drake::log()->warn("Meshes are _not_ supported for proximity: ({})",
-                       mesh.filename());
-  }
-  void ImplementGeometry(const Convex&, void*) final {}
-
- private:
-  bool is_mesh_{false};
-};
-}  // namespace
-
 template <typename T>
 void GeometryState<T>::AssignRole(SourceId source_id,
                                   GeometryId geometry_id,
                                   ProximityProperties properties) {
-  // TODO(SeanCurtis-TRI): When meshes are supported for proximity roles, remove
-  // this test and the MeshIdentifier class.
-  {
-    const InternalGeometry* g = GetGeometry(geometry_id);
-    if (g) {
-      MeshIdentifier identifier;
-      g->shape().Reify(&identifier);
-      if (identifier.is_mesh()) return;
-    }
-  }
-
   AssignRoleInternal(source_id, geometry_id, std::move(properties),
                      Role::kProximity);
 
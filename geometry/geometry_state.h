@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -432,9 +433,10 @@ class GeometryState {
    * objects.
    */
   std::vector<SignedDistancePair<double>>
-  ComputeSignedDistancePairwiseClosestPoints() const {
+  ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance = std::numeric_limits<double>::infinity()) const {
     return geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
-        geometry_index_to_id_map_);
+        geometry_index_to_id_map_, max_distance);
   }
 
   /** Performs work in support of QueryObject::ComputeSignedDistanceToPoint().
@@ -446,6 +448,22 @@ class GeometryState {
     return geometry_engine_->ComputeSignedDistanceToPoint(
         p_WQ, geometry_index_to_id_map_, threshold);
   }
+
+  /** Performs work in support of QueryObject::ComputeSignedDistanceToPoints().
+   */
+  std::vector<std::vector<SignedDistanceToPoint<double>>>
+  ComputeSignedDistanceToPoints(const std::vector<Vector3<double>>& p_WQs,
+                                double threshold, int num_threads) const {
+    return geometry_engine_->ComputeSignedDistanceToPoints(
+        p_WQs, geometry_index_to_id_map_, threshold, num_threads);
+  }
+
+  /** Performs work in support of
+   QueryObject::ComputeSignedDistancePairClosestPoints().  */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairClosestPoints(
+      const std::vector<std::pair<GeometryId, GeometryId>>& pairs,
+      double max_distance, int num_threads) const;
   //@}
 
   /** @name Scalar conversion  */
@@ -5,7 +5,11 @@
 #include <cmath>
 #include <cstdint>
 #include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
@@ -19,8 +23,11 @@
 #include <tiny_obj_loader.h>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/drake_variant.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/sorted_vectors_have_intersection.h"
+#include "drake/common/thread_pool.h"
 #include "drake/geometry/utilities.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
@@ -224,6 +231,9 @@ struct DistanceData {
   // Distance request
   fcl::DistanceRequestd request;
 
+  // Pairs farther apart than this distance are not reported.
+  double max_distance{std::numeric_limits<double>::infinity()};
+
   // Vectors of distance results
   std::vector<SignedDistancePair<double>>* nearest_pairs{};
 };
@@ -512,20 +522,24 @@ void ComputeNarrowPhaseDistance(const fcl::CollisionObjectd* a,
   }
 }
 
-// The callback function in fcl::distance request. The final unnamed parameter
-// is `dist`, which is used in fcl::distance, that if the distance between two
+// The callback function in fcl::distance request. The final parameter is
+// `dist`, which is used in fcl::distance, that if the distance between two
 // geometries is proved to be greater than `dist` (for example, the smallest
 // distance between the bounding boxes containing object A and object B is
-// greater than `dist`), then fcl::distance will skip this callback. In our
-// case, as we want to compute the distance between any pair of geometries, we
-// leave `dist` unchanged as its default value (max_double). So the last
-// parameter is merely a placeholder, and not being used or updated in the
-// callback.
+// greater than `dist`), then fcl::distance will skip this callback. We want
+// every pair within the data's max_distance, so we set `dist` to it (rather
+// than to the smallest distance found so far); with the default max_distance
+// of infinity, every pair is reported. Bounding-box distances are never
+// negative, so a negative max_distance is clamped to zero for pruning;
+// otherwise, penetrating pairs would be pruned before their signed distance is
+// compared against it.
 bool DistanceCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
                       fcl::CollisionObjectd* fcl_object_B_ptr,
                       // NOLINTNEXTLINE
-                      void* callback_data, double&) {
+                      void* callback_data, double& dist) {
   auto& distance_data = *static_cast<DistanceData*>(callback_data);
+  const double pruning_distance = std::max(distance_data.max_distance, 0.0);
+  dist = pruning_distance;
   const std::vector<GeometryId>& geometry_map = distance_data.geometry_map;
   // We want to pass object_A and object_B to the narrowphase distance in a
   // specific order. This way the broadphase distance is free to give us
@@ -554,16 +568,22 @@ bool DistanceCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   const bool can_collide = distance_data.collision_filter.CanCollideWith(
       encoding_A.encoded_data(), encoding_B.encoded_data());
 
-  if (can_collide) {
+  // The broadphase only prunes pairs through their ancestors' bounding boxes,
+  // so two leaves may still reach here with bounding boxes that are too far
+  // apart. There is no need for the narrowphase in that case.
+  if (can_collide && fcl_object_A.getAABB().distance(fcl_object_B.getAABB()) <=
+                         pruning_distance) {
     fcl::DistanceResultd result;
     ComputeNarrowPhaseDistance(&fcl_object_A, &fcl_object_B, geometry_map,
                                distance_data.request, &result);
-    const Vector3d p_ACa =
-        fcl_object_A.getTransform().inverse() * result.nearest_points[0];
-    const Vector3d p_BCb =
-        fcl_object_B.getTransform().inverse() * result.nearest_points[1];
-    distance_data.nearest_pairs->emplace_back(id_A, id_B, p_ACa, p_BCb,
-                                              result.min_distance);
+    if (result.min_distance <= distance_data.max_distance) {
+      const Vector3d p_ACa =
+          fcl_object_A.getTransform().inverse() * result.nearest_points[0];
+      const Vector3d p_BCb =
+          fcl_object_B.getTransform().inverse() * result.nearest_points[1];
+      distance_data.nearest_pairs->emplace_back(id_A, id_B, p_ACa, p_BCb,
+                                                result.min_distance);
+    }
   }
 
   // Returning true would tell the broadphase manager to terminate early. Since
@@ -855,17 +875,6 @@ shared_ptr<fcl::ShapeBased> CopyShapeOrThrow(
       const auto& box = dynamic_cast<const fcl::Boxd&>(geometry);
       return make_shared<fcl::Boxd>(box.side);
     }
-    case fcl::GEOM_CONVEX: {
-      const auto& convex = dynamic_cast<const fcl::Convexd&>(geometry);
-      // TODO(DamrongGuoy): Change to the copy constructor Convex(other) when
-      //  we figure out why "Convex(const Convex& other) = default" created
-      //  link errors for Xenial Debug build.  For now we do deep copy of the
-      //  vertices and faces instead of simply copying the shared pointer.
-      return make_shared<fcl::Convexd>(
-          make_shared<const std::vector<Vector3d>>(convex.getVertices()),
-          convex.getFaceCount(),
-          make_shared<const std::vector<int>>(convex.getFaces()));
-    }
     case fcl::GEOM_ELLIPSOID:
     case fcl::GEOM_CAPSULE:
     case fcl::GEOM_CONE:
@@ -879,17 +888,113 @@ shared_ptr<fcl::ShapeBased> CopyShapeOrThrow(
   }
 }
 
+// Reports true if the given fcl collision geometry was built from a mesh file
+// (i.e., it is either a Convex or a Mesh). Such geometry is shared through the
+// MeshGeometryCache and is never modified after construction (beyond FCL
+// recomputing the identical local AABB whenever a collision object is built on
+// it; see MakeObjectOnSharedGeometry()).
+bool IsMeshFileGeometry(const fcl::CollisionGeometryd& geometry) {
+  return geometry.getNodeType() == fcl::GEOM_CONVEX ||
+         geometry.getNodeType() == fcl::BV_OBBRSS;
+}
+
+// Creates a collision object on the given mesh file geometry. The constructor
+// of fcl::CollisionObject calls computeLocalAABB() on its geometry, and mesh
+// file geometry is shared by objects in engines that may be built or copied on
+// different threads. The mutex serializes those (identical) writes.
+unique_ptr<fcl::CollisionObjectd> MakeObjectOnSharedGeometry(
+    const shared_ptr<fcl::CollisionGeometryd>& geometry) {
+  DRAKE_ASSERT(IsMeshFileGeometry(*geometry));
+  static never_destroyed<std::mutex> mutex;
+  std::lock_guard<std::mutex> lock(mutex.access());
+  return make_unique<fcl::CollisionObjectd>(geometry);
+}
+
 // Helper function that creates a *deep* copy of the given collision object.
+// The one exception is geometry built from a mesh file; because it is
+// immutable, the copy shares it with the source object.
 unique_ptr<fcl::CollisionObjectd> CopyFclObjectOrThrow(
     const fcl::CollisionObjectd& object) {
-  shared_ptr<fcl::ShapeBased> geometry_copy =
-      CopyShapeOrThrow(*object.collisionGeometry());
-  auto copy = make_unique<fcl::CollisionObjectd>(geometry_copy);
+  unique_ptr<fcl::CollisionObjectd> copy;
+  if (IsMeshFileGeometry(*object.collisionGeometry())) {
+    copy = MakeObjectOnSharedGeometry(
+        std::const_pointer_cast<fcl::CollisionGeometryd>(
+            object.collisionGeometry()));
+  } else {
+    copy = make_unique<fcl::CollisionObjectd>(
+        CopyShapeOrThrow(*object.collisionGeometry()));
+  }
   copy->setUserData(object.getUserData());
   copy->setTransform(object.getTransform());
   return copy;
 }
 
+// A process-wide cache of the fcl collision geometry built from mesh files.
+// Parsing an .obj file and building its fcl representation (particularly the
+// bounding volume hierarchy of a Mesh) is expensive, and scenes commonly
+// instantiate the same file many times. The cache only holds weak references;
+// the geometry is released once the last collision object using it is
+// destroyed.
+class MeshGeometryCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshGeometryCache)
+
+  // The kind of fcl geometry built from a file.
+  enum class Kind { kConvex, kMesh };
+
+  // Returns the single live instance of the cache.
+  static MeshGeometryCache& get() {
+    static never_destroyed<MeshGeometryCache> cache;
+    return cache.access();
+  }
+
+  // Returns the geometry of the given `kind` for the file with the given
+  // `filename` and `scale`. If no instance of it is currently alive,
+  // `make_geometry` is invoked to create it. Any exception thrown by
+  // `make_geometry` is propagated and nothing is cached.
+  template <typename MakeGeometry>
+  shared_ptr<fcl::CollisionGeometryd> FindOrCreate(
+      const std::string& filename, double scale, Kind kind,
+      MakeGeometry make_geometry) {
+    // The lock is held while the file is parsed so that concurrent requests
+    // for the same file don't parse it more than once.
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::weak_ptr<fcl::CollisionGeometryd>& entry =
+        geometries_[std::make_tuple(filename, scale, kind)];
+    shared_ptr<fcl::CollisionGeometryd> geometry = entry.lock();
+    if (geometry == nullptr) {
+      geometry = make_geometry();
+      entry = geometry;
+    }
+    return geometry;
+  }
+
+ private:
+  friend class never_destroyed<MeshGeometryCache>;
+  MeshGeometryCache() = default;
+
+  std::mutex mutex_;
+  std::map<std::tuple<std::string, double, Kind>,
+           std::weak_ptr<fcl::CollisionGeometryd>> geometries_;
+};
+
+// Parses the named .obj file with tinyobj, throwing on error. If `triangulate`
+// is true, all polygonal faces are decomposed into triangles.
+void LoadObjOrThrow(const std::string& filename, bool triangulate,
+                    tinyobj::attrib_t* attrib,
+                    std::vector<tinyobj::shape_t>* shapes) {
+  std::vector<tinyobj::material_t> materials;
+  std::string err;
+  // We use default value (NULL) for the base directory of .mtl file (material
+  // description), so it will be searched from the working directory.
+  const char* mtl_basedir = nullptr;
+  bool ret = tinyobj::LoadObj(attrib, shapes, &materials, &err,
+                              filename.c_str(), mtl_basedir, triangulate);
+  if (!ret || !err.empty()) {
+    throw std::runtime_error("Error parsing file '" + filename + "' : " + err);
+  }
+}
+
 // Helper function that creates a deep copy of a vector of collision objects.
 // Assumes the input vector has already been cleared. The `copy_map` parameter
 // serves as a mapping from each source object to its corresponding copy. Used
@@ -924,6 +1029,18 @@ void BuildTreeFromReference(
   }
 }
 
+// Returns a lower bound on the distance between the two objects, based on the
+// bounding spheres of their collision geometries.
+double BoundingSphereDistance(const fcl::CollisionObjectd& a,
+                              const fcl::CollisionObjectd& b) {
+  const fcl::CollisionGeometryd& a_geometry = *a.collisionGeometry();
+  const fcl::CollisionGeometryd& b_geometry = *b.collisionGeometry();
+  const Vector3d p_WAo = a.getTransform() * a_geometry.aabb_center;
+  const Vector3d p_WBo = b.getTransform() * b_geometry.aabb_center;
+  return (p_WAo - p_WBo).norm() - a_geometry.aabb_radius -
+         b_geometry.aabb_radius;
+}
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -1009,6 +1126,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     std::unique_ptr<fcl::CollisionObject<double>> fcl_object;
     shape.Reify(this, &fcl_object);
     fcl_object->setTransform(X_WG);
+    fcl_object->computeAABB();
     anchored_tree_.registerObject(fcl_object.get());
     ProximityIndex proximity_index(static_cast<int>(anchored_objects_.size()));
     EncodedData encoding(index, false /* is dynamic */);
@@ -1093,8 +1211,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     TakeShapeOwnership(fcl_box, user_data);
   }
 
-  void ImplementGeometry(const Mesh&, void*) override {
-    DRAKE_ABORT_MSG("The proximity engine does not support meshes yet");
+  void ImplementGeometry(const Mesh& mesh, void* user_data) override {
+    TakeShapeOwnership(
+        MeshGeometryCache::get().FindOrCreate(
+            mesh.filename(), mesh.scale(), MeshGeometryCache::Kind::kMesh,
+            [this, &mesh]() { return MakeFclMesh(mesh); }),
+        user_data);
   }
 
   //
@@ -1170,23 +1292,23 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   void ImplementGeometry(const Convex& convex, void* user_data) override {
+    TakeShapeOwnership(
+        MeshGeometryCache::get().FindOrCreate(
+            convex.filename(), convex.scale(), MeshGeometryCache::Kind::kConvex,
+            [this, &convex]() { return MakeFclConvex(convex); }),
+        user_data);
+  }
+
+  // Builds the fcl::Convex for the given Convex specification.
+  shared_ptr<fcl::CollisionGeometryd> MakeFclConvex(
+      const Convex& convex) const {
     // We use tiny_obj_loader to read the .obj file of the convex shape.
     tinyobj::attrib_t attrib;
     std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
-    std::string err;
     // We keep polygonal faces without triangulating them. Some algorithms for
     // convex geometry perform better with fewer faces.
-    bool do_tinyobj_triangulation = false;
-    // We use default value (NULL) for the base directory of .mtl file (material
-    // description), so it will be searched from the working directory.
-    const char* mtl_basedir = nullptr;
-    bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err,
-        convex.filename().c_str(), mtl_basedir, do_tinyobj_triangulation);
-    if (!ret || !err.empty()) {
-      throw std::runtime_error("Error parsing file '" + convex.filename() +
-          "' : " + err);
-    }
+    LoadObjOrThrow(convex.filename(), false /* triangulate */, &attrib,
+                   &shapes);
 
     // TODO(DamrongGuoy) Check that the input is a valid convex polyhedron.
     // 1. Each face is a planar polygon.
@@ -1219,22 +1341,51 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     auto faces = std::make_shared<std::vector<int>>();
     int num_faces = TinyObjToFclFaces(mesh, faces.get());
 
-    // Create fcl::Convex.
-    auto fcl_convex = make_shared<fcl::Convexd>(
-        vertices, num_faces, faces);
-    TakeShapeOwnership(fcl_convex, user_data);
+    return make_shared<fcl::Convexd>(vertices, num_faces, faces);
+  }
 
-    // TODO(DamrongGuoy): Per f2f with SeanCurtis-TRI, we want ProximityEngine
-    // to own vertices and face by a map from filename.  This way we won't have
-    // to read the same file again and again when we create multiple Convex
-    // objects from the same file.
+  // Builds the fcl bounding volume hierarchy for the triangles of the given
+  // Mesh specification. All objects defined in the .obj file are merged into a
+  // single model.
+  shared_ptr<fcl::CollisionGeometryd> MakeFclMesh(const Mesh& mesh) const {
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    LoadObjOrThrow(mesh.filename(), true /* triangulate */, &attrib, &shapes);
+
+    const std::vector<Vector3d> vertices =
+        TinyObjToFclVertices(attrib, mesh.scale());
+
+    // After triangulation every face has exactly three vertices. The vertex
+    // indices of all shapes refer to the same, shared vertex list.
+    std::vector<fcl::Triangle> triangles;
+    for (const tinyobj::shape_t& shape : shapes) {
+      const std::vector<tinyobj::index_t>& indices = shape.mesh.indices;
+      DRAKE_DEMAND(indices.size() % 3 == 0);
+      for (size_t i = 0; i < indices.size(); i += 3) {
+        triangles.emplace_back(indices[i].vertex_index,
+                               indices[i + 1].vertex_index,
+                               indices[i + 2].vertex_index);
+      }
+    }
+    if (triangles.empty()) {
+      throw std::runtime_error("The .obj file '" + mesh.filename() +
+                               "' of a Mesh geometry has no faces.");
+    }
+
+    auto fcl_mesh = make_shared<fcl::BVHModel<fcl::OBBRSSd>>();
+    fcl_mesh->beginModel(static_cast<int>(triangles.size()),
+                         static_cast<int>(vertices.size()));
+    fcl_mesh->addSubModel(vertices, triangles);
+    fcl_mesh->endModel();
+    return fcl_mesh;
   }
 
   std::vector<SignedDistancePair<double>>
   ComputeSignedDistancePairwiseClosestPoints(
-      const std::vector<GeometryId>& geometry_map) const {
+      const std::vector<GeometryId>& geometry_map, double max_distance) const {
     std::vector<SignedDistancePair<double>> witness_pairs;
     DistanceData distance_data{&geometry_map, &collision_filter_};
+    distance_data.max_distance = max_distance;
     distance_data.nearest_pairs = &witness_pairs;
     distance_data.request.enable_nearest_points = true;
     distance_data.request.enable_signed_distance = true;
@@ -1257,19 +1408,102 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // it into a fcl::CollisionObject.
     auto fcl_sphere = make_shared<fcl::Sphered>(0.0);  // sphere of zero radius
     fcl::CollisionObjectd query_point(fcl_sphere);
-    query_point.setTranslation(p_WQ);
 
     std::vector<SignedDistanceToPoint<double>> distances;
+    ComputeSignedDistanceToPoint(p_WQ, geometry_map, threshold, &query_point,
+                                 &distances);
+    return distances;
+  }
 
-    DistanceFromPointCallbackData data{&query_point, &geometry_map,
-                                       threshold, &distances};
-
-    anchored_tree_.distance(&query_point, &data, DistanceFromPointCallback);
-    dynamic_tree_.distance(&query_point, &data, DistanceFromPointCallback);
+  // Calls `body(begin, end)` on contiguous, disjoint ranges that together
+  // cover [0, n), running them on this engine's thread pool. At most
+  // `num_threads` threads are used, including the calling one.
+  template <typename Body>
+  void ParallelFor(int n, int num_threads, const Body& body) const {
+    DRAKE_DEMAND(num_threads > 0);
+    const int num_ranges = std::max(1, std::min(num_threads, n));
+    if (num_ranges == 1) {
+      body(0, n);
+      return;
+    }
+    // Concurrent batched queries on the same engine take turns on the pool.
+    std::lock_guard<std::mutex> lock(thread_pool_mutex_);
+    if (thread_pool_ == nullptr ||
+        thread_pool_->num_threads() != num_threads) {
+      thread_pool_.reset();
+      thread_pool_ =
+          std::make_unique<drake::internal::ThreadPool>(num_threads);
+    }
+    thread_pool_->ParallelFor(num_ranges, [n, num_ranges, &body](int r) {
+      body(n * r / num_ranges, n * (r + 1) / num_ranges);
+    });
+  }
 
+  std::vector<std::vector<SignedDistanceToPoint<double>>>
+  ComputeSignedDistanceToPoints(
+      const std::vector<Vector3d>& p_WQs,
+      const std::vector<GeometryId>& geometry_map, double threshold,
+      int num_threads) const {
+    std::vector<std::vector<SignedDistanceToPoint<double>>> distances(
+        p_WQs.size());
+    ParallelFor(static_cast<int>(p_WQs.size()), num_threads,
+                [&](int begin, int end) {
+      // Each thread moves its own zero-radius sphere from point to point.
+      fcl::CollisionObjectd query_point(make_shared<fcl::Sphered>(0.0));
+      for (int i = begin; i < end; ++i) {
+        ComputeSignedDistanceToPoint(p_WQs[i], geometry_map, threshold,
+                                     &query_point, &distances[i]);
+      }
+    });
     return distances;
   }
 
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairClosestPoints(
+      const std::vector<std::pair<GeometryKey, GeometryKey>>& pairs,
+      const std::vector<GeometryId>& geometry_map, double max_distance,
+      int num_threads) const {
+    fcl::DistanceRequestd request;
+    request.enable_nearest_points = true;
+    request.enable_signed_distance = true;
+    request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+    request.distance_tolerance = distance_tolerance_;
+
+    // See DistanceCallback() for why the pruning distance is non-negative.
+    const double pruning_distance = std::max(max_distance, 0.0);
+    const int num_pairs = static_cast<int>(pairs.size());
+    std::vector<optional<SignedDistancePair<double>>> results(num_pairs);
+    ParallelFor(num_pairs, num_threads, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        const fcl::CollisionObjectd& fcl_object_A = GetObject(pairs[i].first);
+        const fcl::CollisionObjectd& fcl_object_B = GetObject(pairs[i].second);
+        // Skips the narrowphase for pairs whose bounding spheres are already
+        // too far apart.
+        if (BoundingSphereDistance(fcl_object_A, fcl_object_B) >
+            pruning_distance) {
+          continue;
+        }
+        fcl::DistanceResultd result;
+        ComputeNarrowPhaseDistance(&fcl_object_A, &fcl_object_B, geometry_map,
+                                   request, &result);
+        if (result.min_distance > max_distance) continue;
+        const Vector3d p_ACa =
+            fcl_object_A.getTransform().inverse() * result.nearest_points[0];
+        const Vector3d p_BCb =
+            fcl_object_B.getTransform().inverse() * result.nearest_points[1];
+        results[i].emplace(EncodedData(fcl_object_A).id(geometry_map),
+                           EncodedData(fcl_object_B).id(geometry_map), p_ACa,
+                           p_BCb, result.min_distance);
+      }
+    });
+
+    std::vector<SignedDistancePair<double>> witness_pairs;
+    for (auto& result : results) {
+      if (result) witness_pairs.push_back(std::move(*result));
+    }
+    return witness_pairs;
+  }
+
 
   std::vector<PenetrationAsPointPair<double>> ComputePointPairPenetration(
       const std::vector<GeometryId>& geometry_map) const {
@@ -1476,6 +1710,28 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   template <typename>
   friend class ProximityEngine;
 
+  const fcl::CollisionObjectd& GetObject(const GeometryKey& key) const {
+    return key.is_dynamic ? *dynamic_objects_[key.index]
+                          : *anchored_objects_[key.index];
+  }
+
+  // Appends the signed distances from the geometries within `threshold` to
+  // the point `p_WQ` to `distances`. The point is represented in the
+  // broadphase by `query_point`, a zero-radius sphere that gets moved to Q.
+  void ComputeSignedDistanceToPoint(
+      const Vector3d& p_WQ, const std::vector<GeometryId>& geometry_map,
+      double threshold, fcl::CollisionObjectd* query_point,
+      std::vector<SignedDistanceToPoint<double>>* distances) const {
+    query_point->setTranslation(p_WQ);
+    // The broadphase culls by bounding box; setTranslation() doesn't update it.
+    query_point->computeAABB();
+
+    DistanceFromPointCallbackData data{query_point, &geometry_map, threshold,
+                                       distances};
+    anchored_tree_.distance(query_point, &data, DistanceFromPointCallback);
+    dynamic_tree_.distance(query_point, &data, DistanceFromPointCallback);
+  }
+
   // Removes the geometry with the given proximity index from the given tree. It
   // potentially moves another object to take its slot in the vector of objects
   // to maintain a contiguous memory block.
@@ -1513,12 +1769,16 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // facilitate the logistics of creating shapes from specifications. `data`
   // is a unique_ptr of an fcl CollisionObject that should be instantiated
   // with the given shape.
-  void TakeShapeOwnership(const std::shared_ptr<fcl::ShapeBased>& shape,
-                          void* data) {
+  void TakeShapeOwnership(
+      const std::shared_ptr<fcl::CollisionGeometryd>& shape, void* data) {
     DRAKE_ASSERT(data != nullptr);
     std::unique_ptr<fcl::CollisionObject<double>>& fcl_object_ptr =
         *reinterpret_cast<std::unique_ptr<fcl::CollisionObject<double>>*>(data);
-    fcl_object_ptr = make_unique<fcl::CollisionObject<double>>(shape);
+    if (IsMeshFileGeometry(*shape)) {
+      fcl_object_ptr = MakeObjectOnSharedGeometry(shape);
+    } else {
+      fcl_object_ptr = make_unique<fcl::CollisionObject<double>>(shape);
+    }
   }
 
   // The BVH of all dynamic geometries; this depends on *all* inputs.
@@ -1544,6 +1804,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // The tolerance that determines when the iterative process would terminate.
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
+
+  // The threads that run the batched queries, created by the first query that
+  // asks for more than one thread and recreated if a later one asks for a
+  // different number. Copies of the engine don't share it.
+  mutable std::mutex thread_pool_mutex_;
+  mutable std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
 };
 
 template <typename T>
@@ -1654,8 +1920,9 @@ void ProximityEngine<T>::UpdateWorldPoses(
 template <typename T>
 std::vector<SignedDistancePair<double>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
-    const std::vector<GeometryId>& geometry_map) const {
-  return impl_->ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+    const std::vector<GeometryId>& geometry_map, double max_distance) const {
+  return impl_->ComputeSignedDistancePairwiseClosestPoints(geometry_map,
+                                                           max_distance);
 }
 
 template <typename T>
@@ -1668,6 +1935,26 @@ ProximityEngine<T>::ComputeSignedDistanceToPoint(
 }
 
 
+template <typename T>
+std::vector<std::vector<SignedDistanceToPoint<double>>>
+ProximityEngine<T>::ComputeSignedDistanceToPoints(
+    const std::vector<Vector3<double>>& p_WQs,
+    const std::vector<GeometryId>& geometry_map, double threshold,
+    int num_threads) const {
+  return impl_->ComputeSignedDistanceToPoints(p_WQs, geometry_map, threshold,
+                                              num_threads);
+}
+
+template <typename T>
+std::vector<SignedDistancePair<double>>
+ProximityEngine<T>::ComputeSignedDistancePairClosestPoints(
+    const std::vector<std::pair<GeometryKey, GeometryKey>>& pairs,
+    const std::vector<GeometryId>& geometry_map, double max_distance,
+    int num_threads) const {
+  return impl_->ComputeSignedDistancePairClosestPoints(
+      pairs, geometry_map, max_distance, num_threads);
+}
+
 template <typename T>
 std::vector<PenetrationAsPointPair<double>>
 ProximityEngine<T>::ComputePointPairPenetration(
@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "drake/common/autodiff.h"
@@ -163,10 +164,14 @@ class ProximityEngine {
    geometries. A valid pair consists of either two dynamic geometries or a
    dynamic geometry and an anchored geometry. It _never_ includes two anchored
    geometries. The order and size of the returned vector are invariant
-   when the poses of the objects are changed.
+   when the poses of the objects are changed, as long as `max_distance` is
+   infinite.
 
    @param[in] geometry_map      A map from geometry _index_ to the corresponding
                                 global geometry identifier.
+   @param[in] max_distance      Pairs farther apart than this distance are not
+                                reported. The broadphase skips the pairs whose
+                                bounding boxes are farther apart.
    @retval signed_distances     A vector populated with per-object-pair signed
                                 distance values (and supporting data).
                                 Note: For a geometry pair (A, B), the supporting
@@ -178,7 +183,8 @@ class ProximityEngine {
    */
   std::vector<SignedDistancePair<double>>
   ComputeSignedDistancePairwiseClosestPoints(
-      const std::vector<GeometryId>& geometry_map) const;
+      const std::vector<GeometryId>& geometry_map,
+      double max_distance = std::numeric_limits<double>::infinity()) const;
 
   /** Performs work in support of GeometryState::ComputeSignedDistanceToPoint().
    @param[in] p_WQ            Position of a query point Q in world frame W.
@@ -194,6 +200,49 @@ class ProximityEngine {
       const Vector3<double>& p_WQ,
       const std::vector<GeometryId>& geometry_map,
       const double threshold = std::numeric_limits<double>::infinity()) const;
+
+  /** Performs work in support of
+   GeometryState::ComputeSignedDistanceToPoints(). The i-th entry of the
+   result holds the same data ComputeSignedDistanceToPoint() reports for the
+   query point `p_WQs[i]`.
+   @param[in] p_WQs           Positions of the query points in world frame W.
+   @param[in] geometry_map    A map from geometry _index_ to the corresponding
+                              global geometry identifier.
+   @param[in] threshold       Ignore any object beyond this distance.
+   @param[in] num_threads     The number of threads the queries are split
+                              across.
+   @pre `num_threads > 0`.  */
+  std::vector<std::vector<SignedDistanceToPoint<double>>>
+  ComputeSignedDistanceToPoints(
+      const std::vector<Vector3<double>>& p_WQs,
+      const std::vector<GeometryId>& geometry_map, double threshold,
+      int num_threads) const;
+
+  /** Identifies a geometry in this engine by its proximity index and whether
+   it is dynamic or anchored.  */
+  struct GeometryKey {
+    ProximityIndex index;
+    bool is_dynamic{};
+  };
+
+  /** Performs work in support of
+   GeometryState::ComputeSignedDistancePairClosestPoints().
+   @param[in] pairs           The pairs (A, B) of geometries to query.
+   @param[in] geometry_map    A map from geometry _index_ to the corresponding
+                              global geometry identifier.
+   @param[in] max_distance    Pairs farther apart than this distance are not
+                              reported.
+   @param[in] num_threads     The number of threads the queries are split
+                              across.
+   @retval signed_distances   The signed distance of each pair within
+                              `max_distance`, in the order of `pairs` and with
+                              the geometries in the same order as the pair.
+   @pre `num_threads > 0`.  */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairClosestPoints(
+      const std::vector<std::pair<GeometryKey, GeometryKey>>& pairs,
+      const std::vector<GeometryId>& geometry_map, double max_distance,
+      int num_threads) const;
   //@}
 
   //----------------------------------------------------------------------------
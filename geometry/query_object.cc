@@ -2,6 +2,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 #include "drake/geometry/scene_graph.h"
 
 namespace drake {
@@ -31,13 +32,14 @@ QueryObject<T>::ComputePointPairPenetration() const {
 
 template <typename T>
 std::vector<SignedDistancePair<double>>
-QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints() const {
+QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
+    double max_distance) const {
   ThrowIfDefault();
 
   // TODO(SeanCurtis-TRI): Modify this when the cache system is in place.
   scene_graph_->FullPoseUpdate(*context_);
   const GeometryState<T>& state = context_->get_geometry_state();
-  return state.ComputeSignedDistancePairwiseClosestPoints();
+  return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
 }
 
 template <typename T>
@@ -52,6 +54,33 @@ QueryObject<T>::ComputeSignedDistanceToPoint(
   return state.ComputeSignedDistanceToPoint(p_WQ, threshold);
 }
 
+template <typename T>
+std::vector<std::vector<SignedDistanceToPoint<double>>>
+QueryObject<T>::ComputeSignedDistanceToPoints(
+    const std::vector<Vector3<double>>& p_WQs, double threshold,
+    int num_threads) const {
+  ThrowIfDefault();
+  DRAKE_THROW_UNLESS(num_threads > 0);
+
+  scene_graph_->FullPoseUpdate(*context_);
+  const GeometryState<T>& state = context_->get_geometry_state();
+  return state.ComputeSignedDistanceToPoints(p_WQs, threshold, num_threads);
+}
+
+template <typename T>
+std::vector<SignedDistancePair<double>>
+QueryObject<T>::ComputeSignedDistancePairClosestPoints(
+    const std::vector<std::pair<GeometryId, GeometryId>>& pairs,
+    double max_distance, int num_threads) const {
+  ThrowIfDefault();
+  DRAKE_THROW_UNLESS(num_threads > 0);
+
+  scene_graph_->FullPoseUpdate(*context_);
+  const GeometryState<T>& state = context_->get_geometry_state();
+  return state.ComputeSignedDistancePairClosestPoints(pairs, max_distance,
+                                                      num_threads);
+}
+
 template <typename T>
 const GeometryState<T>& QueryObject<T>::geometry_state() const {
   // TODO(SeanCurtis-TRI): Handle the "baked" query object case.
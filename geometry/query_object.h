@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "drake/geometry/geometry_context.h"
@@ -168,6 +169,12 @@ class QueryObject {
    B, respectively, such that Aₚ + v = Bₚ, Aₚ ∈ A ∩ B, Bₚ ∈ A ∩ B. These points
    are the witnesses to the penetration.
 
+   @note A Mesh is represented only by its triangulated surface, not by the
+   volume it encloses. For a pair involving a Mesh, φ is the distance between
+   that surface and the other geometry: it is zero if the two intersect and
+   positive even if the other geometry lies entirely inside the mesh. That is,
+   no penetration depth (φ < 0) is reported for a Mesh.
+
    This method is affected by collision filtering; geometry pairs that
    have been filtered will not produce signed distance query results.
 
@@ -176,13 +183,21 @@ class QueryObject {
    filter. We report the distance between dynamic objects, and between dynamic
    and anchored objects. We DO NOT report the distance between two anchored
    objects.
-   @retval near_pairs The signed distance for all unfiltered geometry pairs.
+
+   Optionally you can specify a maximum distance that will filter out any pair
+   farther apart than it. Pairs whose bounding boxes are already farther apart
+   are skipped without computing their distance, so a finite `max_distance` can
+   be much cheaper when only nearby pairs matter. By default, all unfiltered
+   pairs are reported.
+
+   @param[in] max_distance  Pairs with a signed distance larger than this are
+                            not reported.
+   @retval near_pairs The signed distance for all unfiltered geometry pairs
+                      within `max_distance`.
   */
-  // TODO(hongkai.dai): add a distance bound as an optional input, such that the
-  // function doesn't return the pairs whose signed distance is larger than the
-  // distance bound.
   std::vector<SignedDistancePair<double>>
-  ComputeSignedDistancePairwiseClosestPoints() const;
+  ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance = std::numeric_limits<double>::infinity()) const;
 
   // TODO(DamrongGuoy): Improve and refactor documentation of
   // ComputeSignedDistanceToPoint(). Move the common sections into Signed
@@ -193,7 +208,7 @@ class QueryObject {
    geometry in the scene.
 
    @warning Currently supports spheres and boxes only. Silently ignores other
-   kinds of geometries, which will be added later.
+   kinds of geometries (including Mesh and Convex), which will be added later.
 
    This query provides φᵢ(p), φᵢ:ℝ³→ℝ, the signed distance to the position
    p of a query point from geometry Gᵢ in the scene.  It returns an array of
@@ -258,6 +273,61 @@ class QueryObject {
   ComputeSignedDistanceToPoint(const Vector3<double> &p_WQ,
                                const double threshold
                                = std::numeric_limits<double>::infinity()) const;
+
+  /**
+   Computes the signed distances and gradients to each of a batch of query
+   points from each geometry in the scene. This is equivalent to calling
+   ComputeSignedDistanceToPoint() once per query point, but the geometry poses
+   are updated only once for the whole batch and the queries can be split
+   across threads.
+
+   @param[in] p_WQs           Positions of the query points Q in world frame W.
+   @param[in] threshold       We ignore any object beyond this distance.
+                              By default, it is infinity, so we report
+                              distances from the query points to every object.
+   @param[in] num_threads     The number of threads the queries are split
+                              across.
+   @retval signed_distances   A vector whose i-th entry holds the per-object
+                              signed distances to `p_WQs[i]`, as reported by
+                              ComputeSignedDistanceToPoint().
+   @throws std::exception if `num_threads` is not positive.  */
+  std::vector<std::vector<SignedDistanceToPoint<double>>>
+  ComputeSignedDistanceToPoints(
+      const std::vector<Vector3<double>>& p_WQs,
+      double threshold = std::numeric_limits<double>::infinity(),
+      int num_threads = 1) const;
+
+  /**
+   Computes the signed distance together with the nearest points for each of
+   the given pairs of geometries. The signed distance is defined as in
+   ComputeSignedDistancePairwiseClosestPoints(); in particular, it is negative
+   for penetrating geometries, except for a Mesh, which reports no penetration
+   depth.
+
+   Unlike ComputeSignedDistancePairwiseClosestPoints(), only the requested
+   pairs are evaluated and collision filtering is _not_ applied. A pair whose
+   bounding spheres are already farther apart than `max_distance` is rejected
+   without computing its distance.
+
+   @param[in] pairs           The pairs (A, B) of geometries to query. Each
+                              geometry must have a proximity role.
+   @param[in] max_distance    Pairs farther apart than this distance are not
+                              reported. By default, it is infinity, so every
+                              pair is reported.
+   @param[in] num_threads     The number of threads the queries are split
+                              across.
+   @retval near_pairs         The signed distance of each pair within
+                              `max_distance`, in the order of `pairs`. In each
+                              result, `id_A` and `id_B` are in the same order
+                              as in the requested pair.
+   @throws std::exception if any id does not refer to a geometry with a
+                          proximity role, or if `num_threads` is not positive.
+   */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairClosestPoints(
+      const std::vector<std::pair<GeometryId, GeometryId>>& pairs,
+      double max_distance = std::numeric_limits<double>::infinity(),
+      int num_threads = 1) const;
   //@}
 
  private:
@@ -0,0 +1,142 @@
+/// @file benchmark_batched_distance_queries.cc
+///
+/// Compares the time taken by the batched signed distance queries of
+/// QueryObject against looping over the corresponding single queries, for an
+/// increasing number of threads. The scene is a random scattering of anchored
+/// spheres and boxes.
+///
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/geometry/geometry_instance.h"
+#include "drake/geometry/query_object.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/geometry/shape_specification.h"
+
+DEFINE_int32(num_geometries, 200, "Number of geometries in the scene");
+DEFINE_int32(num_points, 5000, "Number of query points per batch");
+DEFINE_int32(num_pairs, 5000, "Number of geometry pairs per batch");
+DEFINE_double(threshold, 0.25, "Distance threshold of the queries");
+
+namespace drake {
+namespace geometry {
+namespace {
+
+using common::test::MeasureExecutionTime;
+using Eigen::Isometry3d;
+using Eigen::Vector3d;
+
+int do_main() {
+  // All of the geometry lies in the cube [-1, 1]³.
+  std::mt19937 generator;
+  std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+  auto random_point = [&]() {
+    return Vector3d(coordinate(generator), coordinate(generator),
+                    coordinate(generator));
+  };
+
+  SceneGraph<double> scene_graph;
+  const SourceId source_id = scene_graph.RegisterSource("benchmark");
+  std::vector<GeometryId> ids;
+  for (int i = 0; i < FLAGS_num_geometries; ++i) {
+    Isometry3d X_WG = Isometry3d::Identity();
+    X_WG.translation() = random_point();
+    std::unique_ptr<Shape> shape;
+    if (i % 2 == 0) {
+      shape = std::make_unique<Sphere>(0.05);
+    } else {
+      shape = std::make_unique<Box>(0.1, 0.05, 0.075);
+    }
+    ids.push_back(scene_graph.RegisterAnchoredGeometry(
+        source_id, std::make_unique<GeometryInstance>(
+                       X_WG, std::move(shape), "g" + std::to_string(i))));
+    scene_graph.AssignRole(source_id, ids.back(), ProximityProperties());
+  }
+  auto context = scene_graph.AllocateContext();
+  const auto& query_object =
+      scene_graph.get_query_output_port().Eval<QueryObject<double>>(*context);
+
+  std::vector<Vector3d> p_WQs;
+  for (int i = 0; i < FLAGS_num_points; ++i) {
+    p_WQs.push_back(random_point());
+  }
+  std::uniform_int_distribution<int> index(0, FLAGS_num_geometries - 1);
+  std::vector<std::pair<GeometryId, GeometryId>> pairs;
+  for (int i = 0; i < FLAGS_num_pairs; ++i) {
+    pairs.emplace_back(ids[index(generator)], ids[index(generator)]);
+  }
+
+  // The single point query, once per point.
+  int num_single_results{0};
+  const double single_time = MeasureExecutionTime([&]() {
+    for (const Vector3d& p_WQ : p_WQs) {
+      num_single_results +=
+          query_object.ComputeSignedDistanceToPoint(p_WQ, FLAGS_threshold)
+              .size();
+    }
+  });
+  std::cout << p_WQs.size() << " query points, " << FLAGS_num_geometries
+            << " geometries:\n"
+            << "  single queries: " << single_time * 1e3 << " ms ("
+            << num_single_results << " results)" << std::endl;
+
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    int num_results{0};
+    const double time = MeasureExecutionTime([&]() {
+      for (const auto& distances : query_object.ComputeSignedDistanceToPoints(
+               p_WQs, FLAGS_threshold, num_threads)) {
+        num_results += distances.size();
+      }
+    });
+    std::cout << "  batched, " << num_threads << " thread(s): " << time * 1e3
+              << " ms (speedup " << single_time / time << "x, " << num_results
+              << " results)" << std::endl;
+  }
+
+  // A batch of one pair at a time.
+  int num_single_pair_results{0};
+  const double single_pair_time = MeasureExecutionTime([&]() {
+    for (const auto& pair : pairs) {
+      num_single_pair_results +=
+          query_object
+              .ComputeSignedDistancePairClosestPoints({pair}, FLAGS_threshold)
+              .size();
+    }
+  });
+  std::cout << pairs.size() << " geometry pairs:\n"
+            << "  single queries: " << single_pair_time * 1e3 << " ms ("
+            << num_single_pair_results << " results)" << std::endl;
+  for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    int num_results{0};
+    const double time = MeasureExecutionTime([&]() {
+      num_results = query_object
+                        .ComputeSignedDistancePairClosestPoints(
+                            pairs, FLAGS_threshold, num_threads)
+                        .size();
+    });
+    std::cout << "  batched, " << num_threads << " thread(s): " << time * 1e3
+              << " ms (speedup " << single_pair_time / time << "x, "
+              << num_results << " results)" << std::endl;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::geometry::do_main();
+}
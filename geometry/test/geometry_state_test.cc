@@ -1,5 +1,6 @@
 #include "drake/geometry/geometry_state.h"
 
+#include <limits>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -8,6 +9,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/find_resource.h"
 #include "drake/common/nice_type_name.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -1991,6 +1993,38 @@ TEST_F(GeometryStateTest, CollisionFilteredExceptions) {
                               "geometries .* neither id is a valid geometry");
 }
 
+// Tests that explicitly requested pairs are reported in the requested order,
+// and that the geometries are validated.
+TEST_F(GeometryStateTest, SignedDistancePairClosestPoints) {
+  SetUpSingleSourceTree();
+  geometry_state_.AssignRole(source_id_, geometries_[0], ProximityProperties());
+  geometry_state_.AssignRole(source_id_, geometries_[1], ProximityProperties());
+
+  // N.B. The two geometries are on the same frame, so collision filtering
+  // would exclude them from ComputeSignedDistancePairwiseClosestPoints().
+  const auto results = geometry_state_.ComputeSignedDistancePairClosestPoints(
+      {{geometries_[1], geometries_[0]}},
+      std::numeric_limits<double>::infinity(), 1 /* num_threads */);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0].id_A, geometries_[1]);
+  EXPECT_EQ(results[0].id_B, geometries_[0]);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.ComputeSignedDistancePairClosestPoints(
+          {{geometries_[0], geometries_[2]}},
+          std::numeric_limits<double>::infinity(), 1),
+      std::logic_error,
+      ".* " + to_string(geometries_[2]) + "; it does not have a proximity role");
+
+  const GeometryId bad_id = GeometryId::get_new_id();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.ComputeSignedDistancePairClosestPoints(
+          {{bad_id, geometries_[0]}}, std::numeric_limits<double>::infinity(),
+          1),
+      std::logic_error,
+      ".* " + to_string(bad_id) + "; it is not a valid geometry");
+}
+
 // Tests the ability to query for a geometry from the name of a geometry.
 TEST_F(GeometryStateTest, GetGeometryIdFromName) {
   SetUpSingleSourceTree(true /* initialize with proximity role */);
@@ -2418,22 +2452,27 @@ TEST_F(GeometryStateTest, RoleAssignExceptions) {
       "role.");
 }
 
-// Confirms that assigning a proximity role to a mesh is a no-op. If it
-// *weren't* no-op, the ProximityEngine would abort; so not aborting is
-// correlated with its no-op-ness. This test will go away when meshes are fully
-// supported in collision.
+// Confirms that a mesh can be assigned the proximity role and is passed to the
+// proximity engine.
 TEST_F(GeometryStateTest, ProximityRoleOnMesh) {
   SetUpSingleSourceTree();
 
   // Add a mesh to a frame.
   GeometryId mesh_id = geometry_state_.RegisterGeometry(
       source_id_, frames_[0],
-      make_unique<GeometryInstance>(Isometry3d::Identity(),
-                                    make_unique<Mesh>("path", 1.0), "mesh"));
+      make_unique<GeometryInstance>(
+          Isometry3d::Identity(),
+          make_unique<Mesh>(
+              FindResourceOrThrow("drake/geometry/test/quad_cube.obj"), 1.0),
+          "mesh"));
   const InternalGeometry* mesh = gs_tester_.GetGeometry(mesh_id);
   ASSERT_FALSE(mesh->has_proximity_role());
+  const int proximity_count =
+      geometry_state_.GetNumGeometriesWithRole(Role::kProximity);
   geometry_state_.AssignRole(source_id_, mesh_id, ProximityProperties());
-  ASSERT_FALSE(mesh->has_proximity_role());
+  ASSERT_TRUE(mesh->has_proximity_role());
+  EXPECT_EQ(geometry_state_.GetNumGeometriesWithRole(Role::kProximity),
+            proximity_count + 1);
 }
 
 // Tests the functionality that counts the number of children geometry a frame
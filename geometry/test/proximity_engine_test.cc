@@ -1,5 +1,10 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -7,6 +12,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/shape_specification.h"
@@ -237,6 +243,10 @@ GTEST_TEST(ProximityEngineTests, CopySemantics) {
       "drake/geometry/test/quad_cube.obj"), 1.0};
   ref_engine.AddDynamicGeometry(convex, GeometryIndex(5));
 
+  Mesh mesh{drake::FindResourceOrThrow(
+      "drake/geometry/test/quad_cube.obj"), 1.0};
+  ref_engine.AddDynamicGeometry(mesh, GeometryIndex(6));
+
   ProximityEngine<double> copy_construct(ref_engine);
   ProximityEngineTester::IsDeepCopy(copy_construct, ref_engine);
 
@@ -327,6 +337,47 @@ GTEST_TEST(ProximityEngineTests, SignedDistanceClosestPointsMultipleAnchored) {
   EXPECT_EQ(results.size(), 0);
 }
 
+// Tests that a distance bound only reports the nearby pairs. A row of unit
+// spheres, 3 m apart, is laid out along the x-axis, next to an anchored sphere
+// at the origin; only neighbors are within 1.5 m of each other.
+GTEST_TEST(ProximityEngineTests, SignedDistanceClosestPointsMaxDistance) {
+  ProximityEngine<double> engine;
+  std::vector<GeometryId> geometry_map;
+
+  const double radius = 1.0;
+  Sphere sphere{radius};
+  engine.AddAnchoredGeometry(sphere, Isometry3<double>::Identity(),
+                             GeometryIndex(0));
+  geometry_map.push_back(GeometryId::get_new_id());
+  const int num_dynamic = 5;
+  std::vector<Isometry3<double>> poses;
+  std::vector<GeometryIndex> indices;
+  for (int i = 0; i < num_dynamic; ++i) {
+    engine.AddDynamicGeometry(sphere, GeometryIndex(i + 1));
+    geometry_map.push_back(GeometryId::get_new_id());
+    Isometry3<double> pose = Isometry3<double>::Identity();
+    pose.translation() << 3 * (i + 1), 0, 0;
+    poses.push_back(pose);
+    indices.push_back(GeometryIndex(i));
+  }
+  engine.UpdateWorldPoses(poses, indices);
+
+  // The anchored sphere with its neighbor, and every dynamic sphere with its
+  // neighbor, are 1 m apart.
+  const auto near_results =
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map, 1.5);
+  EXPECT_EQ(near_results.size(), num_dynamic);
+  for (const auto& result : near_results) {
+    EXPECT_NEAR(result.distance, 1.0, 1e-14);
+  }
+
+  // Without a bound, all 5 * 4 / 2 dynamic pairs and the 5 dynamic-anchored
+  // pairs are reported.
+  const auto all_results =
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+  EXPECT_EQ(all_results.size(), 15);
+}
+
 // ComputeSignedDistanceToPoint tests
 
 using std::make_shared;
@@ -699,6 +750,32 @@ TEST_P(SignedDistanceToPointTest, SingleQueryPointWithThreshold) {
   EXPECT_EQ(results.size(), 0);
 }
 
+// The batched query reports, for each point, the same results as the single
+// point query.
+TEST_P(SignedDistanceToPointTest, MultipleQueryPoints) {
+  auto data = GetParam();
+
+  const std::vector<Vector3d> p_WQs(5, data.p_WQ);
+  const auto results = engine.ComputeSignedDistanceToPoints(
+      p_WQs, geometry_map, std::numeric_limits<double>::infinity(),
+      3 /* num_threads */);
+  ASSERT_EQ(results.size(), p_WQs.size());
+  for (const auto& result : results) {
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].id_G, data.expected_result.id_G);
+    EXPECT_TRUE(
+        CompareMatrices(result[0].p_GN, data.expected_result.p_GN, tolerance));
+    EXPECT_NEAR(result[0].distance, data.expected_result.distance, tolerance);
+    EXPECT_TRUE(CompareMatrices(result[0].grad_W, data.expected_result.grad_W,
+                                tolerance));
+  }
+
+  const double small_threshold = data.expected_result.distance - 0.01;
+  for (const auto& result : engine.ComputeSignedDistanceToPoints(
+           p_WQs, geometry_map, small_threshold, 2 /* num_threads */)) {
+    EXPECT_EQ(result.size(), 0);
+  }
+}
 
 // To debug a specific test, you can use Bazel flag --test_filter and
 // --test_output.  For example, you can use the command:
@@ -1651,6 +1728,39 @@ class SignedDistancePairTest
   // hard-coded tolerance of 1e-14 to account for loss of precision due to
   // rigid transformations and this tolerance reflects that.
   static constexpr double tolerance_ = 1e-14;
+
+ protected:
+  // Confirms that both the pairwise query and the query of the explicit pair
+  // only report the pair when it lies within the given distance bound. The
+  // bound is negative for penetrating pairs.
+  void CheckMaxDistance() {
+    using GeometryKey = ProximityEngine<double>::GeometryKey;
+    const auto& data = GetParam();
+    const double distance = data.expected_result_.distance;
+    const std::vector<std::pair<GeometryKey, GeometryKey>> pairs{
+        {{ProximityIndex(0), false /* is_dynamic */},
+         {ProximityIndex(0), true /* is_dynamic */}}};
+
+    const auto results = engine_.ComputeSignedDistancePairwiseClosestPoints(
+        geometry_map_, distance + 0.01);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_NEAR(results[0].distance, distance, tolerance_);
+    const auto pair_results = engine_.ComputeSignedDistancePairClosestPoints(
+        pairs, geometry_map_, distance + 0.01, 1 /* num_threads */);
+    ASSERT_EQ(pair_results.size(), 1);
+    EXPECT_NEAR(pair_results[0].distance, distance, tolerance_);
+
+    EXPECT_EQ(engine_
+                  .ComputeSignedDistancePairwiseClosestPoints(geometry_map_,
+                                                              distance - 0.01)
+                  .size(),
+              0);
+    EXPECT_EQ(engine_
+                  .ComputeSignedDistancePairClosestPoints(
+                      pairs, geometry_map_, distance - 0.01, 1)
+                  .size(),
+              0);
+  }
 };
 
 TEST_P(SignedDistancePairTest, SinglePair) {
@@ -1686,6 +1796,45 @@ TEST_P(SignedDistancePairTest, SinglePair) {
     << "Distance between witness points do not equal the signed distance.";
 }
 
+// Confirms that the pair is only reported when it lies within the given
+// distance bound.
+TEST_P(SignedDistancePairTest, MaxDistance) {
+  CheckMaxDistance();
+}
+
+// Queries the pair explicitly, in both orders, and confirms the results match
+// the expected result with the geometries in the requested order.
+TEST_P(SignedDistancePairTest, RequestedPairs) {
+  using GeometryKey = ProximityEngine<double>::GeometryKey;
+  const auto& data = GetParam();
+  const GeometryKey key_A{ProximityIndex(0), false /* is_dynamic */};
+  const GeometryKey key_B{ProximityIndex(0), true /* is_dynamic */};
+  const auto results = engine_.ComputeSignedDistancePairClosestPoints(
+      {{key_A, key_B}, {key_B, key_A}}, geometry_map_,
+      std::numeric_limits<double>::infinity(), 2 /* num_threads */);
+  ASSERT_EQ(results.size(), 2);
+
+  EXPECT_EQ(results[0].id_A, data.expected_result_.id_A);
+  EXPECT_EQ(results[0].id_B, data.expected_result_.id_B);
+  EXPECT_EQ(results[1].id_A, data.expected_result_.id_B);
+  EXPECT_EQ(results[1].id_B, data.expected_result_.id_A);
+  for (const auto& result : results) {
+    EXPECT_NEAR(result.distance, data.expected_result_.distance, tolerance_);
+  }
+  EXPECT_TRUE(CompareMatrices(results[0].p_ACa, data.expected_result_.p_ACa,
+                              tolerance_));
+  EXPECT_TRUE(CompareMatrices(results[0].p_BCb, data.expected_result_.p_BCb,
+                              tolerance_));
+
+  // A distance bound below the pair's distance rejects it.
+  EXPECT_EQ(engine_
+                .ComputeSignedDistancePairClosestPoints(
+                    {{key_A, key_B}}, geometry_map_,
+                    data.expected_result_.distance - 0.01, 1)
+                .size(),
+            0);
+}
+
 INSTANTIATE_TEST_CASE_P(SphereSphere, SignedDistancePairTest,
     testing::ValuesIn(GenDistancePairTestSphereSphere()));
 INSTANTIATE_TEST_CASE_P(SphereSphereTransform, SignedDistancePairTest,
@@ -1749,6 +1898,10 @@ TEST_P(SignedDistancePairConcentricTest, DistanceInvariance) {
     << "Incorrect distance between witness points.";
 }
 
+TEST_P(SignedDistancePairConcentricTest, MaxDistance) {
+  CheckMaxDistance();
+}
+
 // Generates one record of test data for two spheres whose centers are at the
 // same point.
 // @param radius_A specifies the radius of the first sphere A.
@@ -2487,27 +2640,142 @@ TEST_F(BoxPenetrationTest, TangentConvex2) {
   TestCollision2(TangentConvex, 1e-3);
 }
 
-// Attempting to add a dynamic Mesh should cause an abort.
-GTEST_TEST(ProximityEngineTests, AddDynamicMesh) {
-  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+// Geometries instantiated from the same mesh file (with the same scale and
+// shape kind) share a single collision geometry, whether dynamic or anchored,
+// in any engine, and copies of an engine share it too. The file is only parsed
+// when no geometry built from it is alive, which is observed by removing the
+// file after it has been parsed once.
+GTEST_TEST(ProximityEngineTests, MeshDataIsShared) {
+  const std::string filename = temp_directory() + "/shared_cube.obj";
+  {
+    std::ifstream source(
+        drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj"));
+    std::ofstream target(filename);
+    target << source.rdbuf();
+  }
+  const Isometry3d pose = Isometry3d::Identity();
+  auto engine = std::make_unique<ProximityEngine<double>>();
+  engine->AddDynamicGeometry(Mesh{filename, 1.0}, GeometryIndex(0));
+  engine->AddDynamicGeometry(Convex{filename, 1.0}, GeometryIndex(1));
+  ASSERT_EQ(std::remove(filename.c_str()), 0);
+
+  // Instances of the parsed geometry don't need the file.
+  EXPECT_NO_THROW(
+      engine->AddDynamicGeometry(Mesh{filename, 1.0}, GeometryIndex(2)));
+  EXPECT_NO_THROW(
+      engine->AddAnchoredGeometry(Mesh{filename, 1.0}, pose, GeometryIndex(3)));
+  EXPECT_NO_THROW(
+      engine->AddDynamicGeometry(Convex{filename, 1.0}, GeometryIndex(4)));
+  ProximityEngine<double> other_engine;
+  EXPECT_NO_THROW(
+      other_engine.AddDynamicGeometry(Mesh{filename, 1.0}, GeometryIndex(0)));
+
+  // A different scale is different geometry, which must be parsed.
+  EXPECT_THROW(
+      engine->AddDynamicGeometry(Mesh{filename, 2.0}, GeometryIndex(5)),
+      std::runtime_error);
+
+  // A copy keeps the geometry alive after the original engine (and the other
+  // engine) are gone, i.e., it shares it rather than copying it.
+  const ProximityEngine<double> copy(*engine);
+  engine.reset();
+  other_engine = ProximityEngine<double>();
+  ProximityEngine<double> third_engine;
+  EXPECT_NO_THROW(
+      third_engine.AddDynamicGeometry(Mesh{filename, 1.0}, GeometryIndex(0)));
+  EXPECT_NO_THROW(
+      third_engine.AddDynamicGeometry(Convex{filename, 1.0}, GeometryIndex(1)));
+}
+
+// Attempting to add a Mesh from a file that can't be parsed throws.
+GTEST_TEST(ProximityEngineTests, AddInvalidMesh) {
   ProximityEngine<double> engine;
   Mesh mesh{"invalid/path/thing.obj", 1.0};
-  ASSERT_DEATH(
-      engine.AddDynamicGeometry(mesh, GeometryIndex(0)),
-      "abort: .*proximity_engine.*"
-      "The proximity engine does not support meshes yet.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.AddDynamicGeometry(mesh, GeometryIndex(0)), std::runtime_error,
+      "Error parsing file 'invalid/path/thing.obj' : .*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.AddAnchoredGeometry(mesh, Isometry3d::Identity(),
+                                 GeometryIndex(0)),
+      std::runtime_error, "Error parsing file 'invalid/path/thing.obj' : .*");
+  EXPECT_EQ(engine.num_geometries(), 0);
 }
 
-// Attempting to add a anchored Mesh should cause an abort.
-GTEST_TEST(ProximityEngineTests, AddAnchoredMesh) {
-  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+// Confirms that a Mesh participates in penetration queries. The mesh is the
+// cube [-1, 1]³; a sphere is placed so that it either overlaps the cube's +x
+// face or is separated from it.
+GTEST_TEST(ProximityEngineTests, MeshPenetration) {
   ProximityEngine<double> engine;
-  Mesh mesh{"invalid/path/thing.obj", 1.0};
-  ASSERT_DEATH(
-      engine.AddAnchoredGeometry(mesh, Isometry3d::Identity(),
-                                 GeometryIndex(0)),
-      "abort: .*proximity_engine.*"
-      "The proximity engine does not support meshes yet.*");
+  const Mesh mesh{
+      drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj"), 1.0};
+  const Sphere sphere{0.5};
+  engine.AddDynamicGeometry(mesh, GeometryIndex(0));
+  engine.AddDynamicGeometry(sphere, GeometryIndex(1));
+  const std::vector<GeometryId> geometry_map{GeometryId::get_new_id(),
+                                             GeometryId::get_new_id()};
+  const std::vector<GeometryIndex> indices{GeometryIndex(0),
+                                           GeometryIndex(1)};
+
+  std::vector<Isometry3d> poses{Isometry3d::Identity(),
+                                Isometry3d::Identity()};
+  poses[1].translation() << 1.25, 0, 0;
+  engine.UpdateWorldPoses(poses, indices);
+  std::vector<PenetrationAsPointPair<double>> results =
+      engine.ComputePointPairPenetration(geometry_map);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_GT(results[0].depth, 0.0);
+
+  poses[1].translation() << 2, 0, 0;
+  engine.UpdateWorldPoses(poses, indices);
+  results = engine.ComputePointPairPenetration(geometry_map);
+  EXPECT_EQ(results.size(), 0);
+}
+
+// Confirms the documented signed distance semantics of a Mesh: the distance is
+// measured to its triangulated surface, so a sphere inside the cube [-1, 1]³
+// is reported at a positive distance (no penetration depth), and point
+// queries ignore meshes. The bounding box of the mesh, which is computed once
+// when its shared geometry is created, must still follow the mesh's pose.
+GTEST_TEST(ProximityEngineTests, MeshSignedDistance) {
+  ProximityEngine<double> engine;
+  const Mesh mesh{
+      drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj"), 1.0};
+  const Sphere sphere{0.5};
+  engine.AddDynamicGeometry(mesh, GeometryIndex(0));
+  engine.AddDynamicGeometry(sphere, GeometryIndex(1));
+  const std::vector<GeometryId> geometry_map{GeometryId::get_new_id(),
+                                             GeometryId::get_new_id()};
+  const std::vector<GeometryIndex> indices{GeometryIndex(0),
+                                           GeometryIndex(1)};
+  const double kTolerance = 1e-6;
+
+  // The mesh is moved 3 units along x; the sphere is 0.5 beyond its +x face.
+  std::vector<Isometry3d> poses{Isometry3d::Identity(),
+                                Isometry3d::Identity()};
+  poses[0].translation() << 3, 0, 0;
+  poses[1].translation() << 5, 0, 0;
+  engine.UpdateWorldPoses(poses, indices);
+  std::vector<SignedDistancePair<double>> results =
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_NEAR(results[0].distance, 0.5, kTolerance);
+  // The bounding boxes are also 0.5 apart, so a smaller bound skips the pair.
+  results =
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map, 0.25);
+  EXPECT_EQ(results.size(), 0);
+
+  // The sphere at the center of the mesh is 0.5 from the mesh's surface.
+  poses[1].translation() << 3, 0, 0;
+  engine.UpdateWorldPoses(poses, indices);
+  results = engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_NEAR(results[0].distance, 0.5, kTolerance);
+
+  // Only the sphere is reported by a point query.
+  const std::vector<SignedDistanceToPoint<double>> point_results =
+      engine.ComputeSignedDistanceToPoint(Vector3d(3, 0, 0), geometry_map);
+  ASSERT_EQ(point_results.size(), 1);
+  EXPECT_EQ(point_results[0].id_G, geometry_map[1]);
 }
 
 }  // namespace
@@ -110,6 +110,10 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
       default_object->ComputeSignedDistancePairwiseClosestPoints());
   EXPECT_DEFAULT_ERROR(
       default_object->ComputeSignedDistanceToPoint(Vector3<double>::Zero()));
+  EXPECT_DEFAULT_ERROR(default_object->ComputeSignedDistanceToPoints(
+      {Vector3<double>::Zero()}));
+  EXPECT_DEFAULT_ERROR(default_object->ComputeSignedDistancePairClosestPoints(
+      {{GeometryId::get_new_id(), GeometryId::get_new_id()}}));
 
 #undef EXPECT_DEFAULT_ERROR
 }
@@ -1,33 +1,227 @@
 #include "drake/lcm/drake_lcm.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
+#include "drake/lcm/spsc_queue.h"
 
 namespace drake {
 namespace lcm {
 namespace {
 
-void Callback(const ::lcm::ReceiveBuffer* buffer,
-              const std::string& /* channel */ ,
-              DrakeLcm::HandlerFunction* context) {
-  DRAKE_DEMAND(buffer != nullptr);
-  DRAKE_DEMAND(context != nullptr);
-  DrakeLcm::HandlerFunction& handler = *context;
-  handler(buffer->data, buffer->data_size);
+// The number of messages each subscription can hold between the receive
+// thread and the dispatch threads.
+constexpr int kQueueCapacity = 64;
+
+// A received message, waiting to be dispatched.
+struct Message {
+  std::vector<uint8_t> bytes;
+  // The time LCM received the message, in microseconds since the epoch.
+  int64_t recv_utime{};
+};
+
+// Returns the current time on LCM's clock, in microseconds since the epoch.
+int64_t NowUtime() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
 }
 
 }  // namespace
 
+struct DrakeLcm::Subscription {
+  Subscription(const DrakeLcm* owner_in, std::string channel_in,
+               HandlerFunction handler_in)
+      : owner(owner_in),
+        channel(std::move(channel_in)),
+        handler(std::move(handler_in)) {}
+
+  Subscription(const DrakeLcm* owner_in, std::string channel_in,
+               std::function<std::unique_ptr<AbstractValue>()> allocate_in,
+               DecoderFunction decode_in,
+               DecodedHandlerFunction decoded_handler_in)
+      : owner(owner_in),
+        channel(std::move(channel_in)),
+        allocate(std::move(allocate_in)),
+        decode(std::move(decode_in)),
+        decoded_handler(std::move(decoded_handler_in)) {}
+
+  // Calls the handler (decoding the message first, if the subscription wants
+  // decoded messages) and records the message's latency.
+  void Handle(const void* data, int size, int64_t recv_utime) {
+    if (handler) {
+      handler(data, size);
+    } else {
+      if (decoded == nullptr) {
+        decoded = allocate();
+      }
+      decode(data, size, decoded.get());
+      decoded_handler(&decoded);
+    }
+    ++num_handled;
+    const int64_t latency = NowUtime() - recv_utime;
+    int bucket = 0;
+    while (bucket < kNumLatencyBuckets - 1 &&
+           (int64_t{1} << bucket) <= latency) {
+      ++bucket;
+    }
+    ++latency_histogram[bucket];
+  }
+
+  const DrakeLcm* const owner;
+  const std::string channel;
+  // Exactly one of handler or decoded_handler is set.
+  const HandlerFunction handler;
+  const std::function<std::unique_ptr<AbstractValue>()> allocate;
+  const DecoderFunction decode;
+  const DecodedHandlerFunction decoded_handler;
+  // The message object that the next message is decoded into; it is only
+  // used by the thread that is handling the subscription's messages.
+  std::unique_ptr<AbstractValue> decoded;
+
+  // Messages go from the receive thread to a dispatch thread through queue,
+  // and their buffers come back through free_buffers to be reused.
+  internal::SpscQueue<Message> queue{kQueueCapacity};
+  internal::SpscQueue<std::vector<uint8_t>> free_buffers{kQueueCapacity};
+  // Whether the subscription is waiting for, or being drained by, a dispatch
+  // thread. At most one dispatch thread drains a subscription at a time, so
+  // that queue has a single consumer.
+  std::atomic<bool> scheduled{false};
+
+  std::atomic<int64_t> num_handled{0};
+  std::atomic<int64_t> num_dropped{0};
+  std::array<std::atomic<int64_t>, kNumLatencyBuckets> latency_histogram{};
+};
+
+// A pool of threads that drain the queues of the scheduled subscriptions.
+class DrakeLcm::Dispatcher {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Dispatcher)
+
+  explicit Dispatcher(int num_threads) {
+    for (int i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this]() { Loop(); });
+    }
+  }
+
+  // Drains every scheduled subscription before returning.
+  ~Dispatcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    ready_.notify_all();
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  // Queues the given message for the subscription, and schedules the
+  // subscription unless it is already scheduled.
+  void Post(const ::lcm::ReceiveBuffer& buffer, Subscription* subscription) {
+    Message message;
+    subscription->free_buffers.TryPop(&message.bytes);
+    const uint8_t* const data = static_cast<const uint8_t*>(buffer.data);
+    message.bytes.assign(data, data + buffer.data_size);
+    message.recv_utime = buffer.recv_utime;
+    if (!subscription->queue.TryPush(&message)) {
+      ++subscription->num_dropped;
+      return;
+    }
+    // Pairs with the fence in Drain(), so that either the dispatch thread sees
+    // the new message, or we see that the subscription is no longer
+    // scheduled.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!subscription->scheduled.exchange(true)) {
+      Schedule(subscription);
+    }
+  }
+
+ private:
+  void Schedule(Subscription* subscription) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      scheduled_.push_back(subscription);
+    }
+    ready_.notify_one();
+  }
+
+  void Loop() {
+    while (true) {
+      Subscription* subscription{};
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this]() { return stop_ || !scheduled_.empty(); });
+        if (scheduled_.empty()) return;
+        subscription = scheduled_.front();
+        scheduled_.pop_front();
+      }
+      Drain(subscription);
+    }
+  }
+
+  static void Drain(Subscription* subscription) {
+    Message message;
+    do {
+      while (subscription->queue.TryPop(&message)) {
+        subscription->Handle(message.bytes.data(),
+                             static_cast<int>(message.bytes.size()),
+                             message.recv_utime);
+        subscription->free_buffers.TryPush(&message.bytes);
+      }
+      subscription->scheduled = false;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      // A message may have arrived after the last TryPop() but before the
+      // receive thread could see that we were done; if so, and nobody else
+      // has scheduled the subscription since, we keep draining.
+    } while (!subscription->queue.empty() &&
+             !subscription->scheduled.exchange(true));
+  }
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<Subscription*> scheduled_;
+  bool stop_{false};
+  std::vector<std::thread> threads_;
+};
+
+constexpr int DrakeLcm::kNumLatencyBuckets;
+
+void DrakeLcm::HandleReceived(const ::lcm::ReceiveBuffer* buffer,
+                              const std::string& /* channel */,
+                              Subscription* subscription) {
+  DRAKE_DEMAND(buffer != nullptr);
+  DRAKE_DEMAND(subscription != nullptr);
+  // This callback is only ever invoked from the receive thread, or from the
+  // user's own calls to LCM::handle() while there is no receive thread (and
+  // thus no dispatcher).
+  Dispatcher* const dispatcher = subscription->owner->dispatcher_.get();
+  if (dispatcher != nullptr) {
+    dispatcher->Post(*buffer, subscription);
+  } else {
+    subscription->Handle(buffer->data, buffer->data_size, buffer->recv_utime);
+  }
+}
+
 DrakeLcm::DrakeLcm() : DrakeLcm(std::string{}) {}
 
 DrakeLcm::DrakeLcm(std::string lcm_url)
     : requested_lcm_url_(std::move(lcm_url)),
       lcm_(requested_lcm_url_) {}
 
-DrakeLcm::~DrakeLcm() { receive_thread_.reset(); }
+DrakeLcm::~DrakeLcm() {
+  receive_thread_.reset();
+  dispatcher_.reset();
+}
 
 void DrakeLcm::StartReceiveThread() {
   DRAKE_DEMAND(receive_thread_ == nullptr);
@@ -37,7 +231,10 @@ void DrakeLcm::StartReceiveThread() {
   // the self-test happening concurrently with the LCM publishing.
   lcm_.getFileno();
 
-  // Now launch the thread.
+  // Now launch the threads.
+  if (num_dispatch_threads_ > 0) {
+    dispatcher_ = std::make_unique<Dispatcher>(num_dispatch_threads_);
+  }
   receive_thread_ = std::make_unique<LcmReceiveThread>(&lcm_);
 }
 
@@ -46,6 +243,30 @@ void DrakeLcm::StopReceiveThread() {
     receive_thread_->Stop();
     receive_thread_.reset();
   }
+  // This dispatches any messages still queued.
+  dispatcher_.reset();
+}
+
+void DrakeLcm::SetDispatchThreads(int num_threads) {
+  DRAKE_DEMAND(receive_thread_ == nullptr);
+  DRAKE_THROW_UNLESS(num_threads >= 0);
+  num_dispatch_threads_ = num_threads;
+}
+
+std::map<std::string, DrakeLcm::ChannelStatistics>
+DrakeLcm::GetChannelStatistics() const {
+  std::map<std::string, ChannelStatistics> result;
+  std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+  for (const auto& subscription : subscriptions_) {
+    ChannelStatistics& statistics = result[subscription->channel];
+    statistics.num_handled += subscription->num_handled;
+    statistics.num_dropped += subscription->num_dropped;
+    statistics.latency_histogram.resize(kNumLatencyBuckets);
+    for (int i = 0; i < kNumLatencyBuckets; ++i) {
+      statistics.latency_histogram[i] += subscription->latency_histogram[i];
+    }
+  }
+  return result;
 }
 
 ::lcm::LCM* DrakeLcm::get_lcm_instance() { return &lcm_; }
@@ -62,10 +283,32 @@ void DrakeLcm::Publish(const std::string& channel, const void* data,
 
 void DrakeLcm::Subscribe(const std::string& channel, HandlerFunction handler) {
   DRAKE_THROW_UNLESS(!channel.empty());
-  handlers_.emplace_back(std::move(handler));
-  // The handlers_ is a std::list so that the context pointers remain stable.
-  HandlerFunction* const context = &handlers_.back();
-  lcm_.subscribeFunction(channel, &Callback, context)->setQueueCapacity(1);
+  DRAKE_THROW_UNLESS(handler != nullptr);
+  AddSubscription(
+      std::make_unique<Subscription>(this, channel, std::move(handler)));
+}
+
+void DrakeLcm::SubscribeDecoded(
+    const std::string& channel,
+    std::function<std::unique_ptr<AbstractValue>()> allocate,
+    DecoderFunction decode, DecodedHandlerFunction handler) {
+  DRAKE_THROW_UNLESS(!channel.empty());
+  DRAKE_THROW_UNLESS(allocate != nullptr);
+  DRAKE_THROW_UNLESS(decode != nullptr);
+  DRAKE_THROW_UNLESS(handler != nullptr);
+  AddSubscription(std::make_unique<Subscription>(
+      this, channel, std::move(allocate), std::move(decode),
+      std::move(handler)));
+}
+
+void DrakeLcm::AddSubscription(std::unique_ptr<Subscription> subscription) {
+  Subscription* const context = subscription.get();
+  {
+    std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+    subscriptions_.push_back(std::move(subscription));
+  }
+  lcm_.subscribeFunction(context->channel, &DrakeLcm::HandleReceived, context)
+      ->setQueueCapacity(1);
 }
 
 }  // namespace lcm
@@ -1,8 +1,11 @@
 #pragma once
 
-#include <list>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "lcm/lcm-cpp.hpp"
 
@@ -58,6 +61,60 @@ class DrakeLcm : public DrakeLcmInterface {
    */
   void StopReceiveThread();
 
+  /**
+   * Chooses how received messages are handed to the subscribers' handlers.
+   *
+   * With @p num_threads = 0 (the default), the receive thread calls every
+   * handler itself, one message at a time.
+   *
+   * Otherwise, each subscription has its own bounded lock-free queue. The
+   * receive thread only moves each message into the queues of its channel's
+   * subscriptions (reusing the buffers of messages already handled), and a
+   * pool of @p num_threads worker threads calls the handlers. The handlers of
+   * one subscription are always called one message at a time, in the order
+   * received, but handlers of different subscriptions may run concurrently.
+   * If a subscription's queue is full when a message arrives, that message is
+   * dropped for that subscription (see ChannelStatistics::num_dropped).
+   * The messages of a SubscribeDecoded() subscription are decoded by the
+   * dispatch thread that handles them, not by the receive thread.
+   *
+   * @pre The receive thread is not running.
+   * @throws std::exception if `num_threads` is negative.
+   */
+  void SetDispatchThreads(int num_threads);
+
+  /** Returns the number of dispatch threads; see SetDispatchThreads(). */
+  int GetDispatchThreads() const { return num_dispatch_threads_; }
+
+  /** The number of buckets in ChannelStatistics::latency_histogram. */
+  static constexpr int kNumLatencyBuckets = 24;
+
+  /**
+   * Statistics about the messages received on one channel, summed over all of
+   * the channel's subscriptions. The latency of a message is the time from its
+   * reception by LCM until a subscription's handler returns.
+   */
+  struct ChannelStatistics {
+    /** The number of messages handed to the handlers. */
+    int64_t num_handled{};
+
+    /** The number of messages dropped because a queue was full. */
+    int64_t num_dropped{};
+
+    /**
+     * The number of handled messages by latency: bucket 0 counts latencies
+     * under 1 µs, and bucket i > 0 counts latencies in [2ⁱ⁻¹, 2ⁱ) µs. The
+     * last bucket also counts all longer latencies.
+     */
+    std::vector<int64_t> latency_histogram;
+  };
+
+  /**
+   * Returns the statistics of every subscribed channel. It is safe to call
+   * while messages are being received.
+   */
+  std::map<std::string, ChannelStatistics> GetChannelStatistics() const;
+
   /**
    * Indicates that the receiving thread is running.
    */
@@ -82,11 +139,34 @@ class DrakeLcm : public DrakeLcmInterface {
 
   void Subscribe(const std::string&, HandlerFunction) override;
 
+  void SubscribeDecoded(
+      const std::string&, std::function<std::unique_ptr<AbstractValue>()>,
+      DecoderFunction, DecodedHandlerFunction) override;
+
  private:
+  struct Subscription;
+  class Dispatcher;
+
+  // Takes ownership of the subscription and subscribes it to LCM.
+  void AddSubscription(std::unique_ptr<Subscription> subscription);
+
+  // The LCM callback of every subscription.
+  static void HandleReceived(const ::lcm::ReceiveBuffer* buffer,
+                             const std::string& channel,
+                             Subscription* subscription);
+
   std::string requested_lcm_url_;
   ::lcm::LCM lcm_;
+  int num_dispatch_threads_{0};
+  // Guards subscriptions_ against a concurrent GetChannelStatistics().
+  mutable std::mutex subscriptions_mutex_;
+  // The subscriptions are owned through pointers, so that the LCM callback
+  // contexts remain stable.
+  std::vector<std::unique_ptr<Subscription>> subscriptions_;
+  // Non-null iff the receive thread is running and num_dispatch_threads_ > 0.
+  // It is declared after the subscriptions, so that it is destroyed first.
+  std::unique_ptr<Dispatcher> dispatcher_;
   std::unique_ptr<LcmReceiveThread> receive_thread_{nullptr};
-  std::list<HandlerFunction> handlers_;
 };
 
 }  // namespace lcm
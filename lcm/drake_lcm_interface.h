@@ -3,13 +3,16 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/value.h"
 
 namespace drake {
 namespace lcm {
@@ -30,6 +33,26 @@ class DrakeLcmInterface {
    */
   using HandlerFunction = std::function<void(const void*, int)>;
 
+  /**
+   * A function used by DrakeLcmInterface::SubscribeDecoded() that decodes the
+   * given message bytes into an existing message object, with arguments:
+   * - `message_buffer` A pointer to the byte vector that is the serial
+   *   representation of the LCM message.
+   * - `message_size` The size of `message_buffer`.
+   * - `message` The message object to overwrite.
+   */
+  using DecoderFunction = std::function<void(const void*, int, AbstractValue*)>;
+
+  /**
+   * A callback used by DrakeLcmInterface::SubscribeDecoded(), with argument:
+   * - `message` The decoded message. The callback may take ownership of it,
+   *   or swap in another object made by the same subscription's allocator,
+   *   or leave it alone; whatever is left in `*message` (if non-null) is
+   *   reused to decode later messages.
+   */
+  using DecodedHandlerFunction =
+      std::function<void(std::unique_ptr<AbstractValue>*)>;
+
   /**
    * Publishes an LCM message on channel @p channel.
    *
@@ -56,6 +79,44 @@ class DrakeLcmInterface {
    */
   virtual void Subscribe(const std::string& channel, HandlerFunction) = 0;
 
+  /**
+   * Subscribes to an LCM channel, handing the handler messages that are
+   * already decoded. Because the handler can take ownership of each message
+   * object, nothing is copied between the decoding and the handler.
+   *
+   * The default implementation decodes within a Subscribe() handler;
+   * implementations that queue messages may instead decode them off of their
+   * receive thread.
+   *
+   * @param channel The channel to subscribe to.
+   * Must not be the empty string.
+   *
+   * @param allocate Creates a message object to decode into.
+   *
+   * @param decode Decodes message bytes into a message object.
+   *
+   * @param handler The callback when a message has been decoded.
+   */
+  virtual void SubscribeDecoded(
+      const std::string& channel,
+      std::function<std::unique_ptr<AbstractValue>()> allocate,
+      DecoderFunction decode, DecodedHandlerFunction handler) {
+    DRAKE_THROW_UNLESS(allocate != nullptr);
+    DRAKE_THROW_UNLESS(decode != nullptr);
+    DRAKE_THROW_UNLESS(handler != nullptr);
+    auto message = std::make_shared<std::unique_ptr<AbstractValue>>();
+    Subscribe(channel, [allocate = std::move(allocate),
+                        decode = std::move(decode),
+                        handler = std::move(handler),
+                        message](const void* data, int size) {
+      if (*message == nullptr) {
+        *message = allocate();
+      }
+      decode(data, size, message->get());
+      handler(message.get());
+    });
+  }
+
  protected:
   DrakeLcmInterface() = default;
 };
@@ -1,15 +1,181 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include <limits>
 #include <utility>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/lcm/lcm_log_index.h"
 
 namespace drake {
 namespace lcm {
 
+// Walks through the events of an LcmLogIndex, in timestamp order, either all
+// of them or only those on a subset of the channels.
+class DrakeLcmLog::IndexedPlayback {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IndexedPlayback)
+
+  IndexedPlayback(const std::string& file_name, const IndexOptions& options)
+      : log_data_(file_name) {
+    const std::string index_file_name =
+        options.index_file_name.empty()
+            ? LcmLogIndex::DefaultFileName(file_name)
+            : options.index_file_name;
+    try {
+      index_ = std::make_unique<LcmLogIndex>(index_file_name);
+    } catch (const std::runtime_error&) {
+      // There is no (valid) index yet; we'll build it below.
+    }
+    if (index_ == nullptr || !index_->IsCurrentFor(log_data_)) {
+      index_.reset();
+      LcmLogIndex::Build(file_name, index_file_name);
+      index_ = std::make_unique<LcmLogIndex>(index_file_name);
+    }
+
+    for (int c = 0; c < index_->num_channels(); ++c) {
+      channel_names_.push_back(index_->channel_name(c));
+    }
+    for (const std::string& name : options.channels) {
+      const optional<int> channel = index_->FindChannel(name);
+      // Channels without any messages have nothing to play back.
+      if (channel && std::find(channels_.begin(), channels_.end(), *channel) ==
+                         channels_.end()) {
+        channels_.push_back(*channel);
+      }
+    }
+    // With channels to select from, but none of them in the log, playback is
+    // immediately over.
+    all_channels_ = options.channels.empty();
+    cursor_.channel_positions.resize(channels_.size(), 0);
+    Update(&cursor_);
+    PrefetchAhead(0, 2 * kPrefetchEvents);
+  }
+
+  // Returns the next event, or nullptr at the end of the log.
+  const LcmLogIndex::Event* next_event() const {
+    if (cursor_.event == index_->num_events()) return nullptr;
+    return &index_->event(cursor_.event);
+  }
+
+  // Returns one past the timestamp of the log's last event, or zero if the
+  // log is empty.
+  uint64_t end_timestamp() const {
+    const int64_t num_events = index_->num_events();
+    return (num_events == 0) ? 0 : index_->event(num_events - 1).timestamp + 1;
+  }
+
+  const std::string& channel_name(const LcmLogIndex::Event& event) const {
+    return channel_names_[event.channel];
+  }
+
+  const void* data(const LcmLogIndex::Event& event) const {
+    return log_data_.data() + event.data_offset;
+  }
+
+  void Advance() {
+    Step(&cursor_);
+    // Keep the bytes of kPrefetchEvents to 2 * kPrefetchEvents upcoming events
+    // on their way into memory.
+    if (++num_advanced_ % kPrefetchEvents == 0) {
+      PrefetchAhead(kPrefetchEvents, kPrefetchEvents);
+    }
+  }
+
+  void Seek(uint64_t timestamp) {
+    if (all_channels_) {
+      cursor_.position = index_->LowerBound(timestamp);
+    } else {
+      for (size_t i = 0; i < channels_.size(); ++i) {
+        cursor_.channel_positions[i] =
+            index_->ChannelLowerBound(channels_[i], timestamp);
+      }
+    }
+    Update(&cursor_);
+    num_advanced_ = 0;
+    PrefetchAhead(0, 2 * kPrefetchEvents);
+  }
+
+ private:
+  static constexpr int kPrefetchEvents = 256;
+
+  // A position in the playback.
+  struct Cursor {
+    // With all channels, the next event.
+    int64_t position{0};
+    // Otherwise, the position of the next event within each channel's events.
+    std::vector<int64_t> channel_positions;
+    // The next event, or num_events() at the end.
+    int64_t event{0};
+    // The index into channels_ of the next event's channel.
+    int channel{-1};
+  };
+
+  // Sets the cursor's next event from its positions.
+  void Update(Cursor* cursor) const {
+    if (all_channels_) {
+      cursor->event = cursor->position;
+      return;
+    }
+    // The earliest event across the channels is the one with the lowest
+    // index, because the events are sorted by timestamp.
+    cursor->event = index_->num_events();
+    cursor->channel = -1;
+    for (int i = 0; i < static_cast<int>(channels_.size()); ++i) {
+      const int64_t k = cursor->channel_positions[i];
+      if (k < index_->num_channel_events(channels_[i])) {
+        const int64_t event = index_->channel_event(channels_[i], k);
+        if (event < cursor->event) {
+          cursor->event = event;
+          cursor->channel = i;
+        }
+      }
+    }
+  }
+
+  // Moves the cursor past its next event.
+  void Step(Cursor* cursor) const {
+    if (cursor->event >= index_->num_events()) return;
+    if (all_channels_) {
+      ++cursor->position;
+    } else {
+      ++cursor->channel_positions[cursor->channel];
+    }
+    Update(cursor);
+  }
+
+  // Prefetches the bytes of `count` events, starting `skip` events after the
+  // next one. Adjacent events are prefetched together.
+  void PrefetchAhead(int skip, int count) const {
+    Cursor cursor = cursor_;
+    for (int i = 0; i < skip; ++i) Step(&cursor);
+    uint64_t begin = 0;
+    uint64_t end = 0;
+    for (int i = 0; i < count && cursor.event < index_->num_events(); ++i) {
+      const LcmLogIndex::Event& event = index_->event(cursor.event);
+      if (event.data_offset != end) {
+        log_data_.Prefetch(begin, end - begin);
+        begin = event.data_offset;
+      }
+      end = event.data_offset + event.data_size;
+      Step(&cursor);
+    }
+    log_data_.Prefetch(begin, end - begin);
+  }
+
+  const internal::MemoryMappedFile log_data_;
+  std::unique_ptr<LcmLogIndex> index_;
+  std::vector<std::string> channel_names_;
+  bool all_channels_{true};
+  std::vector<int> channels_;
+  Cursor cursor_;
+  int64_t num_advanced_{0};
+};
+
 DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
                          bool overwrite_publish_time_with_system_clock)
     : is_write_(is_write),
@@ -26,6 +192,15 @@ DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
   }
 }
 
+DrakeLcmLog::DrakeLcmLog(const std::string& file_name,
+                         const IndexOptions& options)
+    : is_write_(false),
+      overwrite_publish_time_with_system_clock_(false),
+      indexed_playback_(
+          std::make_unique<IndexedPlayback>(file_name, options)) {}
+
+DrakeLcmLog::~DrakeLcmLog() {}
+
 void DrakeLcmLog::Publish(const std::string& channel, const void* data,
                           int data_size, optional<double> time_sec) {
   if (!is_write_) {
@@ -69,6 +244,13 @@ double DrakeLcmLog::GetNextMessageTime() const {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
+  if (indexed_playback_ != nullptr) {
+    const LcmLogIndex::Event* const event = indexed_playback_->next_event();
+    if (event == nullptr) {
+      return std::numeric_limits<double>::infinity();
+    }
+    return timestamp_to_second(event->timestamp);
+  }
   if (next_event_ == nullptr) {
     return std::numeric_limits<double>::infinity();
   }
@@ -82,6 +264,24 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
+  if (indexed_playback_ != nullptr) {
+    const LcmLogIndex::Event* const event = indexed_playback_->next_event();
+    // Do nothing at the end of the log, or if the call time does not match
+    // the event's time.
+    if (event == nullptr ||
+        current_time != timestamp_to_second(event->timestamp)) {
+      return;
+    }
+    const auto& range =
+        subscriptions_.equal_range(indexed_playback_->channel_name(*event));
+    for (auto iter = range.first; iter != range.second; ++iter) {
+      const HandlerFunction& handler = iter->second;
+      handler(indexed_playback_->data(*event), event->data_size);
+    }
+    indexed_playback_->Advance();
+    return;
+  }
+
   // End of log, do nothing.
   if (next_event_ == nullptr) return;
 
@@ -101,5 +301,31 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   next_event_ = log_->readNextEvent();
 }
 
+void DrakeLcmLog::Seek(double time_sec) {
+  if (indexed_playback_ == nullptr) {
+    throw std::logic_error("Seek is only available for indexed playback.");
+  }
+
+  DRAKE_THROW_UNLESS(!std::isnan(time_sec));
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Find the earliest timestamp whose time (as reported by
+  // GetNextMessageTime()) is no earlier than time_sec. Any time after the
+  // last message is clamped to just past it (the end of the playback), so
+  // that the conversion to a timestamp is defined and the search is short.
+  const uint64_t end_timestamp = indexed_playback_->end_timestamp();
+  uint64_t timestamp = end_timestamp;
+  if (time_sec < timestamp_to_second(end_timestamp)) {
+    timestamp = second_to_timestamp(std::max(time_sec, 0.0));
+    while (timestamp > 0 && timestamp_to_second(timestamp - 1) >= time_sec) {
+      --timestamp;
+    }
+    while (timestamp_to_second(timestamp) < time_sec) {
+      ++timestamp;
+    }
+  }
+  indexed_playback_->Seek(timestamp);
+}
+
 }  // namespace lcm
 }  // namespace drake
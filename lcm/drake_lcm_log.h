@@ -45,6 +45,43 @@ class DrakeLcmLog : public DrakeLcmInterface {
   DrakeLcmLog(const std::string& file_name, bool is_write,
               bool overwrite_publish_time_with_system_clock = false);
 
+  /**
+   * Options for indexed playback; see DrakeLcmLog(const std::string&, const
+   * IndexOptions&).
+   */
+  struct IndexOptions {
+    /**
+     * The name of the index file. If empty, it is
+     * LcmLogIndex::DefaultFileName() of the log's name.
+     */
+    std::string index_file_name;
+
+    /**
+     * If non-empty, only the messages on these channels are played back; the
+     * messages on other channels are skipped without being read.
+     */
+    std::vector<std::string> channels;
+  };
+
+  /**
+   * Constructs a DrakeLcmLog in read-only mode, that plays back the log
+   * @p file_name through an index of its messages (see LcmLogIndex). If the
+   * index file does not exist yet, is not a valid index, or was built from a
+   * log of a different size or modification time, it is (re)built first,
+   * which takes one pass over the log.
+   *
+   * Playback memory-maps the log, and only reads a message's bytes from the
+   * mapping when the message is dispatched; the bytes of the upcoming
+   * messages are prefetched in the background. Unlike the other constructor,
+   * it supports Seek().
+   *
+   * @throws std::runtime_error if unable to open the log or to build the
+   * index.
+   */
+  DrakeLcmLog(const std::string& file_name, const IndexOptions& options);
+
+  ~DrakeLcmLog() override;
+
   /**
    * Writes an entry occurred at @p timestamp with content @p data to the log
    * file. The current implementation blocks until writing is done.
@@ -94,11 +131,28 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Moves the playback to the first message (on the played back channels)
+   * whose time is no earlier than @p time_sec, so that GetNextMessageTime()
+   * returns that message's time. This takes O(log n) time in the number n of
+   * messages in the log, and reads none of them.
+   *
+   * @throws std::logic_error if this instance is not constructed for indexed
+   * playback.
+   * @throws std::exception if @p time_sec is NaN.
+   */
+  void Seek(double time_sec);
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
   bool is_write() const { return is_write_; }
 
+  /**
+   * Returns true if this instance is constructed for indexed playback.
+   */
+  bool is_indexed() const { return indexed_playback_ != nullptr; }
+
   /**
    * Converts @p timestamp (in microseconds) to time (in seconds) relative to
    * the starting time passed to the constructor.
@@ -116,6 +170,8 @@ class DrakeLcmLog : public DrakeLcmInterface {
   }
 
  private:
+  class IndexedPlayback;
+
   const bool is_write_;
   const bool overwrite_publish_time_with_system_clock_;
 
@@ -128,6 +184,9 @@ class DrakeLcmLog : public DrakeLcmInterface {
   std::multimap<std::string, DrakeLcmInterface::HandlerFunction> subscriptions_;
   std::unique_ptr<::lcm::LogFile> log_;
   const ::lcm::LogEvent* next_event_{nullptr};
+  // Non-null iff this instance is constructed for indexed playback, in which
+  // case log_ is null.
+  std::unique_ptr<IndexedPlayback> indexed_playback_;
 };
 
 }  // namespace lcm
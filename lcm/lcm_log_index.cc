@@ -0,0 +1,384 @@
+#include "drake/lcm/lcm_log_index.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace lcm {
+namespace internal {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& file_name) {
+  const int fd = ::open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error(fmt::format("Failed to open {}: {}", file_name,
+                                         std::strerror(errno)));
+  }
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0) {
+    const int error = errno;
+    ::close(fd);
+    throw std::runtime_error(fmt::format("Failed to stat {}: {}", file_name,
+                                         std::strerror(error)));
+  }
+  size_ = static_cast<uint64_t>(file_stat.st_size);
+#ifdef __APPLE__
+  const struct timespec& mtime = file_stat.st_mtimespec;
+#else
+  const struct timespec& mtime = file_stat.st_mtim;
+#endif
+  modification_time_ =
+      static_cast<int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec;
+  if (size_ > 0) {
+    void* const data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+      const int error = errno;
+      ::close(fd);
+      throw std::runtime_error(fmt::format("Failed to map {}: {}", file_name,
+                                           std::strerror(error)));
+    }
+    data_ = static_cast<const uint8_t*>(data);
+  }
+  // The mapping stays valid after the file descriptor is closed.
+  ::close(fd);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<uint8_t*>(data_), size_);
+  }
+}
+
+void MemoryMappedFile::Prefetch(uint64_t offset, uint64_t size) const {
+  if (data_ == nullptr || offset >= size_) return;
+  size = std::min(size, size_ - offset);
+  // madvise() requires a page-aligned address.
+  const uint64_t page_size = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+  const uint64_t begin = offset - offset % page_size;
+  ::madvise(const_cast<uint8_t*>(data_) + begin, offset + size - begin,
+            MADV_WILLNEED);
+}
+
+}  // namespace internal
+
+namespace {
+
+// The layout of an LCM log event header: a sync word, an event number, a
+// timestamp, the channel name's length and the message's length, all stored
+// in big-endian order. The channel name and the message follow.
+constexpr uint32_t kLogSyncWord = 0xEDA1DA01;
+constexpr uint64_t kLogHeaderSize = 4 + 8 + 8 + 4 + 4;
+
+uint64_t ReadBigEndian(const uint8_t* bytes, int num_bytes) {
+  uint64_t result = 0;
+  for (int i = 0; i < num_bytes; ++i) {
+    result = (result << 8) | bytes[i];
+  }
+  return result;
+}
+
+constexpr char kIndexMagic[8] = {'D', 'R', 'K', 'L', 'C', 'M', 'I', 'X'};
+constexpr uint32_t kIndexVersion = 2;
+constexpr uint32_t kByteOrderMark = 0x01020304;
+
+}  // namespace
+
+// The layout of an index file is
+//   Header,
+//   Channel[num_channels],
+//   Event[num_events]         (in timestamp order),
+//   int64_t[num_events]       (the events of each channel, channel by channel),
+//   char[names_size]          (the channel names, back to back).
+struct LcmLogIndex::Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order_mark;
+  uint64_t log_size;
+  int64_t log_modification_time;
+  uint64_t num_events;
+  uint64_t num_channels;
+  uint64_t names_size;
+};
+
+struct LcmLogIndex::Channel {
+  // The channel's name in the names section.
+  uint64_t name_offset;
+  uint64_t name_size;
+  // The channel's events in the channel events section.
+  uint64_t first_event;
+  uint64_t num_events;
+};
+
+std::string LcmLogIndex::DefaultFileName(const std::string& log_file_name) {
+  return log_file_name + ".idx";
+}
+
+void LcmLogIndex::Build(const std::string& log_file_name,
+                        const std::string& index_file_name) {
+  const internal::MemoryMappedFile log(log_file_name);
+  const uint8_t* const data = log.data();
+  const uint64_t size = log.size();
+
+  std::vector<Event> events;
+  std::vector<std::string> channel_names;
+  std::map<std::string, uint32_t> channel_indices;
+  uint64_t offset = 0;
+  while (offset + kLogHeaderSize <= size) {
+    const uint8_t* const header = data + offset;
+    if (ReadBigEndian(header, 4) != kLogSyncWord) {
+      // Skip garbage until the next sync word.
+      ++offset;
+      continue;
+    }
+    const uint64_t timestamp = ReadBigEndian(header + 12, 8);
+    const uint64_t channel_size = ReadBigEndian(header + 20, 4);
+    const uint64_t data_size = ReadBigEndian(header + 24, 4);
+    const uint64_t channel_offset = offset + kLogHeaderSize;
+    const uint64_t data_offset = channel_offset + channel_size;
+    if (data_offset + data_size > size) {
+      // The last event was cut off.
+      break;
+    }
+    const std::string channel(
+        reinterpret_cast<const char*>(data + channel_offset), channel_size);
+    auto inserted = channel_indices.emplace(
+        channel, static_cast<uint32_t>(channel_names.size()));
+    if (inserted.second) {
+      channel_names.push_back(channel);
+    }
+    events.push_back(Event{timestamp, data_offset,
+                           static_cast<uint32_t>(data_size),
+                           inserted.first->second});
+    offset = data_offset + data_size;
+  }
+
+  // Logs are normally written in timestamp order already, in which case this
+  // keeps them as they are.
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event& a, const Event& b) {
+                     return a.timestamp < b.timestamp;
+                   });
+
+  const int num_channels = static_cast<int>(channel_names.size());
+  std::vector<Channel> channels(num_channels, Channel{0, 0, 0, 0});
+  std::string names;
+  for (int c = 0; c < num_channels; ++c) {
+    channels[c].name_offset = names.size();
+    channels[c].name_size = channel_names[c].size();
+    names += channel_names[c];
+  }
+  for (const Event& event : events) {
+    ++channels[event.channel].num_events;
+  }
+  uint64_t first_event = 0;
+  for (Channel& channel : channels) {
+    channel.first_event = first_event;
+    first_event += channel.num_events;
+  }
+  std::vector<int64_t> channel_events(events.size());
+  std::vector<uint64_t> next(num_channels);
+  for (int c = 0; c < num_channels; ++c) {
+    next[c] = channels[c].first_event;
+  }
+  for (int64_t i = 0; i < static_cast<int64_t>(events.size()); ++i) {
+    channel_events[next[events[i].channel]++] = i;
+  }
+
+  Header header{};
+  std::memcpy(header.magic, kIndexMagic, sizeof(header.magic));
+  header.version = kIndexVersion;
+  header.byte_order_mark = kByteOrderMark;
+  header.log_size = size;
+  header.log_modification_time = log.modification_time();
+  header.num_events = events.size();
+  header.num_channels = num_channels;
+  header.names_size = names.size();
+
+  // Write to a temporary file first, so that readers never see a partial
+  // index.
+  const std::string temp_file_name = index_file_name + ".tmp";
+  std::FILE* const file = std::fopen(temp_file_name.c_str(), "wb");
+  if (file == nullptr) {
+    throw std::runtime_error(fmt::format("Failed to create {}: {}",
+                                         temp_file_name, std::strerror(errno)));
+  }
+  auto write = [file](const void* bytes, size_t num_bytes) {
+    return num_bytes == 0 || std::fwrite(bytes, num_bytes, 1, file) == 1;
+  };
+  const bool written =
+      write(&header, sizeof(header)) &&
+      write(channels.data(), channels.size() * sizeof(Channel)) &&
+      write(events.data(), events.size() * sizeof(Event)) &&
+      write(channel_events.data(), channel_events.size() * sizeof(int64_t)) &&
+      write(names.data(), names.size());
+  if ((std::fclose(file) != 0) || !written ||
+      (std::rename(temp_file_name.c_str(), index_file_name.c_str()) != 0)) {
+    std::remove(temp_file_name.c_str());
+    throw std::runtime_error("Failed to write " + index_file_name);
+  }
+}
+
+LcmLogIndex::LcmLogIndex(const std::string& index_file_name)
+    : file_(index_file_name) {
+  auto invalid = [&index_file_name]() {
+    return std::runtime_error(index_file_name +
+                              " is not a valid LCM log index");
+  };
+  if (file_.size() < sizeof(Header)) throw invalid();
+  header_ = reinterpret_cast<const Header*>(file_.data());
+  if (std::memcmp(header_->magic, kIndexMagic, sizeof(kIndexMagic)) != 0 ||
+      header_->version != kIndexVersion ||
+      header_->byte_order_mark != kByteOrderMark) {
+    throw invalid();
+  }
+  // Checks every count, offset, and size against the file before using it,
+  // and in a way that cannot overflow, so that a corrupt index is rejected
+  // here rather than read out of bounds later.
+  const uint64_t num_events = header_->num_events;
+  const uint64_t num_channels = header_->num_channels;
+  const uint64_t names_size = header_->names_size;
+  uint64_t remaining = file_.size() - sizeof(Header);
+  if (num_channels > static_cast<uint64_t>(std::numeric_limits<int>::max()) ||
+      num_channels > remaining / sizeof(Channel)) {
+    throw invalid();
+  }
+  remaining -= num_channels * sizeof(Channel);
+  if (num_events > remaining / (sizeof(Event) + sizeof(int64_t))) {
+    throw invalid();
+  }
+  remaining -= num_events * (sizeof(Event) + sizeof(int64_t));
+  if (names_size != remaining) throw invalid();
+
+  const uint64_t channels_offset = sizeof(Header);
+  const uint64_t events_offset =
+      channels_offset + num_channels * sizeof(Channel);
+  const uint64_t channel_events_offset =
+      events_offset + num_events * sizeof(Event);
+  const uint64_t names_offset =
+      channel_events_offset + num_events * sizeof(int64_t);
+  channels_ = reinterpret_cast<const Channel*>(file_.data() + channels_offset);
+  events_ = reinterpret_cast<const Event*>(file_.data() + events_offset);
+  channel_events_ =
+      reinterpret_cast<const int64_t*>(file_.data() + channel_events_offset);
+  names_ = reinterpret_cast<const char*>(file_.data() + names_offset);
+
+  for (uint64_t c = 0; c < num_channels; ++c) {
+    const Channel& channel = channels_[c];
+    if (channel.name_offset > names_size ||
+        channel.name_size > names_size - channel.name_offset ||
+        channel.first_event > num_events ||
+        channel.num_events > num_events - channel.first_event) {
+      throw invalid();
+    }
+  }
+  const uint64_t log_size = header_->log_size;
+  for (uint64_t i = 0; i < num_events; ++i) {
+    const Event& event = events_[i];
+    if (event.channel >= num_channels || event.data_offset > log_size ||
+        event.data_size > log_size - event.data_offset ||
+        (i > 0 && event.timestamp < events_[i - 1].timestamp)) {
+      throw invalid();
+    }
+  }
+  for (uint64_t c = 0; c < num_channels; ++c) {
+    const Channel& channel = channels_[c];
+    for (uint64_t k = 0; k < channel.num_events; ++k) {
+      const int64_t i = channel_events_[channel.first_event + k];
+      if (i < 0 || static_cast<uint64_t>(i) >= num_events ||
+          events_[i].channel != c ||
+          (k > 0 && i <= channel_events_[channel.first_event + k - 1])) {
+        throw invalid();
+      }
+    }
+  }
+}
+
+LcmLogIndex::~LcmLogIndex() {}
+
+uint64_t LcmLogIndex::log_size() const { return header_->log_size; }
+
+int64_t LcmLogIndex::log_modification_time() const {
+  return header_->log_modification_time;
+}
+
+bool LcmLogIndex::IsCurrentFor(const internal::MemoryMappedFile& log) const {
+  return log_size() == log.size() &&
+         log_modification_time() == log.modification_time();
+}
+
+int64_t LcmLogIndex::num_events() const {
+  return static_cast<int64_t>(header_->num_events);
+}
+
+const LcmLogIndex::Event& LcmLogIndex::event(int64_t i) const {
+  DRAKE_ASSERT(i >= 0 && i < num_events());
+  return events_[i];
+}
+
+int64_t LcmLogIndex::LowerBound(uint64_t timestamp) const {
+  const Event* const end = events_ + num_events();
+  return std::lower_bound(events_, end, timestamp,
+                          [](const Event& event, uint64_t value) {
+                            return event.timestamp < value;
+                          }) -
+         events_;
+}
+
+int LcmLogIndex::num_channels() const {
+  return static_cast<int>(header_->num_channels);
+}
+
+std::string LcmLogIndex::channel_name(int channel) const {
+  DRAKE_ASSERT(channel >= 0 && channel < num_channels());
+  return std::string(names_ + channels_[channel].name_offset,
+                     channels_[channel].name_size);
+}
+
+optional<int> LcmLogIndex::FindChannel(const std::string& name) const {
+  for (int c = 0; c < num_channels(); ++c) {
+    if (name.size() == channels_[c].name_size &&
+        name.compare(0, name.size(), names_ + channels_[c].name_offset,
+                     channels_[c].name_size) == 0) {
+      return c;
+    }
+  }
+  return nullopt;
+}
+
+int64_t LcmLogIndex::num_channel_events(int channel) const {
+  DRAKE_ASSERT(channel >= 0 && channel < num_channels());
+  return static_cast<int64_t>(channels_[channel].num_events);
+}
+
+int64_t LcmLogIndex::channel_event(int channel, int64_t k) const {
+  DRAKE_ASSERT(k >= 0 && k < num_channel_events(channel));
+  return channel_events_[channels_[channel].first_event + k];
+}
+
+int64_t LcmLogIndex::ChannelLowerBound(int channel, uint64_t timestamp) const {
+  const int64_t* const begin =
+      channel_events_ + channels_[channel].first_event;
+  const int64_t* const end = begin + num_channel_events(channel);
+  return std::lower_bound(begin, end, timestamp,
+                          [this](int64_t i, uint64_t value) {
+                            return events_[i].timestamp < value;
+                          }) -
+         begin;
+}
+
+}  // namespace lcm
+}  // namespace drake
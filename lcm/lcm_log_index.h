@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
+
+namespace drake {
+namespace lcm {
+namespace internal {
+
+/// A read-only memory mapping of an entire file.
+class MemoryMappedFile {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MemoryMappedFile)
+
+  /// Maps the file named @p file_name.
+  /// @throws std::runtime_error if the file cannot be opened or mapped.
+  explicit MemoryMappedFile(const std::string& file_name);
+
+  ~MemoryMappedFile();
+
+  /// Returns the file's contents; this is null iff the file is empty.
+  const uint8_t* data() const { return data_; }
+
+  /// Returns the size of the file in bytes.
+  uint64_t size() const { return size_; }
+
+  /// Returns the file's last modification time when it was mapped, in
+  /// nanoseconds since the epoch.
+  int64_t modification_time() const { return modification_time_; }
+
+  /// Hints to the operating system that the bytes in [offset, offset + size)
+  /// will be read soon, so that it can start reading them in the background.
+  void Prefetch(uint64_t offset, uint64_t size) const;
+
+ private:
+  const uint8_t* data_{nullptr};
+  uint64_t size_{0};
+  int64_t modification_time_{0};
+};
+
+}  // namespace internal
+
+/**
+ * An index of the messages in an LCM log file, kept in a sidecar file next to
+ * the log. The index is built once, by a single pass over the message headers
+ * of the log, and is afterwards memory-mapped, so that opening it costs
+ * (nearly) nothing, regardless of the size of the log.
+ *
+ * The index lists the events (messages) of the log sorted by timestamp (the
+ * log's order is kept among equal timestamps), as well as the events of each
+ * channel, so that both the first event at or after a given time, overall or
+ * on one channel, are found in O(log n).
+ *
+ * The sidecar file uses the byte order of the machine that built it, and
+ * records the size and modification time of the indexed log, so that a stale
+ * index can be detected with IsCurrentFor(). An index that is corrupt or from
+ * a machine with a different byte order is rejected when opened.
+ */
+class LcmLogIndex {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmLogIndex)
+
+  /// An event in the log, as stored in the index.
+  struct Event {
+    /// The event's timestamp, in microseconds.
+    uint64_t timestamp;
+    /// The position of the event's message bytes in the log file.
+    uint64_t data_offset;
+    /// The number of message bytes.
+    uint32_t data_size;
+    /// The index of the event's channel; see channel_name().
+    uint32_t channel;
+  };
+
+  /// Returns the name of the sidecar file for @p log_file_name used by
+  /// default, i.e., `log_file_name` with `.idx` appended.
+  static std::string DefaultFileName(const std::string& log_file_name);
+
+  /// Indexes the log @p log_file_name into @p index_file_name, which is
+  /// replaced if it exists. Events whose header or message bytes are cut off
+  /// by the end of the log are not indexed; bytes between events that are not
+  /// a valid event header are skipped.
+  /// @throws std::runtime_error if the log cannot be read or the index cannot
+  /// be written.
+  static void Build(const std::string& log_file_name,
+                    const std::string& index_file_name);
+
+  /// Maps the index in @p index_file_name, and checks that every count,
+  /// offset, and size in it is consistent with the index file and with the
+  /// recorded size of the log.
+  /// @throws std::runtime_error if the file cannot be mapped or is not a
+  /// valid index.
+  explicit LcmLogIndex(const std::string& index_file_name);
+
+  ~LcmLogIndex();
+
+  /// Returns the size in bytes of the log this index was built from.
+  uint64_t log_size() const;
+
+  /// Returns the modification time of the log this index was built from, in
+  /// nanoseconds since the epoch.
+  int64_t log_modification_time() const;
+
+  /// Returns true iff @p log has the size and modification time of the log
+  /// this index was built from, i.e., the index is not stale.
+  bool IsCurrentFor(const internal::MemoryMappedFile& log) const;
+
+  /// Returns the number of events in the log.
+  int64_t num_events() const;
+
+  /// Returns the `i`th event in timestamp order.
+  /// @pre 0 <= i < num_events().
+  const Event& event(int64_t i) const;
+
+  /// Returns the first event with a timestamp no earlier than @p timestamp,
+  /// or num_events() if there is none.
+  int64_t LowerBound(uint64_t timestamp) const;
+
+  /// Returns the number of distinct channels in the log.
+  int num_channels() const;
+
+  /// Returns the name of channel @p channel.
+  /// @pre 0 <= channel < num_channels().
+  std::string channel_name(int channel) const;
+
+  /// Returns the index of the channel named @p name, or nullopt if there is
+  /// no event on that channel.
+  optional<int> FindChannel(const std::string& name) const;
+
+  /// Returns the number of events on channel @p channel.
+  int64_t num_channel_events(int channel) const;
+
+  /// Returns (the index of) the `k`th event on channel @p channel.
+  /// @pre 0 <= k < num_channel_events(channel).
+  int64_t channel_event(int channel, int64_t k) const;
+
+  /// Returns the first k such that `event(channel_event(channel, k))` has a
+  /// timestamp no earlier than @p timestamp, or num_channel_events(channel)
+  /// if there is none.
+  int64_t ChannelLowerBound(int channel, uint64_t timestamp) const;
+
+ private:
+  struct Header;
+  struct Channel;
+
+  internal::MemoryMappedFile file_;
+  const Header* header_{};
+  const Channel* channels_{};
+  const Event* events_{};
+  const int64_t* channel_events_{};
+  const char* names_{};
+};
+
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace lcm {
+namespace internal {
+
+/**
+ * A bounded, lock-free queue with exactly one producer thread and exactly one
+ * consumer thread. TryPush() must only be called by the producer and TryPop()
+ * only by the consumer; neither ever blocks. The queue's slots are allocated
+ * once, at construction, and values are moved in and out of them.
+ *
+ * @tparam T The type of the queued values; it must be default constructible
+ * and move assignable.
+ */
+template <typename T>
+class SpscQueue {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SpscQueue)
+
+  /**
+   * Constructs a queue that holds up to @p capacity values.
+   * @throws std::exception if `capacity` is not positive.
+   */
+  explicit SpscQueue(int capacity) : slots_(CheckCapacity(capacity) + 1) {}
+
+  /** Returns the maximum number of values in the queue. */
+  int capacity() const { return static_cast<int>(slots_.size()) - 1; }
+
+  /**
+   * (Producer only.) Moves `*value` to the back of the queue, unless the queue
+   * is full; `*value` is left untouched in that case.
+   * @returns true iff the value was queued.
+   */
+  bool TryPush(T* value) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t next = Next(tail);
+    if (next == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    slots_[tail] = std::move(*value);
+    tail_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * (Consumer only.) Moves the value at the front of the queue into `*value`,
+   * unless the queue is empty.
+   * @returns true iff a value was popped.
+   */
+  bool TryPop(T* value) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *value = std::move(slots_[head]);
+    head_.store(Next(head), std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Returns true iff the queue has no values. When called by the consumer,
+   * the answer can only become stale by the producer pushing more values (and
+   * vice versa).
+   */
+  bool empty() const {
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_acquire);
+  }
+
+ private:
+  static int CheckCapacity(int capacity) {
+    DRAKE_THROW_UNLESS(capacity > 0);
+    return capacity;
+  }
+
+  size_t Next(size_t index) const {
+    return (index + 1 == slots_.size()) ? 0 : index + 1;
+  }
+
+  // One slot is always left empty, so that a full queue can be told apart
+  // from an empty one.
+  std::vector<T> slots_;
+
+  // The index of the front value, written only by the consumer, and the index
+  // one past the back value, written only by the producer.
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+};
+
+}  // namespace internal
+}  // namespace lcm
+}  // namespace drake
@@ -1,6 +1,9 @@
 #include "drake/lcm/drake_lcm_interface.h"
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -99,6 +102,34 @@ TEST_F(DrakeLcmInterfaceTest, CustomErrorHandlingTest) {
   EXPECT_TRUE(error);
 }
 
+TEST_F(DrakeLcmInterfaceTest, DefaultSubscribeDecodedTest) {
+  // Subscribe using the default implementation, keeping every message.
+  int num_allocated = 0;
+  std::vector<std::unique_ptr<AbstractValue>> received;
+  lcm_.SubscribeDecoded(
+      channel_,
+      [&]() {
+        ++num_allocated;
+        return AbstractValue::Make<Message>(Message{});
+      },
+      [](const void* data, int size, AbstractValue* message) {
+        message->GetMutableValue<Message>().decode(data, 0, size);
+      },
+      [&](std::unique_ptr<AbstractValue>* message) {
+        received.push_back(std::move(*message));
+      });
+
+  // Each message is decoded into a new object, since we took the old one.
+  Publish(&lcm_, channel_, sample_);
+  Publish(&lcm_, channel_, sample_);
+  ASSERT_EQ(received.size(), 2);
+  EXPECT_EQ(num_allocated, 2);
+  for (const auto& message : received) {
+    EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+        message->GetValue<Message>(), sample_));
+  }
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
@@ -1,10 +1,16 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <cstdio>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "drake/lcm/lcm_log_index.h"
 #include "drake/lcmt_drake_signal.hpp"
 
 namespace drake {
@@ -53,6 +59,121 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   }
 }
 
+// Writes a log with `num_messages` messages, whose payload is their sequence
+// number i, logged at time i / 8 on channel "channel_<i % 3>". (The times are
+// exact in binary.)
+void WriteTestLog(const std::string& file_name, int num_messages) {
+  DrakeLcmLog log(file_name, true);
+  for (int i = 0; i < num_messages; ++i) {
+    log.Publish("channel_" + std::to_string(i % 3), &i, sizeof(i), i / 8.0);
+  }
+}
+
+// Plays back the whole remaining log, and returns the sequence numbers of the
+// messages received on any channel.
+std::vector<int> PlayBack(DrakeLcmLog* log) {
+  std::vector<int> received;
+  for (int c = 0; c < 3; ++c) {
+    log->Subscribe("channel_" + std::to_string(c),
+                   [&received](const void* data, int size) {
+                     ASSERT_EQ(size, static_cast<int>(sizeof(int)));
+                     int i;
+                     std::memcpy(&i, data, sizeof(i));
+                     received.push_back(i);
+                   });
+  }
+  double time = log->GetNextMessageTime();
+  while (time != std::numeric_limits<double>::infinity()) {
+    log->DispatchMessageAndAdvanceLog(time);
+    time = log->GetNextMessageTime();
+  }
+  return received;
+}
+
+std::vector<int> Range(int begin, int end, int step = 1) {
+  std::vector<int> result;
+  for (int i = begin; i < end; i += step) result.push_back(i);
+  return result;
+}
+
+GTEST_TEST(LcmLogTest, IndexedPlayback) {
+  const std::string file_name = "indexed.log";
+  WriteTestLog(file_name, 30);
+  std::remove(LcmLogIndex::DefaultFileName(file_name).c_str());
+
+  // The first playback builds the index, and the second reuses it.
+  for (int trial = 0; trial < 2; ++trial) {
+    DrakeLcmLog log(file_name, DrakeLcmLog::IndexOptions{});
+    EXPECT_FALSE(log.is_write());
+    EXPECT_EQ(log.GetNextMessageTime(), 0);
+    EXPECT_EQ(PlayBack(&log), Range(0, 30));
+  }
+  EXPECT_NO_THROW(LcmLogIndex(LcmLogIndex::DefaultFileName(file_name)));
+
+  // A different log under the same name makes the index stale; it's rebuilt.
+  WriteTestLog(file_name, 12);
+  DrakeLcmLog log(file_name, DrakeLcmLog::IndexOptions{});
+  EXPECT_EQ(PlayBack(&log), Range(0, 12));
+
+  DrakeLcmLog write_log(file_name, true);
+  EXPECT_THROW(write_log.Seek(0), std::logic_error);
+}
+
+GTEST_TEST(LcmLogTest, IndexedSeek) {
+  const std::string file_name = "seek.log";
+  WriteTestLog(file_name, 30);
+  DrakeLcmLog::IndexOptions options;
+  options.index_file_name = "seek_index.idx";
+  DrakeLcmLog log(file_name, options);
+
+  // Seek forward, to an exact message time and in between messages.
+  log.Seek(20 / 8.0);
+  EXPECT_EQ(log.GetNextMessageTime(), 20 / 8.0);
+  log.Seek(1.3);
+  EXPECT_EQ(log.GetNextMessageTime(), 11 / 8.0);
+  EXPECT_EQ(PlayBack(&log), Range(11, 30));
+
+  // Seek backward, and past the end.
+  log.Seek(0);
+  EXPECT_EQ(log.GetNextMessageTime(), 0);
+  log.Seek(100);
+  EXPECT_EQ(log.GetNextMessageTime(), std::numeric_limits<double>::infinity());
+
+  // Times too large for a timestamp are past the end, too.
+  const double kInf = std::numeric_limits<double>::infinity();
+  for (double time : {1e30, std::numeric_limits<double>::max(), kInf}) {
+    log.Seek(0);
+    log.Seek(time);
+    EXPECT_EQ(log.GetNextMessageTime(), kInf);
+  }
+  log.Seek(-kInf);
+  EXPECT_EQ(log.GetNextMessageTime(), 0);
+  EXPECT_THROW(log.Seek(std::numeric_limits<double>::quiet_NaN()),
+               std::exception);
+}
+
+GTEST_TEST(LcmLogTest, IndexedChannels) {
+  const std::string file_name = "channels.log";
+  WriteTestLog(file_name, 30);
+  DrakeLcmLog::IndexOptions options;
+  options.channels = {"channel_1", "channel_2", "no_such_channel"};
+
+  DrakeLcmLog log(file_name, options);
+  EXPECT_EQ(log.GetNextMessageTime(), 1 / 8.0);
+  log.Seek(1.6);
+  EXPECT_EQ(log.GetNextMessageTime(), 13 / 8.0);
+  std::vector<int> expected;
+  for (int i = 13; i < 30; ++i) {
+    if (i % 3 != 0) expected.push_back(i);
+  }
+  EXPECT_EQ(PlayBack(&log), expected);
+
+  options.channels = {"no_such_channel"};
+  DrakeLcmLog empty_log(file_name, options);
+  EXPECT_EQ(empty_log.GetNextMessageTime(),
+            std::numeric_limits<double>::infinity());
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
@@ -1,13 +1,18 @@
 #include "drake/lcm/drake_lcm.h"
 
 #include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/value.h"
 #include "drake/lcm/lcm_receive_thread.h"
 #include "drake/lcm/lcmt_drake_signal_utils.h"
 #include "drake/lcmt_drake_signal.hpp"
@@ -210,6 +215,147 @@ TEST_F(DrakeLcmTest, SubscribeTest) {
   EXPECT_TRUE(done);
 }
 
+// Tests that messages on several channels reach their handlers, in order, when
+// dispatched by worker threads, and that the statistics account for them.
+TEST_F(DrakeLcmTest, DispatchThreadsTest) {
+  const std::vector<std::string> channel_names{
+      "drake_lcm_dispatch_channel_0", "drake_lcm_dispatch_channel_1",
+      "drake_lcm_dispatch_channel_2"};
+
+  DrakeLcm dut;
+  EXPECT_EQ(dut.GetDispatchThreads(), 0);
+  dut.SetDispatchThreads(2);
+  EXPECT_EQ(dut.GetDispatchThreads(), 2);
+  EXPECT_THROW(dut.SetDispatchThreads(-1), std::exception);
+
+  // Each handler records the last sequence number it received on its channel,
+  // and whether the sequence numbers were always increasing.
+  std::mutex mutex;
+  std::vector<int> last_received(channel_names.size(), -1);
+  bool in_order = true;
+  for (int i = 0; i < static_cast<int>(channel_names.size()); ++i) {
+    dut.Subscribe(channel_names[i], [&, i](const void* data, int size) {
+      ASSERT_EQ(size, static_cast<int>(sizeof(int)));
+      int sequence;
+      std::memcpy(&sequence, data, sizeof(sequence));
+      std::lock_guard<std::mutex> lock(mutex);
+      in_order = in_order && (sequence > last_received[i]);
+      last_received[i] = sequence;
+    });
+  }
+
+  dut.StartReceiveThread();
+
+  // Prevents this unit test from running indefinitely when the messages are
+  // never received.
+  int count = 0;
+  const int kMaxCount = 10;
+  const int kDelayMS = 500;
+  const int kMessagesPerRound = 100;
+
+  bool done = false;
+  while (!done && count < kMaxCount) {
+    for (int j = 0; j < kMessagesPerRound; ++j) {
+      const int sequence = count * kMessagesPerRound + j;
+      for (const std::string& channel_name : channel_names) {
+        dut.Publish(channel_name, &sequence, sizeof(sequence), {});
+      }
+    }
+    ++count;
+    sleep_for(milliseconds(kDelayMS));
+    std::lock_guard<std::mutex> lock(mutex);
+    done = true;
+    for (int last : last_received) {
+      done = done && (last == count * kMessagesPerRound - 1);
+    }
+  }
+
+  dut.StopReceiveThread();
+  EXPECT_TRUE(done);
+  EXPECT_TRUE(in_order);
+
+  const std::map<std::string, DrakeLcm::ChannelStatistics> statistics =
+      dut.GetChannelStatistics();
+  ASSERT_EQ(statistics.size(), channel_names.size());
+  for (const std::string& channel_name : channel_names) {
+    const DrakeLcm::ChannelStatistics& channel = statistics.at(channel_name);
+    EXPECT_GT(channel.num_handled, 0);
+    ASSERT_EQ(channel.latency_histogram.size(), DrakeLcm::kNumLatencyBuckets);
+    int64_t num_in_histogram = 0;
+    for (int64_t num : channel.latency_histogram) {
+      num_in_histogram += num;
+    }
+    EXPECT_EQ(num_in_histogram, channel.num_handled);
+  }
+}
+
+// Tests that SubscribeDecoded() hands over decoded messages, with or without
+// dispatch threads, and reuses the message objects the handler leaves behind.
+TEST_F(DrakeLcmTest, SubscribeDecodedTest) {
+  const std::string channel_name = "drake_lcm_decoded_channel_name";
+
+  for (int num_threads : {0, 2}) {
+    DrakeLcm dut;
+    dut.SetDispatchThreads(num_threads);
+
+    std::mutex mutex;
+    int num_allocated = 0;
+    std::vector<int> received;
+    std::vector<std::unique_ptr<AbstractValue>> kept;
+    dut.SubscribeDecoded(
+        channel_name,
+        [&]() {
+          std::lock_guard<std::mutex> lock(mutex);
+          ++num_allocated;
+          return AbstractValue::Make<int>(-1);
+        },
+        [](const void* data, int size, AbstractValue* message) {
+          ASSERT_EQ(size, static_cast<int>(sizeof(int)));
+          std::memcpy(&message->GetMutableValue<int>(), data, sizeof(int));
+        },
+        [&](std::unique_ptr<AbstractValue>* message) {
+          ASSERT_NE(*message, nullptr);
+          std::lock_guard<std::mutex> lock(mutex);
+          received.push_back((*message)->GetValue<int>());
+          // Take ownership of every other message.
+          if (received.size() % 2 == 0) {
+            kept.push_back(std::move(*message));
+          }
+        });
+    EXPECT_THROW(dut.SubscribeDecoded("", nullptr, nullptr, nullptr),
+                 std::exception);
+
+    dut.StartReceiveThread();
+
+    const int kMaxCount = 10;
+    const int kDelayMS = 500;
+    const int kNumMessages = 10;
+    int count = 0;
+    bool done = false;
+    while (!done && count++ < kMaxCount) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.clear();
+      }
+      for (int i = 0; i < kNumMessages; ++i) {
+        dut.Publish(channel_name, &i, sizeof(i), {});
+      }
+      sleep_for(milliseconds(kDelayMS));
+      std::lock_guard<std::mutex> lock(mutex);
+      done = (static_cast<int>(received.size()) == kNumMessages);
+    }
+
+    dut.StopReceiveThread();
+    ASSERT_TRUE(done);
+    for (int i = 0; i < kNumMessages; ++i) {
+      EXPECT_EQ(received[i], i);
+    }
+    // A new message object is only needed for the first message, and after
+    // the handler took one; since it took the last one, these match.
+    EXPECT_EQ(num_allocated, static_cast<int>(kept.size()));
+  }
+}
+
 TEST_F(DrakeLcmTest, EmptyChannelTest) {
   DrakeLcm dut;
   EXPECT_EQ(dut.get_requested_lcm_url(), "");
@@ -0,0 +1,226 @@
+#include "drake/lcm/lcm_log_index.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/lcm/drake_lcm_log.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+// Returns the int payload of the given event.
+int ReadPayload(const internal::MemoryMappedFile& log,
+                const LcmLogIndex::Event& event) {
+  EXPECT_EQ(event.data_size, sizeof(int));
+  int value;
+  std::memcpy(&value, log.data() + event.data_offset, sizeof(value));
+  return value;
+}
+
+GTEST_TEST(LcmLogIndexTest, Build) {
+  // Log messages out of time order; the payload of each message is its index
+  // in these lists.
+  const std::vector<double> times{3, 1, 2, 2, 5};
+  const std::vector<std::string> channels{"A", "B", "A", "C", "B"};
+  {
+    DrakeLcmLog log("index_test_clean.log", true);
+    for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+      log.Publish(channels[i], &i, sizeof(i), times[i]);
+    }
+  }
+
+  // Surround the messages with garbage and a cut off event.
+  const std::string log_file_name = "index_test.log";
+  {
+    std::ifstream clean("index_test_clean.log", std::ios::binary);
+    std::ofstream dirty(log_file_name, std::ios::binary);
+    dirty << "not an event";
+    dirty << clean.rdbuf();
+    dirty << "\xED\xA1\xDA\x01" << std::string(20, '\0');
+  }
+
+  const std::string index_file_name = LcmLogIndex::DefaultFileName(
+      log_file_name);
+  EXPECT_EQ(index_file_name, "index_test.log.idx");
+  LcmLogIndex::Build(log_file_name, index_file_name);
+  const LcmLogIndex dut(index_file_name);
+  const internal::MemoryMappedFile log(log_file_name);
+  EXPECT_EQ(dut.log_size(), log.size());
+  EXPECT_EQ(dut.log_modification_time(), log.modification_time());
+  EXPECT_TRUE(dut.IsCurrentFor(log));
+
+  // The events are sorted by time; among equal times, the log's order holds.
+  ASSERT_EQ(dut.num_events(), 5);
+  const std::vector<int> expected_order{1, 2, 3, 0, 4};
+  for (int i = 0; i < 5; ++i) {
+    const LcmLogIndex::Event& event = dut.event(i);
+    const int payload = ReadPayload(log, event);
+    EXPECT_EQ(payload, expected_order[i]);
+    EXPECT_EQ(event.timestamp, times[payload] * 1e6);
+    EXPECT_EQ(dut.channel_name(event.channel), channels[payload]);
+  }
+
+  EXPECT_EQ(dut.LowerBound(0), 0);
+  EXPECT_EQ(dut.LowerBound(2e6), 1);
+  EXPECT_EQ(dut.LowerBound(2e6 + 1), 3);
+  EXPECT_EQ(dut.LowerBound(6e6), 5);
+
+  ASSERT_EQ(dut.num_channels(), 3);
+  EXPECT_FALSE(dut.FindChannel("D"));
+  EXPECT_FALSE(dut.FindChannel("AA"));
+  const int channel_b = dut.FindChannel("B").value();
+  EXPECT_EQ(dut.channel_name(channel_b), "B");
+  ASSERT_EQ(dut.num_channel_events(channel_b), 2);
+  EXPECT_EQ(dut.channel_event(channel_b, 0), 0);
+  EXPECT_EQ(dut.channel_event(channel_b, 1), 4);
+  EXPECT_EQ(dut.ChannelLowerBound(channel_b, 0), 0);
+  EXPECT_EQ(dut.ChannelLowerBound(channel_b, 1e6 + 1), 1);
+  EXPECT_EQ(dut.ChannelLowerBound(channel_b, 6e6), 2);
+}
+
+GTEST_TEST(LcmLogIndexTest, EmptyLog) {
+  { DrakeLcmLog log("index_test_empty.log", true); }
+  LcmLogIndex::Build("index_test_empty.log", "index_test_empty.log.idx");
+  const LcmLogIndex dut("index_test_empty.log.idx");
+  EXPECT_EQ(dut.log_size(), 0);
+  EXPECT_EQ(dut.num_events(), 0);
+  EXPECT_EQ(dut.num_channels(), 0);
+  EXPECT_EQ(dut.LowerBound(0), 0);
+}
+
+GTEST_TEST(LcmLogIndexTest, Invalid) {
+  EXPECT_THROW(LcmLogIndex("no_such_file.idx"), std::runtime_error);
+  EXPECT_THROW(LcmLogIndex::Build("no_such_file.log", "no_such_file.idx"),
+               std::runtime_error);
+  {
+    std::ofstream file("index_test_invalid.idx", std::ios::binary);
+    file << std::string(100, 'x');
+  }
+  EXPECT_THROW(LcmLogIndex("index_test_invalid.idx"), std::runtime_error);
+}
+
+// Tests that an index no longer matches a log whose modification time changed,
+// even if its size is the same.
+GTEST_TEST(LcmLogIndexTest, Stale) {
+  {
+    DrakeLcmLog log("index_test_stale.log", true);
+    const int value = 1;
+    log.Publish("A", &value, sizeof(value), 1.0);
+  }
+  LcmLogIndex::Build("index_test_stale.log", "index_test_stale.log.idx");
+  const LcmLogIndex dut("index_test_stale.log.idx");
+  EXPECT_TRUE(dut.IsCurrentFor(
+      internal::MemoryMappedFile("index_test_stale.log")));
+
+  // Move the modification time one second into the past.
+  struct timespec times[2];
+  times[0].tv_nsec = UTIME_OMIT;
+  times[1].tv_sec = dut.log_modification_time() / 1000000000 - 1;
+  times[1].tv_nsec = 0;
+  ASSERT_EQ(::utimensat(AT_FDCWD, "index_test_stale.log", times, 0), 0);
+  const internal::MemoryMappedFile touched("index_test_stale.log");
+  EXPECT_EQ(touched.size(), dut.log_size());
+  EXPECT_FALSE(dut.IsCurrentFor(touched));
+}
+
+// Tests that an index whose counts, offsets, or sizes are inconsistent is
+// rejected when opened.
+GTEST_TEST(LcmLogIndexTest, Corrupt) {
+  // Two events on channel "A" and one on channel "BB".
+  {
+    DrakeLcmLog log("index_test_corrupt.log", true);
+    const int value = 0;
+    log.Publish("A", &value, sizeof(value), 1.0);
+    log.Publish("BB", &value, sizeof(value), 2.0);
+    log.Publish("A", &value, sizeof(value), 3.0);
+  }
+  LcmLogIndex::Build("index_test_corrupt.log", "index_test_corrupt.log.idx");
+  std::string index;
+  {
+    std::ifstream file("index_test_corrupt.log.idx", std::ios::binary);
+    index.assign(std::istreambuf_iterator<char>(file),
+                 std::istreambuf_iterator<char>());
+  }
+  const uint64_t log_size =
+      internal::MemoryMappedFile("index_test_corrupt.log").size();
+
+  // The offsets of the sections of the index, for the layout documented in
+  // lcm_log_index.cc.
+  const size_t kHeaderSize = 56;
+  const size_t kChannelSize = 32;
+  const size_t kEventSize = 24;
+  const size_t kNumEventsOffset = 32;
+  const size_t kNumChannelsOffset = 40;
+  const size_t kChannelsOffset = kHeaderSize;
+  const size_t kEventsOffset = kChannelsOffset + 2 * kChannelSize;
+  const size_t kChannelEventsOffset = kEventsOffset + 3 * kEventSize;
+  ASSERT_EQ(index.size(), kChannelEventsOffset + 3 * sizeof(int64_t) + 3);
+
+  // Writes `index` with `value` written at `offset`, and returns whether it
+  // can be opened.
+  auto opens_with = [&index](size_t offset, auto value) {
+    std::string corrupt = index;
+    std::memcpy(&corrupt[offset], &value, sizeof(value));
+    {
+      std::ofstream file("index_test_corrupt.idx", std::ios::binary);
+      file << corrupt;
+    }
+    try {
+      LcmLogIndex dut("index_test_corrupt.idx");
+    } catch (const std::runtime_error&) {
+      return false;
+    }
+    return true;
+  };
+
+  // The original index opens.
+  EXPECT_TRUE(opens_with(kNumEventsOffset, uint64_t{3}));
+
+  // Header counts that don't match the file size, or overflow.
+  EXPECT_FALSE(opens_with(kNumEventsOffset, uint64_t{4}));
+  EXPECT_FALSE(opens_with(kNumEventsOffset, uint64_t{1} << 62));
+  EXPECT_FALSE(opens_with(kNumChannelsOffset, uint64_t{3}));
+  EXPECT_FALSE(opens_with(kNumChannelsOffset, uint64_t{1} << 61));
+
+  // A channel name beyond the names.
+  EXPECT_FALSE(opens_with(kChannelsOffset, uint64_t{3}));
+  EXPECT_FALSE(opens_with(kChannelsOffset + 8, uint64_t{4}));
+  // A channel's events beyond the channel events.
+  EXPECT_FALSE(opens_with(kChannelsOffset + 16, uint64_t{2}));
+  EXPECT_FALSE(opens_with(kChannelsOffset + 24, uint64_t{4}));
+
+  // An event whose message lies beyond the log.
+  EXPECT_FALSE(opens_with(kEventsOffset + 8, log_size - 3));
+  EXPECT_FALSE(opens_with(kEventsOffset + 16, uint32_t{1000}));
+  // An event on a channel that doesn't exist.
+  EXPECT_FALSE(opens_with(kEventsOffset + 20, uint32_t{2}));
+  // Events out of timestamp order.
+  EXPECT_FALSE(opens_with(kEventsOffset, uint64_t{5000000}));
+
+  // A channel event that doesn't exist, or is on another channel.
+  EXPECT_FALSE(opens_with(kChannelEventsOffset, int64_t{3}));
+  EXPECT_FALSE(opens_with(kChannelEventsOffset, int64_t{-1}));
+  EXPECT_FALSE(opens_with(kChannelEventsOffset, int64_t{1}));
+
+  // A truncated index.
+  {
+    std::ofstream file("index_test_corrupt.idx", std::ios::binary);
+    file << index.substr(0, index.size() - 1);
+  }
+  EXPECT_THROW(LcmLogIndex("index_test_corrupt.idx"), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,85 @@
+#include "drake/lcm/spsc_queue.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace lcm {
+namespace internal {
+namespace {
+
+GTEST_TEST(SpscQueueTest, FifoAndCapacity) {
+  SpscQueue<int> dut(3);
+  EXPECT_EQ(dut.capacity(), 3);
+  EXPECT_TRUE(dut.empty());
+
+  int value = -1;
+  EXPECT_FALSE(dut.TryPop(&value));
+  EXPECT_EQ(value, -1);
+
+  // Wrap around the slots a few times.
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 3; ++i) {
+      value = 10 * round + i;
+      EXPECT_TRUE(dut.TryPush(&value));
+    }
+    value = 100;
+    EXPECT_FALSE(dut.TryPush(&value));
+    EXPECT_EQ(value, 100);
+    EXPECT_FALSE(dut.empty());
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_TRUE(dut.TryPop(&value));
+      EXPECT_EQ(value, 10 * round + i);
+    }
+    EXPECT_TRUE(dut.empty());
+  }
+}
+
+GTEST_TEST(SpscQueueTest, MovesValues) {
+  SpscQueue<std::unique_ptr<int>> dut(1);
+  auto value = std::make_unique<int>(7);
+  const int* const pointer = value.get();
+  EXPECT_TRUE(dut.TryPush(&value));
+  EXPECT_EQ(value, nullptr);
+  std::unique_ptr<int> popped;
+  EXPECT_TRUE(dut.TryPop(&popped));
+  EXPECT_EQ(popped.get(), pointer);
+}
+
+GTEST_TEST(SpscQueueTest, BadCapacity) {
+  EXPECT_THROW(SpscQueue<int>(0), std::exception);
+}
+
+// One thread pushes a long sequence while another pops it; every value must
+// arrive exactly once, in order.
+GTEST_TEST(SpscQueueTest, ConcurrentProducerAndConsumer) {
+  const int kNumValues = 100000;
+  SpscQueue<std::vector<int>> dut(16);
+
+  std::thread producer([&dut]() {
+    for (int i = 0; i < kNumValues; ++i) {
+      std::vector<int> value{i, -i};
+      while (!dut.TryPush(&value)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::vector<int> value;
+  for (int i = 0; i < kNumValues; ++i) {
+    while (!dut.TryPop(&value)) {
+      std::this_thread::yield();
+    }
+    ASSERT_EQ(value, std::vector<int>({i, -i}));
+  }
+  producer.join();
+  EXPECT_TRUE(dut.empty());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace lcm
+}  // namespace drake
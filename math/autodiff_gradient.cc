@@ -1,4 +1,65 @@
-// For now, this is an empty .cc file that only serves to confirm
-// autodiff_gradient.h is a stand-alone header.
-
 #include "drake/math/autodiff_gradient.h"
+
+#include <vector>
+
+namespace drake {
+namespace math {
+
+AutoDiffVecXd EvalWithCompressedDerivatives(
+    const std::function<AutoDiffVecXd(const AutoDiffVecXd&)>& function,
+    const Eigen::Ref<const AutoDiffVecXd>& x) {
+  const Eigen::MatrixXd x_gradient = autoDiffToGradientMatrix(x);
+  const int num_derivatives = x_gradient.cols();
+
+  // The columns of ∂x/∂z that are not all zero.
+  std::vector<int> nonzero_columns;
+  for (int j = 0; j < num_derivatives; ++j) {
+    if (!x_gradient.col(j).isZero(0.0)) {
+      nonzero_columns.push_back(j);
+    }
+  }
+  const int num_nonzero_columns = static_cast<int>(nonzero_columns.size());
+  const bool scatter = num_nonzero_columns <= x.size();
+  const int num_compressed = scatter ? num_nonzero_columns : x.size();
+  if (num_compressed >= num_derivatives) {
+    return function(x);
+  }
+
+  // Evaluate with the compressed derivatives.
+  AutoDiffVecXd x_compressed(x.size());
+  for (int i = 0; i < x.size(); ++i) {
+    x_compressed(i).value() = x(i).value();
+    if (scatter) {
+      x_compressed(i).derivatives().resize(num_compressed);
+      for (int k = 0; k < num_compressed; ++k) {
+        x_compressed(i).derivatives()(k) = x_gradient(i, nonzero_columns[k]);
+      }
+    } else {
+      x_compressed(i).derivatives() =
+          Eigen::VectorXd::Unit(num_compressed, i);
+    }
+  }
+  const AutoDiffVecXd y_compressed = function(x_compressed);
+  const Eigen::MatrixXd y_compressed_gradient =
+      autoDiffToGradientMatrix(y_compressed, num_compressed);
+
+  // Map the derivatives back to ∂y/∂z.
+  Eigen::MatrixXd y_gradient;
+  if (scatter) {
+    y_gradient.setZero(y_compressed.size(), num_derivatives);
+    for (int k = 0; k < num_compressed; ++k) {
+      y_gradient.col(nonzero_columns[k]) = y_compressed_gradient.col(k);
+    }
+  } else {
+    y_gradient = y_compressed_gradient * x_gradient;
+  }
+  AutoDiffVecXd y(y_compressed.size());
+  for (int i = 0; i < y.size(); ++i) {
+    y(i).value() = y_compressed(i).value();
+    y(i).derivatives() = y_gradient.row(i).transpose();
+  }
+  return y;
+}
+
+}  // namespace math
+}  // namespace drake
@@ -5,9 +5,11 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 
 #include <Eigen/Dense>
 
+#include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/unused.h"
 #include "drake/math/autodiff.h"
@@ -210,5 +212,36 @@ DiscardZeroGradient(
   return transform;
 }
 
+/** Evaluates `function(x)` for an autodiff vector `x` whose gradient matrix
+ * ∂x/∂z (with respect to some variables z) is sparse or has few rows, such
+ * that `function` carries narrower derivatives than ∂x/∂z through all of its
+ * operations.
+ *
+ * `function` is called once, on a copy of `x` whose derivatives are either
+ * the nonzero columns of ∂x/∂z, or the identity (i.e., ∂x/∂x) when there are
+ * fewer entries of `x` than nonzero columns; the result's derivatives are
+ * then mapped back to ∂y/∂z, by scattering the columns or by the chain rule,
+ * respectively. When neither is narrower than ∂x/∂z, `function` is simply
+ * called on `x`.
+ *
+ * This makes the cost of differentiating `function` depend on the number of
+ * entries of `x` (or of the variables that `x` actually depends on), rather
+ * than on the number of variables z. For instance, a constraint on a few
+ * decision variables of a large program, evaluated with derivatives with
+ * respect to all of them, costs no more than with derivatives with respect to
+ * its own variables.
+ *
+ * @param function Computes y = f(x), for any x. The derivatives of each entry
+ * of f(x) must either have the size of the derivatives of x, or be empty (as
+ * for a constant).
+ * @param x The value at which to evaluate `function`. Entries with empty
+ * derivatives are taken to have zero derivatives.
+ * @returns y = f(x), where every entry has derivatives of the size of the
+ * (widest) derivatives of `x`.
+ */
+AutoDiffVecXd EvalWithCompressedDerivatives(
+    const std::function<AutoDiffVecXd(const AutoDiffVecXd&)>& function,
+    const Eigen::Ref<const AutoDiffVecXd>& x);
+
 }  // namespace math
 }  // namespace drake
@@ -5,3 +5,5 @@
 // Explicitly instantiate on non-symbolic scalar types.
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RigidTransform)
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS(
+    class ::drake::math::RigidTransform)
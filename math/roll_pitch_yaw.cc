@@ -226,3 +226,5 @@ void RollPitchYaw<T>::ThrowPitchAngleViolatesGimbalLockTolerance(
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RollPitchYaw)
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS(
+    class ::drake::math::RollPitchYaw)
@@ -4,3 +4,5 @@
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RotationMatrix)
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS(
+    class ::drake::math::RotationMatrix)
@@ -214,6 +214,89 @@ GTEST_TEST(AdditionalAutodiffTest, CastToAutoDiff) {
   EXPECT_TRUE(fixed_gradients.isZero(0.));
 }
 
+// A nonlinear function, for which the derivatives of each entry of the
+// result have the size of those of x.
+AutoDiffVecXd NonlinearFunction(const AutoDiffVecXd& x) {
+  AutoDiffVecXd y(3);
+  y(0) = x(0) * x(1) + sin(x(2));
+  y(1) = exp(x(0)) / (1 + x(1) * x(1));
+  y(2) = x(0) * x(1) * x(2);
+  return y;
+}
+
+GTEST_TEST(EvalWithCompressedDerivativesTest, Compression) {
+  const VectorXd x_value = Vector3d(0.3, -1.2, 2.5);
+  // A gradient with 3 nonzero columns out of 8, which are scattered.
+  MatrixXd sparse_gradient = MatrixXd::Zero(3, 8);
+  sparse_gradient(0, 1) = 1;
+  sparse_gradient(1, 4) = 2;
+  sparse_gradient(1, 6) = -1;
+  sparse_gradient(2, 6) = 3;
+  // A dense gradient with more columns than rows, which is compressed to the
+  // identity.
+  const MatrixXd dense_gradient =
+      (MatrixXd(3, 5) << 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, -1, 0, 2, 0, 1)
+          .finished();
+  // A gradient with fewer columns than rows, which isn't compressed.
+  const MatrixXd narrow_gradient =
+      (MatrixXd(3, 2) << 1, 2, 3, 4, 5, 6).finished();
+  // A zero gradient.
+  const MatrixXd zero_gradient = MatrixXd::Zero(3, 4);
+
+  for (const MatrixXd& x_gradient :
+       {sparse_gradient, dense_gradient, narrow_gradient, zero_gradient}) {
+    const AutoDiffVecXd x =
+        initializeAutoDiffGivenGradientMatrix(x_value, x_gradient);
+    const AutoDiffVecXd y_expected = NonlinearFunction(x);
+    int num_calls = 0;
+    const AutoDiffVecXd y = EvalWithCompressedDerivatives(
+        [&num_calls](const AutoDiffVecXd& z) {
+          ++num_calls;
+          return NonlinearFunction(z);
+        },
+        x);
+    EXPECT_EQ(num_calls, 1);
+    ASSERT_EQ(y.size(), 3);
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ(y(i).derivatives().size(), x_gradient.cols());
+    }
+    EXPECT_TRUE(CompareMatrices(autoDiffToValueMatrix(y),
+                                autoDiffToValueMatrix(y_expected), 0));
+    EXPECT_TRUE(CompareMatrices(autoDiffToGradientMatrix(y),
+                                autoDiffToGradientMatrix(y_expected), 1e-14));
+  }
+
+  // The sparse gradient's function is called with 3 derivatives.
+  const AutoDiffVecXd x =
+      initializeAutoDiffGivenGradientMatrix(x_value, sparse_gradient);
+  EvalWithCompressedDerivatives(
+      [](const AutoDiffVecXd& z) {
+        EXPECT_EQ(z(0).derivatives().size(), 3);
+        return NonlinearFunction(z);
+      },
+      x);
+}
+
+// The result has derivatives of the input's size even where f(x) has empty
+// derivatives, and entries of x with empty derivatives are taken as zero.
+GTEST_TEST(EvalWithCompressedDerivativesTest, EmptyDerivatives) {
+  AutoDiffVecXd x(2);
+  x(0) = AutoDiffXd(1.0, VectorXd::Unit(6, 2));
+  x(1) = AutoDiffXd(2.0);
+  const AutoDiffVecXd y = EvalWithCompressedDerivatives(
+      [](const AutoDiffVecXd& z) {
+        AutoDiffVecXd result(2);
+        result(0) = 3 * z(0) + z(1);
+        result(1) = AutoDiffXd(4.0);
+        return result;
+      },
+      x);
+  EXPECT_EQ(y(0).value(), 5.0);
+  EXPECT_TRUE(CompareMatrices(y(0).derivatives(),
+                              3 * VectorXd::Unit(6, 2)));
+  EXPECT_TRUE(CompareMatrices(y(1).derivatives(), VectorXd::Zero(6)));
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
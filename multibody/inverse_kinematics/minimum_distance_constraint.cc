@@ -1,6 +1,8 @@
 #include "drake/multibody/inverse_kinematics/minimum_distance_constraint.h"
 
 #include <limits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "drake/multibody/inverse_kinematics/kinematic_constraint_utilities.h"
@@ -71,56 +73,104 @@ MinimumDistanceConstraint::MinimumDistanceConstraint(
 }
 
 namespace {
-void InitializeY(const Eigen::Ref<const Eigen::VectorXd>&, Eigen::VectorXd* y) {
+// The pose and the Jacobian of a body frame F. They are computed once per
+// evaluation, no matter how many geometry pairs the frame takes part in.
+struct FrameKinematics {
+  Eigen::Isometry3d X_WF;
+  // The Jacobian of the spatial velocity of F in the world frame W, with
+  // respect to q̇, expressed in W.
+  Eigen::Matrix<double, 6, Eigen::Dynamic> Jq_V_WF;
+};
+
+void AddPenalties(
+    const MultibodyPlant<double>&, const systems::Context<double>&,
+    const geometry::SceneGraphInspector<double>&,
+    const std::vector<geometry::SignedDistancePair<double>>&
+        signed_distance_pairs,
+    double minimum_distance, MinimumDistancePenaltyFunction penalty_function,
+    const Eigen::Ref<const Eigen::VectorXd>&, Eigen::VectorXd* y) {
   (*y)(0) = 0;
+  for (const auto& signed_distance_pair : signed_distance_pairs) {
+    const double distance = signed_distance_pair.distance;
+    if (distance < minimum_distance) {
+      double penalty;
+      penalty_function(distance / minimum_distance - 1, &penalty, nullptr);
+      (*y)(0) += penalty;
+    }
+  }
 }
 
-void InitializeY(const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) {
-  (*y) = math::initializeAutoDiffGivenGradientMatrix(
-      Vector1d(0), Eigen::RowVectorXd::Zero(x(0).derivatives().size()));
-}
-void AddPenalty(const MultibodyPlant<double>&, const systems::Context<double>&,
-                const Frame<double>&, const Frame<double>&,
-                const Eigen::Vector3d&, double distance,
-                double minimum_distance,
-                MinimumDistancePenaltyFunction penalty_function,
-                const Eigen::Vector3d&, const Eigen::Vector3d&,
-                const Eigen::Ref<const Eigen::VectorXd>&, Eigen::VectorXd* y) {
-  double penalty;
-  const double x = distance / minimum_distance - 1;
-  penalty_function(x, &penalty, nullptr);
-  (*y)(0) += penalty;
-}
+void AddPenalties(
+    const MultibodyPlant<double>& plant,
+    const systems::Context<double>& context,
+    const geometry::SceneGraphInspector<double>& inspector,
+    const std::vector<geometry::SignedDistancePair<double>>&
+        signed_distance_pairs,
+    double minimum_distance, MinimumDistancePenaltyFunction penalty_function,
+    const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) {
+  std::unordered_map<geometry::FrameId, FrameKinematics> frame_kinematics;
+  auto get_frame_kinematics =
+      [&](geometry::FrameId frame_id) -> const FrameKinematics& {
+    auto it = frame_kinematics.find(frame_id);
+    if (it == frame_kinematics.end()) {
+      const Body<double>& body = *plant.GetBodyFromFrameId(frame_id);
+      FrameKinematics kinematics;
+      kinematics.X_WF = plant.EvalBodyPoseInWorld(context, body);
+      kinematics.Jq_V_WF.resize(6, plant.num_positions());
+      plant.CalcJacobianSpatialVelocity(
+          context, JacobianWrtVariable::kQDot, body.body_frame(),
+          Eigen::Vector3d::Zero(), plant.world_frame(), plant.world_frame(),
+          &kinematics.Jq_V_WF);
+      it = frame_kinematics.emplace(frame_id, std::move(kinematics)).first;
+    }
+    return it->second;
+  };
 
-void AddPenalty(const MultibodyPlant<double>& plant,
-                const systems::Context<double>& context,
-                const Frame<double>& frameA, const Frame<double>& frameB,
-                const Eigen::Vector3d& p_ACa, double distance,
-                double minimum_distance,
-                MinimumDistancePenaltyFunction penalty_function,
-                const Eigen::Vector3d& p_WCa, const Eigen::Vector3d& p_WCb,
-                const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) {
-  // The distance is d = sign * |p_CbCa_B|, where the
-  // closest points are Ca on object A, and Cb on object B.
-  // So the gradient ∂d/∂q = p_CbCa_W * ∂p_BCa_B/∂q / d
-  // where p_CbCa_W = p_WCa - p_WCb = p_WA + R_WA * p_ACa - (p_WB + R_WB *
-  // p_BCb)
-  double penalty, dpenalty_dx;
-  const double penalty_x = distance / minimum_distance - 1;
-  penalty_function(penalty_x, &penalty, &dpenalty_dx);
-  const double dpenalty_ddistance = dpenalty_dx / minimum_distance;
-
-  Eigen::Matrix<double, 6, Eigen::Dynamic> Jq_V_BCa(6, plant.num_positions());
-  plant.CalcJacobianSpatialVelocity(context, JacobianWrtVariable::kQDot, frameA,
-                                    p_ACa, frameB, frameB, &Jq_V_BCa);
-
-  const Eigen::RowVectorXd ddistance_dq =
-      (p_WCa - p_WCb).transpose() * Jq_V_BCa.bottomRows<3>() / distance;
-  const Vector1<AutoDiffXd> penalty_autodiff =
-      math::initializeAutoDiffGivenGradientMatrix(
-          Vector1d(penalty), dpenalty_ddistance * ddistance_dq *
-                                 math::autoDiffToGradientMatrix(x));
-  *y += penalty_autodiff;
+  double penalty_sum = 0;
+  Eigen::RowVectorXd dpenalty_dq =
+      Eigen::RowVectorXd::Zero(plant.num_positions());
+  for (const auto& signed_distance_pair : signed_distance_pairs) {
+    const double distance = signed_distance_pair.distance;
+    if (distance >= minimum_distance) {
+      continue;
+    }
+    double penalty, dpenalty_dx;
+    const double penalty_x = distance / minimum_distance - 1;
+    penalty_function(penalty_x, &penalty, &dpenalty_dx);
+    const double dpenalty_ddistance = dpenalty_dx / minimum_distance;
+
+    // The distance is d = sign * |p_CbCa_W|, where the closest points are Ca
+    // on body A, and Cb on body B. So the gradient is
+    // ∂d/∂q = p_CbCa_Wᵀ * (∂p_WCa/∂q - ∂p_WCb/∂q) / d, where the translational
+    // velocity of Ca (fixed in A) is v_WCa = v_WAo + w_WA × p_AoCa_W, hence
+    // p_CbCa_Wᵀ * v_WCa = p_CbCa_Wᵀ * v_WAo + (p_AoCa_W × p_CbCa_W)ᵀ * w_WA,
+    // and likewise for Cb.
+    const FrameKinematics& kinematics_A = get_frame_kinematics(
+        inspector.GetFrameId(signed_distance_pair.id_A));
+    const FrameKinematics& kinematics_B = get_frame_kinematics(
+        inspector.GetFrameId(signed_distance_pair.id_B));
+    const Eigen::Vector3d p_AoCa_A =
+        inspector.X_FG(signed_distance_pair.id_A) * signed_distance_pair.p_ACa;
+    const Eigen::Vector3d p_BoCb_B =
+        inspector.X_FG(signed_distance_pair.id_B) * signed_distance_pair.p_BCb;
+    const Eigen::Vector3d p_AoCa_W = kinematics_A.X_WF.linear() * p_AoCa_A;
+    const Eigen::Vector3d p_BoCb_W = kinematics_B.X_WF.linear() * p_BoCb_B;
+    const Eigen::Vector3d p_CbCa_W =
+        kinematics_A.X_WF.translation() + p_AoCa_W -
+        kinematics_B.X_WF.translation() - p_BoCb_W;
+    const Eigen::RowVectorXd ddistance_dq =
+        (p_CbCa_W.transpose() * (kinematics_A.Jq_V_WF.bottomRows<3>() -
+                                 kinematics_B.Jq_V_WF.bottomRows<3>()) +
+         p_AoCa_W.cross(p_CbCa_W).transpose() *
+             kinematics_A.Jq_V_WF.topRows<3>() -
+         p_BoCb_W.cross(p_CbCa_W).transpose() *
+             kinematics_B.Jq_V_WF.topRows<3>()) /
+        distance;
+    penalty_sum += penalty;
+    dpenalty_dq += dpenalty_ddistance * ddistance_dq;
+  }
+  *y = math::initializeAutoDiffGivenGradientMatrix(
+      Vector1d(penalty_sum), dpenalty_dq * math::autoDiffToGradientMatrix(x));
 }
 }  // namespace
 
@@ -142,41 +192,16 @@ void MinimumDistanceConstraint::DoEvalGeneric(
   const auto& query_object =
       query_port.Eval<geometry::QueryObject<double>>(*plant_context_);
 
+  // Pairs that are at least minimum_distance_ apart incur no penalty, so the
+  // query can skip them, typically without computing their distance.
   const std::vector<geometry::SignedDistancePair<double>>
       signed_distance_pairs =
-          query_object.ComputeSignedDistancePairwiseClosestPoints();
-
-  InitializeY(x, y);
+          query_object.ComputeSignedDistancePairwiseClosestPoints(
+              minimum_distance_);
 
-  for (const auto& signed_distance_pair : signed_distance_pairs) {
-    const double distance = signed_distance_pair.distance;
-    if (distance < minimum_distance_) {
-      Vector3<double> p_WCa, p_WCb;
-      const geometry::SceneGraphInspector<double>& inspector =
-          query_object.inspector();
-      const geometry::FrameId frame_A_id =
-          inspector.GetFrameId(signed_distance_pair.id_A);
-      const geometry::FrameId frame_B_id =
-          inspector.GetFrameId(signed_distance_pair.id_B);
-      const Frame<double>& frameA =
-          plant_.GetBodyFromFrameId(frame_A_id)->body_frame();
-      const Frame<double>& frameB =
-          plant_.GetBodyFromFrameId(frame_B_id)->body_frame();
-      plant_.CalcPointsPositions(*plant_context_, frameA,
-                                 inspector.X_FG(signed_distance_pair.id_A) *
-                                     signed_distance_pair.p_ACa,
-                                 plant_.world_frame(), &p_WCa);
-      plant_.CalcPointsPositions(*plant_context_, frameB,
-                                 inspector.X_FG(signed_distance_pair.id_B) *
-                                     signed_distance_pair.p_BCb,
-                                 plant_.world_frame(), &p_WCb);
-      AddPenalty(plant_, *plant_context_, frameA, frameB,
-                 inspector.X_FG(signed_distance_pair.id_A) *
-                     signed_distance_pair.p_ACa,
-                 distance, minimum_distance_, penalty_function_, p_WCa, p_WCb,
-                 x, y);
-    }
-  }
+  AddPenalties(plant_, *plant_context_, query_object.inspector(),
+               signed_distance_pairs, minimum_distance_, penalty_function_, x,
+               y);
 }
 
 void MinimumDistanceConstraint::DoEval(
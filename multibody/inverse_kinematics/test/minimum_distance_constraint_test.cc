@@ -277,6 +277,34 @@ TEST_F(TwoFreeSpheresMinimumDistanceTest, QuadraticallySmoothedHingePenalty) {
   CheckConstraintEval(constraint, PenaltyType::kQuadratic);
 }
 
+// With both spheres rotated, the gradient also depends on the angular velocity
+// of each body, since the sphere centers are offset from the body origins.
+TEST_F(TwoFreeSpheresMinimumDistanceTest, RotatedSpheres) {
+  const MinimumDistanceConstraint constraint(plant_double_, 0.1,
+                                             plant_context_double_);
+  const Eigen::Quaterniond sphere1_quaternion(
+      Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized()));
+  const Eigen::Quaterniond sphere2_quaternion(
+      Eigen::AngleAxisd(-0.6, Eigen::Vector3d(0, 1, 1).normalized()));
+  // Separate the spheres by half of the minimum distance.
+  const Eigen::Vector3d p_WB1(0.1, 0.2, 0.3);
+  const Eigen::Vector3d p_WS1 =
+      ComputeCollisionSphereCenterPosition(p_WB1, sphere1_quaternion, X_B1S1_);
+  const Eigen::Vector3d p_WS2 =
+      p_WS1 + Eigen::Vector3d(1.0 / 3, 2.0 / 3, 2.0 / 3) *
+                  (radius1_ + radius2_ + 0.5 * constraint.minimum_distance());
+  const Eigen::Vector3d p_WB2 =
+      p_WS2 - sphere2_quaternion.toRotationMatrix() * X_B2S2_.translation();
+  Eigen::Matrix<double, 14, 1> q;
+  q << QuaternionToVectorWxyz(sphere1_quaternion), p_WB1,
+      QuaternionToVectorWxyz(sphere2_quaternion), p_WB2;
+  const Eigen::Matrix<AutoDiffXd, 14, 1> q_autodiff =
+      math::initializeAutoDiff(q);
+  CheckMinimumDistanceConstraintEval(constraint, q_autodiff, *plant_autodiff_,
+                                     plant_context_autodiff_, 1E-12,
+                                     PenaltyType::kQuadratic);
+}
+
 GTEST_TEST(MinimumDistanceConstraintTest,
            MultibodyPlantWithouthGeometrySource) {
   auto plant = ConstructTwoFreeBodiesPlant<double>();
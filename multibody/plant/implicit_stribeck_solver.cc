@@ -1,6 +1,7 @@
 #include "drake/multibody/plant/implicit_stribeck_solver.h"
 
 #include <algorithm>
+#include <chrono>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -456,9 +457,10 @@ void ImplicitStribeckSolver<T>::CalcNormalForces(
     const Eigen::Ref<const VectorX<T>>& vn,
     const Eigen::Ref<const MatrixX<T>>& Jn,
     double dt,
-    // We change from fn/Gn in the header to fn_ptr, Gn_ptr here to avoid name
-    // clashes with local variables.
+    // We change from fn/dfn_dvn/Gn in the header to fn_ptr, dfn_dvn_ptr,
+    // Gn_ptr here to avoid name clashes with local variables.
     EigenPtr<VectorX<T>> fn_ptr,
+    EigenPtr<VectorX<T>> dfn_dvn_ptr,
     EigenPtr<MatrixX<T>> Gn_ptr) const {
   using std::max;
   const int nc = nc_;  // Number of contact points.
@@ -473,44 +475,33 @@ void ImplicitStribeckSolver<T>::CalcNormalForces(
   const auto& stiffness = problem_data_aliases_.stiffness();
   const auto& dissipation = problem_data_aliases_.dissipation();
 
-  VectorX<T> x_capped(nc);  // = x₊
-  VectorX<T> H_x(nc);  // = H(x), with H the Heaviside function.
-  VectorX<T> k_vn_capped(nc);  // = k(vₙ)₊ = k (1 − d vₙ)₊
-  VectorX<T> H_k_vn(nc);  // = H(k(vₙ)).
-
   auto& fn = *fn_ptr;
+  auto& dfn_dvn = *dfn_dvn_ptr;
   for (int ic = 0; ic < nc; ++ic) {
     // Stiffness as a function of vn, k(vₙ) = k (1 − d vₙ)₊
     // where x₊ = max(x, 0).
-    T k_vn = stiffness(ic) * (1.0 - dissipation(ic) * vn(ic));
+    const T k_vn = stiffness(ic) * (1.0 - dissipation(ic) * vn(ic));
 
-    k_vn_capped(ic) = max(0.0, k_vn);
-    x_capped(ic) = max(0.0, x(ic));
+    const T k_vn_capped = max(0.0, k_vn);  // = k(vₙ)₊ = k (1 − d vₙ)₊
+    const T x_capped = max(0.0, x(ic));    // = x₊
     // fₙ = k(vₙ)₊ x₊
-    fn(ic) = k_vn_capped(ic) * x_capped(ic);
-    // Factors in the derivatives of x₊ and k(vₙ)₊
-    H_x(ic) = x(ic) > 0 ? 1.0 : 0.0;
-    H_k_vn(ic) = k_vn > 0 ? 1.0 : 0.0;
+    fn(ic) = k_vn_capped * x_capped;
+    // Factors in the derivatives of x₊ and k(vₙ)₊, with H the Heaviside
+    // function.
+    const double H_x = x(ic) > 0 ? 1.0 : 0.0;
+    const double H_k_vn = k_vn > 0 ? 1.0 : 0.0;
+
+    // Since xˢ⁺¹ = xˢ − δt vₙˢ⁺¹, we have that:
+    //   ∂xˢ⁺¹₊/∂vₙ = −δt H(xˢ⁺¹)
+    //   ∂k(vₙˢ⁺¹)₊/∂vₙ = −H(k(vₙˢ⁺¹)) k d
+    // and therefore, with fₙ = k(vₙ)₊ x₊:
+    //   ∂fₙ/∂vₙ = x₊ ∂k(vₙˢ⁺¹)₊/∂vₙ + k(vₙ)₊ ∂xˢ⁺¹₊/∂vₙ
+    dfn_dvn(ic) = -x_capped * H_k_vn * stiffness(ic) * dissipation(ic) -
+                  k_vn_capped * dt * H_x;
   }
 
-  // ∇ᵥxˢ⁺¹₊ = −δt diag(H(xˢ⁺¹)) Jₙ, with xˢ⁺¹ = xˢ − δt vₙˢ⁺¹.
-  // of size nc x nv.
-  MatrixX<T> nabla_x_capped = -dt * H_x.asDiagonal() * Jn;
-
-  // ∇ᵥk(vₙˢ⁺¹)₊ = −diag(H(k(vₙˢ⁺¹))) diag(k) diag(d) Jₙ
-  // of size nc x nv.
-  MatrixX<T> nabla_k_vn_capped = -(
-      (H_k_vn.array() *
-          stiffness.array() * dissipation.array()).matrix().asDiagonal() * Jn);
-
-  auto& Gn = *Gn_ptr;
-
-  // fₙ = k(vₙ)₊ x₊
-  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹) =
-  //        diag(x₊) ∇ᵥk(vₙˢ⁺¹)₊ + diag(k(vₙ)₊) ∇ᵥxˢ⁺¹₊
-  // Gn is of size nc x nv.
-  Gn = x_capped.asDiagonal() * nabla_k_vn_capped +
-      k_vn_capped.asDiagonal() * nabla_x_capped;
+  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹) = diag(∂fₙ/∂vₙ) Jₙ, of size nc x nv.
+  *Gn_ptr = dfn_dvn.asDiagonal() * Jn;
 }
 
 template <typename T>
@@ -553,7 +544,10 @@ void ImplicitStribeckSolver<T>::CalcJacobian(
   // Compute Gt = −∇ᵥfₜ (gradient of the friction forces with respect to the
   // generalized velocities) as Gt = −diag(dft_dvt) Jt and use the fact that
   // diag(dft_dvt) is block diagonal.
-  MatrixX<T> Gt(nf, nv);  // −∇ᵥfₜ
+  // Gt is stored in the workspace so that we don't allocate on each
+  // iteration.
+  auto Gt = variable_size_workspace_.mutable_Gt();  // −∇ᵥfₜ
+  DRAKE_ASSERT(Gt.rows() == nf && Gt.cols() == nv);
   for (int ic = 0; ic < nc; ++ic) {  // Index ic scans contact points.
     const int ik = 2 * ic;  // Index ik scans contact vector quantities.
     Gt.block(ik, 0, 2, nv) =
@@ -571,12 +565,113 @@ void ImplicitStribeckSolver<T>::CalcJacobian(
   }
 
   // Form J = M − Jnᵀ Gn − dt Jtᵀ Gt:
-  *J = M - dt * Jt.transpose() * Gt;
+  *J = M;
+  J->noalias() -= dt * Jt.transpose() * Gt;
   if (has_two_way_coupling()) {
-    *J -= dt * Jn.transpose() * Gn;
+    J->noalias() -= dt * Jn.transpose() * Gn;
   }
 }
 
+template <typename T>
+bool ImplicitStribeckSolver<T>::CalcContactSpaceOperators() const {
+  const int nc = nc_;  // Number of contact points.
+  const auto M = problem_data_aliases_.M();
+  const auto Jn = problem_data_aliases_.Jn();
+  const auto Jt = problem_data_aliases_.Jt();
+
+  auto& M_ldlt = fixed_size_workspace_.mutable_M_ldlt();
+  M_ldlt.compute(M);
+  if (M_ldlt.info() != Eigen::Success) return false;
+
+  // Jc = [Jn; Jt] for the two-way coupled scheme and Jc = Jt for the one-way
+  // coupled scheme, for which the normal forces are constant.
+  auto Jc = variable_size_workspace_.mutable_Jc();
+  if (has_two_way_coupling()) {
+    Jc.topRows(nc) = Jn;
+    Jc.bottomRows(2 * nc) = Jt;
+  } else {
+    Jc = Jt;
+  }
+
+  auto Minv_JcT = variable_size_workspace_.mutable_Minv_JcT();
+  Minv_JcT = Jc.transpose();
+  M_ldlt.solveInPlace(Minv_JcT);
+  auto W = variable_size_workspace_.mutable_W();
+  W.noalias() = Jc * Minv_JcT;
+  return true;
+}
+
+template <typename T>
+bool ImplicitStribeckSolver<T>::SolveInContactSpace(
+    const Eigen::Ref<const VectorX<T>>& residual,
+    const Eigen::Ref<const VectorX<T>>& dfn_dvn,
+    const std::vector<Matrix2<T>>& dft_dvt,
+    const Eigen::Ref<const VectorX<T>>& t_hat,
+    const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
+    EigenPtr<VectorX<T>> Delta_v) const {
+  const int nc = nc_;  // Number of contact points.
+
+  // From the expressions for Gn and Gt in CalcJacobian(), the Newton-Raphson
+  // Jacobian can be written as J = M + Jcᵀ C Jc, where in block form C is:
+  //   C = δt ⌈ −diag(∂fₙ/∂vₙ)             0            ⌉
+  //          ⌊ Gfn(ft) diag(∂fₙ/∂vₙ)    diag(dft_dvt) ⌋
+  // for the two-way coupled scheme and C = δt diag(dft_dvt) for the one-way
+  // coupled scheme. The Woodbury matrix identity leads to:
+  //   Δv = z − M⁻¹Jcᵀ y,  with z = M⁻¹(−R) and (I + C W) y = C Jc z.
+  // Since C is block diagonal per contact point (up to the normal-tangential
+  // coupling within each contact point), we form S = I + C W and C Jc z one
+  // contact point at a time.
+  const auto& M_ldlt = fixed_size_workspace_.mutable_M_ldlt();
+  const auto Jc = variable_size_workspace_.mutable_Jc();
+  const auto Minv_JcT = variable_size_workspace_.mutable_Minv_JcT();
+  const auto W = variable_size_workspace_.mutable_W();
+  auto S = variable_size_workspace_.mutable_S();
+  auto s = variable_size_workspace_.mutable_s();
+  auto y = variable_size_workspace_.mutable_y();
+
+  // z = M⁻¹(−R), stored in Delta_v.
+  *Delta_v = -residual;
+  M_ldlt.solveInPlace(*Delta_v);
+
+  // y = Jc z is used as scratch space before solving for y below.
+  y.noalias() = Jc * (*Delta_v);
+
+  // Offset to the tangential rows in Jc.
+  const int it = has_two_way_coupling() ? nc : 0;
+  S.setIdentity();
+  for (int ic = 0; ic < nc; ++ic) {  // Index ic scans contact points.
+    const int ik = 2 * ic;  // Index ik scans contact vector quantities.
+    const int jk = it + ik;  // Index jk scans tangential rows of Jc.
+    const Matrix2<T> C_tt = dt * dft_dvt[ic];
+    S.template middleRows<2>(jk).noalias() +=
+        C_tt * W.template middleRows<2>(jk);
+    s.template segment<2>(jk) = C_tt * y.template segment<2>(jk);
+    if (has_two_way_coupling()) {
+      const T C_nn = -dt * dfn_dvn(ic);
+      const Vector2<T> C_tn =
+          -C_nn * mu_vt(ic) * t_hat.template segment<2>(ik);
+      S.template middleRows<2>(jk).noalias() += C_tn * W.row(ic);
+      s.template segment<2>(jk) += C_tn * y(ic);
+      S.row(ic) += C_nn * W.row(ic);
+      s(ic) = C_nn * y(ic);
+    }
+  }
+
+  // S = I + C W is not symmetric and, unlike J, it is not guaranteed to be
+  // well conditioned. When it is not, the Woodbury update can lose all of its
+  // accuracy and we let the caller fall back to factorizing J instead.
+  // The threshold is loose enough to only reject nearly singular systems.
+  const double kMinReciprocalConditionNumber = 1.0e-12;
+  auto& S_lu = variable_size_workspace_.mutable_S_lu();
+  S_lu.compute(S);
+  if (!(ExtractDoubleOrThrow(S_lu.rcond()) > kMinReciprocalConditionNumber)) {
+    return false;
+  }
+  y = S_lu.solve(s);
+  Delta_v->noalias() -= Minv_JcT * y;
+  return true;
+}
+
 template <typename T>
 T ImplicitStribeckSolver<T>::CalcAlpha(
     const Eigen::Ref<const VectorX<T>>& vt,
@@ -607,9 +702,15 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
   // SolveWithGuess().
   statistics_.Reset();
 
+  using Clock = std::chrono::steady_clock;
+  auto elapsed_seconds = [](const Clock::time_point& start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  };
+
   // If there are no contact points return a zero generalized friction force
   // vector, i.e. tau_f = 0.
   if (nc_ == 0) {
+    const Clock::time_point start = Clock::now();
     fixed_size_workspace_.mutable_tau_f().setZero();
     fixed_size_workspace_.mutable_tau().setZero();
     const auto M = problem_data_aliases_.M();
@@ -617,9 +718,11 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     auto& v = fixed_size_workspace_.mutable_v();
     // With no friction forces Eq. (3) in the documentation reduces to
     // M vˢ⁺¹ = p*.
-    v = M.ldlt().solve(p_star);
+    auto& M_ldlt = fixed_size_workspace_.mutable_M_ldlt();
+    M_ldlt.compute(M);
+    v = M_ldlt.solve(p_star);
     // "One iteration" with exactly "zero" vt_error.
-    statistics_.Update(0.0);
+    statistics_.Update(0.0, elapsed_seconds(start));
     return ImplicitStribeckSolverResult::kSuccess;
   }
 
@@ -643,6 +746,8 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
   auto& Delta_v = fixed_size_workspace_.mutable_Delta_v();
   auto& residual = fixed_size_workspace_.mutable_residual();
   auto& J = fixed_size_workspace_.mutable_J();
+  auto& J_lu = fixed_size_workspace_.mutable_J_lu();
+  auto& J_ldlt = fixed_size_workspace_.mutable_J_ldlt();
   auto& tau_f = fixed_size_workspace_.mutable_tau_f();
   auto& tau = fixed_size_workspace_.mutable_tau();
 
@@ -654,6 +759,7 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
   auto Delta_vn = variable_size_workspace_.mutable_Delta_vn();
   auto Delta_vt = variable_size_workspace_.mutable_Delta_vt();
   auto& dft_dvt = variable_size_workspace_.mutable_dft_dvt();
+  auto dfn_dvn = variable_size_workspace_.mutable_dfn_dvn();
   auto Gn = variable_size_workspace_.mutable_Gn();
   auto mu_vt = variable_size_workspace_.mutable_mu();
   auto t_hat = variable_size_workspace_.mutable_t_hat();
@@ -666,13 +772,29 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
   double vt_error = 2 * v_contact_tolerance;
   double vn_error = 2 * v_contact_tolerance;
 
+  // The Newton-Raphson Jacobian has the structure J = M + Jcᵀ C Jc (see
+  // SolveInContactSpace()). When the number nk of rows in Jc (the number of
+  // contact velocities) is smaller than nv, we factorize M once and only
+  // factorize a dense nk x nk system per iteration instead of the nv x nv
+  // Jacobian.
+  const int nk = has_two_way_coupling() ? 3 * nc_ : 2 * nc_;
+  const bool solve_in_contact_space = nk < nv_;
+  if (solve_in_contact_space) {
+    variable_size_workspace_.ResizeContactSpaceIfNeeded(nk);
+    if (!CalcContactSpaceOperators()) {
+      return ImplicitStribeckSolverResult::kLinearSolverFailed;
+    }
+  }
+
   // Initialize iteration with the guess provided.
   v = v_guess;
 
   for (int iter = 0; iter < max_iterations; ++iter) {
+    const Clock::time_point iteration_start = Clock::now();
+
     // Update normal and tangential velocities.
-    vn = Jn * v;
-    vt = Jt * v;
+    vn.noalias() = Jn * v;
+    vt.noalias() = Jt * v;
 
     if (has_two_way_coupling()) {
       // Update the penetration for the two-way coupling scheme.
@@ -680,8 +802,7 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
       x = x0 - dt * vn;
     }
 
-    CalcNormalForces(x, vn, Jn, dt, &fn, &Gn);
-
+    CalcNormalForces(x, vn, Jn, dt, &fn, &dfn_dvn, &Gn);
 
     // Update v_slip, t_hat, mus and ft as a function of vt and fn.
     CalcFrictionForces(vt, fn, &v_slip, &t_hat, &mu_vt, &ft);
@@ -691,38 +812,48 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     // Convergence is monitored in both tangential and normal directions.
     if (std::max(vt_error, vn_error) < v_contact_tolerance) {
       // Update generalized forces and return.
-      tau_f = Jt.transpose() * ft;
-      tau = tau_f + Jn.transpose() * fn;
+      tau_f.noalias() = Jt.transpose() * ft;
+      tau = tau_f;
+      tau.noalias() += Jn.transpose() * fn;
       return ImplicitStribeckSolverResult::kSuccess;
     }
 
     // Newton-Raphson residual.
-    residual =
-        M * v - p_star - dt * Jn.transpose() * fn - dt * Jt.transpose() * ft;
+    // R = M v − p* − δt Jₙᵀ fₙ − δt Jₜᵀ fₜ.
+    residual.noalias() = M * v;
+    residual -= p_star;
+    residual.noalias() -= dt * Jn.transpose() * fn;
+    residual.noalias() -= dt * Jt.transpose() * ft;
 
     // Compute gradient dft_dvt = ∇ᵥₜfₜ(vₜ) as a function of fn, mus,
     // t_hat and v_slip.
     CalcFrictionForcesGradient(fn, mu_vt, t_hat, v_slip, &dft_dvt);
 
-    // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
-    CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
-
     // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
     // Since we are in a non-linear iteration, an approximate cheap solution
     // is probably best.
     // TODO(amcastro-tri): Consider using a matrix-free iterative method to
     // avoid computing M and J. CG and the Krylov family can be matrix-free.
-    if (has_two_way_coupling()) {
-      auto& J_lu = fixed_size_workspace_.mutable_J_lu();
-      J_lu.compute(J);  // Update factorization.
-      Delta_v = J_lu.solve(-residual);
-    } else {
-      auto& J_ldlt = fixed_size_workspace_.mutable_J_ldlt();
-      J_ldlt.compute(J);  // Update factorization.
-      if (J_ldlt.info() != Eigen::Success) {
-        return ImplicitStribeckSolverResult::kLinearSolverFailed;
+    // When S = I + C W is ill conditioned, SolveInContactSpace() returns
+    // false and we fall back to the dense solve of J Δv = −R below.
+    const bool solved_in_contact_space =
+        solve_in_contact_space &&
+        SolveInContactSpace(
+            residual, dfn_dvn, dft_dvt, t_hat, mu_vt, dt, &Delta_v);
+    if (!solved_in_contact_space) {
+      // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt,
+      // dt.
+      CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
+      if (has_two_way_coupling()) {
+        J_lu.compute(J);  // Update factorization.
+        Delta_v = J_lu.solve(-residual);
+      } else {
+        J_ldlt.compute(J);  // Update factorization.
+        if (J_ldlt.info() != Eigen::Success) {
+          return ImplicitStribeckSolverResult::kLinearSolverFailed;
+        }
+        Delta_v = J_ldlt.solve(-residual);
       }
-      Delta_v = J_ldlt.solve(-residual);
     }
 
     // Since we keep Jt constant we have that:
@@ -733,11 +864,11 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     // determine by limiting the maximum angle change between vₜᵏ and vₜᵏ⁺¹.
     // For multiple contact points, we choose the minimum α among all contact
     // points.
-    Delta_vt = Jt * Delta_v;
+    Delta_vt.noalias() = Jt * Delta_v;
 
     // Similarly to Δvₜᵏ above, we define the update in the normal velocities
     // as Δvₙᵏ = Jₙ Δvᵏ.
-    Delta_vn = Jn * Delta_v;
+    Delta_vn.noalias() = Jn * Delta_v;
 
     // We monitor convergence in both normal and tangential velocities.
     vn_error = ExtractDoubleOrThrow(Delta_vn.norm());
@@ -750,7 +881,7 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     v = v + alpha * Delta_v;
 
     // Save iteration statistics.
-    statistics_.Update(vt_error);
+    statistics_.Update(vt_error, elapsed_seconds(iteration_start));
   }
 
   // If we are here is because we reached the maximum number of iterations
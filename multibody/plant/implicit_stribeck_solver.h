@@ -239,12 +239,14 @@ struct ImplicitStribeckSolverIterationStats {
     // Clear does not change a std::vector "capacity", and therefore there's
     // no reallocation (or deallocation) that could affect performance.
     residuals.clear();
+    iteration_times.clear();
   }
 
   /// (Internal) Used by ImplicitStribeckSolver to update statistics.
-  void Update(double iteration_residual) {
+  void Update(double iteration_residual, double iteration_time) {
     ++num_iterations;
     residuals.push_back(iteration_residual);
+    iteration_times.push_back(iteration_time);
   }
 
   /// The number of iterations performed by the last ImplicitStribeckSolver
@@ -264,6 +266,21 @@ struct ImplicitStribeckSolverIterationStats {
   /// The last entry in this vector, `residuals[num_iterations-1]`, corresponds
   /// to the residual upon completion of the solver, i.e. vt_residual.
   std::vector<double> residuals;
+
+  /// (Advanced) Wall-clock time, in seconds, spent in each Newton-Raphson
+  /// iteration performed by the solver. Like `residuals`, this vector has size
+  /// num_iterations after ImplicitStribeckSolver solved a problem.
+  /// One-time setup costs of a solve, such as factorizing the mass matrix, are
+  /// not included.
+  std::vector<double> iteration_times;
+
+  /// Returns the total wall-clock time, in seconds, spent in the
+  /// Newton-Raphson iterations of the last solve.
+  double total_iteration_time() const {
+    double total_time = 0;
+    for (double time : iteration_times) total_time += time;
+    return total_time;
+  }
 };
 
 /** @anchor implicit_stribeck_class_intro
@@ -619,6 +636,17 @@ class ImplicitStribeckSolver {
   ///
   /// @throws std::logic_error if `v_guess` is not of size `nv`, the number of
   /// generalized velocities specified at construction.
+  ///
+  /// The Newton-Raphson Jacobian has the structure J = M + Jcᵀ C Jc, where
+  /// Jc stacks the contact Jacobians (Jₜ for one-way coupling, Jₙ and Jₜ for
+  /// two-way coupling) and C is block diagonal per contact point. When there
+  /// are fewer contact velocities than generalized velocities, this method
+  /// exploits this structure: M is factorized once per call and each
+  /// iteration only factorizes a dense matrix in the size of the contact
+  /// velocities, by means of the Woodbury matrix identity. Otherwise the
+  /// dense nv x nv Jacobian is formed and factorized at each iteration.
+  /// In both cases the iterations do not allocate memory once the solver's
+  /// workspace has grown to fit the problem.
   ImplicitStribeckSolverResult SolveWithGuess(
       double dt, const VectorX<T>& v_guess) const;
 
@@ -849,7 +877,8 @@ class ImplicitStribeckSolver {
   class FixedSizeWorkspace {
    public:
     // Constructs a workspace with size only dependent on nv.
-    explicit FixedSizeWorkspace(int nv) : J_ldlt_(nv), J_lu_(nv) {
+    explicit FixedSizeWorkspace(int nv)
+        : J_ldlt_(nv), J_lu_(nv), M_ldlt_(nv) {
       J_ldlt_.setZero();
       v_.setZero(nv);
       residual_.setZero(nv);
@@ -866,6 +895,7 @@ class ImplicitStribeckSolver {
     VectorX<T>& mutable_tau() { return tau_; }
     Eigen::LDLT<MatrixX<T>>& mutable_J_ldlt() { return J_ldlt_; }
     Eigen::PartialPivLU<MatrixX<T>>& mutable_J_lu() { return J_lu_; }
+    Eigen::LDLT<MatrixX<T>>& mutable_M_ldlt() { return M_ldlt_; }
 
    private:
     // Vector of generalized velocities.
@@ -886,6 +916,10 @@ class ImplicitStribeckSolver {
     // LU Factorization of the Newton-Raphson Jacobian J. Only used for
     // two-way coupled problems with non-symmetric Jacobian.
     Eigen::PartialPivLU<MatrixX<T>> J_lu_;
+    // LDLT Factorization of the mass matrix M. Used when there are no contact
+    // points and when the Newton-Raphson update is computed in the space of
+    // contact velocities.
+    Eigen::LDLT<MatrixX<T>> M_ldlt_;
   };
 
   // The variables in this workspace can change size with each invocation of
@@ -921,7 +955,24 @@ class ImplicitStribeckSolver {
       v_slip_.resize(nc);
       mus_.resize(nc);
       dft_dv_.resize(nc);
+      dfn_dvn_.resize(nc);
       Gn_.resize(nc, nv);
+      Gt_.resize(nf, nv);
+    }
+
+    // Resizes, only if needed, the variables used to compute the
+    // Newton-Raphson update in the space of contact velocities, of size
+    // nk. This storage is allocated separately from the rest of the
+    // workspace since it is only needed when nk < nv.
+    void ResizeContactSpaceIfNeeded(int nk) {
+      nk_ = nk;
+      if (W_.rows() >= nk) return;  // no-op if not needed.
+      Jc_.resize(nk, nv_);
+      Minv_JcT_.resize(nv_, nk);
+      W_.resize(nk, nk);
+      S_.resize(nk, nk);
+      s_.resize(nk);
+      y_.resize(nk);
     }
 
     // Returns the current (maximum) capacity of the workspace.
@@ -1027,6 +1078,61 @@ class ImplicitStribeckSolver {
       return dft_dv_;
     }
 
+    // Returns a mutable reference to the vector storing ∂fₙ/∂vₙ for each
+    // contact point, of size nc. With this, Gn = diag(∂fₙ/∂vₙ) Jₙ.
+    Eigen::VectorBlock<VectorX<T>> mutable_dfn_dvn() {
+      return dfn_dvn_.segment(0, nc_);
+    }
+
+    // Returns a mutable reference to the gradient Gt = −∇ᵥfₜ(vₜˢ⁺¹), of
+    // size 2nc x nv.
+    Eigen::Block<MatrixX<T>> mutable_Gt() {
+      return Gt_.block(0, 0, 2 * nc_, nv_);
+    }
+
+    // The accessors below return the variables used to compute the
+    // Newton-Raphson update in the space of contact velocities, with sizes
+    // set by the last call to ResizeContactSpaceIfNeeded().
+
+    // Returns a mutable reference to the stacked contact Jacobian Jc, of size
+    // nk x nv.
+    Eigen::Block<MatrixX<T>> mutable_Jc() {
+      return Jc_.block(0, 0, nk_, nv_);
+    }
+
+    // Returns a mutable reference to M⁻¹Jcᵀ, of size nv x nk.
+    Eigen::Block<MatrixX<T>> mutable_Minv_JcT() {
+      return Minv_JcT_.block(0, 0, nv_, nk_);
+    }
+
+    // Returns a mutable reference to the Delassus operator W = Jc M⁻¹ Jcᵀ, of
+    // size nk x nk.
+    Eigen::Block<MatrixX<T>> mutable_W() {
+      return W_.block(0, 0, nk_, nk_);
+    }
+
+    // Returns a mutable reference to the matrix S = I + C W, of size nk x nk.
+    Eigen::Block<MatrixX<T>> mutable_S() {
+      return S_.block(0, 0, nk_, nk_);
+    }
+
+    // Returns a mutable reference to a vector of size nk, used to store the
+    // right hand side of the system S y = C Jc M⁻¹(−R).
+    Eigen::VectorBlock<VectorX<T>> mutable_s() {
+      return s_.segment(0, nk_);
+    }
+
+    // Returns a mutable reference to the solution y of S y = C Jc M⁻¹(−R), of
+    // size nk.
+    Eigen::VectorBlock<VectorX<T>> mutable_y() {
+      return y_.segment(0, nk_);
+    }
+
+    // Returns a mutable reference to the LU factorization of S.
+    Eigen::PartialPivLU<MatrixX<T>>& mutable_S_lu() {
+      return S_lu_;
+    }
+
    private:
     // The number of contact points. This determines sizes in this workspace.
     int nc_, nv_;
@@ -1042,7 +1148,19 @@ class ImplicitStribeckSolver {
     VectorX<T> mus_;       // (modified) Stribeck friction, in ℝⁿᶜ.
     // Vector of size nc storing ∂fₜ/∂vₜ (in ℝ²ˣ²) for each contact point.
     std::vector<Matrix2<T>> dft_dv_;
+    VectorX<T> dfn_dvn_;   // ∂fₙ/∂vₙ, in ℝⁿᶜ.
     MatrixX<T> Gn_;        // ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹), in ℝⁿᶜˣⁿᵛ
+    MatrixX<T> Gt_;        // −∇ᵥfₜ(vₜˢ⁺¹), in ℝ²ⁿᶜˣⁿᵛ
+    // Variables used to compute the Newton-Raphson update in the space of
+    // contact velocities, see SolveInContactSpace().
+    int nk_{0};            // The number of contact velocities.
+    MatrixX<T> Jc_;        // Jc, in ℝⁿᵏˣⁿᵛ.
+    MatrixX<T> Minv_JcT_;  // M⁻¹Jcᵀ, in ℝⁿᵛˣⁿᵏ.
+    MatrixX<T> W_;         // W = Jc M⁻¹ Jcᵀ, in ℝⁿᵏˣⁿᵏ.
+    MatrixX<T> S_;         // S = I + C W, in ℝⁿᵏˣⁿᵏ.
+    VectorX<T> s_;         // C Jc M⁻¹(−R), in ℝⁿᵏ.
+    VectorX<T> y_;         // S⁻¹ C Jc M⁻¹(−R), in ℝⁿᵏ.
+    Eigen::PartialPivLU<MatrixX<T>> S_lu_;
   };
 
   // Returns true if the solver is solving the two-way coupled problem.
@@ -1057,13 +1175,14 @@ class ImplicitStribeckSolver {
   // where `x₊` is max(x, 0) and k and d are the stiffness and
   // dissipation coefficients for a given contact point, respectively.
   // In addition, this method also computes the gradient
-  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹).
+  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹) = diag(dfn_dvn) Jₙ, with dfn_dvn = ∂fₙ/∂vₙ.
   void CalcNormalForces(
       const Eigen::Ref<const VectorX<T>>& x,
       const Eigen::Ref<const VectorX<T>>& vn,
       const Eigen::Ref<const MatrixX<T>>& Jn,
       double dt,
       EigenPtr<VectorX<T>> fn,
+      EigenPtr<VectorX<T>> dfn_dvn,
       EigenPtr<MatrixX<T>> Gn) const;
 
   // Helper to compute fₜ(vₜ) = −vₜ/‖vₜ‖ₛ μ(‖vₜ‖ₛ) fₙ, where ‖vₜ‖ₛ
@@ -1102,6 +1221,30 @@ class ImplicitStribeckSolver {
       const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
       EigenPtr<MatrixX<T>> J) const;
 
+  // Factorizes M and computes the operators M⁻¹Jcᵀ and W = Jc M⁻¹ Jcᵀ used
+  // by SolveInContactSpace(), where Jc stacks Jₙ and Jₜ (two-way coupling) or
+  // is Jₜ (one-way coupling). These only depend on the problem data and
+  // therefore are computed once per call to SolveWithGuess().
+  // Returns false if the factorization of M fails.
+  bool CalcContactSpaceOperators() const;
+
+  // Computes the Newton-Raphson update Δv = −J⁻¹R without forming J, by
+  // writing J = M + Jcᵀ C Jc, with C block diagonal per contact point, and
+  // applying the Woodbury matrix identity:
+  //   Δv = z − M⁻¹Jcᵀ (I + C W)⁻¹ C Jc z,  z = M⁻¹(−R).
+  // The dense system solved is of size nk x nk, with nk the number of rows in
+  // Jc. CalcContactSpaceOperators() must be called first.
+  // Returns false, leaving Delta_v unspecified, if S = I + C W is too ill
+  // conditioned for the update to be accurate. Callers must then compute Δv by
+  // factorizing the full Jacobian J instead.
+  bool SolveInContactSpace(
+      const Eigen::Ref<const VectorX<T>>& residual,
+      const Eigen::Ref<const VectorX<T>>& dfn_dvn,
+      const std::vector<Matrix2<T>>& dft_dvt,
+      const Eigen::Ref<const VectorX<T>>& t_hat,
+      const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
+      EigenPtr<VectorX<T>> Delta_v) const;
+
   // Limit the per-iteration angle change between vₜᵏ⁺¹ and vₜᵏ for
   // all contact points. The angle change θ is defined by the dot product
   // between vₜᵏ⁺¹ and vₜᵏ as: cos(θ) = vₜᵏ⁺¹⋅vₜᵏ/(‖vₜᵏ⁺¹‖‖vₜᵏ‖).
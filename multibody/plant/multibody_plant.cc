@@ -1271,14 +1271,10 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
   const int nv = this->num_velocities();
 
   // Allocate workspace. We might want to cache these to avoid allocations.
-  // Mass matrix.
-  MatrixX<T> M(nv, nv);
   // Forces.
   MultibodyForces<T> forces(internal_tree());
-  // Bodies' accelerations, ordered by BodyNodeIndex.
-  std::vector<SpatialAcceleration<T>> A_WB_array(internal_tree().num_bodies());
   // Generalized accelerations.
-  VectorX<T> vdot = VectorX<T>::Zero(nv);
+  VectorX<T> vdot(nv);
 
   const internal::PositionKinematicsCache<T>& pc =
       EvalPositionKinematics(context);
@@ -1300,35 +1296,19 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
     forces.mutable_generalized_forces() +=
         applied_generalized_force_input.Eval(context);
 
-  internal_tree().CalcMassMatrixViaInverseDynamics(context, &M);
-
-  // WARNING: to reduce memory foot-print, we use the input applied arrays also
-  // as output arrays. This means that both the array of applied body forces and
-  // the array of applied generalized forces get overwritten on output. This is
-  // not important in this case since we don't need their values anymore.
-  // Please see the documentation for CalcInverseDynamics() for details.
-
-  // With vdot = 0, this computes:
-  //   tau = C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
-  std::vector<SpatialForce<T>>& F_BBo_W_array = forces.mutable_body_forces();
-  VectorX<T>& tau_array = forces.mutable_generalized_forces();
-
   // Compute contact forces on each body by penalty method.
   if (num_collision_geometries() > 0) {
     std::vector<PenetrationAsPointPair<T>> point_pairs =
         CalcPointPairPenetrations(context);
     CalcAndAddContactForcesByPenaltyMethod(
-        context, pc, vc, point_pairs, &F_BBo_W_array);
+        context, pc, vc, point_pairs, &forces.mutable_body_forces());
   }
 
-  internal_tree().CalcInverseDynamics(
-      context, pc, vc, vdot,
-      F_BBo_W_array, tau_array,
-      &A_WB_array,
-      &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
-      &tau_array);
-
-  vdot = M.ldlt().solve(-tau_array);
+  // Solve M(q)v̇ + C(q, v)v = tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W for v̇ with the
+  // O(n) articulated body algorithm. This avoids forming and factorizing the
+  // dense mass matrix, an O(n³) operation.
+  internal_tree().CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+      context, forces, &vdot);
 
   auto v = x.bottomRows(nv);
   VectorX<T> xdot(this->num_multibody_states());
@@ -1407,10 +1387,10 @@ void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
   VectorX<T> q0 = x0.topRows(nq);
   VectorX<T> v0 = x0.bottomRows(nv);
 
-  // Mass matrix and its factorization.
+  // Mass matrix. Its factorization, when needed, is computed and stored by
+  // the contact solver in its workspace.
   MatrixX<T> M0(nv, nv);
   internal_tree().CalcMassMatrixViaInverseDynamics(context0, &M0);
-  auto M0_ldlt = M0.ldlt();
 
   // Forces at the previous time step.
   MultibodyForces<T> forces0(internal_tree());
@@ -83,6 +83,9 @@ namespace multibody {
 /// The vector `tau ∈ ℝⁿᵛ` on the right hand side of Eq. (1) corresponds to
 /// generalized forces applied on the system. These can include externally
 /// applied body forces, constraint forces, and contact forces.
+/// For continuous models, the time derivatives of the generalized velocities
+/// v̇ are computed with the O(n) articulated body algorithm [Jain 2010], which
+/// never forms nor factorizes the mass matrix `M(q)`.
 ///
 /// @section sdf_loading Loading models from SDF files
 ///
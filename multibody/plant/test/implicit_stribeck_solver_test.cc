@@ -1,6 +1,8 @@
 #include "drake/multibody/plant/implicit_stribeck_solver.h"
 
+#include <limits>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -31,6 +33,7 @@ class ImplicitStribeckSolverTester {
     auto vt = solver.variable_size_workspace_.mutable_vt();
     auto fn = solver.variable_size_workspace_.mutable_fn();
     auto ft = solver.variable_size_workspace_.mutable_ft();
+    auto dfn_dvn = solver.variable_size_workspace_.mutable_dfn_dvn();
     auto Gn = solver.variable_size_workspace_.mutable_Gn();
     auto mus = solver.variable_size_workspace_.mutable_mu();
     auto t_hat = solver.variable_size_workspace_.mutable_t_hat();
@@ -50,7 +53,7 @@ class ImplicitStribeckSolverTester {
 
     // Computes friction forces fn and gradients Gn as a function of x, vn,
     // Jn and dt.
-    solver.CalcNormalForces(x, vn, Jn, dt, &fn, &Gn);
+    solver.CalcNormalForces(x, vn, Jn, dt, &fn, &dfn_dvn, &Gn);
 
     // Tangential velocity.
     vt = Jt * v;
@@ -68,6 +71,33 @@ class ImplicitStribeckSolverTester {
 
     return J;
   }
+
+  // Computes the Newton-Raphson update Δv = −J⁻¹R at v for the given residual
+  // R, without forming J, using the solver's solve in the space of contact
+  // velocities.
+  static VectorX<double> SolveInContactSpace(
+      const ImplicitStribeckSolver<double>& solver,
+      const Eigen::Ref<const VectorX<double>>& v,
+      const Eigen::Ref<const VectorX<double>>& residual,
+      double dt) {
+    // Updates the solver's workspace at v.
+    CalcJacobian(solver, v, dt);
+
+    const int nc = solver.nc_;
+    const int nk = solver.has_two_way_coupling() ? 3 * nc : 2 * nc;
+    solver.variable_size_workspace_.ResizeContactSpaceIfNeeded(nk);
+    EXPECT_TRUE(solver.CalcContactSpaceOperators());
+
+    const auto dfn_dvn = solver.variable_size_workspace_.mutable_dfn_dvn();
+    const auto mus = solver.variable_size_workspace_.mutable_mu();
+    const auto t_hat = solver.variable_size_workspace_.mutable_t_hat();
+    const std::vector<Matrix2<double>>& dft_dvt =
+        solver.variable_size_workspace_.mutable_dft_dvt();
+    VectorX<double> Delta_v(solver.nv_);
+    EXPECT_TRUE(solver.SolveInContactSpace(
+        residual, dfn_dvn, dft_dvt, t_hat, mus, dt, &Delta_v));
+    return Delta_v;
+  }
 };
 namespace {
 
@@ -1080,6 +1110,96 @@ TEST_F(RollingCylinder, SlidingAfterImpact) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// A problem with more generalized velocities than contact velocities, for
+// which ImplicitStribeckSolver computes the Newton-Raphson updates in the
+// space of contact velocities instead of factorizing the nv x nv Jacobian.
+class ContactSpaceSolve : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // Arbitrary SPD mass matrix and contact Jacobians. Eigen's Random() is
+    // deterministic.
+    const MatrixX<double> A = MatrixX<double>::Random(nv_, nv_);
+    M_ = A * A.transpose() + nv_ * MatrixX<double>::Identity(nv_, nv_);
+    Jn_ = MatrixX<double>::Random(nc_, nv_);
+    Jt_ = MatrixX<double>::Random(2 * nc_, nv_);
+    v0_ = VectorX<double>::Random(nv_);
+    p_star_ = M_ * v0_ + dt_ * VectorX<double>::Random(nv_);
+    // Penetrations of O(dt) and a dissipation small enough so that all
+    // contact points are active for velocities of order one.
+    x0_ = VectorX<double>::Constant(nc_, 0.01);
+    stiffness_ = VectorX<double>::Constant(nc_, 1.0e4);
+    dissipation_ = VectorX<double>::Constant(nc_, 0.1);
+    fn_ = VectorX<double>::Constant(nc_, 10.0);
+    mu_ = VectorX<double>::Constant(nc_, 0.5);
+  }
+
+  // Verifies that the Newton-Raphson update computed in the space of contact
+  // velocities matches the update computed with the dense Jacobian.
+  void VerifyNewtonRaphsonUpdate() {
+    const VectorX<double> residual = VectorX<double>::Random(nv_);
+    const MatrixX<double> J =
+        ImplicitStribeckSolverTester::CalcJacobian(solver_, v0_, dt_);
+    const VectorX<double> Delta_v_expected = J.partialPivLu().solve(-residual);
+    const VectorX<double> Delta_v =
+        ImplicitStribeckSolverTester::SolveInContactSpace(
+            solver_, v0_, residual, dt_);
+    EXPECT_TRUE(CompareMatrices(
+        Delta_v, Delta_v_expected,
+        nv_ * Delta_v_expected.norm() * std::numeric_limits<double>::epsilon(),
+        MatrixCompareType::absolute));
+  }
+
+  // Verifies the solution and statistics after a call to SolveWithGuess().
+  void VerifySolution() {
+    ASSERT_EQ(solver_.SolveWithGuess(dt_, v0_),
+              ImplicitStribeckSolverResult::kSuccess);
+    const auto& stats = solver_.get_iteration_statistics();
+    EXPECT_GT(stats.num_iterations, 0);
+    ASSERT_EQ(stats.iteration_times.size(), stats.residuals.size());
+    for (double time : stats.iteration_times) EXPECT_GE(time, 0.0);
+    EXPECT_GE(stats.total_iteration_time(), 0.0);
+
+    // Upon convergence, the momentum balance is satisfied up to the
+    // Newton-Raphson update of the last iteration.
+    const VectorX<double>& v = solver_.get_generalized_velocities();
+    const VectorX<double> momentum_residual =
+        M_ * v - p_star_ - dt_ * solver_.get_generalized_contact_forces();
+    EXPECT_LT(momentum_residual.norm(),
+              M_.norm() * 10 * stats.vt_residual() + 1.0e-10);
+  }
+
+ protected:
+  const int nv_{8};  // Number of generalized velocities.
+  const int nc_{2};  // Number of contact points.
+  const double dt_{1.0e-3};
+
+  MatrixX<double> M_;
+  MatrixX<double> Jn_;
+  MatrixX<double> Jt_;
+  VectorX<double> v0_;
+  VectorX<double> p_star_;
+  VectorX<double> x0_;
+  VectorX<double> stiffness_;
+  VectorX<double> dissipation_;
+  VectorX<double> fn_;
+  VectorX<double> mu_;
+
+  ImplicitStribeckSolver<double> solver_{nv_};
+};
+
+TEST_F(ContactSpaceSolve, OneWayCoupling) {
+  solver_.SetOneWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn_, &mu_);
+  VerifyNewtonRaphsonUpdate();
+  VerifySolution();
+}
+
+TEST_F(ContactSpaceSolve, TwoWayCoupling) {
+  solver_.SetTwoWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &x0_,
+                                      &stiffness_, &dissipation_, &mu_);
+  VerifyNewtonRaphsonUpdate();
+  VerifySolution();
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/math/spatial_algebra.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
+#include "drake/multibody/tree/multibody_tree_topology.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/// This class holds the results of the tip-to-base pass of the articulated
+/// body algorithm that depend on the generalized velocities and on the
+/// applied forces, in addition to the generalized positions. Together with
+/// an ArticulatedBodyInertiaCache these are all the quantities needed by the
+/// final base-to-tip pass that computes generalized accelerations.
+///
+/// Articulated body force cache entries include:
+///
+/// - Spatial acceleration bias `Ab_WB`, the velocity dependent part of the
+///   spatial acceleration of body B in the world frame W, i.e. the
+///   acceleration B would have if both its parent's spatial acceleration and
+///   its mobilizer's generalized accelerations were zero. It includes the
+///   centrifugal and Coriolis terms, about Bo and expressed in W.
+/// - Articulated body force bias `Zplus_PB_W`, which can be thought of as the
+///   force bias of body B's articulated body as felt by its parent body P
+///   through B's inboard mobilizer, but taken about Bo and expressed in W.
+/// - Mobility space residual force `e_B`, the projection onto the motion
+///   sub-space of B's inboard mobilizer of the applied generalized forces
+///   minus the articulated body bias forces.
+///
+/// @tparam T The mathematical type of the context, which must be a valid Eigen
+///           scalar.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+///
+/// - double
+/// - AutoDiffXd
+/// - symbolic::Expression
+///
+/// They are already available to link against in the containing library.
+template<typename T>
+class ArticulatedBodyForceCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ArticulatedBodyForceCache)
+
+  /// Constructs an articulated body force cache entry for the given
+  /// MultibodyTreeTopology.
+  explicit ArticulatedBodyForceCache(const MultibodyTreeTopology& topology) :
+      num_nodes_(topology.num_bodies()) {
+    Allocate();
+  }
+
+  /// Spatial acceleration bias `Ab_WB` of body B, about Bo and expressed in W.
+  const SpatialAcceleration<T>& get_Ab_WB(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return Ab_WB_[body_node_index];
+  }
+
+  /// Mutable version of get_Ab_WB().
+  SpatialAcceleration<T>& get_mutable_Ab_WB(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return Ab_WB_[body_node_index];
+  }
+
+  /// Articulated body force bias `Zplus_PB_W` projected across body B's
+  /// inboard mobilizer, taken about Bo and expressed in W.
+  const SpatialForce<T>& get_Zplus_PB_W(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return Zplus_PB_W_[body_node_index];
+  }
+
+  /// Mutable version of get_Zplus_PB_W().
+  SpatialForce<T>& get_mutable_Zplus_PB_W(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return Zplus_PB_W_[body_node_index];
+  }
+
+  /// Mobility space residual force `e_B` for body B's inboard mobilizer, of
+  /// size equal to the number of mobilities of the node.
+  const VectorUpTo6<T>& get_e_B(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return e_B_[body_node_index];
+  }
+
+  /// Mutable version of get_e_B().
+  VectorUpTo6<T>& get_mutable_e_B(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return e_B_[body_node_index];
+  }
+
+ private:
+  // Allocates resources for this articulated body force cache.
+  void Allocate() {
+    Ab_WB_.resize(num_nodes_);
+    Zplus_PB_W_.resize(num_nodes_);
+    e_B_.resize(num_nodes_);
+  }
+
+  // Number of body nodes in the corresponding MultibodyTree.
+  int num_nodes_{0};
+
+  // Pools, all indexed by BodyNodeIndex.
+  std::vector<SpatialAcceleration<T>> Ab_WB_{};
+  std::vector<SpatialForce<T>> Zplus_PB_W_{};
+  std::vector<VectorUpTo6<T>> e_B_{};
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::internal::ArticulatedBodyForceCache)
@@ -9,6 +9,7 @@
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/math/spatial_algebra.h"
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
+#include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/body.h"
 #include "drake/multibody/tree/mobilizer.h"
@@ -1005,6 +1006,9 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
       P_B_W += Pplus_BCb_W;
     }
 
+    // Store P_B_W, needed by the force bias pass of the algorithm.
+    get_mutable_P_B_W(abc) = P_B_W;
+
     // Get the number of mobilizer velocities (number of columns of H_PB_W).
     const int nv = get_num_mobilizer_velocities();
 
@@ -1015,10 +1019,12 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     MatrixUpTo6<T> D_B(nv, nv);
     D_B.template triangularView<Eigen::Lower>() = HTxP * H_PB_W;
 
-    // Compute the LDLT factorization of D_B as ldlt_D_B.
+    // Compute the LDLT factorization of D_B as ldlt_D_B and store it in the
+    // cache for the second pass of the articulated body algorithm.
     // TODO(bobbyluig): Test performance against inverse().
-    const auto ldlt_D_B =
-        D_B.template selfadjointView<Eigen::Lower>().ldlt();
+    Eigen::LDLT<MatrixUpTo6<T>>& ldlt_D_B = get_mutable_ldlt_D_B(abc);
+    ldlt_D_B.compute(MatrixUpTo6<T>(
+        D_B.template selfadjointView<Eigen::Lower>()));
 
     // Ensure that D_B is not singular.
     // Singularity means that a non-physical hinge mapping matrix was used or
@@ -1035,7 +1041,8 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     }
 
     // Compute the Kalman gain, g_PB_W, using (6).
-    const MatrixUpTo6<T> g_PB_W = ldlt_D_B.solve(HTxP).transpose();
+    MatrixUpTo6<T>& g_PB_W = get_mutable_g_PB_W(abc);
+    g_PB_W = ldlt_D_B.solve(HTxP).transpose();
 
     // Project P_B_W using (7) to obtain Pplus_PB_W, the articulated body
     // inertia of this body B as felt by body P and expressed in frame W.
@@ -1046,6 +1053,228 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
         0.5 * (Pplus_PB_W_mat + Pplus_PB_W_mat.transpose()));
   }
 
+  /// This method is used by MultibodyTree within a tip-to-base loop to compute
+  /// this node's articulated body algorithm quantities that depend on the
+  /// generalized velocities and on the applied forces.
+  ///
+  /// @param[in] context
+  ///   The context with the state of the MultibodyTree model.
+  /// @param[in] pc
+  ///   An already updated position kinematics cache in sync with `context`.
+  /// @param[in] vc
+  ///   An already updated velocity kinematics cache in sync with `context`.
+  /// @param[in] abic
+  ///   An already updated articulated body inertia cache in sync with
+  ///   `context`.
+  /// @param[in] Fapplied_Bo_W
+  ///   Externally applied spatial force on this node's body B at the body's
+  ///   frame origin `Bo`, expressed in the world frame.
+  /// @param[in] tau_applied
+  ///   Externally applied generalized force at this node's mobilizer. It can
+  ///   have zero size, implying no generalized forces are applied. Otherwise it
+  ///   must have a size equal to the number of generalized velocities for this
+  ///   node's mobilizer, see get_num_mobilizer_velocities().
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix that relates to the spatial velocity `V_PB_W`
+  ///   of this node's body B in its parent node body P, expressed in the world
+  ///   frame W, with this node's generalized velocities (or mobilities) `v_B`
+  ///   by `V_PB_W = H_PB_W⋅v_B`.
+  /// @param[out] aba_force_cache
+  ///   A pointer to a valid, non nullptr, articulated body force cache.
+  ///
+  /// @pre The position kinematics cache `pc` and the velocity kinematics cache
+  /// `vc` were already updated to be in sync with `context`.
+  /// @pre `abic` was already updated by
+  /// MultibodyTree::CalcArticulatedBodyInertiaCache().
+  /// @pre CalcArticulatedBodyForceCache_TipToBase() must have already been
+  /// called for all the child nodes of `this` node (and, by recursive
+  /// precondition, all successor nodes in the tree.)
+  ///
+  /// @throws std::exception when called on the _root_ node or
+  /// `aba_force_cache` is nullptr.
+  void CalcArticulatedBodyForceCache_TipToBase(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      const ArticulatedBodyInertiaCache<T>& abic,
+      const SpatialForce<T>& Fapplied_Bo_W,
+      const Eigen::Ref<const VectorX<T>>& tau_applied,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      ArticulatedBodyForceCache<T>* aba_force_cache) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_THROW_UNLESS(aba_force_cache != nullptr);
+    DRAKE_DEMAND(
+        tau_applied.size() == get_num_mobilizer_velocities() ||
+        tau_applied.size() == 0);
+
+    // As a guideline for developers, a summary of the computations performed in
+    // this method is provided. Notation is as in
+    // CalcArticulatedBodyInertiaCache_TipToBase(), where P_B_W, D_B and g_PB_W
+    // were already computed.
+    //
+    // The spatial acceleration of body B can be written in terms of the
+    // acceleration A_WP of its parent P and its generalized accelerations vmdot
+    // as:
+    //   A_WB = Φᵀ(p_PB_W) A_WP + H_PB_W vmdot + Ab_WB                      (1)
+    // where Ab_WB is the spatial acceleration bias collecting all velocity
+    // dependent terms (centrifugal, Coriolis and H_FMdot * vm). That is, Ab_WB
+    // is the acceleration B would have if both A_WP and vmdot were zero.
+    //
+    // The spatial force F_BBo_W exerted on B by its inboard mobilizer is,
+    // given the recursive definition of the articulated body inertia:
+    //   F_BBo_W = P_B_W A_WB + Z_B_W                                        (2)
+    // where Z_B_W is the articulated body force bias, which collects the
+    // gyroscopic force b_Bo_W of body B, the applied force Fapplied_Bo_W and
+    // the projected force biases Zplus_BCᵢ_W of all children Cᵢ:
+    //   Z_B_W = b_Bo_W - Fapplied_Bo_W + Σᵢ(Φ(p_BCᵢ_W) Zplus_BCᵢ_W)         (3)
+    //
+    // Projecting (2) onto the motion sub-space of the mobilizer leads to the
+    // equation for the generalized accelerations vmdot:
+    //   D_B vmdot = e_B - H_PB_Wᵀ P_B_W Φᵀ(p_PB_W) A_WP                     (4)
+    // with the mobility space residual force:
+    //   e_B = tau_applied - H_PB_Wᵀ (Z_B_W + P_B_W Ab_WB)                   (5)
+    //
+    // Substituting vmdot from (4) back into (2) gives the force through the
+    // mobilizer as a function of the parent's acceleration only,
+    // F_BBo_W = Pplus_PB_W Φᵀ(p_PB_W) A_WP + Zplus_PB_W, with:
+    //   Zplus_PB_W = Z_B_W + P_B_W Ab_WB + g_PB_W e_B                       (6)
+
+    // Body for this node.
+    const Body<T>& body_B = body();
+
+    // Inboard frame F and outboard frame M of this node's mobilizer.
+    const Frame<T>& frame_F = inboard_frame();
+    DRAKE_ASSERT(frame_F.body().index() == parent_body().index());
+    const Frame<T>& frame_M = outboard_frame();
+    DRAKE_ASSERT(frame_M.body().index() == body_B.index());
+
+    // =========================================================================
+    // Computation of the spatial acceleration bias Ab_WB in Eq. (1). This
+    // mirrors CalcSpatialAcceleration_BaseToTip() with A_WP = 0 and vmdot = 0.
+    const Isometry3<T> X_PF = frame_F.CalcPoseInBodyFrame(context);
+    const Isometry3<T> X_MB = frame_M.CalcPoseInBodyFrame(context).inverse();
+    const Isometry3<T>& X_WP = get_X_WP(pc);
+    const Matrix3<T> R_WF = X_WP.linear() * X_PF.linear();
+    const Vector3<T> p_MB_F = get_X_FM(pc).linear() * X_MB.translation();
+    const SpatialVelocity<T>& V_FM = get_V_FM(vc);
+
+    // Operator Ab_FM = Hdot_FM * vm, i.e. A_FM with vmdot = 0.
+    const int nv = get_num_mobilizer_velocities();
+    const VectorX<T> vmdot_zero = VectorX<T>::Zero(nv);
+    const SpatialAcceleration<T> Ab_FM =
+        get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(
+            context, vmdot_zero);
+    const SpatialAcceleration<T> Ab_PB_W =
+        R_WF * Ab_FM.Shift(p_MB_F, V_FM.rotational());
+
+    const SpatialVelocity<T>& V_WP = get_V_WP(vc);
+    const SpatialVelocity<T>& V_PB_W = get_V_PB_W(vc);
+    const Vector3<T> p_PB_W = X_WP.linear() * get_X_PB(pc).translation();
+    SpatialAcceleration<T>& Ab_WB = get_mutable_Ab_WB(aba_force_cache);
+    Ab_WB = SpatialAcceleration<T>::Zero().ComposeWithMovingFrameAcceleration(
+        p_PB_W, V_WP.rotational(), V_PB_W, Ab_PB_W);
+
+    // =========================================================================
+    // Computation of the articulated body force bias Z_B_W in Eq. (3).
+
+    // Gyroscopic spatial force b_Bo_W, i.e. the total force for A_WB = 0.
+    SpatialForce<T> Z_B_W;
+    CalcBodySpatialForceGivenItsSpatialAcceleration(
+        context, pc, vc, SpatialAcceleration<T>::Zero(), &Z_B_W);
+    Z_B_W -= Fapplied_Bo_W;
+
+    // Add force bias contributions from all children.
+    const Matrix3<T>& R_WB = get_X_WB(pc).linear();
+    for (const BodyNode<T>* child : children_) {
+      // Compute shift vector p_CoBo_W.
+      const Isometry3<T>& X_BC = child->get_X_PB(pc);
+      const Vector3<T> p_CoBo_W = -(R_WB * X_BC.translation());
+
+      // Pull Zplus_BC_W from cache (which is Zplus_PB_W for child) and shift
+      // it to Bo.
+      Z_B_W += child->get_Zplus_PB_W(*aba_force_cache).Shift(p_CoBo_W);
+    }
+
+    // Add the contribution of the acceleration bias, Zb_B_W = Z_B_W + P_B_W
+    // Ab_WB, common to Eqs. (5) and (6).
+    const ArticulatedBodyInertia<T>& P_B_W = get_P_B_W(abic);
+    const SpatialForce<T> Zb_B_W =
+        Z_B_W + SpatialForce<T>(P_B_W * Ab_WB.get_coeffs());
+
+    // Compute the mobility space residual force using Eq. (5).
+    VectorUpTo6<T>& e_B = get_mutable_e_B(aba_force_cache);
+    e_B = -H_PB_W.transpose() * Zb_B_W.get_coeffs();
+    if (tau_applied.size() != 0) e_B += tau_applied;
+
+    // Compute the projected force bias using Eq. (6).
+    const MatrixUpTo6<T>& g_PB_W = get_g_PB_W(abic);
+    get_mutable_Zplus_PB_W(aba_force_cache) =
+        Zb_B_W + SpatialForce<T>(g_PB_W * e_B);
+  }
+
+  /// This method is used by MultibodyTree within a base-to-tip loop to compute
+  /// the generalized accelerations of this node's mobilizer and the spatial
+  /// acceleration of its body, the final pass of the articulated body
+  /// algorithm.
+  ///
+  /// @param[in] pc
+  ///   An already updated position kinematics cache in sync with the context.
+  /// @param[in] abic
+  ///   An already updated articulated body inertia cache in sync with the
+  ///   context.
+  /// @param[in] aba_force_cache
+  ///   An already updated articulated body force cache in sync with the
+  ///   context.
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix of this node, see
+  ///   CalcArticulatedBodyForceCache_TipToBase().
+  /// @param[in,out] A_WB_array
+  ///   A pointer to a valid, non nullptr, vector of spatial accelerations
+  ///   ordered by BodyNodeIndex. On input it must contain the already computed
+  ///   spatial acceleration of the parent body. On output the entry for this
+  ///   node's body B contains A_WB.
+  /// @param[out] vdot
+  ///   A pointer to a valid, non nullptr, vector of generalized accelerations
+  ///   for the entire model. On output the entries for this node's mobilizer
+  ///   are overwritten.
+  ///
+  /// @pre CalcArticulatedBodyAccelerations_BaseToTip() must have already been
+  /// called for the parent node (and, by recursive precondition, all
+  /// predecessor nodes in the tree).
+  void CalcArticulatedBodyAccelerations_BaseToTip(
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abic,
+      const ArticulatedBodyForceCache<T>& aba_force_cache,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      std::vector<SpatialAcceleration<T>>* A_WB_array,
+      EigenPtr<VectorX<T>> vdot) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_DEMAND(A_WB_array != nullptr);
+    DRAKE_DEMAND(vdot != nullptr);
+
+    // Rigidly shift the parent's acceleration to Bo, Aplus_WB = Φᵀ(p_PB_W)
+    // A_WP. The centrifugal terms are already accounted for in Ab_WB.
+    const SpatialAcceleration<T>& A_WP = get_A_WP_from_array(*A_WB_array);
+    const Vector3<T> p_PB_W =
+        get_X_WP(pc).linear() * get_X_PB(pc).translation();
+    const SpatialAcceleration<T> Aplus_WB(
+        A_WP.rotational(),
+        A_WP.translational() + A_WP.rotational().cross(p_PB_W));
+
+    // Solve Eq. (4) in CalcArticulatedBodyForceCache_TipToBase() for the
+    // generalized accelerations, using g_PB_Wᵀ = D_B⁻¹ H_PB_Wᵀ P_B_W:
+    //   vmdot = D_B⁻¹ e_B - g_PB_Wᵀ Aplus_WB
+    auto vmdot = get_mutable_velocities_from_array(vdot);
+    vmdot = get_ldlt_D_B(abic).solve(get_e_B(aba_force_cache)) -
+        get_g_PB_W(abic).transpose() * Aplus_WB.get_coeffs();
+
+    // Spatial acceleration of B, Eq. (1) in
+    // CalcArticulatedBodyForceCache_TipToBase().
+    get_mutable_A_WB_from_array(A_WB_array) = SpatialAcceleration<T>(
+        Aplus_WB.get_coeffs() + H_PB_W * vmdot +
+        get_Ab_WB(aba_force_cache).get_coeffs());
+  }
+
  protected:
   /// Returns the inboard frame F of this node's mobilizer.
   /// @throws std::runtime_error if called on the root node corresponding to
@@ -1221,6 +1450,87 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     return abc->get_mutable_Pplus_PB_W(topology_.index);
   }
 
+  /// Returns a const reference to the articulated body inertia `P_B_W` of
+  /// this node's body B, taken about Bo and expressed in W.
+  const ArticulatedBodyInertia<T>& get_P_B_W(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_P_B_W(topology_.index);
+  }
+
+  /// Mutable version of get_P_B_W().
+  ArticulatedBodyInertia<T>& get_mutable_P_B_W(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_P_B_W(topology_.index);
+  }
+
+  /// Returns a const reference to the LDLT factorization of the articulated
+  /// body hinge inertia `D_B` of this node.
+  const Eigen::LDLT<MatrixUpTo6<T>>& get_ldlt_D_B(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_ldlt_D_B(topology_.index);
+  }
+
+  /// Mutable version of get_ldlt_D_B().
+  Eigen::LDLT<MatrixUpTo6<T>>& get_mutable_ldlt_D_B(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_ldlt_D_B(topology_.index);
+  }
+
+  /// Returns a const reference to the Kalman gain `g_PB_W` of this node.
+  const MatrixUpTo6<T>& get_g_PB_W(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_g_PB_W(topology_.index);
+  }
+
+  /// Mutable version of get_g_PB_W().
+  MatrixUpTo6<T>& get_mutable_g_PB_W(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_g_PB_W(topology_.index);
+  }
+
+  // =========================================================================
+  // ArticulatedBodyForceCache Accessors and Mutators.
+
+  /// Returns a const reference to the spatial acceleration bias `Ab_WB` of
+  /// this node's body B.
+  const SpatialAcceleration<T>& get_Ab_WB(
+      const ArticulatedBodyForceCache<T>& aba_force_cache) const {
+    return aba_force_cache.get_Ab_WB(topology_.index);
+  }
+
+  /// Mutable version of get_Ab_WB().
+  SpatialAcceleration<T>& get_mutable_Ab_WB(
+      ArticulatedBodyForceCache<T>* aba_force_cache) const {
+    return aba_force_cache->get_mutable_Ab_WB(topology_.index);
+  }
+
+  /// Returns a const reference to the articulated body force bias
+  /// `Zplus_PB_W` of this node's body B, projected across its inboard
+  /// mobilizer.
+  const SpatialForce<T>& get_Zplus_PB_W(
+      const ArticulatedBodyForceCache<T>& aba_force_cache) const {
+    return aba_force_cache.get_Zplus_PB_W(topology_.index);
+  }
+
+  /// Mutable version of get_Zplus_PB_W().
+  SpatialForce<T>& get_mutable_Zplus_PB_W(
+      ArticulatedBodyForceCache<T>* aba_force_cache) const {
+    return aba_force_cache->get_mutable_Zplus_PB_W(topology_.index);
+  }
+
+  /// Returns a const reference to the mobility space residual force `e_B` of
+  /// this node.
+  const VectorUpTo6<T>& get_e_B(
+      const ArticulatedBodyForceCache<T>& aba_force_cache) const {
+    return aba_force_cache.get_e_B(topology_.index);
+  }
+
+  /// Mutable version of get_e_B().
+  VectorUpTo6<T>& get_mutable_e_B(
+      ArticulatedBodyForceCache<T>* aba_force_cache) const {
+    return aba_force_cache->get_mutable_e_B(topology_.index);
+  }
+
   // =========================================================================
   // Per Node Array Accessors.
   // Quantities are ordered by BodyNodeIndex unless otherwise specified.
@@ -1507,6 +1507,103 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcArticulatedBodyForceCache(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    const VelocityKinematicsCache<T>& vc,
+    const ArticulatedBodyInertiaCache<T>& abic,
+    const MultibodyForces<T>& forces,
+    ArticulatedBodyForceCache<T>* aba_force_cache) const {
+  DRAKE_DEMAND(aba_force_cache != nullptr);
+  DRAKE_DEMAND(forces.CheckHasRightSizeForModel(*this));
+
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
+  const std::vector<SpatialForce<T>>& Fapplied_Bo_W_array =
+      forces.body_forces();
+  const VectorX<T>& tau_applied_array = forces.generalized_forces();
+
+  // Perform tip-to-base recursion, skipping the world.
+  for (int depth = tree_height() - 1; depth > 0; depth--) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+      // Get hinge mapping matrix.
+      const MatrixUpTo6<T> H_PB_W = node.GetJacobianFromArray(H_PB_W_cache);
+
+      // Applied forces on this node.
+      const SpatialForce<T>& Fapplied_Bo_W =
+          Fapplied_Bo_W_array[body_node_index];
+      const auto tau_applied =
+          node.get_mobilizer().get_generalized_forces_from_array(
+              tau_applied_array);
+
+      node.CalcArticulatedBodyForceCache_TipToBase(
+          context, pc, vc, abic, Fapplied_Bo_W, tau_applied, H_PB_W,
+          aba_force_cache);
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    const ArticulatedBodyInertiaCache<T>& abic,
+    const ArticulatedBodyForceCache<T>& aba_force_cache,
+    std::vector<SpatialAcceleration<T>>* A_WB_array,
+    EigenPtr<VectorX<T>> vdot) const {
+  DRAKE_DEMAND(A_WB_array != nullptr);
+  DRAKE_DEMAND(static_cast<int>(A_WB_array->size()) == num_bodies());
+  DRAKE_DEMAND(vdot != nullptr);
+  DRAKE_DEMAND(vdot->size() == num_velocities());
+
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
+  // The world's spatial acceleration is always zero.
+  (*A_WB_array)[world_index()] = SpatialAcceleration<T>::Zero();
+
+  // Perform base-to-tip recursion, skipping the world.
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+      // Get hinge mapping matrix.
+      const MatrixUpTo6<T> H_PB_W = node.GetJacobianFromArray(H_PB_W_cache);
+
+      node.CalcArticulatedBodyAccelerations_BaseToTip(
+          pc, abic, aba_force_cache, H_PB_W, A_WB_array, vdot);
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+    const systems::Context<T>& context,
+    const MultibodyForces<T>& forces,
+    EigenPtr<VectorX<T>> vdot) const {
+  DRAKE_THROW_UNLESS(vdot != nullptr);
+  DRAKE_THROW_UNLESS(vdot->size() == num_velocities());
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
+  const ArticulatedBodyInertiaCache<T>& abic =
+      EvalArticulatedBodyInertiaCache(context);
+
+  // TODO(amcastro-tri): Consider placing these workspace arrays in the
+  // context to avoid heap allocations.
+  ArticulatedBodyForceCache<T> aba_force_cache(get_topology());
+  CalcArticulatedBodyForceCache(
+      context, pc, vc, abic, forces, &aba_force_cache);
+
+  std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+  CalcArticulatedBodyAccelerations(
+      context, pc, abic, aba_force_cache, &A_WB_array, vdot);
+}
+
 template <typename T>
 MatrixX<double> MultibodyTree<T>::MakeStateSelectorMatrix(
     const std::vector<JointIndex>& user_to_joint_index_map) const {
@@ -18,6 +18,7 @@
 #include "drake/common/random.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
+#include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
@@ -1573,6 +1574,98 @@ class MultibodyTree {
       const PositionKinematicsCache<T>& pc,
       ArticulatedBodyInertiaCache<T>* abc) const;
 
+  /// Computes the quantities of the tip-to-base pass of the articulated body
+  /// algorithm that depend on the generalized velocities and on the applied
+  /// forces, and stores them in the articulated body force cache
+  /// `aba_force_cache`.
+  ///
+  /// These include:
+  /// - Spatial acceleration bias `Ab_WB` of each body B, collecting all
+  ///   velocity dependent terms of its spatial acceleration.
+  /// - Articulated body force bias `Zplus_PB_W` of each body B, projected
+  ///   across its inboard mobilizer, taken about Bo and expressed in W.
+  /// - Mobility space residual force `e_B` of each body B's inboard mobilizer.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] pc
+  ///   A position kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] vc
+  ///   A velocity kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] abic
+  ///   An articulated body inertia cache already updated to be in sync with
+  ///   `context`, see CalcArticulatedBodyInertiaCache().
+  /// @param[in] forces
+  ///   Applied body spatial forces and generalized forces. It must be
+  ///   compatible with `this` model, see
+  ///   MultibodyForces::CheckHasRightSizeForModel().
+  /// @param[out] aba_force_cache
+  ///   A pointer to a valid, non nullptr, articulated body force cache. This
+  ///   method throws an exception if `aba_force_cache` is a nullptr.
+  void CalcArticulatedBodyForceCache(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      const ArticulatedBodyInertiaCache<T>& abic,
+      const MultibodyForces<T>& forces,
+      ArticulatedBodyForceCache<T>* aba_force_cache) const;
+
+  /// Performs the final base-to-tip pass of the articulated body algorithm,
+  /// computing the generalized accelerations `vdot` and the spatial
+  /// accelerations `A_WB` of all bodies.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] pc
+  ///   A position kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] abic
+  ///   An articulated body inertia cache already updated to be in sync with
+  ///   `context`, see CalcArticulatedBodyInertiaCache().
+  /// @param[in] aba_force_cache
+  ///   An articulated body force cache already updated to be in sync with
+  ///   `context`, see CalcArticulatedBodyForceCache().
+  /// @param[out] A_WB_array
+  ///   A pointer to a valid, non nullptr, vector of spatial accelerations
+  ///   of size num_bodies(). On output, entries are ordered by BodyNodeIndex.
+  /// @param[out] vdot
+  ///   A pointer to a valid, non nullptr, vector of size num_velocities().
+  ///   On output it contains the generalized accelerations.
+  void CalcArticulatedBodyAccelerations(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abic,
+      const ArticulatedBodyForceCache<T>& aba_force_cache,
+      std::vector<SpatialAcceleration<T>>* A_WB_array,
+      EigenPtr<VectorX<T>> vdot) const;
+
+  /// Computes the generalized accelerations `vdot` resulting from the
+  /// applied `forces` and the state stored in `context`, that is, it solves
+  /// the forward dynamics problem: <pre>
+  ///   M(q)v̇ + C(q, v)v = tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W
+  /// </pre>
+  /// This method uses the O(n) articulated body algorithm and never forms
+  /// the mass matrix `M(q)`. The position dependent articulated body inertias
+  /// are evaluated from the cache in `context`.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] forces
+  ///   Applied body spatial forces and generalized forces. It must be
+  ///   compatible with `this` model.
+  /// @param[out] vdot
+  ///   A pointer to a valid, non nullptr, vector of size num_velocities().
+  ///   On output it contains the generalized accelerations.
+  ///
+  /// @throws std::exception if `vdot` is nullptr or if it does not have size
+  /// num_velocities().
+  void CalcForwardDynamicsViaArticulatedBodyAlgorithm(
+      const systems::Context<T>& context,
+      const MultibodyForces<T>& forces,
+      EigenPtr<VectorX<T>> vdot) const;
+
   /// @}
   // Closes "Computational methods" Doxygen section.
 
@@ -1833,6 +1926,17 @@ class MultibodyTree {
     return tree_system_->EvalVelocityKinematics(context);
   }
 
+  /// Evaluates the articulated body inertia cache in context. This will also
+  /// force position kinematics to be updated if it hasn't already.
+  /// @param context A Context whose articulated body inertia cache will be
+  ///                updated and returned.
+  /// @return Reference to the ArticulatedBodyInertiaCache of context.
+  const ArticulatedBodyInertiaCache<T>& EvalArticulatedBodyInertiaCache(
+      const systems::Context<T>& context) const {
+    DRAKE_ASSERT(tree_system_ != nullptr);
+    return tree_system_->EvalArticulatedBodyInertiaCache(context);
+  }
+
   /// @name                 State access methods
   /// These methods use information in the MultibodyTree to determine how to
   /// locate the tree's state variables in a given Context or State.
@@ -166,7 +166,23 @@ void MultibodyTreeSystem<T>::Finalize() {
       {this->cache_entry_ticket(position_kinematics_cache_index_)});
   H_PB_W_cache_index_ = H_PB_W_cache_entry.cache_index();
 
-  // TODO(sherm1) Allocate articulated body inertia cache.
+  // Allocate articulated body inertia cache.
+  auto& abi_cache_entry = this->DeclareCacheEntry(
+      std::string("Articulated Body Inertia"),
+      [tree = tree_.get()]() {
+        return AbstractValue::Make(
+            ArticulatedBodyInertiaCache<T>(tree->get_topology()));
+      },
+      [tree = tree_.get()](const systems::ContextBase& context_base,
+                           AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& abi_cache =
+            cache_value->GetMutableValue<ArticulatedBodyInertiaCache<T>>();
+        tree->CalcArticulatedBodyInertiaCache(
+            context, tree->EvalPositionKinematics(context), &abi_cache);
+      },
+      {this->configuration_ticket()});
+  abi_cache_index_ = abi_cache_entry.cache_index();
 
   already_finalized_ = true;
 }
@@ -8,6 +8,7 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/position_kinematics_cache.h"
 #include "drake/multibody/tree/velocity_kinematics_cache.h"
 #include "drake/systems/framework/cache_entry.h"
@@ -117,7 +118,16 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
         .template Eval<std::vector<Vector6<T>>>(context);
   }
 
-  // TODO(sherm1) Add ArticulatedBodyInertiaCache.
+  /** Returns a reference to the up to date ArticulatedBodyInertiaCache in the
+  given Context, recalculating it first if necessary. Also if necessary, the
+  PositionKinematicsCache and the across-mobilizer geometric Jacobians H_PB_W
+  will be recalculated as well. This cache entry depends only on the
+  generalized positions and the parameters of the model. */
+  const ArticulatedBodyInertiaCache<T>& EvalArticulatedBodyInertiaCache(
+      const systems::Context<T>& context) const {
+    return this->get_cache_entry(abi_cache_index_)
+        .template Eval<ArticulatedBodyInertiaCache<T>>(context);
+  }
 
  protected:
   /** @name        Alternate API for derived classes
@@ -190,6 +200,7 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   systems::CacheIndex position_kinematics_cache_index_;
   systems::CacheIndex velocity_kinematics_cache_index_;
   systems::CacheIndex H_PB_W_cache_index_;
+  systems::CacheIndex abi_cache_index_;
 
   // Used to enforce "finalize once" restriction for protected-API users.
   bool already_finalized_{false};
@@ -3,13 +3,21 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/tree/fixed_offset_frame.h"
 #include "drake/multibody/tree/frame.h"
 #include "drake/multibody/tree/mobilizer_impl.h"
+#include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/prismatic_mobilizer.h"
+#include "drake/multibody/tree/quaternion_floating_mobilizer.h"
+#include "drake/multibody/tree/revolute_mobilizer.h"
 #include "drake/multibody/tree/space_xyz_mobilizer.h"
 #include "drake/multibody/tree/spatial_inertia.h"
+#include "drake/multibody/tree/uniform_gravity_field_element.h"
 #include "drake/multibody/tree/unit_inertia.h"
 #include "drake/systems/framework/context.h"
 
@@ -364,6 +372,124 @@ GTEST_TEST(ArticulatedBodyInertiaAlgorithm, ModifiedFeatherstoneExample) {
       P_WB_W_actual.CopyToFullMatrix6(), kEpsilon));
 }
 
+// Verifies that the generalized accelerations computed with the articulated
+// body algorithm match those obtained by solving M(q)v̇ = -(C(q, v)v - tau_app -
+// ∑ J_WBᵀ(q) Fapp_Bo_W), with M(q) formed by inverse dynamics. The model is a
+// branched tree with a free floating base, a gravity field, and mobilizers with
+// one, two and six degrees of freedom placed at non-trivial offsets, in a
+// generic state with applied body and generalized forces.
+GTEST_TEST(ArticulatedBodyAlgorithm, ForwardDynamicsMatchesMassMatrixSolve) {
+  auto tree_owned = std::make_unique<MultibodyTree<double>>();
+  auto& tree = *tree_owned;
+
+  auto make_inertia = [](double mass, const Vector3d& p_BoBcm,
+                         double Lx, double Ly, double Lz) {
+    return SpatialInertia<double>::MakeFromCentralInertia(
+        mass, p_BoBcm,
+        mass * UnitInertia<double>::SolidBox(Lx, Ly, Lz));
+  };
+
+  // Free floating base.
+  const RigidBody<double>& base = tree.AddBody<RigidBody>(
+      make_inertia(3.0, Vector3d(0.1, -0.05, 0.2), 0.5, 0.3, 0.2));
+  const auto& base_mobilizer = tree.AddMobilizer<QuaternionFloatingMobilizer>(
+      tree.world_frame(), base.body_frame());
+
+  // Revolute link attached to the base at an offset.
+  const RigidBody<double>& link1 = tree.AddBody<RigidBody>(
+      make_inertia(1.5, Vector3d(0.0, 0.0, -0.3), 0.1, 0.1, 0.6));
+  const Isometry3<double> X_BaseF1 = math::RigidTransform<double>(
+      math::RollPitchYaw<double>(0.3, -0.2, 0.5),
+      Vector3d(0.2, 0.1, -0.1)).GetAsIsometry3();
+  const auto& F1 = tree.AddFrame<FixedOffsetFrame>(base, X_BaseF1);
+  tree.AddMobilizer<RevoluteMobilizer>(
+      F1, link1.body_frame(), Vector3d(0.0, 1.0, 1.0).normalized());
+
+  // Prismatic link outboard of link1.
+  const RigidBody<double>& link2 = tree.AddBody<RigidBody>(
+      make_inertia(0.7, Vector3d(0.05, 0.0, 0.0), 0.2, 0.1, 0.1));
+  const Isometry3<double> X_L1F2 = math::RigidTransform<double>(
+      math::RollPitchYaw<double>(-0.4, 0.1, 0.0),
+      Vector3d(0.0, 0.0, -0.6)).GetAsIsometry3();
+  const auto& F2 = tree.AddFrame<FixedOffsetFrame>(link1, X_L1F2);
+  tree.AddMobilizer<PrismaticMobilizer>(
+      F2, link2.body_frame(), Vector3d(1.0, 0.0, 0.0));
+
+  // A second branch off the base, with two degrees of freedom.
+  const RigidBody<double>& link3 = tree.AddBody<RigidBody>(
+      make_inertia(0.9, Vector3d(0.0, 0.1, 0.0), 0.3, 0.2, 0.1));
+  tree.AddMobilizer<FeatherstoneMobilizer>(base.body_frame(),
+                                           link3.body_frame());
+
+  tree.AddForceElement<UniformGravityFieldElement>(Vector3d(0.0, 0.0, -9.81));
+
+  MultibodyTreeSystem<double> system(std::move(tree_owned));
+  auto context = system.CreateDefaultContext();
+  const int nv = tree.num_velocities();
+
+  // Set a generic state.
+  const int nq = tree.num_positions();
+  VectorXd x(nq + nv);
+  for (int i = 0; i < nq + nv; ++i) x(i) = 0.1 * i - 0.45 * std::sin(i);
+  tree.GetMutablePositionsAndVelocities(context.get()) = x;
+  base_mobilizer.set_quaternion(
+      context.get(), Eigen::Quaterniond(0.4, -0.3, 0.7, 0.2).normalized());
+
+  const PositionKinematicsCache<double>& pc =
+      tree.EvalPositionKinematics(*context);
+  const VelocityKinematicsCache<double>& vc =
+      tree.EvalVelocityKinematics(*context);
+
+  // Applied forces, including gravity.
+  MultibodyForces<double> forces(tree);
+  tree.CalcForceElementsContribution(*context, pc, vc, &forces);
+  for (BodyIndex body_index(1); body_index < tree.num_bodies(); ++body_index) {
+    const Body<double>& body = tree.get_body(body_index);
+    const double k = body_index;
+    forces.mutable_body_forces()[body.node_index()] += SpatialForce<double>(
+        Vector3d(0.3 * k, -0.2, 0.1 * k), Vector3d(-0.5, 0.4 * k, 1.0));
+  }
+  for (int i = 0; i < nv; ++i) {
+    forces.mutable_generalized_forces()(i) += 0.25 * i - 1.0;
+  }
+
+  // Expected generalized accelerations.
+  MatrixX<double> M(nv, nv);
+  tree.CalcMassMatrixViaInverseDynamics(*context, &M);
+  std::vector<SpatialAcceleration<double>> A_WB_array(tree.num_bodies());
+  std::vector<SpatialForce<double>> F_BMo_W_array(tree.num_bodies());
+  VectorXd minus_rhs(nv);
+  tree.CalcInverseDynamics(
+      *context, pc, vc, VectorXd::Zero(nv), forces.body_forces(),
+      forces.generalized_forces(), &A_WB_array, &F_BMo_W_array, &minus_rhs);
+  const VectorXd vdot_expected = M.ldlt().solve(-minus_rhs);
+
+  // Generalized accelerations computed with the articulated body algorithm.
+  VectorXd vdot(nv);
+  tree.CalcForwardDynamicsViaArticulatedBodyAlgorithm(*context, forces, &vdot);
+  EXPECT_TRUE(CompareMatrices(vdot, vdot_expected, 1.0e-12,
+                              MatrixCompareType::relative));
+
+  // The spatial accelerations computed by the algorithm must be consistent
+  // with the generalized accelerations.
+  const ArticulatedBodyInertiaCache<double>& abic =
+      tree.EvalArticulatedBodyInertiaCache(*context);
+  ArticulatedBodyForceCache<double> aba_force_cache(tree.get_topology());
+  tree.CalcArticulatedBodyForceCache(
+      *context, pc, vc, abic, forces, &aba_force_cache);
+  std::vector<SpatialAcceleration<double>> A_WB_aba(tree.num_bodies());
+  tree.CalcArticulatedBodyAccelerations(
+      *context, pc, abic, aba_force_cache, &A_WB_aba, &vdot);
+  EXPECT_TRUE(CompareMatrices(vdot, vdot_expected, 1.0e-12,
+                              MatrixCompareType::relative));
+  tree.CalcSpatialAccelerationsFromVdot(*context, pc, vc, vdot, &A_WB_array);
+  for (BodyNodeIndex i(0); i < tree.num_bodies(); ++i) {
+    EXPECT_TRUE(CompareMatrices(
+        A_WB_aba[i].get_coeffs(), A_WB_array[i].get_coeffs(), 1.0e-12,
+        MatrixCompareType::relative));
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
@@ -1,6 +1,8 @@
 #include "drake/perception/depth_image_to_point_cloud.h"
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "drake/common/drake_optional.h"
 #include "drake/common/drake_throw.h"
@@ -44,73 +46,171 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
   throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
+// The normalized image-plane coordinate of each pixel column (or row), i.e.,
+// (u - c) / f for u in [0, size).  Because the camera model is separable, a
+// table per axis suffices to deproject every pixel.
+std::vector<float> MakeRayTable(int size, float center, float focal) {
+  const float focal_inv = 1.f / focal;
+  std::vector<float> table(size);
+  for (int u = 0; u < size; ++u) {
+    table[u] = (u - center) * focal_inv;
+  }
+  return table;
+}
+
+// Converts the rows [v_begin, v_end) of the depth (and color) image.  The inner
+// loops run over contiguous memory and replace invalid pixels with a select
+// rather than a branch, so that the compiler is free to vectorize them.
+template <PixelType pixel_type>
+void ConvertRows(int v_begin, int v_end, const float* ray_x,
+                 const float* ray_y, const Isometry3f* X_PC,
+                 const Image<pixel_type>& depth_image,
+                 const ImageRgba8U* color_image, const float scale,
+                 float* output_xyz, uint8_t* output_rgb) {
+  using ChannelType = typename ImageTraits<pixel_type>::ChannelType;
+  constexpr ChannelType kTooClose = ImageTraits<pixel_type>::kTooClose;
+  constexpr ChannelType kTooFar = ImageTraits<pixel_type>::kTooFar;
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+
+  // N.B. Local copies are made so that the compiler needn't assume that
+  // writes to `output_xyz` alias the pose.
+  const Isometry3f X = X_PC ? *X_PC : Isometry3f::Identity();
+  const Eigen::Matrix3f R = X.linear();
+  const Vector3f p = X.translation();
+
+  const int width = depth_image.width();
+  if (width == 0) return;
+  for (int v = v_begin; v < v_end; ++v) {
+    const ChannelType* const depth = depth_image.at(0, v);
+    float* const xyz = output_xyz + 3 * v * width;
+    const float y_factor = ray_y[v];
+    if (X_PC == nullptr) {
+      for (int u = 0; u < width; ++u) {
+        const bool invalid = (depth[u] == kTooClose) || (depth[u] == kTooFar);
+        // N.B. This handles both true depths *and* NaNs.
+        const float z = scale * depth[u];
+        xyz[3 * u + 0] = invalid ? kInf : z * ray_x[u];
+        xyz[3 * u + 1] = invalid ? kInf : z * y_factor;
+        xyz[3 * u + 2] = invalid ? kInf : z;
+      }
+    } else {
+      for (int u = 0; u < width; ++u) {
+        const bool invalid = (depth[u] == kTooClose) || (depth[u] == kTooFar);
+        const float z = scale * depth[u];
+        const float x = z * ray_x[u];
+        const float y = z * y_factor;
+        const float x_P = R(0, 0) * x + R(0, 1) * y + R(0, 2) * z + p(0);
+        const float y_P = R(1, 0) * x + R(1, 1) * y + R(1, 2) * z + p(1);
+        const float z_P = R(2, 0) * x + R(2, 1) * y + R(2, 2) * z + p(2);
+        xyz[3 * u + 0] = invalid ? kInf : x_P;
+        xyz[3 * u + 1] = invalid ? kInf : y_P;
+        xyz[3 * u + 2] = invalid ? kInf : z_P;
+      }
+    }
+
+    if (color_image) {
+      const uint8_t* const rgba = color_image->at(0, v);
+      uint8_t* const rgb = output_rgb + 3 * v * width;
+      for (int u = 0; u < width; ++u) {
+        rgb[3 * u + 0] = rgba[4 * u + 0];
+        rgb[3 * u + 1] = rgba[4 * u + 1];
+        rgb[3 * u + 2] = rgba[4 * u + 2];
+      }
+    }
+  }
+}
+
 // TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
 // cloud output? (This would require adding support for colored point clouds,
 // because current implementation assume that an RGB image will still line up).
 template <PixelType pixel_type>
 void DoConvert(const optional<pc_flags::BaseFieldT>& exact_base_fields,
-               const CameraInfo& camera_info,
+               const std::vector<float>& ray_x,
+               const std::vector<float>& ray_y,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
-               PointCloud* output) {
+               drake::internal::ThreadPool* thread_pool, PointCloud* output) {
   if (exact_base_fields) {
     DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
   }
+  DRAKE_THROW_UNLESS(static_cast<int>(ray_x.size()) == depth_image.width());
+  DRAKE_THROW_UNLESS(static_cast<int>(ray_y.size()) == depth_image.height());
+  if (color_image) {
+    DRAKE_THROW_UNLESS(color_image->width() == depth_image.width());
+    DRAKE_THROW_UNLESS(color_image->height() == depth_image.height());
+  }
 
   // Reset the output size, if necessary.  We can leave the memory
-  // uninitialized iff we are going to fill it in below.
+  // uninitialized iff we are going to fill it in below.  Otherwise, the
+  // storage of the output cloud is reused.
   if (output->size() != depth_image.size()) {
     const bool skip_initialize = (output->fields().base_fields() == kXYZs);
     output->resize(depth_image.size(), skip_initialize);
   }
-  Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
-  optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
-  if (color_image) {
-    output_rgb = output->mutable_rgbs();
-  }
 
+  const optional<Isometry3f> X_PC =
+      camera_pose ? optional<Isometry3f>(
+                        camera_pose->GetAsIsometry3().cast<float>())
+                  : nullopt;
+  const Isometry3f* const X_PC_or_null = X_PC ? &*X_PC : nullptr;
+  // N.B. The cloud's channels are densely packed, column-major matrices.
+  DRAKE_DEMAND(output->mutable_xyzs().outerStride() == 3);
+  float* const output_xyz = output->mutable_xyzs().data();
+  uint8_t* const output_rgb =
+      color_image ? output->mutable_rgbs().data() : nullptr;
+
+  // Each thread converts a contiguous band of rows, and so writes to a
+  // disjoint range of the output.
   const int height = depth_image.height();
-  const int width = depth_image.width();
-  const float cx = camera_info.center_x();
-  const float cy = camera_info.center_y();
-  const float fx_inv = 1.f / camera_info.focal_x();
-  const float fy_inv = 1.f / camera_info.focal_y();
-  const Isometry3f X_PC = camera_pose
-                              ? camera_pose->GetAsIsometry3().cast<float>()
-                              : Isometry3f::Identity();
-
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
-      if ((z == ImageTraits<pixel_type>::kTooClose) ||
-          (z == ImageTraits<pixel_type>::kTooFar)) {
-        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
-      } else {
-        // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) =
-            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv,
-                            scale * z);
-      }
-      if (color_image) {
-        const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
-      }
-    }
+  const int num_threads = thread_pool ? thread_pool->num_threads() : 1;
+  const int num_bands = std::max(1, std::min(num_threads, height));
+  auto convert_band = [&](int band) {
+    ConvertRows(height * band / num_bands, height * (band + 1) / num_bands,
+                ray_x.data(), ray_y.data(), X_PC_or_null, depth_image,
+                color_image, scale, output_xyz, output_rgb);
+  };
+  if (thread_pool) {
+    thread_pool->ParallelFor(num_bands, convert_band);
+  } else {
+    convert_band(0);
   }
 }
 
+// Converts using ray tables computed on the fly from `camera_info`.
+template <PixelType pixel_type>
+void DoConvert(const CameraInfo& camera_info,
+               const RigidTransformd* const camera_pose,
+               const Image<pixel_type>& depth_image,
+               const ImageRgba8U* color_image, const float scale,
+               PointCloud* output) {
+  DoConvert(nullopt,
+            MakeRayTable(camera_info.width(), camera_info.center_x(),
+                         camera_info.focal_x()),
+            MakeRayTable(camera_info.height(), camera_info.center_y(),
+                         camera_info.focal_y()),
+            camera_pose, depth_image, color_image, scale, nullptr, output);
+}
+
 }  // namespace
 
 DepthImageToPointCloud::DepthImageToPointCloud(
     const CameraInfo& camera_info, PixelType depth_pixel_type, float scale,
-    const pc_flags::BaseFieldT fields)
+    const pc_flags::BaseFieldT fields, int num_threads)
     : camera_info_(camera_info),
       depth_pixel_type_(depth_pixel_type),
       scale_(scale),
-      fields_(fields) {
+      fields_(fields),
+      ray_x_(MakeRayTable(camera_info.width(), camera_info.center_x(),
+                          camera_info.focal_x())),
+      ray_y_(MakeRayTable(camera_info.height(), camera_info.center_y(),
+                          camera_info.focal_y())) {
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  if (num_threads > 1) {
+    thread_pool_ =
+        std::make_unique<drake::internal::ThreadPool>(num_threads);
+  }
+
   // Input port for depth image.
   depth_image_input_port_ =
       this->DeclareAbstractInputPort("depth_image",
@@ -141,9 +241,9 @@ void DepthImageToPointCloud::Convert(
     const systems::sensors::ImageDepth32F& depth_image,
     const optional<systems::sensors::ImageRgba8U>& color_image,
     const optional<float>& scale, PointCloud* output) {
-  DoConvert(nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
-            depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+  DoConvert(camera_info, camera_pose ? &*camera_pose : nullptr, depth_image,
+            color_image ? &*color_image : nullptr, scale.value_or(1.0f),
+            output);
 }
 
 void DepthImageToPointCloud::Convert(
@@ -152,9 +252,9 @@ void DepthImageToPointCloud::Convert(
     const systems::sensors::ImageDepth16U& depth_image,
     const optional<systems::sensors::ImageRgba8U>& color_image,
     const optional<float>& scale, PointCloud* output) {
-  DoConvert(nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
-            depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+  DoConvert(camera_info, camera_pose ? &*camera_pose : nullptr, depth_image,
+            color_image ? &*color_image : nullptr, scale.value_or(1.0f),
+            output);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(
@@ -166,8 +266,8 @@ void DepthImageToPointCloud::CalcOutput32F(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  DoConvert(fields_, ray_x_, ray_y_, pose_or_null, *depth_image,
+            color_image_or_null, scale_, thread_pool_.get(), output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -179,8 +279,8 @@ void DepthImageToPointCloud::CalcOutput16U(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  DoConvert(fields_, ray_x_, ray_y_, pose_or_null, *depth_image,
+            color_image_or_null, scale_, thread_pool_.get(), output);
 }
 
 }  // namespace perception
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/thread_pool.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/perception/point_cloud.h"
 #include "drake/systems/framework/context.h"
@@ -40,6 +41,10 @@ namespace perception {
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
 /// the Point Cloud Library (PCL).
 ///
+/// The depth image must have the width and height given by the camera info,
+/// and a color image, if provided, must have the same size as the depth image.
+/// Otherwise, computing the output throws an exception.
+///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
  public:
@@ -54,11 +59,15 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///   before projecting to a point cloud.  (This is useful for converting mm
   ///   to meters, etc.)
   /// @param[in] fields The fields the point cloud contains.
+  /// @param[in] num_threads The number of threads used to compute the output;
+  ///   the rows of the depth image are divided evenly among them.  Must be
+  ///   positive.
   explicit DepthImageToPointCloud(
       const systems::sensors::CameraInfo& camera_info,
       systems::sensors::PixelType depth_pixel_type =
           systems::sensors::PixelType::kDepth32F,
-      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      int num_threads = 1);
 
   /// Returns the abstract valued input port that expects either an
   /// ImageDepth16U or ImageDepth32F (depending on the constructor argument).
@@ -92,6 +101,9 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
   /// The `cloud` will be resized to match the size of the depth image.  The
   /// `cloud` must have the XYZ channel enabled.
+  /// @throws std::exception if the size of `depth_image` differs from the
+  /// width and height of `camera_info`, or if `color_image` is provided and its
+  /// size differs from that of `depth_image`.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const optional<math::RigidTransformd>& camera_pose,
@@ -106,6 +118,9 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
   /// The `cloud` will be resized to match the size of the depth image.  The
   /// `cloud` must have the XYZ channel enabled.
+  /// @throws std::exception if the size of `depth_image` differs from the
+  /// width and height of `camera_info`, or if `color_image` is provided and its
+  /// size differs from that of `depth_image`.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const optional<math::RigidTransformd>& camera_pose,
@@ -121,6 +136,13 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const systems::sensors::PixelType depth_pixel_type_;
   const float scale_;
   const pc_flags::BaseFieldT fields_;
+  // Null when the output is computed on a single thread.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+
+  // The normalized image-plane coordinates of each pixel column and row, i.e.,
+  // (u - cx) / fx and (v - cy) / fy, computed once from camera_info_.
+  std::vector<float> ray_x_;
+  std::vector<float> ray_y_;
 
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
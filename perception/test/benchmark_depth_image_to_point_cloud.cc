@@ -0,0 +1,148 @@
+/// @file benchmark_depth_image_to_point_cloud.cc
+///
+/// Compares the time taken by DepthImageToPointCloud to convert a depth image
+/// (with a color image and a camera pose) against the original per-pixel
+/// implementation, for an increasing number of threads.
+///
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <thread>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/depth_image_to_point_cloud.h"
+
+DEFINE_int32(width, 640, "Width of the depth image, in pixels");
+DEFINE_int32(height, 480, "Height of the depth image, in pixels");
+DEFINE_int32(num_iterations, 100, "Number of conversions per measurement");
+
+namespace drake {
+namespace perception {
+namespace {
+
+using common::test::MeasureExecutionTime;
+using Eigen::Isometry3f;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+// The original per-pixel conversion, kept as the baseline.
+void ReferenceConvert(const CameraInfo& camera_info,
+                      const RigidTransformd& camera_pose,
+                      const ImageDepth32F& depth_image,
+                      const ImageRgba8U& color_image, PointCloud* output) {
+  using Traits = ImageTraits<PixelType::kDepth32F>;
+  if (output->size() != depth_image.size()) {
+    output->resize(depth_image.size());
+  }
+  auto output_xyz = output->mutable_xyzs();
+  auto output_rgb = output->mutable_rgbs();
+  const int height = depth_image.height();
+  const int width = depth_image.width();
+  const float cx = camera_info.center_x();
+  const float cy = camera_info.center_y();
+  const float fx_inv = 1.f / camera_info.focal_x();
+  const float fy_inv = 1.f / camera_info.focal_y();
+  const Isometry3f X_PC = camera_pose.GetAsIsometry3().cast<float>();
+  for (int v = 0; v < height; ++v) {
+    for (int u = 0; u < width; ++u) {
+      const int col = v * width + u;
+      const float z = depth_image.at(u, v)[0];
+      if ((z == Traits::kTooClose) || (z == Traits::kTooFar)) {
+        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
+      } else {
+        output_xyz.col(col) = X_PC * Vector3f(z * (u - cx) * fx_inv,
+                                              z * (v - cy) * fy_inv, z);
+      }
+      const auto color = color_image.at(u, v);
+      output_rgb.col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
+    }
+  }
+}
+
+int do_main() {
+  const int width = FLAGS_width;
+  const int height = FLAGS_height;
+  const CameraInfo camera(width, height, M_PI_4);
+  const RigidTransformd X_WC(RollPitchYawd(0.1, -0.2, 0.3),
+                             Eigen::Vector3d(1.1, -1.2, 1.3));
+  const pc_flags::BaseFieldT fields = pc_flags::kXYZs | pc_flags::kRGBs;
+
+  // A random depth image, with a sprinkling of invalid pixels.
+  std::mt19937 generator;
+  std::uniform_real_distribution<float> depth(0.3, 3.0);
+  std::uniform_int_distribution<int> color(0, 255);
+  ImageDepth32F depth_image(width, height);
+  ImageRgba8U color_image(width, height);
+  for (int v = 0; v < height; ++v) {
+    for (int u = 0; u < width; ++u) {
+      depth_image.at(u, v)[0] =
+          (u + v) % 97 == 0 ? ImageTraits<PixelType::kDepth32F>::kTooFar
+                            : depth(generator);
+      for (int c = 0; c < 4; ++c) {
+        color_image.at(u, v)[c] = static_cast<uint8_t>(color(generator));
+      }
+    }
+  }
+
+  PointCloud reference(0, fields);
+  const double reference_time = MeasureExecutionTime([&]() {
+    for (int i = 0; i < FLAGS_num_iterations; ++i) {
+      ReferenceConvert(camera, X_WC, depth_image, color_image, &reference);
+    }
+  });
+  std::cout << width << "x" << height << " image, per conversion:\n"
+            << "  reference:  " << reference_time / FLAGS_num_iterations * 1e3
+            << " ms" << std::endl;
+
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    const DepthImageToPointCloud dut(camera, PixelType::kDepth32F, 1.0,
+                                     fields, num_threads);
+    auto context = dut.CreateDefaultContext();
+    context->FixInputPort(dut.depth_image_input_port().get_index(),
+                          Value<ImageDepth32F>(depth_image));
+    context->FixInputPort(dut.color_image_input_port().get_index(),
+                          Value<ImageRgba8U>(color_image));
+    context->FixInputPort(dut.camera_pose_input_port().get_index(),
+                          Value<RigidTransformd>(X_WC));
+    std::unique_ptr<AbstractValue> output =
+        dut.point_cloud_output_port().Allocate();
+    const double time = MeasureExecutionTime([&]() {
+      for (int i = 0; i < FLAGS_num_iterations; ++i) {
+        dut.point_cloud_output_port().Calc(*context, output.get());
+      }
+    });
+    const PointCloud& cloud = output->GetValueOrThrow<PointCloud>();
+    // N.B. Invalid pixels are infinite in both clouds; skip them.
+    const Eigen::ArrayXXf error =
+        (cloud.xyzs() - reference.xyzs()).array().abs();
+    const float max_error = error.isFinite().select(error, 0.f).maxCoeff();
+    std::cout << "  " << num_threads << " thread(s): "
+              << time / FLAGS_num_iterations * 1e3 << " ms (speedup "
+              << reference_time / time << "x, max |error| " << max_error
+              << ", colors " << (cloud.rgbs() == reference.rgbs() ? "" : "NOT ")
+              << "equal)" << std::endl;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::perception::do_main();
+}
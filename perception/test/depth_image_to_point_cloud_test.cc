@@ -470,6 +470,78 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies that images whose size doesn't match the camera info (or the depth
+// image, for the color image) are rejected.
+TYPED_TEST(DepthImageToPointCloudTest, MismatchedSizes) {
+  using Pixel = typename TestFixture::Pixel;
+  const auto& camera = this->single_pixel_camera_;
+  const auto& single_pixel = Vector1<Pixel>::Constant(1).eval();
+  const MatrixX<Pixel> two_pixels = MatrixX<Pixel>::Constant(2, 1, 1);
+  const auto& single_color = this->MakeRgbaImage(1, 1, 10, 20, 30);
+
+  EXPECT_THROW(
+      this->DoConvert(camera, nullopt, two_pixels, single_color, nullopt),
+      std::exception);
+  if (TestFixture::kFields & pc_flags::kRGBs) {
+    const auto& two_colors = this->MakeRgbaImage(2, 1, 10, 20, 30);
+    EXPECT_THROW(
+        this->DoConvert(camera, nullopt, single_pixel, two_colors, nullopt),
+        std::exception);
+  }
+}
+
+// Verifies that dividing the rows among several threads produces exactly the
+// same point cloud as the single-threaded static conversion.
+TYPED_TEST(DepthImageToPointCloudTest, MultipleThreads) {
+  using Pixel = typename TestFixture::Pixel;
+  using ConfiguredImage = typename TestFixture::ConfiguredImage;
+  using Traits = typename TestFixture::ConfiguredImageTraits;
+  if (!TestFixture::kUseSystem) {
+    return;
+  }
+
+  // An image whose height isn't a multiple of the number of threads, with a
+  // mix of valid and invalid pixels.
+  static constexpr int kImageWidth = 37;
+  static constexpr int kImageHeight = 23;
+  const CameraInfo camera(kImageWidth, kImageHeight, 300.0, 310.0, 18.2, 11.7);
+  MatrixX<Pixel> depth_matrix(kImageWidth, kImageHeight);
+  for (int v = 0; v < kImageHeight; ++v) {
+    for (int u = 0; u < kImageWidth; ++u) {
+      depth_matrix(u, v) = static_cast<Pixel>(1 + (u * 7 + v * 3) % 11);
+    }
+  }
+  depth_matrix(3, 4) = Traits::kTooClose;
+  depth_matrix(30, 20) = Traits::kTooFar;
+  const ConfiguredImage depth_image = this->MakeDepthImage(depth_matrix);
+  const ImageRgba8U color_image =
+      this->MakeRgbaImage(kImageWidth, kImageHeight, 10, 20, 30);
+  const RigidTransformd& pose = this->random_transform_;
+  const float scale = 0.25;
+
+  PointCloud expected(0, TestFixture::kFields);
+  DepthImageToPointCloud::Convert(
+      camera, pose, depth_image,
+      (TestFixture::kFields & pc_flags::kRGBs)
+          ? optional<ImageRgba8U>(color_image)
+          : nullopt,
+      scale, &expected);
+
+  for (int num_threads : {1, 2, 4, 50}) {
+    const DepthImageToPointCloud dut(camera, TestFixture::kConfiguredPixelType,
+                                     scale, TestFixture::kFields, num_threads);
+    auto context = dut.CreateDefaultContext();
+    context->FixInputPort(0, Value<ConfiguredImage>(depth_image));
+    if (TestFixture::kFields & pc_flags::kRGBs) {
+      context->FixInputPort(1, Value<ImageRgba8U>(color_image));
+    }
+    context->FixInputPort(2, Value<RigidTransformd>(pose));
+    const PointCloud& result = dut.get_output_port(0).Eval<PointCloud>(
+        *context);
+    EXPECT_TRUE(TestFixture::CompareClouds(result, expected, 0));
+  }
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
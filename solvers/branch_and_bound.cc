@@ -2,11 +2,13 @@
 
 #include <algorithm>
 #include <limits>
+#include <mutex>
 #include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/never_destroyed.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/scs_solver.h"
@@ -50,10 +52,10 @@ std::unique_ptr<SolverInterface> MakeSolver(const SolverId& solver_id) {
 }  // namespace
 
 MixedIntegerBranchAndBoundNode::MixedIntegerBranchAndBoundNode(
-    const MathematicalProgram& prog,
+    std::shared_ptr<const MathematicalProgram> prog,
     const std::list<symbolic::Variable>& binary_variables,
     const SolverId& solver_id)
-    : prog_{prog.Clone()},
+    : root_prog_{std::move(prog)},
       prog_result_{std::make_unique<MathematicalProgramResult>()},
       left_child_{nullptr},
       right_child_{nullptr},
@@ -65,9 +67,7 @@ MixedIntegerBranchAndBoundNode::MixedIntegerBranchAndBoundNode(
       optimal_solution_is_integral_{OptimalSolutionIsIntegral::kUnknown},
       solver_id_{solver_id} {
   // Check if there are still binary variables.
-  DRAKE_ASSERT(!MathProgHasBinaryVariables(*prog_));
-  // Set Gurobi DualReductions to 0, to differentiate infeasible from unbounded.
-  prog_->SetSolverOption(GurobiSolver::id(), "DualReductions", 0);
+  DRAKE_ASSERT(!MathProgHasBinaryVariables(*root_prog_));
 }
 
 bool MixedIntegerBranchAndBoundNode::IsRoot() const {
@@ -119,6 +119,13 @@ SolutionResult SolveProgramWithSolver(const MathematicalProgram& prog,
                                       MathematicalProgramResult* result) {
   std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id);
   DRAKE_ASSERT(solver.get());
+  // All GurobiSolver instances share a single Gurobi environment, which must
+  // not be used from multiple threads at once.
+  static never_destroyed<std::mutex> gurobi_mutex;
+  std::unique_lock<std::mutex> lock(gurobi_mutex.access(), std::defer_lock);
+  if (solver_id == GurobiSolver::id()) {
+    lock.lock();
+  }
   solver->Solve(prog, {}, {}, result);
   return result->get_solution_result();
 }
@@ -218,18 +225,16 @@ MixedIntegerBranchAndBoundNode::ConstructRootNode(
   // Set the initial guess.
   new_prog.SetInitialGuessForAllVariables(prog.initial_guess());
   // TODO(hongkai.dai) Set the solver options as well.
+  // Set Gurobi DualReductions to 0, to differentiate infeasible from unbounded.
+  new_prog.SetSolverOption(GurobiSolver::id(), "DualReductions", 0);
 
   std::list<symbolic::Variable> binary_variables_list;
   for (int i = 0; i < binary_variables.rows(); ++i) {
     binary_variables_list.push_back(binary_variables(i));
   }
   MixedIntegerBranchAndBoundNode* node = new MixedIntegerBranchAndBoundNode(
-      new_prog, binary_variables_list, solver_id);
-  node->solution_result_ = SolveProgramWithSolver(
-      *node->prog_, solver_id, node->prog_result_.get());
-  if (node->solution_result_ == SolutionResult::kSolutionFound) {
-    node->CheckOptimalSolutionIsIntegral();
-  }
+      new_prog.Clone(), binary_variables_list, solver_id);
+  node->Solve();
   return std::make_pair(std::unique_ptr<MixedIntegerBranchAndBoundNode>(node),
                         map_old_vars_to_new_vars);
 }
@@ -286,12 +291,37 @@ bool IsVariableInList(const std::list<symbolic::Variable>& variable_list,
   return false;
 }
 
+std::unique_ptr<MathematicalProgram>
+MixedIntegerBranchAndBoundNode::ConstructProgram() const {
+  // Collect the nodes from this node up to (but excluding) the root, each of
+  // which fixes one binary variable.
+  std::vector<const MixedIntegerBranchAndBoundNode*> fixing_nodes;
+  for (const MixedIntegerBranchAndBoundNode* node = this; !node->IsRoot();
+       node = node->parent_) {
+    fixing_nodes.push_back(node);
+  }
+  auto prog = root_prog_->Clone();
+  // Add constraint y == 0 or y == 1, from the root down to this node.
+  for (auto it = fixing_nodes.rbegin(); it != fixing_nodes.rend(); ++it) {
+    const double binary_value = static_cast<double>((*it)->fixed_binary_value_);
+    prog->AddBoundingBoxConstraint(binary_value, binary_value,
+                                   (*it)->fixed_binary_variable_);
+  }
+  return prog;
+}
+
+const MathematicalProgram* MixedIntegerBranchAndBoundNode::prog() const {
+  if (IsRoot()) {
+    return root_prog_.get();
+  }
+  if (prog_ == nullptr) {
+    prog_ = ConstructProgram();
+  }
+  return prog_.get();
+}
+
 void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
     const symbolic::Variable& binary_variable, bool binary_value) {
-  // Add constraint y == 0 or y == 1.
-  prog_->AddBoundingBoxConstraint(static_cast<double>(binary_value),
-                                  static_cast<double>(binary_value),
-                                  binary_variable);
   // Remove binary_variable from remaining_binary_variables_
   bool found_binary_variable = false;
   for (auto it = remaining_binary_variables_.begin();
@@ -313,30 +343,33 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
   fixed_binary_value_ = binary_value;
 }
 
-void MixedIntegerBranchAndBoundNode::Branch(
+void MixedIntegerBranchAndBoundNode::CreateChildNodes(
     const symbolic::Variable& binary_variable) {
   left_child_.reset(new MixedIntegerBranchAndBoundNode(
-      *prog_, remaining_binary_variables_, solver_id_));
+      root_prog_, remaining_binary_variables_, solver_id_));
   right_child_.reset(new MixedIntegerBranchAndBoundNode(
-      *prog_, remaining_binary_variables_, solver_id_));
+      root_prog_, remaining_binary_variables_, solver_id_));
   left_child_->FixBinaryVariable(binary_variable, 0);
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
-  left_child_->solution_result_ = SolveProgramWithSolver(
-      *left_child_->prog_, left_child_->solver_id_,
-      left_child_->prog_result_.get());
-  right_child_->solution_result_ = SolveProgramWithSolver(
-      *right_child_->prog_, right_child_->solver_id_,
-      right_child_->prog_result_.get());
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
-  }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
+}
+
+void MixedIntegerBranchAndBoundNode::Solve() {
+  solution_result_ = SolveProgramWithSolver(*ConstructProgram(), solver_id_,
+                                            prog_result_.get());
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    CheckOptimalSolutionIsIntegral();
   }
 }
 
+void MixedIntegerBranchAndBoundNode::Branch(
+    const symbolic::Variable& binary_variable) {
+  CreateChildNodes(binary_variable);
+  left_child_->Solve();
+  right_child_->Solve();
+}
+
 MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
     const MathematicalProgram& prog, const SolverId& solver_id)
     : root_{nullptr},
@@ -390,9 +423,13 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
     // should terminate.
     // TODO(hongkai.dai) We might need to have a function that picks the
     // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
+    if (num_threads_ > 1) {
+      BranchAndUpdateInParallel(PickBranchingNodes(branching_node));
+    } else {
+      const symbolic::Variable* branching_variable =
+          PickBranchingVariable(*branching_node);
+      BranchAndUpdate(branching_node, *branching_variable);
+    }
     if (HasConverged()) {
       return SolutionResult::kSolutionFound;
     }
@@ -558,6 +595,24 @@ MixedIntegerBranchAndBoundNode* PickDepthFirstNodeInSubTree(
   }
 }
 
+// Appends the non-fathomed leaf nodes in the tree to `leaf_nodes`.
+void CollectNonFathomedLeafNodesInSubTree(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaf_nodes) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaf_nodes->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+  } else {
+    CollectNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.left_child()),
+                                         leaf_nodes);
+    CollectNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.right_child()),
+                                         leaf_nodes);
+  }
+}
+
 double BestLowerBoundInSubTree(
     const MixedIntegerBranchAndBound& bnb,
     const MixedIntegerBranchAndBoundNode& sub_tree_root) {
@@ -635,6 +690,43 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
   return PickDepthFirstNodeInSubTree(*this, *root_);
 }
 
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes(
+    MixedIntegerBranchAndBoundNode* first_node) const {
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes{first_node};
+  // The user defined function picks a single node.
+  if (node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    return nodes;
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> leaf_nodes;
+  CollectNonFathomedLeafNodesInSubTree(*this, *root_, &leaf_nodes);
+  if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound) {
+    std::stable_sort(leaf_nodes.begin(), leaf_nodes.end(),
+                     [](const MixedIntegerBranchAndBoundNode* node1,
+                        const MixedIntegerBranchAndBoundNode* node2) {
+                       return node1->prog_result()->get_optimal_cost() <
+                              node2->prog_result()->get_optimal_cost();
+                     });
+  } else {
+    DRAKE_DEMAND(node_selection_method_ == NodeSelectionMethod::kDepthFirst);
+    std::stable_sort(leaf_nodes.begin(), leaf_nodes.end(),
+                     [](const MixedIntegerBranchAndBoundNode* node1,
+                        const MixedIntegerBranchAndBoundNode* node2) {
+                       return node1->remaining_binary_variables().size() <
+                              node2->remaining_binary_variables().size();
+                     });
+  }
+  for (MixedIntegerBranchAndBoundNode* node : leaf_nodes) {
+    if (static_cast<int>(nodes.size()) == num_threads_) {
+      break;
+    }
+    if (node != first_node) {
+      nodes.push_back(node);
+    }
+  }
+  return nodes;
+}
+
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node) const {
   switch (variable_selection_method_) {
@@ -679,27 +771,53 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
   node->Branch(branching_variable);
+  UpdateAfterBranching({node});
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdateInParallel(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes) {
+  std::vector<MixedIntegerBranchAndBoundNode*> child_nodes;
+  for (MixedIntegerBranchAndBoundNode* node : nodes) {
+    const symbolic::Variable* branching_variable =
+        PickBranchingVariable(*node);
+    node->CreateChildNodes(*branching_variable);
+    child_nodes.push_back(node->mutable_left_child());
+    child_nodes.push_back(node->mutable_right_child());
+  }
+
+  // The child nodes are spread over the threads of thread_pool_, the calling
+  // thread included.
+  thread_pool_->ParallelFor(static_cast<int>(child_nodes.size()),
+                            [&child_nodes](int i) { child_nodes[i]->Solve(); });
+
+  UpdateAfterBranching(nodes);
+}
+
+void MixedIntegerBranchAndBound::UpdateAfterBranching(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes) {
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
   best_lower_bound_ = BestLowerBoundInSubTree(*this, *root_);
-  // If either the left or the right children finds integral solution, then
-  // we can potentially update the best upper bound, and insert the solutions
-  // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
-    if (child->solution_result() == SolutionResult::kSolutionFound &&
-        child->optimal_solution_is_integral()) {
-      const double child_node_optimal_cost =
-          child->prog_result()->get_optimal_cost();
-      const Eigen::VectorXd x_sol =
-          child->prog_result()->GetSolution(
-              child->prog()->decision_variables());
-      UpdateIntegralSolution(x_sol, child_node_optimal_cost);
-    }
-    if (search_integral_solution_by_rounding_) {
-      SearchIntegralSolutionByRounding(*child);
+  for (const MixedIntegerBranchAndBoundNode* node : nodes) {
+    // If either the left or the right children finds integral solution, then
+    // we can potentially update the best upper bound, and insert the
+    // solutions to the list solutions_;
+    for (auto& child : {node->left_child(), node->right_child()}) {
+      if (child->solution_result() == SolutionResult::kSolutionFound &&
+          child->optimal_solution_is_integral()) {
+        const double child_node_optimal_cost =
+            child->prog_result()->get_optimal_cost();
+        const Eigen::VectorXd x_sol =
+            child->prog_result()->GetSolution(
+                root_->prog()->decision_variables());
+        UpdateIntegralSolution(x_sol, child_node_optimal_cost);
+      }
+      if (search_integral_solution_by_rounding_) {
+        SearchIntegralSolutionByRounding(*child);
+      }
+      NodeCallback(*child);
     }
-    NodeCallback(*child);
   }
 }
 
@@ -752,7 +870,7 @@ void MixedIntegerBranchAndBound::SearchIntegralSolutionByRounding(
     // or 1, and solve for the continuous variables. If this optimization
     // problem is feasible, then the optimal solution is a feasible
     // solution to the MIP, and we get an upper bound on the MIP optimal cost.
-    auto new_prog = node.prog()->Clone();
+    auto new_prog = node.ConstructProgram();
     // Go through each remaining binary variables, and constrain them to either
     // 0 or 1 by rounding the solution to the integer.
     for (const auto& remaining_binary_variable :
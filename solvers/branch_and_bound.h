@@ -5,7 +5,9 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "drake/common/thread_pool.h"
 #include "drake/solvers/mathematical_program.h"
 
 namespace drake {
@@ -31,7 +33,11 @@ namespace solvers {
  * binary variables z_fixed, b_fixed only contains value either 0 or 1.
  *
  * Each node is created from its parent node, by fixing one binary variable to
- * either 0 or 1.
+ * either 0 or 1. The nodes do not store their own optimization program, only
+ * the binary variable that they fix. All nodes of a tree share the program of
+ * the root node, and the program of a node is constructed from it when the
+ * node is solved, or when it is requested through prog(), see
+ * ConstructProgram().
  */
 class MixedIntegerBranchAndBoundNode {
  public:
@@ -91,9 +97,21 @@ class MixedIntegerBranchAndBoundNode {
   bool IsLeaf() const { return !left_child_ && !right_child_; }
 
   /**
-   * Getter for the mathematical program.
+   * Getter for the mathematical program of this node, including the
+   * constraints z_fixed = b_fixed of this node and of its ancestors. The
+   * program of a node other than the root is constructed by the first call to
+   * this getter, see ConstructProgram(), and kept until the node is destroyed.
+   * This getter must not be called on the same node from multiple threads at
+   * once.
    */
-  const MathematicalProgram* prog() const { return prog_.get(); }
+  const MathematicalProgram* prog() const;
+
+  /**
+   * Constructs the mathematical program of this node, which is the program of
+   * the root node together with the constraints z_fixed = b_fixed of this node
+   * and of its ancestors.
+   */
+  std::unique_ptr<MathematicalProgram> ConstructProgram() const;
 
   /**
    * Getter for the mathematical program result.
@@ -163,6 +181,10 @@ class MixedIntegerBranchAndBoundNode {
   const SolverId& solver_id() const { return solver_id_; }
 
  private:
+  // MixedIntegerBranchAndBound creates and solves the child nodes separately
+  // when it branches on multiple nodes in parallel.
+  friend class MixedIntegerBranchAndBound;
+
   /**
    * If the solution to a binary variable is either less than integral_tol or
    * larger than 1 - integral_tol, then we regard the solution to be binary.
@@ -173,24 +195,31 @@ class MixedIntegerBranchAndBoundNode {
   }
 
  private:
-  // Constructs an empty node. Clone the input mathematical program to this
-  // node. The child and the parent nodes are all nullptr.
-  // @param prog The optimization program whose binary variable constraints are
-  // all relaxed to 0 ≤ z ≤ 1.
+  // Constructs an empty node, that shares the input mathematical program.
+  // The child and the parent nodes are all nullptr.
+  // @param prog The optimization program of the root node, whose binary
+  // variable constraints are all relaxed to 0 ≤ z ≤ 1.
   // @param binary_variables The list of binary variables in the mixed-integer
   // problem.
   MixedIntegerBranchAndBoundNode(
-      const MathematicalProgram& prog,
+      std::shared_ptr<const MathematicalProgram> prog,
       const std::list<symbolic::Variable>& binary_variables,
       const SolverId& solver_id);
 
-  // Fix a binary variable to a binary value. Add a constraint z = 0 or z = 1 to
-  // the optimization program. Remove this binary variable from the
-  // remaining_binary_variables_ list; set the binary_var_ and
-  // binary_var_value_.
+  // Fix a binary variable to a binary value. Remove this binary variable from
+  // the remaining_binary_variables_ list; set the binary_var_ and
+  // binary_var_value_. The constraint z = 0 or z = 1 is added by
+  // ConstructProgram().
   void FixBinaryVariable(const symbolic::Variable& binary_variable,
                          bool binary_value);
 
+  // Creates the two child nodes of Branch(), without solving them.
+  void CreateChildNodes(const symbolic::Variable& binary_variable);
+
+  // Solves the optimization program of this node, and checks if its optimal
+  // solution is integral.
+  void Solve();
+
   // Check if the optimal solution to the program in this node satisfies all
   // integral constraints.
   // Only call this function AFTER the program is solved.
@@ -206,8 +235,11 @@ class MixedIntegerBranchAndBoundNode {
     /// constraints yet.
   };
 
-  // Stores the optimization program in this node.
-  std::unique_ptr<MathematicalProgram> prog_;
+  // The optimization program of the root node, shared by all nodes.
+  std::shared_ptr<const MathematicalProgram> root_prog_;
+  // The optimization program of this node, constructed on demand by prog().
+  // Null until then, and always null for the root node.
+  mutable std::unique_ptr<MathematicalProgram> prog_;
   std::unique_ptr<MathematicalProgramResult> prog_result_;
   std::unique_ptr<MixedIntegerBranchAndBoundNode> left_child_;
   std::unique_ptr<MixedIntegerBranchAndBoundNode> right_child_;
@@ -561,6 +593,31 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /** Setter for the number of threads used to solve the nodes.
+   * With more than one thread, each step of Solve() branches on up to
+   * `num_threads` un-fathomed leaf nodes (the one picked by the node
+   * selection method, followed by the next ones in the order of the node
+   * selection method, unless it is NodeSelectionMethod::kUserDefined), and
+   * solves the programs of their child nodes concurrently. The bounds, the
+   * solutions and the user-defined callbacks are then updated from the
+   * calling thread, as when branching on these nodes one after the other.
+   * @note All GurobiSolver instances share a single Gurobi environment,
+   * which must not be used from multiple threads at once, so the programs
+   * solved by Gurobi are still solved one at a time.
+   * @pre num_threads >= 1.
+   */
+  void set_num_threads(int num_threads) {
+    DRAKE_DEMAND(num_threads >= 1);
+    num_threads_ = num_threads;
+    thread_pool_ =
+        num_threads > 1
+            ? std::make_unique<drake::internal::ThreadPool>(num_threads)
+            : nullptr;
+  }
+
+  /** Getter for the number of threads used to solve the nodes. */
+  int num_threads() const { return num_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -580,6 +637,13 @@ class MixedIntegerBranchAndBound {
    */
   MixedIntegerBranchAndBoundNode* PickDepthFirstNode() const;
 
+  /**
+   * Pick up to num_threads_ nodes to branch in parallel, starting with
+   * `first_node`, which is the node returned by PickBranchingNode().
+   */
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes(
+      MixedIntegerBranchAndBoundNode* first_node) const;
+
   /**
    * Pick the branching variable in a node.
    */
@@ -595,6 +659,22 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on several nodes, solves the optimizations of their child nodes on
+   * up to num_threads_ threads, and update the best lower and upper bounds.
+   * @param nodes. The nodes to be branched, on the variables picked by
+   * PickBranchingVariable().
+   */
+  void BranchAndUpdateInParallel(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes);
+
+  /**
+   * Update the best lower and upper bounds after branching on `nodes`, and
+   * call the callback function in their child nodes.
+   */
+  void UpdateAfterBranching(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -687,6 +767,12 @@ class MixedIntegerBranchAndBound {
 
   // The user defined callback function in each node. Default is null.
   NodeCallbackFun node_callback_userfun_ = nullptr;
+
+  // The number of threads used to solve the nodes.
+  int num_threads_{1};
+  // The threads that solve the nodes, kept for the whole search. Null when
+  // the nodes are solved on the calling thread.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
 };
 }  // namespace solvers
 }  // namespace drake
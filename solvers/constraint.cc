@@ -1,5 +1,6 @@
 #include "drake/solvers/constraint.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <unordered_map>
@@ -313,7 +314,12 @@ ExpressionConstraint::ExpressionConstraint(
                                                       &map_var_to_index_);
   }
 
-  derivatives_ = symbolic::Jacobian(expressions_, vars_);
+  if (symbolic::ExpressionTape::IsSupported(expressions_, vars_)) {
+    tape_.emplace(expressions_, vars_);
+  } else {
+    // Falls back to evaluating the expressions symbolically.
+    derivatives_ = symbolic::Jacobian(expressions_, vars_);
+  }
 
   // Setup the environment.
   for (int i = 0; i < vars_.size(); i++) {
@@ -325,6 +331,12 @@ void ExpressionConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                   Eigen::VectorXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
 
+  // N.B. map_var_to_index_ is the identity, so x is ordered like vars_.
+  if (tape_) {
+    tape_->Evaluate(x, y);
+    return;
+  }
+
   // Set environment with current x values.
   for (int i = 0; i < vars_.size(); i++) {
     environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id()));
@@ -341,6 +353,34 @@ void ExpressionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                                   AutoDiffVecXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
 
+  if (tape_) {
+    // Propagates ∂x/∂z through the tape. An entry of x with empty derivatives
+    // has zero gradient; the others must all have the same size.
+    int num_derivatives = 0;
+    for (int k = 0; k < x.size(); k++) {
+      num_derivatives = std::max<int>(num_derivatives,
+                                      x(k).derivatives().size());
+    }
+    Eigen::VectorXd x_value(x.size());
+    Eigen::MatrixXd x_gradient = Eigen::MatrixXd::Zero(x.size(),
+                                                       num_derivatives);
+    for (int k = 0; k < x.size(); k++) {
+      x_value(k) = x(k).value();
+      if (x(k).derivatives().size() > 0) {
+        x_gradient.row(k) = x(k).derivatives().transpose();
+      }
+    }
+    Eigen::VectorXd y_value;
+    Eigen::MatrixXd y_gradient;
+    tape_->Evaluate(x_value, x_gradient, &y_value, &y_gradient);
+    y->resize(num_constraints());
+    for (int i = 0; i < num_constraints(); i++) {
+      (*y)[i].value() = y_value(i);
+      (*y)[i].derivatives() = y_gradient.row(i).transpose();
+    }
+    return;
+  }
+
   // Set environment with current x values.
   for (int i = 0; i < vars_.size(); i++) {
     environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id())).value();
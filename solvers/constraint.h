@@ -15,6 +15,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic.h"
@@ -866,6 +867,12 @@ class ExpressionConstraint : public Constraint {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionConstraint)
 
+  /**
+   * Constructs the constraint lb ≤ v ≤ ub. Unless @p v includes an
+   * if-then-else expression or an uninterpreted function, it is compiled into
+   * a symbolic::ExpressionTape, so that evaluating the constraint (and its
+   * gradient) does not walk the expression trees.
+   */
   ExpressionConstraint(const Eigen::Ref<const VectorX<symbolic::Expression>>& v,
                        const Eigen::Ref<const Eigen::VectorXd>& lb,
                        const Eigen::Ref<const Eigen::VectorXd>& ub);
@@ -895,6 +902,13 @@ class ExpressionConstraint : public Constraint {
 
  private:
   VectorX<symbolic::Expression> expressions_{0};
+
+  // The compiled expressions_, with vars_ as its variables. When set, it is
+  // used for all numerical evaluations.
+  optional<symbolic::ExpressionTape> tape_;
+
+  // The symbolic Jacobian of expressions_ with respect to vars_, only used
+  // when tape_ is not set.
   MatrixX<symbolic::Expression> derivatives_{0, 0};
 
   // map_var_to_index_[vars_(i).get_id()] = i.
@@ -1,5 +1,8 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <set>
+#include <stdexcept>
+
 using std::make_shared;
 using std::shared_ptr;
 using Eigen::MatrixXd;
@@ -8,6 +11,106 @@ using Eigen::VectorXd;
 namespace drake {
 namespace solvers {
 
+void EvaluatorBase::SetGradientSparsityPattern(
+    const std::vector<std::pair<int, int>>& gradient_sparsity_pattern) {
+  if (num_vars_ == Eigen::Dynamic) {
+    throw std::invalid_argument(
+        "SetGradientSparsityPattern(): the evaluator must have a fixed number "
+        "of variables.");
+  }
+  // The rows of each column.
+  std::vector<std::vector<int>> column_rows(num_vars_);
+  std::set<std::pair<int, int>> entries;
+  for (const auto& entry : gradient_sparsity_pattern) {
+    if (entry.first < 0 || entry.first >= num_outputs_ || entry.second < 0 ||
+        entry.second >= num_vars_) {
+      throw std::invalid_argument(
+          "SetGradientSparsityPattern(): entry (" +
+          std::to_string(entry.first) + ", " + std::to_string(entry.second) +
+          ") is out of range.");
+    }
+    if (!entries.insert(entry).second) {
+      throw std::invalid_argument(
+          "SetGradientSparsityPattern(): entry (" +
+          std::to_string(entry.first) + ", " + std::to_string(entry.second) +
+          ") is repeated.");
+    }
+    column_rows[entry.second].push_back(entry.first);
+  }
+
+  // Greedily gives each column the first derivative direction that none of
+  // the previous columns sharing one of its rows has.
+  gradient_column_directions_.assign(num_vars_, 0);
+  num_gradient_directions_ = 0;
+  // row_used[d][i] is true if a column with direction d has row i.
+  std::vector<std::vector<bool>> row_used;
+  for (int j = 0; j < num_vars_; ++j) {
+    int direction = 0;
+    for (; direction < num_gradient_directions_; ++direction) {
+      bool conflict = false;
+      for (int i : column_rows[j]) {
+        if (row_used[direction][i]) {
+          conflict = true;
+          break;
+        }
+      }
+      if (!conflict) {
+        break;
+      }
+    }
+    if (direction == num_gradient_directions_) {
+      row_used.emplace_back(num_outputs_, false);
+      ++num_gradient_directions_;
+    }
+    for (int i : column_rows[j]) {
+      row_used[direction][i] = true;
+    }
+    gradient_column_directions_[j] = direction;
+  }
+  gradient_sparsity_pattern_ = gradient_sparsity_pattern;
+}
+
+void EvaluatorBase::EvalWithSparseGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::VectorXd* gradient) const {
+  DRAKE_ASSERT(x.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+  AutoDiffVecXd tx(x.rows());
+  AutoDiffVecXd ty(num_outputs_);
+  if (!gradient_sparsity_pattern_) {
+    tx = math::initializeAutoDiff(x);
+    DoEval(tx, &ty);
+    *y = math::autoDiffToValueMatrix(ty);
+    gradient->resize(num_outputs_ * x.rows());
+    int index = 0;
+    for (int i = 0; i < num_outputs_; ++i) {
+      for (int j = 0; j < x.rows(); ++j) {
+        (*gradient)(index++) = ty(i).derivatives().size() > 0
+                                   ? ty(i).derivatives()(j)
+                                   : 0.0;
+      }
+    }
+    return;
+  }
+
+  for (int j = 0; j < num_vars_; ++j) {
+    tx(j).value() = x(j);
+    tx(j).derivatives() =
+        Eigen::VectorXd::Unit(num_gradient_directions_,
+                              gradient_column_directions_[j]);
+  }
+  DoEval(tx, &ty);
+  *y = math::autoDiffToValueMatrix(ty);
+  gradient->resize(gradient_sparsity_pattern_->size());
+  for (int k = 0; k < gradient->size(); ++k) {
+    const auto& entry = (*gradient_sparsity_pattern_)[k];
+    const Eigen::VectorXd& derivatives = ty(entry.first).derivatives();
+    (*gradient)(k) =
+        derivatives.size() > 0
+            ? derivatives(gradient_column_directions_[entry.second])
+            : 0.0;
+  }
+}
+
 void PolynomialEvaluator::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                  Eigen::VectorXd* y) const {
   double_evaluation_point_temp_.clear();
@@ -10,6 +10,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic.h"
@@ -94,6 +95,45 @@ class EvaluatorBase {
    */
   int num_outputs() const { return num_outputs_; }
 
+  /**
+   * Declares which entries of the gradient ∂y/∂x of the outputs with respect
+   * to the inputs may be nonzero, as a list of (row, column) pairs; all the
+   * other entries must be zero for every x.  Solvers that take a sparse
+   * gradient (such as SNOPT and IPOPT) then only receive these entries, as
+   * evaluated by EvalWithSparseGradient().
+   * @throws std::invalid_argument if num_vars() is Eigen::Dynamic, or if a
+   * pair is out of range or repeated.
+   */
+  void SetGradientSparsityPattern(
+      const std::vector<std::pair<int, int>>& gradient_sparsity_pattern);
+
+  /**
+   * Returns the (row, column) pairs of the possibly nonzero entries of the
+   * gradient, or nullopt if SetGradientSparsityPattern() was not called (in
+   * which case the gradient is considered dense).
+   */
+  const optional<std::vector<std::pair<int, int>>>& gradient_sparsity_pattern()
+      const {
+    return gradient_sparsity_pattern_;
+  }
+
+  /**
+   * Evaluates the expression and its gradient.
+   * @param[in] x A `num_vars` x 1 input vector.
+   * @param[out] y A `num_outputs` x 1 output vector.
+   * @param[out] gradient The entries of ∂y/∂x at the (row, column) pairs of
+   * gradient_sparsity_pattern(), in the same order, or all the entries in
+   * row-major order if there is no sparsity pattern.
+   *
+   * With a sparsity pattern, the columns of ∂y/∂x that have no possibly
+   * nonzero row in common share a single derivative direction of the
+   * AutoDiffXd evaluation, so that e.g. a banded gradient is evaluated with
+   * as many derivatives as the width of its band rather than `num_vars`.
+   */
+  void EvalWithSparseGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                              Eigen::VectorXd* y,
+                              Eigen::VectorXd* gradient) const;
+
  protected:
   /**
    * Constructs a evaluator.
@@ -150,6 +190,11 @@ class EvaluatorBase {
   int num_vars_{};
   int num_outputs_{};
   std::string description_;
+  optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
+  // The derivative direction of each column of the gradient, such that no
+  // two columns with the same direction share a row in the sparsity pattern.
+  std::vector<int> gradient_column_directions_;
+  int num_gradient_directions_{0};
 };
 
 /**
@@ -44,7 +44,11 @@ int GetConstraintBounds(const Constraint& c, Number* lb, Number* ub) {
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  if (c.gradient_sparsity_pattern()) {
+    *num_grad = c.gradient_sparsity_pattern()->size();
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -67,6 +71,16 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  if (c.gradient_sparsity_pattern()) {
+    for (const auto& entry : *c.gradient_sparsity_pattern()) {
+      iRow[grad_index] = constraint_idx + entry.first;
+      jCol[grad_index] =
+          prog.FindDecisionVariableIndex(variables(entry.second));
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
@@ -109,6 +123,18 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
     this_x(i) = xvec(prog.FindDecisionVariableIndex(variables(i)));
   }
 
+  if (c.gradient_sparsity_pattern()) {
+    Eigen::VectorXd y, gradient;
+    c.EvalWithSparseGradient(this_x, &y, &gradient);
+    for (int i = 0; i < c.num_constraints(); i++) {
+      result[i] = y(i);
+    }
+    for (int k = 0; k < gradient.size(); k++) {
+      grad[k] = gradient(k);
+    }
+    return gradient.size();
+  }
+
   AutoDiffVecXd ty(c.num_constraints());
   c.Eval(math::initializeAutoDiff(this_x), &ty);
 
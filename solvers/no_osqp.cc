@@ -9,6 +9,12 @@ namespace solvers {
 
 bool OsqpSolver::is_available() { return false; }
 
+struct OsqpSolver::Workspace {};
+
+void OsqpSolver::WorkspaceDeleter::operator()(Workspace* workspace) const {
+  delete workspace;
+}
+
 void OsqpSolver::DoSolve(
     const MathematicalProgram&,
     const Eigen::VectorXd&,
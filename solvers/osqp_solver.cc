@@ -1,5 +1,8 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
@@ -215,8 +218,163 @@ void SetOsqpSolverSettings(const SolverOptions& solver_options,
   SetOsqpSolverSettingWithDefaultValue(options_int, "polish",
                                        &(settings->polish), 1);
 }
+
+// Returns true iff the fields set by SetOsqpSolverSettings() are equal.
+bool HaveSameSettings(const OSQPSettings& a, const OSQPSettings& b) {
+  return a.rho == b.rho && a.sigma == b.sigma && a.scaling == b.scaling &&
+         a.max_iter == b.max_iter &&
+         a.polish_refine_iter == b.polish_refine_iter &&
+         a.verbose == b.verbose && a.polish == b.polish;
+}
+
+// Returns true iff `a` and `b` have the same size and sparsity pattern.  Both
+// must be compressed.
+bool HaveSameSparsityPattern(const Eigen::SparseMatrix<c_float>& a,
+                             const Eigen::SparseMatrix<c_float>& b) {
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.outerSize() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr());
+}
+
+// Returns true iff `a` and `b`, which have the same sparsity pattern, have the
+// same values.
+bool HaveSameValues(const Eigen::SparseMatrix<c_float>& a,
+                    const Eigen::SparseMatrix<c_float>& b) {
+  return std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
+
+// Returns the values of the upper triangular part of P.  This is the order of
+// the values of OSQP's own copy of P, which is what osqp_update_P() expects.
+std::vector<c_float> UpperTriangularValues(
+    const Eigen::SparseMatrix<c_float>& P) {
+  std::vector<c_float> values;
+  values.reserve(P.nonZeros());
+  for (int j = 0; j < P.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<c_float>::InnerIterator it(P, j); it; ++it) {
+      if (it.row() <= j) {
+        values.push_back(it.value());
+      }
+    }
+  }
+  return values;
+}
 }  // namespace
 
+// The data, settings and OSQP workspace of the last QP solved.
+struct OsqpSolver::Workspace {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  // Sets up the OSQP workspace for the given QP.  On failure (e.g., invalid
+  // data), `work` is nullptr.
+  Workspace(Eigen::SparseMatrix<c_float> P_in, std::vector<c_float> q_in,
+            Eigen::SparseMatrix<c_float> A_in, std::vector<c_float> l_in,
+            std::vector<c_float> u_in, const OSQPSettings& settings_in)
+      : P(std::move(P_in)),
+        q(std::move(q_in)),
+        A(std::move(A_in)),
+        l(std::move(l_in)),
+        u(std::move(u_in)),
+        settings(settings_in) {
+    data.n = P.cols();
+    data.m = A.rows();
+    data.P = EigenSparseToCSC(P);
+    data.q = q.data();
+    data.A = EigenSparseToCSC(A);
+    data.l = l.data();
+    data.u = u.data();
+    work = osqp_setup(&data, &settings);
+  }
+
+  ~Workspace() {
+    if (work != nullptr) {
+      osqp_cleanup(work);
+    }
+    for (csc* matrix : {data.P, data.A}) {
+      c_free(matrix->x);
+      c_free(matrix->i);
+      c_free(matrix->p);
+      c_free(matrix);
+    }
+  }
+
+  // Returns true iff this workspace can be updated in place to the QP with
+  // the given P, A and settings.
+  bool CanUpdate(const Eigen::SparseMatrix<c_float>& new_P,
+                 const Eigen::SparseMatrix<c_float>& new_A,
+                 const OSQPSettings& new_settings) const {
+    return work != nullptr && HaveSameSparsityPattern(P, new_P) &&
+           HaveSameSparsityPattern(A, new_A) &&
+           HaveSameSettings(settings, new_settings);
+  }
+
+  // Updates this workspace in place to the given QP, for which CanUpdate()
+  // must be true, and keeps the previous solution to warm start from.
+  // Returns false if OSQP rejects any of the updates.
+  bool Update(const Eigen::SparseMatrix<c_float>& new_P,
+              const std::vector<c_float>& new_q,
+              const Eigen::SparseMatrix<c_float>& new_A,
+              const std::vector<c_float>& new_l,
+              const std::vector<c_float>& new_u) {
+    DRAKE_DEMAND(CanUpdate(new_P, new_A, settings));
+    c_int exitflag = 0;
+    // N.B. The vectors are copied into the existing storage, which `data`
+    // points into.
+    if (new_q != q) {
+      std::copy(new_q.begin(), new_q.end(), q.begin());
+      exitflag |= osqp_update_lin_cost(work, q.data());
+    }
+    if (new_l != l || new_u != u) {
+      std::copy(new_l.begin(), new_l.end(), l.begin());
+      std::copy(new_u.begin(), new_u.end(), u.begin());
+      exitflag |= osqp_update_bounds(work, l.data(), u.data());
+    }
+    const bool update_P = !HaveSameValues(P, new_P);
+    const bool update_A = !HaveSameValues(A, new_A);
+    if (update_P) {
+      P = new_P;
+    }
+    if (update_A) {
+      A = new_A;
+    }
+    // Each of these refactors the KKT matrix, so update both at once.
+    std::vector<c_float> P_values;
+    if (update_P) {
+      P_values = UpperTriangularValues(P);
+    }
+    if (update_P && update_A) {
+      exitflag |= osqp_update_P_A(
+          work, P_values.data(), OSQP_NULL,
+          static_cast<c_int>(P_values.size()), A.valuePtr(), OSQP_NULL,
+          A.nonZeros());
+    } else if (update_P) {
+      exitflag |= osqp_update_P(work, P_values.data(), OSQP_NULL,
+                                static_cast<c_int>(P_values.size()));
+    } else if (update_A) {
+      exitflag |= osqp_update_A(work, A.valuePtr(), OSQP_NULL, A.nonZeros());
+    }
+    return exitflag == 0;
+  }
+
+  OSQPWorkspace* work{nullptr};
+  // The QP that `work` was set up with or updated to.
+  Eigen::SparseMatrix<c_float> P;
+  std::vector<c_float> q;
+  Eigen::SparseMatrix<c_float> A;
+  std::vector<c_float> l;
+  std::vector<c_float> u;
+  OSQPSettings settings{};
+  // The OSQP data that `work` was set up with, which points into the members
+  // above.
+  OSQPData data{};
+};
+
+void OsqpSolver::WorkspaceDeleter::operator()(Workspace* workspace) const {
+  delete workspace;
+}
+
 bool OsqpSolver::is_available() { return true; }
 
 void OsqpSolver::DoSolve(
@@ -245,39 +403,43 @@ void OsqpSolver::DoSolve(
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u);
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data;  // OSQPData
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
   // Define Solver settings as default.
   // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
+  OSQPSettings settings;
+  osqp_set_default_settings(&settings);
 
-  SetOsqpSolverSettings(merged_options, settings);
+  SetOsqpSolverSettings(merged_options, &settings);
 
-  // Setup workspace.
+  // Setup workspace, or update the persistent one when possible.
+  bool workspace_reused = false;
+  if (persistent_workspace_ && workspace_ &&
+      workspace_->CanUpdate(P_sparse, A_sparse, settings)) {
+    workspace_reused = workspace_->Update(P_sparse, q, A_sparse, l, u);
+  }
+  std::unique_ptr<Workspace, WorkspaceDeleter> new_workspace;
+  if (!workspace_reused) {
+    workspace_.reset();
+    new_workspace.reset(new Workspace(std::move(P_sparse), std::move(q),
+                                      std::move(A_sparse), std::move(l),
+                                      std::move(u), settings));
+  }
   // OSQP structures.
-  OSQPWorkspace* work;  // Workspace
-  work = osqp_setup(data, settings);
+  OSQPWorkspace* work =
+      workspace_reused ? workspace_->work : new_workspace->work;
+
+  OsqpSolverDetails& solver_details =
+      result->SetSolverDetailsType<OsqpSolverDetails>();
+  solver_details.workspace_reused = workspace_reused;
+  if (work == nullptr) {
+    // OSQP rejected the problem data.
+    result->set_solution_result(SolutionResult::kInvalidInput);
+    return;
+  }
 
   // Solve Problem.
   c_int osqp_exitflag = osqp_solve(work);
 
   SolutionResult solution_result;
-  OsqpSolverDetails& solver_details =
-      result->SetSolverDetailsType<OsqpSolverDetails>();
   solver_details.iter = work->info->iter;
   solver_details.status_val = work->info->status_val;
   solver_details.primal_res = work->info->pri_res;
@@ -319,18 +481,9 @@ void OsqpSolver::DoSolve(
   }
   result->set_solution_result(solution_result);
 
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  if (persistent_workspace_ && new_workspace) {
+    workspace_ = std::move(new_workspace);
+  }
 }
 
 }  // namespace solvers
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/solver_base.h"
 
@@ -28,6 +30,10 @@ struct OsqpSolverDetails {
   double polish_time{};
   /// Total OSQP time (seconds).
   double run_time{};
+  /// Whether the OSQP workspace of the previous solve was updated and reused,
+  /// instead of setting up a new one.  See
+  /// OsqpSolver::set_persistent_workspace().
+  bool workspace_reused{};
 };
 
 class OsqpSolver final : public SolverBase {
@@ -50,9 +56,37 @@ class OsqpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Sets whether this solver keeps its OSQP workspace (the problem data, the
+  /// factorization of the KKT matrix, and the last primal and dual solution)
+  /// from one Solve() to the next.  This is disabled by default.
+  ///
+  /// When it is enabled, and a program has the same number of variables and
+  /// constraints, the same sparsity patterns of the cost Hessian P and of the
+  /// constraint matrix A, and the same solver options as the previous one,
+  /// Solve() only updates the vectors q, l, u and the values of P and A that
+  /// changed (refactoring the KKT matrix only if P or A did), and warm starts
+  /// from the previous solution.  Otherwise it sets up a new workspace.  This
+  /// suits solving a sequence of programs that differ only in their data,
+  /// e.g. the successive steps of model predictive control.
+  ///
+  /// A solver with a persistent workspace must not be used from multiple
+  /// threads at once.
+  void set_persistent_workspace(bool persistent_workspace);
+
+  bool persistent_workspace() const { return persistent_workspace_; }
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  // The OSQP state kept by a persistent workspace, defined with DoSolve().
+  struct Workspace;
+  struct WorkspaceDeleter {
+    void operator()(Workspace*) const;
+  };
+
+  bool persistent_workspace_{false};
+  mutable std::unique_ptr<Workspace, WorkspaceDeleter> workspace_;
 };
 }  // namespace solvers
 }  // namespace drake
@@ -16,6 +16,13 @@ OsqpSolver::OsqpSolver()
 
 OsqpSolver::~OsqpSolver() = default;
 
+void OsqpSolver::set_persistent_workspace(bool persistent_workspace) {
+  persistent_workspace_ = persistent_workspace;
+  if (!persistent_workspace_) {
+    workspace_.reset();
+  }
+}
+
 SolverId OsqpSolver::id() {
   static const never_destroyed<SolverId> singleton{"OSQP"};
   return singleton.access();
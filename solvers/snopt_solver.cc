@@ -362,6 +362,20 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
                     constraint.q().cast<AutoDiffXd>());
 }
 
+// Return true if the gradient of the nonlinear constraint is evaluated with
+// its declared sparsity pattern, see
+// EvaluatorBase::SetGradientSparsityPattern().
+template <typename C>
+bool HasGradientSparsityPattern(const C& constraint) {
+  return static_cast<bool>(constraint.gradient_sparsity_pattern());
+}
+
+template <>
+bool HasGradientSparsityPattern<LinearComplementarityConstraint>(
+    const LinearComplementarityConstraint& constraint) {
+  return false;
+}
+
 /*
  * Evaluate the value and gradients of nonlinear constraints.
  * The template type Binding is supposed to be a
@@ -391,6 +405,18 @@ void EvaluateNonlinearConstraints(
       this_x(i) = xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
     }
 
+    if (HasGradientSparsityPattern(*c)) {
+      Eigen::VectorXd y, gradient;
+      c->EvalWithSparseGradient(this_x, &y, &gradient);
+      for (int i = 0; i < num_constraints; i++) {
+        F[(*constraint_index)++] = y(i);
+      }
+      for (int k = 0; k < gradient.size(); ++k) {
+        G[(*grad_index)++] = gradient(k);
+      }
+      continue;
+    }
+
     AutoDiffVecXd ty;
     ty.resize(num_constraints);
     EvaluateSingleNonlinearConstraint(*c, this_x, &ty);
@@ -548,7 +574,11 @@ void UpdateNumNonlinearConstraintsAndGradients(
   for (auto const& binding : constraint_list) {
     auto const& c = binding.evaluator();
     int n = c->num_constraints();
-    *max_num_gradients += n * binding.GetNumElements();
+    if (HasGradientSparsityPattern(*c)) {
+      *max_num_gradients += c->gradient_sparsity_pattern()->size();
+    } else {
+      *max_num_gradients += n * binding.GetNumElements();
+    }
     *num_nonlinear_constraints += n;
   }
 }
@@ -586,14 +616,24 @@ void UpdateConstraintBoundsAndGradients(
       (*Fupp)[constraint_index_i] = ub(i);
     }
 
-    for (int i = 0; i < n; i++) {
-      for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
+    if (HasGradientSparsityPattern(*c)) {
+      for (const auto& entry : *c->gradient_sparsity_pattern()) {
         // Fortran is 1-indexed.
-        (*iGfun)[*grad_index] = 1 + *constraint_index + i;  // row order
-        (*jGvar)[*grad_index] =
-            1 + prog.FindDecisionVariableIndex(binding.variables()(j));
+        (*iGfun)[*grad_index] = 1 + *constraint_index + entry.first;
+        (*jGvar)[*grad_index] = 1 + prog.FindDecisionVariableIndex(
+                                        binding.variables()(entry.second));
         (*grad_index)++;
       }
+    } else {
+      for (int i = 0; i < n; i++) {
+        for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
+          // Fortran is 1-indexed.
+          (*iGfun)[*grad_index] = 1 + *constraint_index + i;  // row order
+          (*jGvar)[*grad_index] =
+              1 + prog.FindDecisionVariableIndex(binding.variables()(j));
+          (*grad_index)++;
+        }
+      }
     }
 
     (*constraint_index) += n;
@@ -335,6 +335,50 @@ GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch1) {
   EXPECT_THROW(root->Branch(x(3)), std::runtime_error);
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestConstructProgram) {
+  // Test that the nodes share the program of the root node, and construct
+  // their own program by fixing the binary variables of their ancestors.
+  auto prog = ConstructMathematicalProgram1();
+
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> root;
+  std::tie(root, std::ignore) =
+      MixedIntegerBranchAndBoundNode::ConstructRootNode(*prog,
+                                                        GurobiSolver::id());
+  VectorDecisionVariable<4> x = root->prog()->decision_variables();
+  const int num_root_bounding_box_constraints =
+      root->prog()->bounding_box_constraints().size();
+  EXPECT_EQ(static_cast<int>(
+                root->ConstructProgram()->bounding_box_constraints().size()),
+            num_root_bounding_box_constraints);
+
+  root->Branch(x(0));
+  MixedIntegerBranchAndBoundNode* left = root->mutable_left_child();
+  left->Branch(x(2));
+  const MixedIntegerBranchAndBoundNode* left_right = left->right_child();
+
+  // The program of root->left->right fixes x(0) = 0 and x(2) = 1. prog()
+  // constructs it once, and then returns the same program.
+  const MathematicalProgram* left_right_prog = left_right->prog();
+  EXPECT_NE(left_right_prog, root->prog());
+  EXPECT_EQ(left_right->prog(), left_right_prog);
+  EXPECT_EQ(left_right->ConstructProgram()->bounding_box_constraints().size(),
+            left_right_prog->bounding_box_constraints().size());
+  const auto& bounding_box_constraints =
+      left_right_prog->bounding_box_constraints();
+  ASSERT_EQ(static_cast<int>(bounding_box_constraints.size()),
+            num_root_bounding_box_constraints + 2);
+  const auto& fix_x0 =
+      bounding_box_constraints[num_root_bounding_box_constraints];
+  const auto& fix_x2 =
+      bounding_box_constraints[num_root_bounding_box_constraints + 1];
+  EXPECT_TRUE(fix_x0.variables()(0).equal_to(x(0)));
+  EXPECT_EQ(fix_x0.evaluator()->lower_bound()(0), 0);
+  EXPECT_EQ(fix_x0.evaluator()->upper_bound()(0), 0);
+  EXPECT_TRUE(fix_x2.variables()(0).equal_to(x(2)));
+  EXPECT_EQ(fix_x2.evaluator()->lower_bound()(0), 1);
+  EXPECT_EQ(fix_x2.evaluator()->upper_bound()(0), 1);
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch2) {
   // Test branching on the root node for prog 2.
   auto prog = ConstructMathematicalProgram2();
@@ -983,6 +1027,44 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSteelBlendingProblem) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel) {
+  // Solves prog1 and prog2 branching on multiple nodes in parallel, and
+  // compares the results against branching on one node at a time. Gurobi
+  // solves the nodes one at a time, while SCS solves them concurrently.
+  std::vector<std::unique_ptr<MathematicalProgram>> progs;
+  progs.push_back(ConstructMathematicalProgram1());
+  progs.push_back(ConstructMathematicalProgram2());
+  for (const SolverId& solver_id : {GurobiSolver::id(), ScsSolver::id()}) {
+    // SCS is a first-order solver, and only meets a looser tolerance.
+    const double tol = solver_id == ScsSolver::id() ? 1E-3 : 1E-5;
+    for (const auto& prog : progs) {
+      const VectorXDecisionVariable x = prog->decision_variables();
+      for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+        for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+          MixedIntegerBranchAndBound bnb(*prog, solver_id);
+          bnb.SetNodeSelectionMethod(pick_node);
+          bnb.SetVariableSelectionMethod(pick_variable);
+          EXPECT_EQ(bnb.num_threads(), 1);
+          const SolutionResult solution_result = bnb.Solve();
+
+          MixedIntegerBranchAndBound bnb_parallel(*prog, solver_id);
+          bnb_parallel.SetNodeSelectionMethod(pick_node);
+          bnb_parallel.SetVariableSelectionMethod(pick_variable);
+          bnb_parallel.set_num_threads(3);
+          EXPECT_EQ(bnb_parallel.num_threads(), 3);
+          EXPECT_EQ(bnb_parallel.Solve(), solution_result);
+
+          EXPECT_NEAR(bnb_parallel.GetOptimalCost(), bnb.GetOptimalCost(),
+                      tol);
+          EXPECT_TRUE(CompareMatrices(bnb_parallel.GetSolution(x),
+                                      bnb.GetSolution(x), tol,
+                                      MatrixCompareType::absolute));
+        }
+      }
+    }
+  }
+}
+
 void CheckAllIntegralSolution(
     const MixedIntegerBranchAndBound& bnb,
     const Eigen::Ref<const VectorXDecisionVariable>& x,
@@ -382,6 +382,64 @@ GTEST_TEST(testConstraint, testExpressionConstraint) {
                0 <= e[0] && e[0] <= 2 && 0 <= e[1] && e[1] <= 2);
 }
 
+// Functions that symbolic differentiation does not support still have their
+// gradients evaluated.
+GTEST_TEST(testConstraint, testExpressionConstraintNonSmooth) {
+  Variable x0{"x0"};
+  Variable x1{"x1"};
+
+  Vector2<Expression> e{abs(x0 - x1), max(x0, x1) * x1};
+  ExpressionConstraint constraint(e, Vector2d::Zero(), Vector2d::Ones());
+
+  const Vector2d x{.2, .5};
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(drake::math::initializeAutoDiff(x), &y_autodiff);
+  Eigen::Matrix2d y_gradient_expected;
+  // clang-format off
+  y_gradient_expected << -1., 1.,
+                          0., 1.;
+  // clang-format on
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y_autodiff),
+                              Vector2d(.3, .25), 1e-15));
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y_autodiff),
+                              y_gradient_expected));
+}
+
+// Entries of x with empty derivatives have zero gradient, even when x(0) is
+// one of them.
+GTEST_TEST(testConstraint, testExpressionConstraintEmptyDerivatives) {
+  Variable x0{"x0"};
+  Variable x1{"x1"};
+  Variable x2{"x2"};
+
+  Vector2<Expression> e{x0 * x1, x1 + x2 * x2};
+  ExpressionConstraint constraint(e, Vector2d::Zero(), Vector2d::Ones());
+
+  AutoDiffVecXd x_autodiff(3);
+  x_autodiff(0).value() = .2;
+  x_autodiff(1).value() = .4;
+  x_autodiff(1).derivatives() = Vector2d(1., 2.);
+  x_autodiff(2).value() = .6;
+  x_autodiff(2).derivatives() = Vector2d(3., 4.);
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(x_autodiff, &y_autodiff);
+
+  // ∂y/∂z = ∂y/∂x ∂x/∂z, where the first row of ∂x/∂z is zero.
+  Eigen::Matrix<double, 2, 3> y_x;
+  // clang-format off
+  y_x << .4, .2, 0.,
+         0., 1., 1.2;
+  Eigen::Matrix<double, 3, 2> x_z;
+  x_z << 0., 0.,
+         1., 2.,
+         3., 4.;
+  // clang-format on
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y_autodiff),
+                              Vector2d(.08, .76), 1e-15));
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y_autodiff),
+                              y_x * x_z, 1e-15));
+}
+
 // Test that the Eval() method of LinearComplementarityConstraint correctly
 // returns the slack.
 GTEST_TEST(testConstraint, testSimpleLCPConstraintEval) {
@@ -166,6 +166,72 @@ GTEST_TEST(EvaluatorBaseTest, FunctionEvaluatorTest) {
   VerifyFunctionEvaluator(MakeFunctionWrapped(callable, 3, 3), x);
 }
 
+// y(i) = x(i)² + x(i+1)³, whose gradient is upper bidiagonal.
+struct BidiagonalFunctor {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BidiagonalFunctor)
+
+  BidiagonalFunctor() {}
+
+  int numInputs() const { return 5; }
+  int numOutputs() const { return 4; }
+
+  template <typename T>
+  void eval(const detail::VecIn<T>& x, detail::VecOut<T>* y) const {
+    y->resize(4);
+    for (int i = 0; i < 4; ++i) {
+      (*y)(i) = x(i) * x(i) + x(i + 1) * x(i + 1) * x(i + 1);
+    }
+  }
+};
+
+GTEST_TEST(EvaluatorBaseTest, EvalWithSparseGradient) {
+  shared_ptr<EvaluatorBase> evaluator =
+      MakeFunctionEvaluator(BidiagonalFunctor());
+  const VectorXd x = VectorXd::LinSpaced(5, 1, 3);
+
+  AutoDiffVecXd ty(4);
+  evaluator->Eval(math::initializeAutoDiff(x), &ty);
+  const VectorXd y_expected = math::autoDiffToValueMatrix(ty);
+  const MatrixXd dy_expected = math::autoDiffToGradientMatrix(ty);
+
+  // Without a sparsity pattern, the gradient is dense and row-major.
+  EXPECT_FALSE(evaluator->gradient_sparsity_pattern());
+  VectorXd y, gradient;
+  evaluator->EvalWithSparseGradient(x, &y, &gradient);
+  EXPECT_TRUE(CompareMatrices(y, y_expected));
+  ASSERT_EQ(gradient.size(), 20);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      EXPECT_EQ(gradient(5 * i + j), dy_expected(i, j));
+    }
+  }
+
+  // List the entries column by column, to check that the order is kept.
+  vector<std::pair<int, int>> pattern;
+  for (int j = 0; j < 5; ++j) {
+    if (j < 4) pattern.emplace_back(j, j);
+    if (j > 0) pattern.emplace_back(j - 1, j);
+  }
+  evaluator->SetGradientSparsityPattern(pattern);
+  ASSERT_TRUE(evaluator->gradient_sparsity_pattern());
+  EXPECT_EQ(*evaluator->gradient_sparsity_pattern(), pattern);
+  evaluator->EvalWithSparseGradient(x, &y, &gradient);
+  EXPECT_TRUE(CompareMatrices(y, y_expected));
+  ASSERT_EQ(gradient.size(), static_cast<int>(pattern.size()));
+  for (int k = 0; k < gradient.size(); ++k) {
+    EXPECT_NEAR(gradient(k), dy_expected(pattern[k].first, pattern[k].second),
+                1e-14);
+  }
+
+  // Out of range and repeated entries are rejected.
+  EXPECT_THROW(evaluator->SetGradientSparsityPattern({{4, 0}}),
+               std::invalid_argument);
+  EXPECT_THROW(evaluator->SetGradientSparsityPattern({{0, 5}}),
+               std::invalid_argument);
+  EXPECT_THROW(evaluator->SetGradientSparsityPattern({{0, 0}, {0, 0}}),
+               std::invalid_argument);
+}
+
 }  // anonymous namespace
 }  // namespace solvers
 }  // namespace drake
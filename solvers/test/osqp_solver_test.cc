@@ -139,6 +139,75 @@ GTEST_TEST(OsqpSolverTest, SolverOptionsTest) {
     EXPECT_NE(result.get_solver_details<OsqpSolver>().status_val, OSQP_SOLVED);
   }
 }
+
+GTEST_TEST(OsqpSolverTest, PersistentWorkspace) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto cost = prog.AddQuadraticCost(Eigen::Matrix2d::Identity(),
+                                    Eigen::Vector2d(1, 1), x);
+  auto constraint = prog.AddLinearConstraint(
+      Eigen::RowVector2d(1, 1), Vector1d(1), Vector1d(2), x);
+
+  OsqpSolver solver;
+  EXPECT_FALSE(solver.persistent_workspace());
+  solver.set_persistent_workspace(true);
+  EXPECT_TRUE(solver.persistent_workspace());
+  if (solver.available()) {
+    // Compares the solution of `prog` by `solver` with that of a solver
+    // without a persistent workspace.
+    auto check_solution = [&prog, &x](const MathematicalProgramResult& result) {
+      OsqpSolver fresh_solver;
+      const auto fresh_result = fresh_solver.Solve(prog, {}, {});
+      EXPECT_TRUE(result.is_success());
+      EXPECT_FALSE(
+          fresh_result.get_solver_details<OsqpSolver>().workspace_reused);
+      EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                  fresh_result.GetSolution(x), 1E-6));
+    };
+
+    auto result = solver.Solve(prog, {}, {});
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    check_solution(result);
+
+    // Change the linear cost.
+    cost.evaluator()->UpdateCoefficients(Eigen::Matrix2d::Identity(),
+                                         Eigen::Vector2d(-3, 1));
+    result = solver.Solve(prog, {}, {});
+    EXPECT_TRUE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    check_solution(result);
+
+    // Change the bounds and the values of the constraint matrix.
+    constraint.evaluator()->UpdateCoefficients(Eigen::RowVector2d(1, 2),
+                                               Vector1d(2), Vector1d(3));
+    result = solver.Solve(prog, {}, {});
+    EXPECT_TRUE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    check_solution(result);
+
+    // Change the values of the Hessian.
+    cost.evaluator()->UpdateCoefficients(
+        (Eigen::Matrix2d() << 2, 1, 1, 3).finished(), Eigen::Vector2d(-3, 1));
+    result = solver.Solve(prog, {}, {});
+    EXPECT_TRUE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    check_solution(result);
+
+    // Adding a constraint changes the size of the problem.
+    prog.AddLinearConstraint(x(0) >= 0);
+    result = solver.Solve(prog, {}, {});
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    check_solution(result);
+
+    // Changing the solver options requires a new workspace.
+    SolverOptions solver_options;
+    solver_options.SetOption(solver.solver_id(), "max_iter", 1000);
+    result = solver.Solve(prog, {}, solver_options);
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().workspace_reused);
+
+    // Without a persistent workspace, the workspace is never reused.
+    solver.set_persistent_workspace(false);
+    result = solver.Solve(prog, {}, {});
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().workspace_reused);
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
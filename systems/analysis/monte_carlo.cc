@@ -1,5 +1,12 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "drake/common/drake_throw.h"
+
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -22,7 +29,18 @@ double RandomSimulation(const SimulatorFactory& make_simulator,
 
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator) {
+    double final_time, int num_samples, RandomGenerator* generator,
+    int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+  DRAKE_THROW_UNLESS(num_parallel_executions > 0 ||
+                     num_parallel_executions == kNumParallelExecutionsAuto);
+  if (num_parallel_executions == kNumParallelExecutionsAuto) {
+    // hardware_concurrency() is allowed to return zero when the value is not
+    // computable.
+    num_parallel_executions =
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+
   std::unique_ptr<RandomGenerator> owned_generator{};
   if (generator == nullptr) {
     // Create a generator to be used for this set of tests.
@@ -30,18 +48,58 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     generator = owned_generator.get();
   }
 
-  std::vector<RandomSimulationResult> data;
-  data.reserve(num_samples);
+  // Draw the seed of every sample's generator up front (and in order), so
+  // that the samples are independent of the order in which they are run.
+  std::vector<RandomGenerator::result_type> seeds(num_samples);
+  for (auto& seed : seeds) {
+    seed = (*generator)();
+  }
 
-  // TODO(russt): Support running these in multiple threads, as they are
-  // trivially parallelizable.
-  for (int i = 0; i < num_samples; i++) {
-    RandomSimulationResult result(*generator);
-    result.output =
-        RandomSimulation(make_simulator, output, final_time, generator);
-    data.emplace_back(std::move(result));
+  std::vector<double> outputs(num_samples);
+  std::vector<std::exception_ptr> errors(num_samples);
+  std::atomic<int> next_sample{0};
+  // Each worker claims the next unclaimed sample until none are left.  The
+  // workers write only to their own samples' slots in `outputs` and
+  // `errors`, so no further synchronization is required.
+  auto run_samples = [&]() {
+    for (int i = next_sample++; i < num_samples; i = next_sample++) {
+      try {
+        RandomGenerator sample_generator(seeds[i]);
+        outputs[i] = RandomSimulation(make_simulator, output, final_time,
+                                      &sample_generator);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+
+  const int num_threads = std::min(num_parallel_executions, num_samples);
+  if (num_threads <= 1) {
+    run_samples();
+  } else {
+    // The calling thread runs samples too, so we only spawn the others.
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (int i = 1; i < num_threads; ++i) {
+      workers.emplace_back(run_samples);
+    }
+    run_samples();
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
   }
 
+  std::vector<RandomSimulationResult> data;
+  data.reserve(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    data.emplace_back(RandomGenerator(seeds[i]), outputs[i]);
+  }
   return data;
 }
 
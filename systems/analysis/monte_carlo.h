@@ -111,6 +111,13 @@ struct RandomSimulationResult {
   double output{};
 };
 
+/**
+ * Sentinel value for the `num_parallel_executions` argument of
+ * MonteCarloSimulation() requesting one worker per hardware thread (as
+ * reported by std::thread::hardware_concurrency()).
+ */
+constexpr int kNumParallelExecutionsAuto = -1;
+
 /**
  * Generate samples of a scalar random variable output by running many
  * random simulations drawn from independent samples of the
@@ -119,12 +126,19 @@ struct RandomSimulationResult {
  * In pseudo-code, this algorithm implements:
  * @code
  *   for i=1:num_samples
- *     const generator_snapshot = deepcopy(generator)
- *     output = RandomSimulation(..., generator)
+ *     sample_generator = RandomGenerator(generator())
+ *     const generator_snapshot = deepcopy(sample_generator)
+ *     output = RandomSimulation(..., sample_generator)
  *     data(i) = std::pair(generator_snapshot, output)
  *   return data
  * @endcode
  *
+ * Each sample draws from its own RandomGenerator, whose seed is drawn (in
+ * sample order) from @p generator before any simulation is run.  The
+ * results therefore do not depend on how the samples are distributed across
+ * threads: for a given @p generator state, the returned data are identical
+ * for every value of @p num_parallel_executions.
+ *
  * @see RandomSimulation() for details about @p make_simulator, @p output,
  * and @p final_time.
  *
@@ -138,16 +152,27 @@ struct RandomSimulationResult {
  * future call to MonteCarloSimulation, you should make repeated uses of the
  * same RandomGenerator object.
  *
- * @returns a list of RandomSimulationResult's.
+ * @param num_parallel_executions Number of worker threads used to run the
+ * simulations.  Each worker constructs its own Simulator (via
+ * @p make_simulator) for every sample it runs, so no Simulator, System, or
+ * Context is ever shared between threads.  When this is greater than one,
+ * @p make_simulator and @p output will be invoked concurrently and must be
+ * safe to call from multiple threads.  Use kNumParallelExecutionsAuto to
+ * use one worker per hardware thread.  Must be positive or
+ * kNumParallelExecutionsAuto.
+ *
+ * @returns a list of RandomSimulationResult's, in sample order.
+ *
+ * @throws std::exception if @p num_parallel_executions is invalid, or
+ * rethrows the first exception (in sample order) thrown by any of the
+ * simulations.
  *
  * @ingroup analysis
  */
-// TODO(russt): Consider generalizing this with options (e.g. setting the
-// number of simulators, number of samples per simulator, number of parallel
-// threads, ...).
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator = nullptr);
+    double final_time, int num_samples, RandomGenerator* generator = nullptr,
+    int num_parallel_executions = 1);
 
 }  // namespace analysis
 }  // namespace systems
@@ -1,6 +1,8 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
 #include <cmath>
+#include <stdexcept>
+#include <unordered_set>
 
 #include <gtest/gtest.h>
 
@@ -169,6 +171,56 @@ GTEST_TEST(MonteCarloSimulationTest, BasicTest) {
   }
 }
 
+// Confirm that running the samples in parallel produces exactly the same
+// results (in the same order) as running them serially.
+GTEST_TEST(MonteCarloSimulationTest, ParallelMatchesSerial) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    std::normal_distribution<> distribution;
+    auto system = std::make_unique<ConstantVectorSource<double>>(
+        distribution(*generator));
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 23;
+
+  RandomGenerator serial_generator;
+  const auto serial_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &serial_generator);
+  ASSERT_EQ(serial_results.size(), num_samples);
+
+  for (const int num_parallel_executions : {2, 4, kNumParallelExecutionsAuto}) {
+    RandomGenerator parallel_generator;
+    const auto parallel_results = MonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        &parallel_generator, num_parallel_executions);
+    ASSERT_EQ(parallel_results.size(), num_samples);
+    for (int i = 0; i < num_samples; ++i) {
+      EXPECT_EQ(parallel_results[i].output, serial_results[i].output);
+      EXPECT_EQ(parallel_results[i].generator_snapshot,
+                serial_results[i].generator_snapshot);
+    }
+    // The parent generator is advanced identically, too.
+    EXPECT_EQ(parallel_generator, serial_generator);
+  }
+
+  EXPECT_THROW(MonteCarloSimulation(make_simulator, &GetScalarOutput,
+                                    final_time, num_samples, nullptr, 0),
+               std::exception);
+}
+
+// Exceptions thrown by a simulation on a worker thread are propagated to the
+// caller.
+GTEST_TEST(MonteCarloSimulationTest, ParallelException) {
+  const SimulatorFactory make_simulator =
+      [](RandomGenerator*) -> std::unique_ptr<Simulator<double>> {
+    throw std::runtime_error("bad factory");
+  };
+  EXPECT_THROW(MonteCarloSimulation(make_simulator, &GetScalarOutput, 0.1, 8,
+                                    nullptr, 4),
+               std::runtime_error);
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
@@ -1356,6 +1356,8 @@ class UnrestrictedUpdater : public LeafSystem<double> {
     event.AddToComposite(event_info);
   }
 
+  bool DoIsNextUpdateTimePeriodic() const override { return false; }
+
   void DoCalcUnrestrictedUpdate(
       const Context<double>& context,
       const std::vector<const UnrestrictedUpdateEvent<double>*>& events,
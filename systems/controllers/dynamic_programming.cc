@@ -1,10 +1,19 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <Eigen/SparseCore>
+
 #include "drake/common/text_logging.h"
+#include "drake/common/thread_pool.h"
 #include "drake/math/wrap_to.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
@@ -20,6 +29,56 @@ DynamicProgrammingOptions::PeriodicBoundaryCondition::PeriodicBoundaryCondition(
   DRAKE_DEMAND(low_in < high_in);
 }
 
+namespace {
+
+// Runs the parallel loops of FittedValueIteration on a ThreadPool, and gives
+// each of the pool's threads an index in [0, num_threads), which selects the
+// thread's Simulator and scratch space.  The calling thread has index 0.
+class ThreadLoop {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadLoop)
+
+  explicit ThreadLoop(int num_threads) {
+    if (num_threads > 1) {
+      thread_pool_ = std::make_unique<drake::internal::ThreadPool>(num_threads);
+    }
+    thread_indices_.emplace(std::this_thread::get_id(), 0);
+  }
+
+  // Calls body(thread_index, item) for every item in [0, num_items).  Once any
+  // call throws, the remaining items are skipped, and the exception is
+  // rethrown after all of the running calls are done.
+  void ParallelFor(int num_items, const std::function<void(int, int)>& body) {
+    if (thread_pool_ == nullptr) {
+      for (int item = 0; item < num_items; ++item) {
+        body(0, item);
+      }
+      return;
+    }
+    thread_pool_->ParallelFor(num_items, [this, &body](int item) {
+      body(thread_index(), item);
+    });
+  }
+
+ private:
+  int thread_index() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int next_index = static_cast<int>(thread_indices_.size());
+    return thread_indices_.emplace(std::this_thread::get_id(), next_index)
+        .first->second;
+  }
+
+  // Null when the loops run on a single thread.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+  std::mutex mutex_;
+  std::unordered_map<std::thread::id, int> thread_indices_;
+};
+
+// The number of mesh points per work item of the parallel loops.
+constexpr int kMeshPointsPerItem = 256;
+
+}  // namespace
+
 std::pair<std::unique_ptr<BarycentricMeshSystem<double>>, Eigen::RowVectorXd>
 FittedValueIteration(
     Simulator<double>* simulator,
@@ -28,6 +87,12 @@ FittedValueIteration(
     const math::BarycentricMesh<double>::MeshGrid& input_grid, double timestep,
     const DynamicProgrammingOptions& options) {
   DRAKE_DEMAND(options.discount_factor > 0. && options.discount_factor <= 1.);
+  DRAKE_DEMAND(options.num_threads > 0);
+  if (options.num_threads > 1 && !options.simulator_factory) {
+    throw std::logic_error(
+        "FittedValueIteration requires DynamicProgrammingOptions::"
+        "simulator_factory when num_threads is greater than one");
+  }
 
   const int state_size = state_grid.size();
   const int input_size = input_grid.size();
@@ -35,7 +100,7 @@ FittedValueIteration(
   DRAKE_DEMAND(input_size > 0);
 
   const auto& system = simulator->get_system();
-  auto& context = simulator->get_mutable_context();
+  const auto& context = simulator->get_context();
 
   math::BarycentricMesh<double> state_mesh(state_grid);
   math::BarycentricMesh<double> input_mesh(input_grid);
@@ -63,38 +128,69 @@ FittedValueIteration(
     DRAKE_DEMAND(b.high <= *(state_grid[b.state_index].rbegin()));
   }
 
-  // The transition probabilities are represented as a sparse matrix,
-  // where Tind[input](:,state) is a list of non-zero indexes into the
+  // Each thread simulates with its own Simulator (and so its own Context).
+  const int num_threads = options.num_threads;
+  std::vector<std::unique_ptr<Simulator<double>>> thread_simulators;
+  std::vector<Simulator<double>*> simulators{simulator};
+  for (int i = 1; i < num_threads; ++i) {
+    thread_simulators.push_back(options.simulator_factory());
+    const Context<double>& thread_context =
+        thread_simulators.back()->get_context();
+    DRAKE_DEMAND(thread_context.has_only_continuous_state());
+    DRAKE_DEMAND(thread_context.get_continuous_state().size() == state_size);
+    DRAKE_DEMAND(thread_context.get_num_input_ports() == 1);
+    simulators.push_back(thread_simulators.back().get());
+  }
+
+  // The transition from each state mesh point under each input mesh point is
+  // first computed into the dense matrices Tind[input] and T[input], where
+  // Tind[input](:,state) is a list of (possibly repeated) indexes into the
   // state_mesh, and T[input](:,state) is the associated list of coefficients.
   // cost[input](j) is the cost of taking action input from state mesh index j.
   std::vector<Eigen::MatrixXi> Tind(num_inputs);
   std::vector<Eigen::MatrixXd> T(num_inputs);
-  std::vector<Eigen::RowVectorXd> cost(num_inputs);
-
-  drake::log()->info("Computing transition and cost matrices.");
-  auto& sim_state = context.get_mutable_continuous_state_vector();
-
-  Eigen::VectorXd input_vec(input_mesh.get_input_size());
-  Eigen::VectorXd state_vec(state_mesh.get_input_size());
-
-  Eigen::VectorXi Tind_tmp(num_state_indices);
-  Eigen::VectorXd T_tmp(num_state_indices);
-
+  std::vector<Eigen::VectorXd> cost(num_inputs);
+  Eigen::MatrixXd input_points(input_mesh.get_input_size(), num_inputs);
   for (int input = 0; input < num_inputs; input++) {
     Tind[input].resize(num_state_indices, num_states);
     T[input].resize(num_state_indices, num_states);
     cost[input].resize(num_states);
+    input_points.col(input) = input_mesh.get_mesh_point(input);
+  }
 
-    input_mesh.get_mesh_point(input, &input_vec);
-    context.FixInputPort(0, input_vec);
-
-    for (int state = 0; state < num_states; state++) {
-      context.set_time(0.0);
+  drake::log()->info("Computing transition and cost matrices.");
+  const int num_state_blocks =
+      (num_states + kMeshPointsPerItem - 1) / kMeshPointsPerItem;
+  const int64_t num_total = static_cast<int64_t>(num_states) * num_inputs;
+  std::atomic<int64_t> num_done{0};
+  // Only the calling thread reports the progress.
+  int64_t num_reported = 0;
+  // The input currently fixed in the Context of each thread.
+  std::vector<int> thread_inputs(num_threads, -1);
+  ThreadLoop thread_loop(num_threads);
+  thread_loop.ParallelFor(num_inputs * num_state_blocks,
+                          [&](int thread_index, int item) {
+    const int input = item / num_state_blocks;
+    const int begin = (item % num_state_blocks) * kMeshPointsPerItem;
+    const int end = std::min(begin + kMeshPointsPerItem, num_states);
+
+    Simulator<double>& thread_simulator = *simulators[thread_index];
+    auto& thread_context = thread_simulator.get_mutable_context();
+    if (thread_inputs[thread_index] != input) {
+      thread_context.FixInputPort(0, input_points.col(input));
+      thread_inputs[thread_index] = input;
+    }
+    auto& sim_state = thread_context.get_mutable_continuous_state_vector();
+    Eigen::VectorXd state_vec(state_mesh.get_input_size());
+    Eigen::VectorXi Tind_tmp(num_state_indices);
+    Eigen::VectorXd T_tmp(num_state_indices);
+    for (int state = begin; state < end; state++) {
+      thread_context.set_time(0.0);
       sim_state.SetFromVector(state_mesh.get_mesh_point(state));
 
-      cost[input](state) = timestep * cost_function(context);
+      cost[input](state) = timestep * cost_function(thread_context);
 
-      simulator->StepTo(timestep);
+      thread_simulator.StepTo(timestep);
       state_vec = sim_state.CopyToVector();
 
       for (const auto& b : options.periodic_boundary_conditions) {
@@ -106,51 +202,110 @@ FittedValueIteration(
       Tind[input].col(state) = Tind_tmp;
       T[input].col(state) = T_tmp;
     }
+
+    num_done += end - begin;
+    if (thread_index == 0 && options.progress_callback) {
+      num_reported = num_done;
+      options.progress_callback(num_reported, num_total);
+    }
+  });
+  if (options.progress_callback && num_reported < num_total) {
+    options.progress_callback(num_total, num_total);
   }
+
+  // Convert the transitions to sparse matrices, where the row state of
+  // Tsparse[input] holds the coefficients of the mesh points that the
+  // transition from state under input is interpolated from.
+  std::vector<Eigen::SparseMatrix<double, Eigen::RowMajor>> Tsparse(
+      num_inputs);
+  thread_loop.ParallelFor(num_inputs, [&](int, int input) {
+    auto& matrix = Tsparse[input];
+    matrix.resize(num_states, num_states);
+    matrix.reserve(num_states * num_state_indices);
+    std::vector<std::pair<int, double>> row(num_state_indices);
+    for (int state = 0; state < num_states; state++) {
+      for (int index = 0; index < num_state_indices; index++) {
+        row[index] = {Tind[input](index, state), T[input](index, state)};
+      }
+      // The entries of a row must be sorted, and without repetitions.
+      std::sort(row.begin(), row.end());
+      matrix.startVec(state);
+      for (int index = 0; index < num_state_indices;) {
+        const int column = row[index].first;
+        double coefficient = 0;
+        for (; index < num_state_indices && row[index].first == column;
+             index++) {
+          coefficient += row[index].second;
+        }
+        if (coefficient != 0) {
+          matrix.insertBack(state, column) = coefficient;
+        }
+      }
+    }
+    matrix.finalize();
+    Tind[input] = Eigen::MatrixXi();
+    T[input] = Eigen::MatrixXd();
+  });
   drake::log()->info("Done computing transition and cost matrices.");
 
   // Perform value iteration loop.
-  Eigen::RowVectorXd J = Eigen::RowVectorXd::Zero(num_states);
-  Eigen::RowVectorXd Jnext(num_states);
+  Eigen::VectorXd J = Eigen::VectorXd::Zero(num_states);
+  Eigen::VectorXd Jnext(num_states);
+  Eigen::VectorXi best_input(num_states);
   Eigen::MatrixXd Pi(input_mesh.get_input_size(), num_states);
+  auto update_policy = [&]() {
+    for (int state = 0; state < num_states; state++) {
+      Pi.col(state) = input_points.col(best_input(state));
+    }
+  };
+  std::vector<Eigen::VectorXd> thread_Q(num_threads);
 
   drake::log()->info("Running value iteration.");
   double max_diff = std::numeric_limits<double>::infinity();
   int iteration = 0;
   while (max_diff > options.convergence_tol) {
-    for (int state = 0; state < num_states; state++) {
-      Jnext(state) = std::numeric_limits<double>::infinity();
-
-      int best_input = 0;
+    thread_loop.ParallelFor(num_state_blocks, [&](int thread_index,
+                                                  int block) {
+      const int begin = block * kMeshPointsPerItem;
+      const int size = std::min(kMeshPointsPerItem, num_states - begin);
+      auto Jnext_block = Jnext.segment(begin, size);
+      auto best_input_block = best_input.segment(begin, size);
+      Eigen::VectorXd& Q = thread_Q[thread_index];
+      Jnext_block.setConstant(std::numeric_limits<double>::infinity());
+      best_input_block.setZero();
       for (int input = 0; input < num_inputs; input++) {
         // Q(x,u) = g(x,u) + γ J(f(x,u)).
-        double Q = cost[input](state);
-        for (int index = 0; index < num_state_indices; index++) {
-          Q += options.discount_factor * T[input](index, state) *
-               J(Tind[input](index, state));
-        }
+        Q.noalias() = Tsparse[input].middleRows(begin, size) * J;
+        Q = cost[input].segment(begin, size) + options.discount_factor * Q;
         // Cost-to-go: J = minᵤ Q(x,u).
         // Policy:  π(x) = argminᵤ Q(x,u).
-        if (Q < Jnext(state)) {
-          Jnext(state) = Q;
-          best_input = input;
+        for (int i = 0; i < size; i++) {
+          if (Q(i) < Jnext_block(i)) {
+            Jnext_block(i) = Q(i);
+            best_input_block(i) = input;
+          }
         }
       }
-      Pi.col(state) = input_mesh.get_mesh_point(best_input);
-    }
+    });
     max_diff = (J - Jnext).lpNorm<Eigen::Infinity>();
     J = Jnext;
     iteration++;
+    if (options.convergence_callback) {
+      options.convergence_callback(iteration, max_diff);
+    }
     if (options.visualization_callback) {
-      options.visualization_callback(iteration, state_mesh, J, Pi);
+      update_policy();
+      options.visualization_callback(iteration, state_mesh, J.transpose(), Pi);
     }
   }
   drake::log()->info("Value iteration converged to requested tolerance.");
+  update_policy();
 
   // Create the policy.
   auto policy = std::make_unique<BarycentricMeshSystem<double>>(state_mesh, Pi);
 
-  return std::make_pair(std::move(policy), J);
+  const Eigen::RowVectorXd cost_to_go = J.transpose();
+  return std::make_pair(std::move(policy), cost_to_go);
 }
 
 Eigen::VectorXd LinearProgrammingApproximateDynamicProgramming(
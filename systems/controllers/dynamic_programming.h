@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
 #include <set>
@@ -50,6 +52,35 @@ struct DynamicProgrammingOptions {
       int iteration, const math::BarycentricMesh<double>& state_mesh,
       const Eigen::RowVectorXd& cost_to_go, const Eigen::MatrixXd& policy)>
       visualization_callback{nullptr};
+
+  /// The number of threads used by FittedValueIteration to simulate the
+  /// one-step dynamics from the mesh points, and to perform the value
+  /// iteration updates.  When this is greater than one, each additional
+  /// thread simulates with its own Simulator (see simulator_factory), and
+  /// the cost function is invoked concurrently on different Contexts, so it
+  /// must be safe to call from multiple threads.
+  int num_threads{1};
+
+  /// Creates the Simulator of each additional thread of FittedValueIteration,
+  /// for a System with the same state and input sizes as the given one, and
+  /// normally with the same integrator settings as the given simulator.  It
+  /// must be callable when num_threads is greater than one; otherwise
+  /// FittedValueIteration throws std::logic_error.
+  std::function<std::unique_ptr<Simulator<double>>()> simulator_factory{
+      nullptr};
+
+  /// If callable, this method is invoked (from the calling thread) while
+  /// FittedValueIteration simulates the one-step dynamics, with the number of
+  /// (state, input) mesh point pairs done so far.  The last call has
+  /// num_done == num_total.
+  std::function<void(int64_t num_done, int64_t num_total)> progress_callback{
+      nullptr};
+
+  /// If callable, this method is invoked after each major iteration of value
+  /// iteration, with the l∞ norm of the change of the cost-to-go that is
+  /// compared against convergence_tol.
+  std::function<void(int iteration, double max_diff)> convergence_callback{
+      nullptr};
 };
 
 /// Implements Fitted Value Iteration on a (triangulated) Barycentric Mesh,
@@ -79,6 +110,12 @@ struct DynamicProgrammingOptions {
 /// @param timestep a time in seconds used for the discrete-time approximation.
 /// @param options optional DynamicProgrammingOptions structure.
 ///
+/// The transitions between the mesh points are stored as one sparse matrix
+/// per input mesh point, so that each value iteration update is a sparse
+/// matrix-vector product per input.  See
+/// DynamicProgrammingOptions::num_threads to spread the simulations and the
+/// updates over multiple threads.
+///
 /// @return a std::pair containing the resulting policy, implemented as a
 /// BarycentricMeshSystem, and the RowVectorXd J that defines the expected
 /// cost-to-go on a BarycentricMesh using @p state_grid.  The policy has a
@@ -1,11 +1,11 @@
 #include "drake/systems/controllers/linear_model_predictive_controller.h"
 
+#include <limits>
 #include <memory>
 #include <utility>
 
 #include "drake/common/eigen_types.h"
 #include "drake/solvers/solve.h"
-#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
@@ -14,12 +14,32 @@ namespace controllers {
 using solvers::VectorXDecisionVariable;
 using trajectory_optimization::DirectTranscription;
 
+namespace {
+constexpr double kInf = std::numeric_limits<double>::infinity();
+}  // namespace
+
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
     std::unique_ptr<systems::System<double>> model,
     std::unique_ptr<systems::Context<double>> base_context,
     const Eigen::MatrixXd& Q, const Eigen::MatrixXd& R, double time_period,
     double time_horizon)
+    : LinearModelPredictiveController(
+          std::move(model), std::move(base_context), Q, R, time_period,
+          time_horizon, Eigen::VectorXd::Constant(R.cols(), -kInf),
+          Eigen::VectorXd::Constant(R.cols(), kInf),
+          Eigen::VectorXd::Constant(Q.cols(), -kInf),
+          Eigen::VectorXd::Constant(Q.cols(), kInf)) {}
+
+template <typename T>
+LinearModelPredictiveController<T>::LinearModelPredictiveController(
+    std::unique_ptr<systems::System<double>> model,
+    std::unique_ptr<systems::Context<double>> base_context,
+    const Eigen::MatrixXd& Q, const Eigen::MatrixXd& R, double time_period,
+    double time_horizon, const Eigen::VectorXd& input_lower_bound,
+    const Eigen::VectorXd& input_upper_bound,
+    const Eigen::VectorXd& state_lower_bound,
+    const Eigen::VectorXd& state_upper_bound)
     : state_input_index_(
           this->DeclareVectorInputPort(BasicVector<T>(Q.cols())).get_index()),
       control_output_index_(
@@ -35,7 +55,11 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
       Q_(Q),
       R_(R),
       time_period_(time_period),
-      time_horizon_(time_horizon) {
+      time_horizon_(time_horizon),
+      input_lower_bound_(input_lower_bound),
+      input_upper_bound_(input_upper_bound),
+      state_lower_bound_(state_lower_bound),
+      state_upper_bound_(state_upper_bound) {
   DRAKE_DEMAND(time_period_ > 0.);
   DRAKE_DEMAND(time_horizon_ > 0.);
 
@@ -52,6 +76,10 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
   DRAKE_DEMAND(num_states_ > 0 && num_inputs_ > 0);
   DRAKE_DEMAND(Q.rows() == num_states_ && Q.cols() == num_states_);
   DRAKE_DEMAND(R.rows() == num_inputs_ && R.cols() == num_inputs_);
+  DRAKE_DEMAND(input_lower_bound.size() == num_inputs_ &&
+               input_upper_bound.size() == num_inputs_);
+  DRAKE_DEMAND(state_lower_bound.size() == num_states_ &&
+               state_upper_bound.size() == num_states_);
 
   // N.B. A Cholesky decomposition exists if and only if it is positive
   // semidefinite, however it turns out that Eigen's algorithm for checking this
@@ -68,49 +96,107 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
   }
+
+  qp_cache_index_ =
+      this->DeclareCacheEntry(
+              "QP", &LinearModelPredictiveController<T>::CalcQp,
+              {this->input_port_ticket(InputPortIndex(state_input_index_))})
+          .cache_index();
 }
 
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
-  const Eigen::VectorBlock<const VectorX<T>> current_state =
-      get_state_port().Eval(context);
-
-  const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+  const QpWorkspace& workspace =
+      this->get_cache_entry(qp_cache_index_).template Eval<QpWorkspace>(
+          context);
 
   const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
 
-  control->SetFromVector(current_input + input_ref);
+  control->SetFromVector(workspace.input + input_ref);
 
   // TODO(jadecastro) Implement the time-varying case.
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
+void LinearModelPredictiveController<T>::SetupQp(
+    QpWorkspace* workspace) const {
   DRAKE_DEMAND(linear_model_ != nullptr);
 
   const int kNumSampleTimes =
       static_cast<int>(time_horizon_ / time_period_ + 0.5);
 
-  DirectTranscription prog(linear_model_.get(), *base_context_,
-                           kNumSampleTimes);
+  auto prog = std::make_unique<DirectTranscription>(
+      linear_model_.get(), *base_context_, kNumSampleTimes);
+
+  const auto state_error = prog->state();
+  const auto input_error = prog->input();
+
+  prog->AddRunningCost(state_error.transpose() * Q_ * state_error +
+                       input_error.transpose() * R_ * input_error);
+
+  // The decision variables are the errors with respect to the reference
+  // point, so the bounds are shifted by it.
+  const Eigen::VectorXd state_ref =
+      base_context_->get_discrete_state().get_vector().CopyToVector();
+  const Eigen::VectorXd input_ref =
+      model_->get_input_port(0).Eval(*base_context_);
+  const bool has_input_bounds = !(input_lower_bound_.array() == -kInf).all() ||
+                                !(input_upper_bound_.array() == kInf).all();
+  const bool has_state_bounds = !(state_lower_bound_.array() == -kInf).all() ||
+                                !(state_upper_bound_.array() == kInf).all();
+  for (int i = 0; i < kNumSampleTimes; ++i) {
+    if (has_input_bounds) {
+      prog->AddBoundingBoxConstraint(input_lower_bound_ - input_ref,
+                                     input_upper_bound_ - input_ref,
+                                     prog->input(i));
+    }
+    // The initial state is the current state, which is not constrained.
+    if (has_state_bounds && i > 0) {
+      prog->AddBoundingBoxConstraint(state_lower_bound_ - state_ref,
+                                     state_upper_bound_ - state_ref,
+                                     prog->state(i));
+    }
+  }
 
-  const auto state_error = prog.state();
-  const auto input_error = prog.input();
+  // The initial state is set by CalcQp().
+  workspace->initial_state_constraint =
+      prog->AddLinearEqualityConstraint(
+              Eigen::MatrixXd::Identity(num_states_, num_states_),
+              Eigen::VectorXd::Zero(num_states_), prog->initial_state())
+          .evaluator();
+
+  workspace->osqp_solver.reset();
+  if ((has_input_bounds || has_state_bounds) &&
+      solvers::OsqpSolver::is_available()) {
+    workspace->osqp_solver = std::make_unique<solvers::OsqpSolver>();
+    workspace->osqp_solver->set_persistent_workspace(true);
+  }
+  workspace->prog = std::move(prog);
+}
 
-  prog.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                      input_error.transpose() * R_ * input_error);
+template <typename T>
+void LinearModelPredictiveController<T>::CalcQp(
+    const Context<T>& context, QpWorkspace* workspace) const {
+  if (workspace->prog == nullptr) {
+    SetupQp(workspace);
+  }
 
+  const Eigen::VectorBlock<const VectorX<T>> current_state =
+      get_state_port().Eval(context);
   const VectorX<T> state_ref =
-      base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
-
-  const auto result = Solve(prog);
+      base_context_->get_discrete_state().get_vector().CopyToVector();
+  workspace->initial_state_constraint->UpdateCoefficients(
+      Eigen::MatrixXd::Identity(num_states_, num_states_),
+      current_state - state_ref);
+
+  const solvers::MathematicalProgramResult result =
+      workspace->osqp_solver != nullptr
+          ? workspace->osqp_solver->Solve(*workspace->prog, {}, {})
+          : solvers::Solve(*workspace->prog);
   DRAKE_DEMAND(result.is_success());
 
-  return prog.GetInputSamples(result).col(0);
+  workspace->input = workspace->prog->GetInputSamples(result).col(0);
 }
 
 template class LinearModelPredictiveController<double>;
@@ -4,7 +4,9 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/solvers/osqp_solver.h"
 #include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
@@ -23,9 +25,17 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.  The inputs and the states can
+/// optionally be bounded at every time step of the horizon.
+///
+/// The QP is set up once per Context, the first time the control is
+/// evaluated, and kept in that Context's cache.  Only its initial state
+/// constraint changes from one time step to the next.  Without bounds, the QP
+/// is solved by solvers::Solve().  With bounds, it is solved by an OsqpSolver
+/// with a persistent workspace when OSQP is available, which updates the
+/// constraint bounds in place and warm starts from the solution of the
+/// previous step computed in the same Context.  A cloned Context sets up its
+/// own QP.
 ///
 /// Instantiated templates for the following kinds of T's are provided:
 ///
@@ -68,6 +78,34 @@ class LinearModelPredictiveController : public LeafSystem<T> {
       double time_horizon);
     // TODO(jadecastro) Get time_period directly from the plant model.
 
+  /// Constructor for an MPC formulation that also bounds the inputs and the
+  /// states, i.e. adds the constraints
+  ///
+  ///   @f[ u_{min} \le u(i) \le u_{max}, \quad x_{min} \le x(i) \le x_{max} @f]
+  ///
+  /// at every time step i of the horizon, except for the state at the current
+  /// time step, which is given.  The other parameters are the same as for the
+  /// unconstrained formulation above.
+  ///
+  /// @param input_lower_bound The lower bound u_min on the inputs, of size
+  /// num_inputs.  Entries may be -∞.
+  /// @param input_upper_bound The upper bound u_max on the inputs, of size
+  /// num_inputs.  Entries may be +∞.
+  /// @param state_lower_bound The lower bound x_min on the states, of size
+  /// num_states.  Entries may be -∞.
+  /// @param state_upper_bound The upper bound x_max on the states, of size
+  /// num_states.  Entries may be +∞.
+  ///
+  /// @pre The states and the input of @p base_context satisfy the bounds.
+  LinearModelPredictiveController(
+      std::unique_ptr<systems::System<double>> model,
+      std::unique_ptr<systems::Context<double>> base_context,
+      const Eigen::MatrixXd& Q, const Eigen::MatrixXd& R, double time_period,
+      double time_horizon, const Eigen::VectorXd& input_lower_bound,
+      const Eigen::VectorXd& input_upper_bound,
+      const Eigen::VectorXd& state_lower_bound,
+      const Eigen::VectorXd& state_upper_bound);
+
   const InputPort<T>& get_state_port() const {
     return this->get_input_port(state_input_index_);
   }
@@ -76,12 +114,40 @@ class LinearModelPredictiveController : public LeafSystem<T> {
   }
 
  private:
+  // The QP of one Context, kept in its cache, and its latest solution.  A
+  // copy, e.g. in a cloned Context, only copies the solution; the QP is set
+  // up again by the next CalcQp().
+  struct QpWorkspace {
+    QpWorkspace() = default;
+    QpWorkspace(const QpWorkspace& other) : input(other.input) {}
+    QpWorkspace& operator=(const QpWorkspace& other) {
+      if (this != &other) {
+        prog.reset();
+        initial_state_constraint.reset();
+        osqp_solver.reset();
+        input = other.input;
+      }
+      return *this;
+    }
+
+    std::unique_ptr<trajectory_optimization::DirectTranscription> prog;
+    // The constraint that sets the initial state to the current state error.
+    std::shared_ptr<solvers::LinearEqualityConstraint>
+        initial_state_constraint;
+    // Null unless the QP has inequality constraints and OSQP is available.
+    std::unique_ptr<solvers::OsqpSolver> osqp_solver;
+    // The first input of the solution.
+    Eigen::VectorXd input;
+  };
+
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Sets up the DirectTranscription problem of @p workspace.
+  void SetupQp(QpWorkspace* workspace) const;
+
+  // Updates the initial state of the DirectTranscription problem to the
+  // current state and solves for the current control input.
+  void CalcQp(const Context<T>& context, QpWorkspace* workspace) const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -99,8 +165,16 @@ class LinearModelPredictiveController : public LeafSystem<T> {
   const double time_period_{};
   const double time_horizon_{};
 
+  // Bounds on the inputs and the states; infinite when unbounded.
+  const Eigen::VectorXd input_lower_bound_;
+  const Eigen::VectorXd input_upper_bound_;
+  const Eigen::VectorXd state_lower_bound_;
+  const Eigen::VectorXd state_upper_bound_;
+
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  CacheIndex qp_cache_index_;
 };
 
 }  // namespace controllers
@@ -1,12 +1,16 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
 #include <cmath>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/proto/call_matlab.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/barycentric.h"
+#include "drake/systems/analysis/explicit_euler_integrator.h"
 #include "drake/systems/controllers/linear_quadratic_regulator.h"
 #include "drake/systems/primitives/integrator.h"
 #include "drake/systems/primitives/linear_system.h"
@@ -201,6 +205,161 @@ GTEST_TEST(FittedValueIteration, DoubleIntegrator) {
   }
 }
 
+// The double integrator problem above, on a coarser mesh, solved with
+// multiple threads gives the same result as with one thread, and reports its
+// progress and convergence.
+GTEST_TEST(FittedValueIteration, DoubleIntegratorThreads) {
+  Eigen::Matrix2d A;
+  A << 0., 1., 0., 0.;
+  const Eigen::Vector2d B{0., 1.};
+  LinearSystem<double> sys(A, B, Eigen::Matrix2d::Identity(),
+                           Eigen::Vector2d::Zero());
+
+  const auto cost_function = [&sys](const Context<double>& context) {
+    const Eigen::Vector2d x = context.get_continuous_state().CopyToVector();
+    const double u = sys.get_input_port().Eval(context)[0];
+    return x.dot(x) + u * u;
+  };
+
+  math::BarycentricMesh<double>::MeshGrid state_grid(2);
+  for (double x = -3.; x <= 3.; x += .5) {
+    state_grid[0].insert(x);
+  }
+  for (double xdot = -4.; xdot <= 4.; xdot += .5) {
+    state_grid[1].insert(xdot);
+  }
+  math::BarycentricMesh<double>::MeshGrid input_grid(1);
+  for (double u = -6.; u <= 6.; u += 1.) {
+    input_grid[0].insert(u);
+  }
+  const int num_states = 13 * 17;
+  const int num_inputs = 13;
+  const double timestep = .1;
+
+  Simulator<double> simulator(sys);
+  DynamicProgrammingOptions options;
+  options.discount_factor = .95;
+  const auto serial = FittedValueIteration(&simulator, cost_function,
+                                           state_grid, input_grid, timestep,
+                                           options);
+
+  int64_t last_num_done = 0;
+  int num_progress_calls = 0;
+  options.progress_callback = [&](int64_t num_done, int64_t num_total) {
+    EXPECT_GE(num_done, last_num_done);
+    EXPECT_EQ(num_total, num_states * num_inputs);
+    last_num_done = num_done;
+    ++num_progress_calls;
+  };
+  int last_iteration = 0;
+  double last_max_diff = 0;
+  options.convergence_callback = [&](int iteration, double max_diff) {
+    EXPECT_EQ(iteration, last_iteration + 1);
+    last_iteration = iteration;
+    last_max_diff = max_diff;
+  };
+  // Without a simulator_factory, only one thread can be used.
+  options.num_threads = 3;
+  EXPECT_THROW(FittedValueIteration(&simulator, cost_function, state_grid,
+                                    input_grid, timestep, options),
+               std::logic_error);
+  options.simulator_factory = [&sys]() {
+    return std::make_unique<Simulator<double>>(sys);
+  };
+  const auto parallel = FittedValueIteration(&simulator, cost_function,
+                                             state_grid, input_grid, timestep,
+                                             options);
+
+  EXPECT_TRUE(CompareMatrices(parallel.second, serial.second, 1e-6));
+  EXPECT_EQ(last_num_done, num_states * num_inputs);
+  EXPECT_GE(num_progress_calls, 1);
+  EXPECT_GT(last_iteration, 1);
+  EXPECT_LE(last_max_diff, options.convergence_tol);
+
+  // The policies agree on the mesh.
+  auto serial_context = serial.first->CreateDefaultContext();
+  auto parallel_context = parallel.first->CreateDefaultContext();
+  const math::BarycentricMesh<double> state_mesh(state_grid);
+  for (int i = 0; i < num_states; ++i) {
+    const Eigen::VectorXd x = state_mesh.get_mesh_point(i);
+    serial_context->FixInputPort(0, x);
+    parallel_context->FixInputPort(0, x);
+    EXPECT_TRUE(CompareMatrices(
+        serial.first->get_output_port().Eval(*serial_context),
+        parallel.first->get_output_port().Eval(*parallel_context)));
+  }
+
+  // An exception from another thread reaches the caller.
+  options.progress_callback = nullptr;
+  options.convergence_callback = nullptr;
+  const auto throwing_cost_function = [](const Context<double>& context) {
+    if (context.get_continuous_state()[0] > 2.) {
+      throw std::runtime_error("cost");
+    }
+    return 0.;
+  };
+  EXPECT_THROW(FittedValueIteration(&simulator, throwing_cost_function,
+                                    state_grid, input_grid, timestep, options),
+               std::runtime_error);
+}
+
+// The additional threads simulate with the Simulators of the
+// simulator_factory: with the same fixed-step integrator as the given
+// simulator, the transitions don't depend on which Simulator computes them, so
+// that any number of threads gives exactly the cost-to-go of one thread.
+GTEST_TEST(FittedValueIteration, ThreadsUseSimulatorFactory) {
+  Eigen::Matrix2d A;
+  A << 0., 1., 0., 0.;
+  const Eigen::Vector2d B{0., 1.};
+  LinearSystem<double> sys(A, B, Eigen::Matrix2d::Identity(),
+                           Eigen::Vector2d::Zero());
+
+  const auto cost_function = [&sys](const Context<double>& context) {
+    const Eigen::Vector2d x = context.get_continuous_state().CopyToVector();
+    const double u = sys.get_input_port().Eval(context)[0];
+    return x.dot(x) + u * u;
+  };
+
+  math::BarycentricMesh<double>::MeshGrid state_grid(2);
+  for (double x = -3.; x <= 3.; x += .5) {
+    state_grid[0].insert(x);
+  }
+  for (double xdot = -4.; xdot <= 4.; xdot += .5) {
+    state_grid[1].insert(xdot);
+  }
+  math::BarycentricMesh<double>::MeshGrid input_grid(1);
+  for (double u = -6.; u <= 6.; u += 1.) {
+    input_grid[0].insert(u);
+  }
+  const double timestep = .1;
+
+  const auto make_simulator = [&sys]() {
+    auto result = std::make_unique<Simulator<double>>(sys);
+    result->reset_integrator<ExplicitEulerIntegrator<double>>(
+        sys, .05, &result->get_mutable_context());
+    return result;
+  };
+  const std::unique_ptr<Simulator<double>> simulator = make_simulator();
+  DynamicProgrammingOptions options;
+  options.discount_factor = .95;
+  const Eigen::RowVectorXd serial_cost_to_go =
+      FittedValueIteration(simulator.get(), cost_function, state_grid,
+                           input_grid, timestep, options)
+          .second;
+
+  options.simulator_factory = make_simulator;
+
+  for (int num_threads : {2, 4}) {
+    options.num_threads = num_threads;
+    const Eigen::RowVectorXd parallel_cost_to_go =
+        FittedValueIteration(simulator.get(), cost_function, state_grid,
+                             input_grid, timestep, options)
+            .second;
+    EXPECT_TRUE(CompareMatrices(parallel_cost_to_go, serial_cost_to_go))
+        << num_threads << " threads";
+  }
+}
+
 // Minimum-time problem for the single integrator (which has a trivial solution,
 // that can be achieved exactly on a mesh when timestep=1).
 // ẋ = u,  u ∈ {-1,0,1}.
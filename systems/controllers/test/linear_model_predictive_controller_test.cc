@@ -1,9 +1,13 @@
 #include "drake/systems/controllers/linear_model_predictive_controller.h"
 
+#include <cmath>
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/discrete_algebraic_riccati_equation.h"
+#include "drake/solvers/osqp_solver.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -81,6 +85,71 @@ TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
                               kTolerance));
 }
 
+GTEST_TEST(TestMpcWithInputBounds, SaturatesAndWarmStarts) {
+  // The bounded QP is solved by OSQP, with warm starts.
+  if (!solvers::OsqpSolver::is_available()) {
+    return;
+  }
+  const double kTimeStep = 0.1;
+  const double kTimeHorizon = 10.;
+  const double kInputBound = 0.1;
+  const double kTolerance = 1e-5;
+
+  // The discrete double integrator of TestMpcWithDoubleIntegrator.
+  Eigen::Matrix2d A;
+  Eigen::Vector2d B;
+  A << 1, 0.1, 0, 1;
+  B << 0.005, 0.1;
+  const Eigen::Matrix2d C = Eigen::Matrix2d::Identity();
+  const Eigen::Vector2d D = Eigen::Vector2d::Zero();
+  auto system = std::make_unique<LinearSystem<double>>(A, B, C, D, kTimeStep);
+  std::unique_ptr<Context<double>> system_context =
+      system->CreateDefaultContext();
+  system_context->FixInputPort(0, Vector1d::Zero());
+  system_context->get_mutable_discrete_state(0).SetFromVector(
+      Eigen::Vector2d::Zero());
+
+  const Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+  const Vector1d R = Vector1d::Constant(1.);
+  const double kInf = std::numeric_limits<double>::infinity();
+  const LinearModelPredictiveController<double> dut(
+      std::move(system), std::move(system_context), Q, R, kTimeStep,
+      kTimeHorizon, Vector1d::Constant(-kInputBound),
+      Vector1d::Constant(kInputBound), Eigen::Vector2d::Constant(-kInf),
+      Eigen::Vector2d::Constant(kInf));
+
+  const Eigen::Matrix2d S = DiscreteAlgebraicRiccatiEquation(A, B, Q, R);
+  const Eigen::Matrix<double, 1, 2> K =
+      -(R + B.transpose() * S * B).inverse() * (B.transpose() * S * A);
+
+  auto context = dut.CreateDefaultContext();
+  auto calc_control = [&dut](Context<double>* dut_context,
+                             const Eigen::Vector2d& x) {
+    dut_context->FixInputPort(0, x);
+    return dut.get_control_port().Eval(*dut_context)[0];
+  };
+
+  // Near the origin the bound is inactive, and the control is the LQR one.
+  const Eigen::Vector2d x_near(0.01, 0.01);
+  ASSERT_LT(std::abs(K * x_near), kInputBound);
+  EXPECT_NEAR(calc_control(context.get(), x_near), K * x_near, kTolerance);
+
+  // Far from the origin the LQR control exceeds the bound, so it saturates.
+  const Eigen::Vector2d x_far(1., 1.);
+  ASSERT_GT(std::abs(K * x_far), kInputBound);
+  const double u_far = calc_control(context.get(), x_far);
+  EXPECT_NEAR(std::abs(u_far), kInputBound, kTolerance);
+  EXPECT_EQ(u_far > 0, K * x_far > 0);
+
+  // The warm started solves agree with the cold ones of a fresh Context and
+  // of a cloned Context.
+  auto fresh_context = dut.CreateDefaultContext();
+  EXPECT_NEAR(calc_control(fresh_context.get(), x_far), u_far, kTolerance);
+  auto cloned_context = context->Clone();
+  EXPECT_NEAR(calc_control(cloned_context.get(), x_near), K * x_near,
+              kTolerance);
+}
+
 namespace {
 
 // A discrete-time cubic polynomial system.
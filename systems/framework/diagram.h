@@ -14,8 +14,10 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/symbolic.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/thread_pool.h"
 #include "drake/systems/framework/diagram_context.h"
 #include "drake/systems/framework/diagram_continuous_state.h"
 #include "drake/systems/framework/diagram_discrete_values.h"
@@ -67,6 +69,68 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     return result;
   }
 
+  /// (Advanced) Enables or disables periodic event scheduling, which is
+  /// disabled by default.
+  ///
+  /// By default, CalcNextUpdateTime() queries every subsystem for its next
+  /// update time. With periodic event scheduling enabled, the subsystems for
+  /// which System::IsNextUpdateTimePeriodic() is true are not queried on
+  /// every call. Instead, the periodic events of the subsystems are grouped by
+  /// timing (period and offset) when this %Diagram is built, the next time of
+  /// each distinct timing is computed, and only the subsystems with an event
+  /// at the earliest of those times are queried. All other subsystems are
+  /// queried on every call. Since IsNextUpdateTimePeriodic() of a subsystem
+  /// may change from false to true once it has been queried (see
+  /// LeafSystem::DoIsNextUpdateTimePeriodic()), it is checked on every call. The update times and events reported by
+  /// CalcNextUpdateTime() are identical in both modes. Enabling this reduces
+  /// the cost of CalcNextUpdateTime() for Diagrams with many periodic
+  /// subsystems that share few distinct timings.
+  void set_periodic_event_scheduling(bool enabled) {
+    periodic_event_scheduling_ = enabled;
+  }
+
+  /// Returns true if periodic event scheduling is enabled.
+  /// See set_periodic_event_scheduling().
+  bool get_periodic_event_scheduling() const {
+    return periodic_event_scheduling_;
+  }
+
+  /// (Advanced) Sets the number of threads used to evaluate the subsystems of
+  /// this %Diagram, which is one (i.e., serial evaluation) by default.
+  ///
+  /// When this %Diagram is built, its subsystems are partitioned into
+  /// independent groups: two subsystems are in the same group if an input
+  /// port of one is connected to an output port of the other, directly or
+  /// through other subsystems. The subsystems that have an input port
+  /// exported as an input port of this %Diagram are all in one group. With
+  /// more than one thread, CalcTimeDerivatives(), CalcDiscreteVariableUpdates()
+  /// and CalcUnrestrictedUpdate() evaluate the groups concurrently, and the
+  /// subsystems within each group serially in their usual order. The output
+  /// ports and cache entries that a subsystem evaluates on demand are then
+  /// those of its own group only, so concurrent evaluations never touch the
+  /// same subcontext and the results are identical to serial evaluation.
+  /// A typical use is a %Diagram that simulates many robots, each a separate
+  /// plant and controller.
+  ///
+  /// @warning Only use this if subsystems in different groups do not share
+  /// mutable state outside of their Contexts, e.g. a shared LCM interface.
+  /// Publish events are always dispatched serially.
+  /// @throws std::exception if @p num_threads is less than one.
+  void set_subsystem_evaluation_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads > 0);
+    if (num_threads == 1) {
+      thread_pool_.reset();
+    } else {
+      thread_pool_ = std::make_unique<drake::internal::ThreadPool>(num_threads);
+    }
+  }
+
+  /// Returns the number of threads used to evaluate the subsystems of this
+  /// %Diagram. See set_subsystem_evaluation_threads().
+  int get_subsystem_evaluation_threads() const {
+    return thread_pool_ ? thread_pool_->num_threads() : 1;
+  }
+
   std::multimap<int, int> GetDirectFeedthroughs() const final {
     std::multimap<int, int> pairs;
     for (InputPortIndex u(0); u < this->get_num_input_ports(); ++u) {
@@ -279,12 +343,12 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     DRAKE_DEMAND(num_subsystems() == n);
 
     // Evaluate the derivatives of each constituent system.
-    for (SubsystemIndex i(0); i < n; ++i) {
+    ForEachSubsystem([&](SubsystemIndex i) {
       const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
       ContinuousState<T>& subderivatives =
           diagram_derivatives->get_mutable_substate(i);
       registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
-    }
+    });
   }
 
   /// Retrieves a reference to the subsystem with name @p name returned by
@@ -875,6 +939,11 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     DRAKE_DEMAND(diagram_context != nullptr);
     DRAKE_DEMAND(info != nullptr);
 
+    if (periodic_event_scheduling_) {
+      CalcNextUpdateTimeWithPeriodicScheduling(*diagram_context, info, time);
+      return;
+    }
+
     *time = std::numeric_limits<double>::infinity();
 
     // Iterate over the subsystems, and harvest the most imminent updates.
@@ -900,6 +969,16 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     }
   }
 
+  /// Returns true if DoIsNextUpdateTimePeriodic() is true for all the
+  /// subsystems.
+  bool DoIsNextUpdateTimePeriodic() const override {
+    if (!aperiodic_subsystems_.empty()) return false;
+    for (const SubsystemIndex i : subsystems_with_periodic_events_) {
+      if (!registered_systems_[i]->IsNextUpdateTimePeriodic()) return false;
+    }
+    return true;
+  }
+
  private:
   std::unique_ptr<AbstractValue> DoAllocateInput(
       const InputPort<T>& input_port) const final {
@@ -1134,7 +1213,7 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
         dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
             event_info);
 
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    ForEachSubsystem([&](SubsystemIndex i) {
       const EventCollection<DiscreteUpdateEvent<T>>& subinfo =
           info.get_subevent_collection(i);
 
@@ -1146,7 +1225,7 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
         registered_systems_[i]->CalcDiscreteVariableUpdates(subcontext, subinfo,
                                                             &subdiscrete);
       }
-    }
+    });
   }
 
   // For each subsystem, if there is an unrestricted update event in its
@@ -1168,7 +1247,7 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
         dynamic_cast<const DiagramEventCollection<UnrestrictedUpdateEvent<T>>&>(
             event_info);
 
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    ForEachSubsystem([&](SubsystemIndex i) {
       const EventCollection<UnrestrictedUpdateEvent<T>>& subinfo =
           info.get_subevent_collection(i);
 
@@ -1179,7 +1258,7 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
         registered_systems_[i]->CalcUnrestrictedUpdate(subcontext, subinfo,
             &substate);
       }
-    }
+    });
   }
 
   // Tries to recursively find @p target_system's BaseStuff
@@ -1449,6 +1528,55 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
           system->get_system_scalar_converter());
     }
 
+    // Group the periodic events of the subsystems by timing, for periodic
+    // event scheduling.
+    std::map<PeriodicEventData, std::vector<SubsystemIndex>,
+             PeriodicEventDataComparator> periodic_timings;
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      const auto periodic_events = registered_systems_[i]->GetPeriodicEvents();
+      if (periodic_events.empty()) {
+        aperiodic_subsystems_.push_back(i);
+        continue;
+      }
+      subsystems_with_periodic_events_.push_back(i);
+      for (const auto& timing_events : periodic_events) {
+        periodic_timings[timing_events.first].push_back(i);
+      }
+    }
+    periodic_timings_.assign(periodic_timings.begin(), periodic_timings.end());
+
+    // Partition the subsystems into independent groups for concurrent
+    // evaluation. See set_subsystem_evaluation_threads().
+    std::vector<int> group_root(num_subsystems());
+    for (int i = 0; i < num_subsystems(); ++i) group_root[i] = i;
+    auto find_root = [&group_root](int i) {
+      while (group_root[i] != i) {
+        group_root[i] = group_root[group_root[i]];
+        i = group_root[i];
+      }
+      return i;
+    };
+    auto join = [&](const System<T>* a, const System<T>* b) {
+      const int root_a = find_root(GetSystemIndexOrAbort(a));
+      const int root_b = find_root(GetSystemIndexOrAbort(b));
+      group_root[std::max(root_a, root_b)] = std::min(root_a, root_b);
+    };
+    for (const auto& edge : connection_map_) {
+      join(edge.first.first, edge.second.first);
+    }
+    for (const InputPortLocator& id : input_port_ids_) {
+      join(input_port_ids_.front().first, id.first);
+    }
+    std::map<int, int> group_of_root;
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      const int root = find_root(i);
+      if (group_of_root.count(root) == 0) {
+        group_of_root[root] = static_cast<int>(subsystem_groups_.size());
+        subsystem_groups_.emplace_back();
+      }
+      subsystem_groups_[group_of_root[root]].push_back(i);
+    }
+
     this->set_forced_publish_events(
         AllocateForcedEventCollection<PublishEvent<T>>(
             &System<T>::AllocateForcedPublishEventCollection));
@@ -1460,6 +1588,104 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
             &System<T>::AllocateForcedUnrestrictedUpdateEventCollection));
   }
 
+  // Calls @p calc for every subsystem index. With more than one subsystem
+  // evaluation thread, the groups in subsystem_groups_ are processed
+  // concurrently; otherwise, the subsystems are visited in order.
+  void ForEachSubsystem(const std::function<void(SubsystemIndex)>& calc) const {
+    if (thread_pool_ == nullptr || subsystem_groups_.size() == 1) {
+      for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+        calc(i);
+      }
+      return;
+    }
+    thread_pool_->ParallelFor(
+        static_cast<int>(subsystem_groups_.size()), [&](int group) {
+          for (const SubsystemIndex i : subsystem_groups_[group]) {
+            calc(i);
+          }
+        });
+  }
+
+  // Implements DoCalcNextUpdateTime() when periodic event scheduling is
+  // enabled. See set_periodic_event_scheduling().
+  void CalcNextUpdateTimeWithPeriodicScheduling(
+      const DiagramContext<T>& diagram_context,
+      DiagramCompositeEventCollection<T>* info, T* time) const {
+    using std::min;
+    const T& current_time = diagram_context.get_time();
+
+    // The subsystems with periodic events whose update times are not (yet)
+    // periodic are queried like those without periodic events.
+    std::vector<bool> is_periodic(num_subsystems(), false);
+    std::vector<SubsystemIndex> aperiodic_subsystems = aperiodic_subsystems_;
+    for (const SubsystemIndex i : subsystems_with_periodic_events_) {
+      if (registered_systems_[i]->IsNextUpdateTimePeriodic()) {
+        is_periodic[i] = true;
+      } else {
+        aperiodic_subsystems.push_back(i);
+      }
+    }
+
+    // The earliest of the next times of the periodic event timings that have
+    // a periodic subsystem.
+    T periodic_time = std::numeric_limits<double>::infinity();
+    for (const auto& timing_subsystems : periodic_timings_) {
+      const std::vector<SubsystemIndex>& subsystems = timing_subsystems.second;
+      if (std::none_of(subsystems.begin(), subsystems.end(),
+                       [&is_periodic](SubsystemIndex i) {
+                         return is_periodic[i];
+                       })) {
+        continue;
+      }
+      periodic_time = min(periodic_time, internal::GetNextSampleTime(
+          timing_subsystems.first, current_time));
+    }
+    *time = periodic_time;
+
+    // Query the subsystems whose update times are not periodic.
+    std::vector<T> aperiodic_times(aperiodic_subsystems.size());
+    for (size_t k = 0; k < aperiodic_subsystems.size(); ++k) {
+      const SubsystemIndex i = aperiodic_subsystems[k];
+      const Context<T>& subcontext = diagram_context.GetSubsystemContext(i);
+      CompositeEventCollection<T>& subinfo =
+          info->get_mutable_subevent_collection(i);
+      aperiodic_times[k] =
+          registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
+      if (aperiodic_times[k] < *time) {
+        *time = aperiodic_times[k];
+      }
+    }
+    for (size_t k = 0; k < aperiodic_subsystems.size(); ++k) {
+      if (aperiodic_times[k] > *time) {
+        info->get_mutable_subevent_collection(aperiodic_subsystems[k])
+            .Clear();
+      }
+    }
+
+    // Query the subsystems with a periodic event at *time, which report their
+    // events at that time. The event collections of all other periodic
+    // subsystems are left empty, as cleared by CalcNextUpdateTime() on entry.
+    if (periodic_time > *time) return;
+    for (const auto& timing_subsystems : periodic_timings_) {
+      if (internal::GetNextSampleTime(timing_subsystems.first,
+                                      current_time) > *time) {
+        continue;
+      }
+      for (const SubsystemIndex i : timing_subsystems.second) {
+        if (!is_periodic[i]) continue;
+        CompositeEventCollection<T>& subinfo =
+            info->get_mutable_subevent_collection(i);
+        // A subsystem with more than one timing due at *time only needs to be
+        // queried once.
+        if (subinfo.HasEvents()) continue;
+        const Context<T>& subcontext = diagram_context.GetSubsystemContext(i);
+        const T sub_time =
+            registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
+        DRAKE_ASSERT(sub_time == *time);
+      }
+    }
+  }
+
   // Exposes the given port as an input of the Diagram.
   void ExportInput(const InputPortLocator& port, std::string name) {
     const System<T>* const sys = port.first;
@@ -1586,6 +1812,31 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   std::vector<InputPortLocator> input_port_ids_;
   std::vector<OutputPortLocator> output_port_ids_;
 
+  // Whether periodic event scheduling is enabled. See
+  // set_periodic_event_scheduling().
+  bool periodic_event_scheduling_{false};
+
+  // The distinct timings of the periodic events of the subsystems, each with
+  // the subsystems that have at least one event with that timing.
+  std::vector<std::pair<PeriodicEventData, std::vector<SubsystemIndex>>>
+      periodic_timings_;
+
+  // The subsystems that have periodic events, whose next update times are
+  // periodic if System::IsNextUpdateTimePeriodic() is true.
+  std::vector<SubsystemIndex> subsystems_with_periodic_events_;
+
+  // The subsystems without periodic events, which are queried on every call
+  // to DoCalcNextUpdateTime().
+  std::vector<SubsystemIndex> aperiodic_subsystems_;
+
+  // The subsystems partitioned into groups that no connection crosses, each
+  // in increasing order. See set_subsystem_evaluation_threads().
+  std::vector<std::vector<SubsystemIndex>> subsystem_groups_;
+
+  // The threads that evaluate subsystem_groups_ concurrently, or nullptr for
+  // serial evaluation. See set_subsystem_evaluation_threads().
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
@@ -1596,8 +1847,17 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   template <typename> friend class Diagram;
 };
 
+// A Diagram supports the fixed-size autodiff scalar types when all of its
+// subsystems do.
+namespace scalar_conversion {
+template <>
+struct FixedSizeAutoDiffTraits<Diagram> : std::true_type {};
+}  // namespace scalar_conversion
+
 }  // namespace systems
 }  // namespace drake
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::systems::Diagram)
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS(
+    class ::drake::systems::Diagram)
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <utility>
 
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/value.h"
 #include "drake/systems/framework/context.h"
@@ -79,6 +81,43 @@ class PeriodicEventData : public EventData {
   double offset_sec_{0.0};
 };
 
+/** @cond */
+namespace internal {
+
+// Returns the next sample time for the given @p attribute, i.e., the first
+// time strictly greater than @p current_time_sec at which an event with this
+// timing occurs.
+template <typename T>
+T GetNextSampleTime(
+    const PeriodicEventData& attribute,
+    const T& current_time_sec) {
+  const double period = attribute.period_sec();
+  DRAKE_ASSERT(period > 0);
+  const double offset = attribute.offset_sec();
+  DRAKE_ASSERT(offset >= 0);
+
+  // If the first sample time hasn't arrived yet, then that is the next
+  // sample time.
+  if (current_time_sec < offset) {
+    return offset;
+  }
+
+  // Compute the index in the sequence of samples for the next time to sample,
+  // which should be greater than the present time.
+  using std::ceil;
+  const T offset_time = current_time_sec - offset;
+  const T next_k = ceil(offset_time / period);
+  T next_t = offset + next_k * period;
+  if (next_t <= current_time_sec) {
+    next_t = offset + (next_k + 1) * period;
+  }
+  DRAKE_ASSERT(next_t > current_time_sec);
+  return next_t;
+}
+
+}  // namespace internal
+/** @endcond */
+
 /**
  * Class for storing data from a witness function triggering to be passed
  * to event handlers. A witness function isolates the time to a (typically
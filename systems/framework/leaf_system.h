@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <map>
@@ -37,43 +38,6 @@
 namespace drake {
 namespace systems {
 
-/** @cond */
-// Private helper functions for LeafSystem.
-namespace leaf_system_detail {
-
-// Returns the next sample time for the given @p attribute.
-template <typename T>
-static T GetNextSampleTime(
-    const PeriodicEventData& attribute,
-    const T& current_time_sec) {
-  const double period = attribute.period_sec();
-  DRAKE_ASSERT(period > 0);
-  const double offset = attribute.offset_sec();
-  DRAKE_ASSERT(offset >= 0);
-
-  // If the first sample time hasn't arrived yet, then that is the next
-  // sample time.
-  if (current_time_sec < offset) {
-    return offset;
-  }
-
-  // Compute the index in the sequence of samples for the next time to sample,
-  // which should be greater than the present time.
-  using std::ceil;
-  const T offset_time = current_time_sec - offset;
-  const T next_k = ceil(offset_time / period);
-  T next_t = offset + next_k * period;
-  if (next_t <= current_time_sec) {
-    next_t = offset + (next_k + 1) * period;
-  }
-  DRAKE_ASSERT(next_t > current_time_sec);
-  return next_t;
-}
-
-}  // namespace leaf_system_detail
-/** @endcond */
-
-
 /// A superclass template that extends System with some convenience utilities
 /// that are not applicable to Diagrams.
 ///
@@ -391,9 +355,13 @@ class LeafSystem : public System<T> {
   ///          cause simulations of systems derived from %LeafSystem to loop
   ///          interminably. Such a loop will occur if, for example, the
   ///          event(s) does not modify the state.
+  /// @warning If your override invokes this implementation and also reports
+  ///          other events, you must also override
+  ///          DoIsNextUpdateTimePeriodic() to return false.
   void DoCalcNextUpdateTime(const Context<T>& context,
                             CompositeEventCollection<T>* events,
                             T* time) const override {
+    default_next_update_time_calculated_.store(true, std::memory_order_relaxed);
     T min_time = std::numeric_limits<double>::infinity();
 
     if (periodic_events_.empty()) {
@@ -408,7 +376,7 @@ class LeafSystem : public System<T> {
       const PeriodicEventData& event_data = event_pair.first;
       const Event<T>* const event = event_pair.second.get();
       const T t =
-          leaf_system_detail::GetNextSampleTime(event_data, context.get_time());
+          internal::GetNextSampleTime(event_data, context.get_time());
       if (t < min_time) {
         min_time = t;
         next_events = {event};
@@ -424,6 +392,18 @@ class LeafSystem : public System<T> {
     }
   }
 
+  /// Returns true if this system has declared periodic events and the
+  /// default implementation of DoCalcNextUpdateTime(), which only reports
+  /// those, has been invoked at least once. Until then, this returns false, so
+  /// that an override of DoCalcNextUpdateTime() that never invokes the default
+  /// implementation always has its update times queried. Subclasses whose
+  /// override invokes the default implementation and also reports other
+  /// events must override this method to return false.
+  bool DoIsNextUpdateTimePeriodic() const override {
+    return !periodic_events_.empty() &&
+        default_next_update_time_calculated_.load(std::memory_order_relaxed);
+  }
+
   /// Emits a graphviz fragment for this System. Leaf systems are visualized as
   /// records. For instance, a leaf system with 2 inputs and 1 output is:
   ///
@@ -2574,6 +2554,11 @@ class LeafSystem : public System<T> {
                         std::unique_ptr<Event<T>>>>
       periodic_events_;
 
+  // Whether the default implementation of DoCalcNextUpdateTime() has been
+  // invoked, i.e., whether it is not overridden or the override invokes it.
+  // See DoIsNextUpdateTimePeriodic().
+  mutable std::atomic<bool> default_next_update_time_calculated_{false};
+
   // Update or Publish events registered on this system for every simulator
   // major time step.
   LeafCompositeEventCollection<T> per_step_events_;
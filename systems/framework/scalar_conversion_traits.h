@@ -87,6 +87,34 @@ struct FromDoubleTraits {
     std::true_type, std::false_type>::type;
 };
 
+/// A templated traits class for whether the `S<T>::S(const S<double>&)`
+/// scalar-conversion copy constructor should be used to convert into the
+/// fixed-size autodiff scalar types, i.e., drake::AutoDiffd<N> for the sizes
+/// listed by
+/// DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS.
+///
+/// Unlike the default scalar types, which are supported unless Traits says
+/// otherwise, these are opt-in: only a System that is instantiated on them
+/// should enable them, by specializing this struct as follows:
+///
+/// @code
+/// namespace drake {
+/// namespace systems {
+/// namespace scalar_conversion {
+/// template <> struct FixedSizeAutoDiffTraits<MySystem> : std::true_type {};
+/// }  // namespace scalar_conversion
+/// }  // namespace systems
+/// }  // namespace drake
+/// @endcode
+///
+/// Code that differentiates a System<double> in a few directions (e.g.,
+/// Linearize()) uses these scalar types when the System supports them, and
+/// falls back to drake::AutoDiffXd otherwise.
+///
+/// @tparam S is the scalar-templated type to copy
+template <template <typename> class S>
+struct FixedSizeAutoDiffTraits : std::false_type {};
+
 }  // namespace scalar_conversion
 }  // namespace systems
 }  // namespace drake
@@ -792,6 +792,17 @@ class System : public SystemBase {
     return time;
   }
 
+  /// (Advanced) Returns true if the next update time and the events reported
+  /// by CalcNextUpdateTime() are fully determined by the context time and the
+  /// periodic events of this System, as reported by GetPeriodicEvents(). A
+  /// Diagram with periodic event scheduling enabled (see
+  /// Diagram::set_periodic_event_scheduling()) only queries such subsystems
+  /// when one of their periodic events is due. The result may change from
+  /// false to true once this System has been queried, but never the other way.
+  bool IsNextUpdateTimePeriodic() const {
+    return DoIsNextUpdateTimePeriodic();
+  }
+
   /// This method is called by Simulator::Initialize() to gather all
   /// update and publish events that are to be handled in StepTo() at the point
   /// before Simulator integrates continuous state. It is assumed that these
@@ -1822,6 +1833,14 @@ class System : public SystemBase {
     *time = std::numeric_limits<double>::infinity();
   }
 
+  /// Override this method to return true if DoCalcNextUpdateTime() only
+  /// reports this System's periodic events. See IsNextUpdateTimePeriodic().
+  ///
+  /// The default implementation returns false, which is always correct but
+  /// means that a Diagram will query this System on every call to
+  /// CalcNextUpdateTime().
+  virtual bool DoIsNextUpdateTimePeriodic() const { return false; }
+
   /// Implement this method to return all periodic triggered events.
   /// @see GetPeriodicEvents() for a detailed description of the returned
   ///      variable.
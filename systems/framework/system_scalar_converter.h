@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <sstream>
+#include <type_traits>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
@@ -65,6 +66,10 @@ class SystemScalarConverter {
   /// conversions, or after construction may call Add<T, U>() on the returned
   /// object to enable support for additional custom types.
   ///
+  /// In addition, systems that specialize
+  /// scalar_conversion::FixedSizeAutoDiffTraits can be converted from double
+  /// into the fixed-size autodiff types drake::AutoDiffd<N>.
+  ///
   /// @tparam S is the System type to convert
   ///
   /// This an implicit conversion constructor (not marked `explicit`), in order
@@ -112,6 +117,11 @@ class SystemScalarConverter {
     // From Expression to all other types.
     AddIfSupported<S, double,     Expression>(subtype_preservation);
     AddIfSupported<S, AutoDiffXd, Expression>(subtype_preservation);
+    // From double to the opt-in fixed-size autodiff types.
+    AddFixedSizeAutoDiffIfSupported<S>(
+        subtype_preservation,
+        std::integral_constant<
+            bool, scalar_conversion::FixedSizeAutoDiffTraits<S>::value>{});
   }
 
   /// Returns true iff no conversions are supported.  (In other words, whether
@@ -172,6 +182,20 @@ class SystemScalarConverter {
   template <template <typename> class S, typename T, typename U>
   void AddIfSupported(GuaranteedSubtypePreservation subtype_preservation);
 
+  // Adds the conversions from double to the fixed-size autodiff types; see
+  // scalar_conversion::FixedSizeAutoDiffTraits.  N.B. The sizes must match
+  // DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS.
+  template <template <typename> class S>
+  void AddFixedSizeAutoDiffIfSupported(
+      GuaranteedSubtypePreservation subtype_preservation, std::true_type) {
+    AddIfSupported<S, AutoDiffd<4>,  double>(subtype_preservation);
+    AddIfSupported<S, AutoDiffd<8>,  double>(subtype_preservation);
+    AddIfSupported<S, AutoDiffd<16>, double>(subtype_preservation);
+  }
+  template <template <typename> class S>
+  void AddFixedSizeAutoDiffIfSupported(GuaranteedSubtypePreservation,
+                                       std::false_type) {}
+
   // Given typeid(T), typeid(U), returns a converter.  If no converter has been
   // added yet, returns nullptr.
   const ErasedConverterFunc* Find(
@@ -1,5 +1,8 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <limits>
+#include <vector>
+
 #include <Eigen/Dense>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -2529,9 +2532,9 @@ class MyEventTestSystem : public LeafSystem<double> {
  public:
   // If p > 0, declares a periodic publish event with p. Otherwise, declares
   // a per step publish event.
-  MyEventTestSystem(const std::string& name, double p) {
+  MyEventTestSystem(const std::string& name, double p, double offset = 0) {
     if (p > 0) {
-      DeclarePeriodicPublish(p);
+      DeclarePeriodicPublish(p, offset);
 
       // Verify that no periodic discrete updates are registered.
       EXPECT_FALSE(this->GetUniquePeriodicDiscreteUpdateAttribute());
@@ -2638,6 +2641,250 @@ GTEST_TEST(MyEventTest, MyEventTestDiagram) {
   EXPECT_EQ(sys[4]->get_per_step_count(), 1);
 }
 
+// A system that publishes at each of a list of times, which it schedules by
+// overriding DoCalcNextUpdateTime(). It doesn't override
+// DoIsNextUpdateTimePeriodic(); since it has no periodic events, LeafSystem
+// must not report it as periodic.
+// A system that publishes at the given alarm times. If `period` is positive,
+// it also declares a periodic publish, which its DoCalcNextUpdateTime()
+// override never reports.
+class AlarmTestSystem : public LeafSystem<double> {
+ public:
+  explicit AlarmTestSystem(const std::vector<double>& alarm_times,
+                           double period = 0)
+      : alarm_times_(alarm_times) {
+    set_name("alarm");
+    if (period > 0) this->DeclarePeriodicPublish(period);
+  }
+
+  int get_count() const { return count_; }
+
+ private:
+  void DoCalcNextUpdateTime(const Context<double>& context,
+                            CompositeEventCollection<double>* events,
+                            double* time) const override {
+    *time = std::numeric_limits<double>::infinity();
+    for (double alarm_time : alarm_times_) {
+      if (alarm_time > context.get_time()) {
+        *time = alarm_time;
+        PublishEvent<double> event(TriggerType::kTimed);
+        event.AddToComposite(events);
+        return;
+      }
+    }
+  }
+
+  void DoPublish(
+      const Context<double>& context,
+      const std::vector<const PublishEvent<double>*>& events) const override {
+    count_ += static_cast<int>(events.size());
+  }
+
+  const std::vector<double> alarm_times_;
+  mutable int count_{0};
+};
+
+// Builds a diagram of MyEventTestSystem with different periods and offsets,
+// including a sub diagram, and an AlarmTestSystem whose alarms coincide with
+// some of the periodic events. The AlarmTestSystem also declares a periodic
+// publish, so its alarms are only reported if it is queried on every call.
+std::unique_ptr<Diagram<double>> MakePeriodicEventSchedulingDiagram(
+    bool periodic_event_scheduling,
+    std::vector<const MyEventTestSystem*>* periodic_systems,
+    const AlarmTestSystem** alarm) {
+  std::unique_ptr<Diagram<double>> sub_diagram;
+  {
+    DiagramBuilder<double> builder;
+    periodic_systems->push_back(
+        builder.AddSystem<MyEventTestSystem>("sub0", 0.1));
+    periodic_systems->push_back(
+        builder.AddSystem<MyEventTestSystem>("sub1", 0.2, 0.1));
+    sub_diagram = builder.Build();
+    sub_diagram->set_name("sub_diagram");
+    sub_diagram->set_periodic_event_scheduling(periodic_event_scheduling);
+  }
+  DiagramBuilder<double> builder;
+  builder.AddSystem(std::move(sub_diagram));
+  periodic_systems->push_back(
+      builder.AddSystem<MyEventTestSystem>("sys0", 0.1));
+  periodic_systems->push_back(
+      builder.AddSystem<MyEventTestSystem>("sys1", 0.1));
+  periodic_systems->push_back(
+      builder.AddSystem<MyEventTestSystem>("sys2", 0.25, 0.05));
+  periodic_systems->push_back(
+      builder.AddSystem<MyEventTestSystem>("sys3", 0.3));
+  *alarm = builder.AddSystem<AlarmTestSystem>(
+      std::vector<double>{0.05, 0.12, 0.3, 0.71}, 0.1);
+  auto diagram = builder.Build();
+  diagram->set_periodic_event_scheduling(periodic_event_scheduling);
+  return diagram;
+}
+
+// Verifies that a diagram with periodic event scheduling reports the same
+// update times and events as one without.
+GTEST_TEST(PeriodicEventSchedulingTest, SameEventsAsWithoutScheduling) {
+  std::vector<const MyEventTestSystem*> expected_systems;
+  const AlarmTestSystem* expected_alarm{};
+  auto expected_diagram = MakePeriodicEventSchedulingDiagram(
+      false, &expected_systems, &expected_alarm);
+  EXPECT_FALSE(expected_diagram->get_periodic_event_scheduling());
+
+  std::vector<const MyEventTestSystem*> systems;
+  const AlarmTestSystem* alarm{};
+  auto dut = MakePeriodicEventSchedulingDiagram(true, &systems, &alarm);
+  EXPECT_TRUE(dut->get_periodic_event_scheduling());
+
+  // No subsystem has been queried yet, so none is known to be periodic.
+  const auto& sub_diagram = dynamic_cast<const Diagram<double>&>(
+      dut->GetSubsystemByName("sub_diagram"));
+  EXPECT_FALSE(sub_diagram.IsNextUpdateTimePeriodic());
+  EXPECT_FALSE(systems[0]->IsNextUpdateTimePeriodic());
+  EXPECT_FALSE(alarm->IsNextUpdateTimePeriodic());
+  EXPECT_FALSE(dut->IsNextUpdateTimePeriodic());
+
+  auto expected_context = expected_diagram->CreateDefaultContext();
+  auto expected_events = expected_diagram->AllocateCompositeEventCollection();
+  auto context = dut->CreateDefaultContext();
+  auto events = dut->AllocateCompositeEventCollection();
+  for (int step = 0; step < 30; ++step) {
+    const double expected_time = expected_diagram->CalcNextUpdateTime(
+        *expected_context, expected_events.get());
+    const double time = dut->CalcNextUpdateTime(*context, events.get());
+    ASSERT_EQ(time, expected_time);
+
+    expected_context->set_time(expected_time);
+    expected_diagram->Publish(*expected_context,
+                              expected_events->get_publish_events());
+    context->set_time(time);
+    dut->Publish(*context, events->get_publish_events());
+    for (size_t i = 0; i < systems.size(); ++i) {
+      EXPECT_EQ(systems[i]->get_periodic_count(),
+                expected_systems[i]->get_periodic_count());
+    }
+    EXPECT_EQ(alarm->get_count(), expected_alarm->get_count());
+
+    // Once queried, the sub diagram only has periodic systems, but the alarm
+    // overrides DoCalcNextUpdateTime() and is never periodic.
+    EXPECT_TRUE(sub_diagram.IsNextUpdateTimePeriodic());
+    EXPECT_TRUE(systems[0]->IsNextUpdateTimePeriodic());
+    EXPECT_FALSE(alarm->IsNextUpdateTimePeriodic());
+    EXPECT_FALSE(dut->IsNextUpdateTimePeriodic());
+  }
+  EXPECT_EQ(alarm->get_count(), 4);
+  // sub0 has a shorter period than sub1.
+  EXPECT_GT(systems[0]->get_periodic_count(), systems[1]->get_periodic_count());
+}
+
+// Verifies that a LeafSystem is only reported as periodic when it has declared
+// periodic events and the default DoCalcNextUpdateTime() has been invoked, and
+// that a Diagram is periodic only if all of its subsystems are.
+GTEST_TEST(PeriodicEventSchedulingTest, LeafSystemPeriodicity) {
+  const ZeroOrderHold<double> hold(0.1, 1);
+  const Gain<double> gain(2.0, 1);
+  const AlarmTestSystem alarm({0.5}, 0.1);
+  EXPECT_FALSE(hold.IsNextUpdateTimePeriodic());
+  EXPECT_FALSE(gain.IsNextUpdateTimePeriodic());
+  EXPECT_FALSE(alarm.IsNextUpdateTimePeriodic());
+
+  for (const System<double>* system :
+       std::vector<const System<double>*>{&hold, &gain, &alarm}) {
+    auto context = system->CreateDefaultContext();
+    auto events = system->AllocateCompositeEventCollection();
+    system->CalcNextUpdateTime(*context, events.get());
+  }
+  EXPECT_TRUE(hold.IsNextUpdateTimePeriodic());
+  EXPECT_FALSE(gain.IsNextUpdateTimePeriodic());
+  EXPECT_FALSE(alarm.IsNextUpdateTimePeriodic());
+
+  DiagramBuilder<double> builder;
+  builder.AddSystem<ZeroOrderHold<double>>(0.1, 1);
+  builder.AddSystem<Gain<double>>(2.0, 1);
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  auto events = diagram->AllocateCompositeEventCollection();
+  diagram->CalcNextUpdateTime(*context, events.get());
+  EXPECT_FALSE(diagram->IsNextUpdateTimePeriodic());
+}
+
+// Builds a diagram of several independent "robots", each an Integrator with
+// a Gain in feedback and a ZeroOrderHold of the Integrator output, plus one
+// robot whose Gain is fed by an exported input port.
+std::unique_ptr<Diagram<double>> MakeSubsystemEvaluationDiagram(
+    int num_threads, std::vector<const Integrator<double>*>* integrators) {
+  const int kNumRobots = 6;
+  DiagramBuilder<double> builder;
+  for (int k = 0; k < kNumRobots; ++k) {
+    auto integrator = builder.AddSystem<Integrator<double>>(2);
+    auto gain = builder.AddSystem<Gain<double>>(-(k + 1.0), 2);
+    auto hold = builder.AddSystem<ZeroOrderHold<double>>(0.1, 2);
+    builder.Connect(integrator->get_output_port(), gain->get_input_port());
+    builder.Connect(gain->get_output_port(), integrator->get_input_port());
+    builder.Connect(integrator->get_output_port(), hold->get_input_port());
+    integrators->push_back(integrator);
+  }
+  auto integrator = builder.AddSystem<Integrator<double>>(2);
+  auto gain = builder.AddSystem<Gain<double>>(3.0, 2);
+  builder.ExportInput(gain->get_input_port());
+  builder.Connect(gain->get_output_port(), integrator->get_input_port());
+  integrators->push_back(integrator);
+  auto diagram = builder.Build();
+  diagram->set_subsystem_evaluation_threads(num_threads);
+  return diagram;
+}
+
+// Verifies that evaluating the independent subsystems of a diagram
+// concurrently gives the same derivatives and updates as serial evaluation.
+GTEST_TEST(SubsystemEvaluationThreadsTest, SameResultsAsSerial) {
+  std::vector<const Integrator<double>*> expected_integrators;
+  auto expected_diagram =
+      MakeSubsystemEvaluationDiagram(1, &expected_integrators);
+  EXPECT_EQ(expected_diagram->get_subsystem_evaluation_threads(), 1);
+  std::vector<const Integrator<double>*> integrators;
+  auto dut = MakeSubsystemEvaluationDiagram(4, &integrators);
+  EXPECT_EQ(dut->get_subsystem_evaluation_threads(), 4);
+  EXPECT_THROW(dut->set_subsystem_evaluation_threads(0), std::exception);
+
+  auto expected_context = expected_diagram->CreateDefaultContext();
+  auto context = dut->CreateDefaultContext();
+  expected_context->FixInputPort(0, Vector2<double>(1.0, -2.0));
+  context->FixInputPort(0, Vector2<double>(1.0, -2.0));
+  auto expected_derivatives = expected_diagram->AllocateTimeDerivatives();
+  auto derivatives = dut->AllocateTimeDerivatives();
+  auto expected_discrete = expected_diagram->AllocateDiscreteVariables();
+  auto discrete = dut->AllocateDiscreteVariables();
+
+  // Repeat with changing states, so the cached outputs are reevaluated.
+  for (int step = 0; step < 10; ++step) {
+    for (size_t k = 0; k < integrators.size(); ++k) {
+      const Vector2<double> value(step + k, step - 2.0 * k);
+      expected_integrators[k]->set_integral_value(
+          &expected_diagram->GetMutableSubsystemContext(
+              *expected_integrators[k], expected_context.get()),
+          value);
+      integrators[k]->set_integral_value(
+          &dut->GetMutableSubsystemContext(*integrators[k], context.get()),
+          value);
+    }
+
+    expected_diagram->CalcTimeDerivatives(*expected_context,
+                                          expected_derivatives.get());
+    dut->CalcTimeDerivatives(*context, derivatives.get());
+    EXPECT_EQ(derivatives->CopyToVector(),
+              expected_derivatives->CopyToVector());
+
+    expected_diagram->CalcDiscreteVariableUpdates(*expected_context,
+                                                  expected_discrete.get());
+    dut->CalcDiscreteVariableUpdates(*context, discrete.get());
+    ASSERT_EQ(discrete->num_groups(), expected_discrete->num_groups());
+    for (int i = 0; i < discrete->num_groups(); ++i) {
+      EXPECT_EQ(discrete->get_vector(i).CopyToVector(),
+                expected_discrete->get_vector(i).CopyToVector());
+    }
+  }
+  // The last robot integrates the gained input.
+  EXPECT_EQ(derivatives->CopyToVector().tail<2>(), Vector2<double>(3.0, -6.0));
+}
+
 template <typename T>
 class ConstraintTestSystem : public LeafSystem<T> {
  public:
@@ -105,11 +105,35 @@ class SubclassOfAnyToAnySystem : public AnyToAnySystem<T> {
       : SubclassOfAnyToAnySystem() {}
 };
 
+// A system that has non-trivial non-T-typed member data.
+// This system can convert between all scalar types, and also from double to
+// the fixed-size autodiff scalar types.
+template <typename T>
+class FixedSizeAutoDiffSystem : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FixedSizeAutoDiffSystem);
+
+  // User constructor.
+  explicit FixedSizeAutoDiffSystem(int magic) : magic_(magic) {}
+
+  // Copy constructor that converts to a different scalar type.
+  template <typename U>
+  explicit FixedSizeAutoDiffSystem(const FixedSizeAutoDiffSystem<U>& other)
+      : FixedSizeAutoDiffSystem(other.magic()) {}
+
+  int magic() const { return magic_; }
+
+ private:
+  int magic_{};
+};
+
 }  // namespace
 
 namespace scalar_conversion {
 template <> struct Traits<NonSymbolicSystem> : public NonSymbolicTraits {};
 template <> struct Traits<FromDoubleSystem> : public FromDoubleTraits {};
+template <>
+struct FixedSizeAutoDiffTraits<FixedSizeAutoDiffSystem> : std::true_type {};
 }  // namespace scalar_conversion
 
 namespace {
@@ -250,6 +274,23 @@ GTEST_TEST(SystemScalarConverterTest, TestUserTypes) {
   EXPECT_TRUE(downcast != nullptr);
 }
 
+GTEST_TEST(SystemScalarConverterTest, TestFixedSizeAutoDiff) {
+  // The fixed-size autodiff types are not supported by default.
+  TestConversionFail<AnyToAnySystem, AutoDiffd<4>, double>();
+  TestConversionFail<AnyToAnySystem, AutoDiffd<16>, double>();
+
+  // A system can opt-in to them, for conversion from double.
+  TestConversionPass<FixedSizeAutoDiffSystem, AutoDiffd<4>,  double, 1>();
+  TestConversionPass<FixedSizeAutoDiffSystem, AutoDiffd<8>,  double, 2>();
+  TestConversionPass<FixedSizeAutoDiffSystem, AutoDiffd<16>, double, 3>();
+  TestConversionFail<FixedSizeAutoDiffSystem, AutoDiffd<5>,  double>();
+  TestConversionFail<FixedSizeAutoDiffSystem, double, AutoDiffd<4>>();
+
+  // The standard types are still supported.
+  TestConversionPass<FixedSizeAutoDiffSystem, AutoDiffXd, double,     4>();
+  TestConversionPass<FixedSizeAutoDiffSystem, double,     AutoDiffXd, 5>();
+}
+
 GTEST_TEST(SystemScalarConverterTest, SubclassMismatch) {
   // When correctly configured, converting the subclass type is successful.
   {
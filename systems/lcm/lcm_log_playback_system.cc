@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <memory>
 
 #include "drake/common/drake_throw.h"
@@ -25,8 +26,16 @@ void LcmLogPlaybackSystem::DoCalcNextUpdateTime(
   DRAKE_THROW_UNLESS(events->HasEvents() == false);
   DRAKE_THROW_UNLESS(std::isinf(*time));
 
+  // An indexed log that is behind the simulation (e.g., when simulating from
+  // a later initial time) skips ahead to the first message after now.
+  double next_message_time = log_->GetNextMessageTime();
+  if (log_->is_indexed() && next_message_time <= context.get_time()) {
+    log_->Seek(std::nextafter(context.get_time(),
+                              std::numeric_limits<double>::infinity()));
+    next_message_time = log_->GetNextMessageTime();
+  }
+
   // If there are no more messages in the log, do nothing.
-  const double next_message_time = log_->GetNextMessageTime();
   if (std::isinf(next_message_time)) {
     return;
   }
@@ -15,6 +15,11 @@ namespace lcm {
  * This is useful when a simulated Diagram contains LcmSubscriberSystem(s)
  * whose outputs should be determined by logged data and when the log's cursor
  * should advance automatically during simulation.
+ *
+ * If the log is constructed for indexed playback (see DrakeLcmLog::Seek()),
+ * the simulation may start at any time: the messages up to and including the
+ * initial time are skipped without being read. Otherwise, the log's first
+ * message must be later than the initial time.
  */
 class LcmLogPlaybackSystem : public LeafSystem<double> {
  public:
@@ -34,6 +39,8 @@ class LcmLogPlaybackSystem : public LeafSystem<double> {
                             systems::CompositeEventCollection<double>*,
                             double*) const override;
 
+  bool DoIsNextUpdateTimePeriodic() const override { return false; }
+
  private:
   drake::lcm::DrakeLcmLog* const log_;
 };
@@ -35,17 +35,39 @@ LcmSubscriberSystem::LcmSubscriberSystem(
     const std::string& channel, const LcmAndVectorBaseTranslator* translator,
     std::unique_ptr<SerializerInterface> serializer,
     drake::lcm::DrakeLcmInterface* lcm,
-    int fixed_encoded_size)
+    int fixed_encoded_size, bool decode_on_receipt)
     : channel_(channel),
       translator_(translator),
       serializer_(std::move(serializer)),
-      fixed_encoded_size_(fixed_encoded_size) {
+      fixed_encoded_size_(fixed_encoded_size),
+      decode_on_receipt_(decode_on_receipt) {
   DRAKE_DEMAND((translator_ != nullptr) != (serializer_ != nullptr));
+  DRAKE_DEMAND(!decode_on_receipt_ || is_abstract_state());
   DRAKE_DEMAND(lcm);
 
-  lcm->Subscribe(channel_, [this](const void* buffer, int size) {
-      this->HandleMessage(buffer, size);
-    });
+  if (decode_on_receipt_) {
+    // Have the messages decoded before they are handed to us, so that we can
+    // take them over without copying or decoding them again.
+    lcm->SubscribeDecoded(
+        channel_,
+        [this]() { return this->AllocateSerializerOutputValue(); },
+        [this](const void* buffer, int size, AbstractValue* message) {
+          // A bad message must not take down the LCM thread; the error is
+          // reported to whoever uses the message instead.
+          try {
+            this->serializer_->Deserialize(buffer, size, message);
+          } catch (...) {
+            this->decode_error_ = std::current_exception();
+          }
+        },
+        [this](std::unique_ptr<AbstractValue>* message) {
+          this->HandleDecodedMessage(message);
+        });
+  } else {
+    lcm->Subscribe(channel_, [this](const void* buffer, int size) {
+        this->HandleMessage(buffer, size);
+      });
+  }
 
   // Declare the single output port.
   if (translator_ != nullptr) {
@@ -154,7 +176,15 @@ void LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
   DRAKE_ASSERT(serializer_ != nullptr);
 
   std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
+  if (decode_on_receipt_) {
+    if (received_error_) {
+      std::rethrow_exception(received_error_);
+    }
+    if (received_value_ != nullptr) {
+      abstract_state->get_mutable_value(kStateIndexMessage)
+          .SetFrom(*received_value_);
+    }
+  } else if (!received_message_.empty()) {
     serializer_->Deserialize(
         received_message_.data(), received_message_.size(),
         &abstract_state->get_mutable_value(kStateIndexMessage));
@@ -277,6 +307,22 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   received_message_condition_variable_.notify_all();
 }
 
+void LcmSubscriberSystem::HandleDecodedMessage(
+    std::unique_ptr<AbstractValue>* message) {
+  SPDLOG_TRACE(drake::log(), "Receiving LCM {} message", channel_);
+
+  // Take over the decoded message, and give back the previous one (if any)
+  // for decoding a later message into.
+  std::lock_guard<std::mutex> lock(received_message_mutex_);
+  received_error_ = decode_error_;
+  decode_error_ = nullptr;
+  if (!received_error_) {
+    received_value_.swap(*message);
+  }
+  received_message_count_++;
+  received_message_condition_variable_.notify_all();
+}
+
 int LcmSubscriberSystem::WaitForMessage(
     int old_message_count, AbstractValue* message) const {
   DRAKE_ASSERT(serializer_ != nullptr);
@@ -296,8 +342,15 @@ int LcmSubscriberSystem::WaitForMessage(
   }
   int new_message_count = received_message_count_;
   if (message) {
+    if (decode_on_receipt_) {
+      if (received_error_) {
+        std::rethrow_exception(received_error_);
+      }
+      message->SetFrom(*received_value_);
+    } else {
       serializer_->Deserialize(
           received_message_.data(), received_message_.size(), message);
+    }
   }
   lock.unlock();
 
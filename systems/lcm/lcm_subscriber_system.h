@@ -1,6 +1,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -48,6 +49,8 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   /**
    * Factory method that returns a subscriber System that provides
    * Value<LcmMessage> message objects on its sole abstract-valued output port.
+   * Messages are decoded as soon as they are received (on the LCM service's
+   * thread, if it has one), and are then stored without being copied.
    *
    * @tparam LcmMessage message type to deserialize, e.g., lcmt_drake_signal.
    *
@@ -58,8 +61,10 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   template <typename LcmMessage>
   static std::unique_ptr<LcmSubscriberSystem> Make(
       const std::string& channel, drake::lcm::DrakeLcmInterface* lcm) {
-    return std::make_unique<LcmSubscriberSystem>(
-        channel, std::make_unique<Serializer<LcmMessage>>(), lcm);
+    // We can't use make_unique when calling a private constructor.
+    return std::unique_ptr<LcmSubscriberSystem>(new LcmSubscriberSystem(
+        channel, nullptr, std::make_unique<Serializer<LcmMessage>>(), lcm,
+        -1 /* fixed_encoded_size */, true /* decode_on_receipt */));
   }
 
   /**
@@ -172,6 +177,8 @@ class LcmSubscriberSystem : public LeafSystem<double> {
                             systems::CompositeEventCollection<double>* events,
                             double* time) const override;
 
+  bool DoIsNextUpdateTimePeriodic() const override { return false; }
+
   void DoCalcUnrestrictedUpdate(
       const Context<double>&,
       const std::vector<const systems::UnrestrictedUpdateEvent<double>*>&,
@@ -192,7 +199,8 @@ class LcmSubscriberSystem : public LeafSystem<double> {
                       const LcmAndVectorBaseTranslator* translator,
                       std::unique_ptr<SerializerInterface> serializer,
                       drake::lcm::DrakeLcmInterface* lcm,
-                      int fixed_encoded_size = -1);
+                      int fixed_encoded_size = -1,
+                      bool decode_on_receipt = false);
 
   void ProcessMessageAndStoreToDiscreteState(
       DiscreteValues<double>* discrete_state) const;
@@ -200,8 +208,10 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   void ProcessMessageAndStoreToAbstractState(
       AbstractValues* abstract_state) const;
 
-  // Callback entry point from LCM into this class.
+  // Callback entry points from LCM into this class; the second is used iff
+  // decode_on_receipt_.
   void HandleMessage(const void*, int);
+  void HandleDecodedMessage(std::unique_ptr<AbstractValue>*);
 
   // This pair of methods is used for the output port when we're using a
   // translator.
@@ -235,15 +245,35 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   const std::unique_ptr<SerializerInterface> serializer_;
   const int fixed_encoded_size_;
 
-  // The mutex that guards received_message_ and received_message_count_.
+  // Whether messages are decoded by the LCM service's handler thread (see
+  // DrakeLcmInterface::SubscribeDecoded), instead of by our state update.
+  // This is only done with serializers made by Make(), which are known to be
+  // safe to call from any thread.
+  const bool decode_on_receipt_;
+
+  // The mutex that guards received_message_, received_value_, and
+  // received_message_count_.
   mutable std::mutex received_message_mutex_;
 
   // A condition variable that's signaled every time the handler is called.
   mutable std::condition_variable received_message_condition_variable_;
 
-  // The bytes of the most recently received LCM message.
+  // The bytes of the most recently received LCM message, unless
+  // decode_on_receipt_.
   std::vector<uint8_t> received_message_;
 
+  // The most recently received LCM message, already decoded, iff
+  // decode_on_receipt_; it is null until a message is received.
+  std::unique_ptr<AbstractValue> received_value_;
+
+  // The error from decoding the most recently received LCM message, iff it
+  // could not be decoded; it is rethrown when the message would be used.
+  std::exception_ptr received_error_;
+
+  // The error from the decoder, on its way to the handler. It is only used by
+  // the thread that handles our LCM messages.
+  std::exception_ptr decode_error_;
+
   // A message counter that's incremented every time the handler is called.
   int received_message_count_{0};
 };
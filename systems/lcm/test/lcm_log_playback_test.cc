@@ -1,3 +1,7 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/lcm/drake_lcm_log.h"
@@ -137,10 +141,19 @@ void CheckLog(const std::vector<double>& expected_times,
   }
 }
 
-void CheckLog() {
+// Plays back the log from @p start_time, through an index iff @p indexed,
+// and checks the messages received after @p start_time.
+void CheckLog(bool indexed = false, double start_time = 0.0) {
   // Since time shifting is taken care of in log generation, we don't need to
   // worry about it here.
-  drake::lcm::DrakeLcmLog r_log("test.log", false);
+  std::unique_ptr<drake::lcm::DrakeLcmLog> r_log_ptr;
+  if (indexed) {
+    r_log_ptr = std::make_unique<drake::lcm::DrakeLcmLog>(
+        "test.log", drake::lcm::DrakeLcmLog::IndexOptions{});
+  } else {
+    r_log_ptr = std::make_unique<drake::lcm::DrakeLcmLog>("test.log", false);
+  }
+  drake::lcm::DrakeLcmLog& r_log = *r_log_ptr;
 
   DiagramBuilder<double> builder;
   builder.AddSystem<LcmLogPlaybackSystem>(&r_log);
@@ -163,18 +176,31 @@ void CheckLog() {
   auto diagram = builder.Build();
 
   Simulator<double> sim(*diagram);
+  sim.get_mutable_context().set_time(start_time);
   sim.StepTo(0.5);
 
+  // Of the messages below, only those after start_time are received.
+  const auto received_after = [start_time](std::vector<double> times,
+                                           std::vector<double> vals) {
+    while (!times.empty() && times.front() <= start_time) {
+      times.erase(times.begin());
+      vals.erase(vals.begin());
+    }
+    return std::make_pair(times, vals);
+  };
+
   // printer0 should have msg at t = [0.1, 0.3], with val = [1, 5].
-  CheckLog({0.1, 0.3}, {1, 5}, "Ch0", printer0->get_received_msgs(),
+  const auto ch0 = received_after({0.1, 0.3}, {1, 5});
+  CheckLog(ch0.first, ch0.second, "Ch0", printer0->get_received_msgs(),
            printer0->get_received_times());
 
   // printer1 should have the exact same msg as print0.
-  CheckLog({0.1, 0.3}, {1, 5}, "Ch0", printer1->get_received_msgs(),
+  CheckLog(ch0.first, ch0.second, "Ch0", printer1->get_received_msgs(),
            printer1->get_received_times());
 
-  // printer2 should have msg at t = [0.1, 0.3], with val = [2, 6, 7].
-  CheckLog({0.22, 0.3, 0.4}, {2, 6, 7}, "Ch1", printer2->get_received_msgs(),
+  // printer2 should have msg at t = [0.22, 0.3, 0.4], with val = [2, 6, 7].
+  const auto ch1 = received_after({0.22, 0.3, 0.4}, {2, 6, 7});
+  CheckLog(ch1.first, ch1.second, "Ch1", printer2->get_received_msgs(),
            printer2->get_received_times());
 }
 
@@ -193,6 +219,14 @@ GTEST_TEST(TestLcmLogPlayback, TestLcmLogPlayback) {
   CheckLog();
 }
 
+// The same log, played back through an index, both from the start and from a
+// later time (which skips the earlier messages).
+GTEST_TEST(TestLcmLogPlayback, TestIndexedLcmLogPlayback) {
+  GenerateLog();
+  CheckLog(true /* indexed */);
+  CheckLog(true /* indexed */, 0.25 /* start_time */);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace systems
@@ -2,6 +2,8 @@
 
 #include <array>
 #include <future>
+#include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -180,6 +182,40 @@ GTEST_TEST(LcmSubscriberSystemTest, SerializerTest) {
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(value, sample_data.value));
 }
 
+// Tests that both the decoding done by Make() and the decoding done by the
+// state update (when using the constructor) report bad messages when the
+// message is used, and recover with the next good message.
+GTEST_TEST(LcmSubscriberSystemTest, CorruptMessageTest) {
+  const std::string channel_name = "channel_name";
+  for (bool use_make : {true, false}) {
+    drake::lcm::DrakeMockLcm lcm;
+    std::unique_ptr<LcmSubscriberSystem> dut;
+    if (use_make) {
+      dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(channel_name, &lcm);
+    } else {
+      dut = std::make_unique<LcmSubscriberSystem>(
+          channel_name, std::make_unique<Serializer<lcmt_drake_signal>>(),
+          &lcm);
+    }
+    std::unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+    std::unique_ptr<SystemOutput<double>> output = dut->AllocateOutput();
+
+    // A message that cannot be decoded is reported by the update.
+    const std::vector<uint8_t> corrupt_bytes{1, 2, 3};
+    lcm.InduceSubscriberCallback(channel_name, corrupt_bytes.data(),
+                                 corrupt_bytes.size());
+    EXPECT_THROW(EvalOutputHelper(*dut, context.get(), output.get()),
+                 std::exception);
+
+    // The next good message is received as usual.
+    SampleData sample_data;
+    sample_data.MockPublish(&lcm, channel_name);
+    EvalOutputHelper(*dut, context.get(), output.get());
+    const auto& value = output->get_data(0)->GetValue<lcmt_drake_signal>();
+    EXPECT_TRUE(CompareLcmtDrakeSignalMessages(value, sample_data.value));
+  }
+}
+
 // Tests LcmSubscriberSystem using a fixed-size Serializer.
 GTEST_TEST(LcmSubscriberSystemTest, FixedSizeSerializerTest) {
   drake::lcm::DrakeMockLcm lcm;
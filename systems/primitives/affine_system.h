@@ -245,5 +245,12 @@ class AffineSystem : public TimeVaryingAffineSystem<T> {
   const Eigen::VectorXd y0_;
 };
 
+// AffineSystem also supports the fixed-size autodiff scalar types, so that it
+// can be linearized without heap allocation.
+namespace scalar_conversion {
+template <>
+struct FixedSizeAutoDiffTraits<AffineSystem> : std::true_type {};
+}  // namespace scalar_conversion
+
 }  // namespace systems
 }  // namespace drake
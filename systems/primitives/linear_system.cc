@@ -84,71 +84,33 @@ unique_ptr<LinearSystem<T>> LinearSystem<T>::MakeLinearSystem(
 
 namespace {
 
-// Helper function allows reuse for both FirstOrderTaylorApproximation and
-// Linearize.
-std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
-    const System<double>& system, const Context<double>& context,
-    int input_port_index, int output_port_index,
-    optional<double> equilibrium_check_tolerance = nullopt) {
-  DRAKE_ASSERT_VOID(system.CheckValidContext(context));
-
-  const bool has_only_discrete_states_contained_in_one_group =
-      context.has_only_discrete_state() &&
-      context.get_num_discrete_state_groups() == 1;
-  DRAKE_DEMAND(context.is_stateless() || context.has_only_continuous_state() ||
-               has_only_discrete_states_contained_in_one_group);
-
-  double time_period = 0.0;
-  if (has_only_discrete_states_contained_in_one_group) {
-    optional<PeriodicEventData> periodic_data =
-        system.GetUniquePeriodicDiscreteUpdateAttribute();
-    DRAKE_THROW_UNLESS(static_cast<bool>(periodic_data));
-    time_period = periodic_data->period_sec();
+// Returns `value` as autodiff scalars whose derivatives are the directions
+// `offset`, ..., `offset + value.size() - 1` out of `num_derivatives`.
+template <typename U>
+VectorX<U> InitializeDerivatives(const Eigen::VectorXd& value, int offset,
+                                 int num_derivatives) {
+  VectorX<U> result(value.size());
+  for (int i = 0; i < value.size(); ++i) {
+    result(i).value() = value(i);
+    result(i).derivatives() = U::DerType::Unit(num_derivatives, offset + i);
   }
+  return result;
+}
 
-  // Create an autodiff version of the system.
-  std::unique_ptr<System<AutoDiffXd>> autodiff_system =
-      drake::systems::System<double>::ToAutoDiffXd(system);
-
+// Implements DoFirstOrderTaylorApproximation() using `autodiff_system`, the
+// conversion of `system` to the autodiff scalar type U, whose derivatives
+// must have room for num_states + num_inputs directions.
+template <typename U>
+std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
+    const System<double>& system, const System<U>& autodiff_system,
+    const Context<double>& context, const InputPort<double>* input_port,
+    const OutputPort<double>* output_port,
+    optional<double> equilibrium_check_tolerance, double time_period) {
   // Initialize autodiff.
-  std::unique_ptr<Context<AutoDiffXd>> autodiff_context =
-      autodiff_system->CreateDefaultContext();
+  std::unique_ptr<Context<U>> autodiff_context =
+      autodiff_system.CreateDefaultContext();
   autodiff_context->SetTimeStateAndParametersFrom(context);
 
-  // By default, use the first input / output ports (if they exist).
-  const InputPort<AutoDiffXd>* input_port = nullptr;
-  if (input_port_index == kUseFirstInputIfItExists) {
-    if (system.get_num_input_ports() > 0) {
-      input_port = &(autodiff_system->get_input_port(0));
-    }
-  } else if (input_port_index >= 0 &&
-             input_port_index < system.get_num_input_ports()) {
-    input_port = &(autodiff_system->get_input_port(input_port_index));
-  } else if (input_port_index != kNoInput) {
-    DRAKE_ABORT_MSG("Invalid input_port_index specified.");
-  }
-
-  // By default, use the first input / output ports (if they exist).
-  const OutputPort<AutoDiffXd>* output_port = nullptr;
-  if (output_port_index == kUseFirstOutputIfItExists) {
-    if (system.get_num_output_ports() > 0) {
-      output_port = &(autodiff_system->get_output_port(0));
-    }
-  } else if (output_port_index >= 0 &&
-             output_port_index < system.get_num_output_ports()) {
-    output_port = &(autodiff_system->get_output_port(output_port_index));
-  } else if (output_port_index != kNoOutput) {
-    DRAKE_ABORT_MSG("Invalid output_port_index specified.");
-  }
-
-  // Verify that the input port is not abstract valued.
-  if (input_port &&
-      input_port->get_data_type() == PortDataType::kAbstractValued) {
-    throw std::logic_error(
-        "Port requested for differentiation is abstract, and differentiation "
-        "of abstract ports is not supported.");
-  }
-
   const int num_inputs = input_port ? input_port->size() : 0;
   const int num_outputs = output_port ? output_port->size() : 0;
 
@@ -160,6 +122,14 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
                  : context.get_discrete_state(0).get_value());
   const int num_states = x0.size();
 
+  // The number of derivatives of U: num_states + num_inputs, or more for a
+  // fixed-size U, of which the rest remain zero.
+  const int num_derivatives =
+      U::DerType::SizeAtCompileTime == Eigen::Dynamic
+          ? num_states + num_inputs
+          : static_cast<int>(U::DerType::SizeAtCompileTime);
+  DRAKE_DEMAND(num_states + num_inputs <= num_derivatives);
+
   // Fix autodiff'd versions of the inputs to the autodiff'd Context.
   for (int i = 0; i < system.get_num_input_ports(); ++i) {
     const InputPort<double>& input_port_i =
@@ -183,18 +153,18 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
           "the output of another system.", input_port_i.get_name()));
     }
     Eigen::VectorBlock<const VectorX<double>> u = input_port_i.Eval(context);
-    autodiff_context->FixInputPort(i, u.cast<AutoDiffXd>());
+    autodiff_context->FixInputPort(i, u.cast<U>());
   }
 
   Eigen::VectorXd u0 = Eigen::VectorXd::Zero(num_inputs);
   if (input_port) {
-    u0 = system.get_input_port(input_port->get_index()).Eval(context);
+    u0 = input_port->Eval(context);
   }
 
-  auto autodiff_args = math::initializeAutoDiffTuple(x0, u0);
   if (input_port) {
-    auto input_vector = std::make_unique<BasicVector<AutoDiffXd>>(num_inputs);
-    input_vector->SetFromVector(std::get<1>(autodiff_args));
+    auto input_vector = std::make_unique<BasicVector<U>>(num_inputs);
+    input_vector->SetFromVector(
+        InitializeDerivatives<U>(u0, num_states, num_derivatives));
     autodiff_context->FixInputPort(input_port->get_index(),
                                    std::move(input_vector));
   }
@@ -202,19 +172,21 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
   Eigen::MatrixXd A(num_states, num_states), B(num_states, num_inputs);
   Eigen::VectorXd f0(num_states);
   if (num_states > 0) {
+    const VectorX<U> autodiff_x0 =
+        InitializeDerivatives<U>(x0, 0, num_derivatives);
     if (autodiff_context->has_only_continuous_state()) {
       autodiff_context->get_mutable_continuous_state_vector().SetFromVector(
-          std::get<0>(autodiff_args));
-      std::unique_ptr<ContinuousState<AutoDiffXd>> autodiff_xdot =
-          autodiff_system->AllocateTimeDerivatives();
-      autodiff_system->CalcTimeDerivatives(*autodiff_context,
-                                           autodiff_xdot.get());
+          autodiff_x0);
+      std::unique_ptr<ContinuousState<U>> autodiff_xdot =
+          autodiff_system.AllocateTimeDerivatives();
+      autodiff_system.CalcTimeDerivatives(*autodiff_context,
+                                          autodiff_xdot.get());
       auto autodiff_xdot_vec = autodiff_xdot->CopyToVector();
 
       const Eigen::MatrixXd AB =
-          math::autoDiffToGradientMatrix(autodiff_xdot_vec);
+          math::autoDiffToGradientMatrix(autodiff_xdot_vec, num_derivatives);
       A = AB.leftCols(num_states);
-      B = AB.rightCols(num_inputs);
+      B = AB.middleCols(num_states, num_inputs);
 
       const Eigen::VectorXd xdot0 =
           math::autoDiffToValueMatrix(autodiff_xdot_vec);
@@ -230,20 +202,19 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
 
       f0 = xdot0 - A * x0 - B * u0;
     } else {
-      DRAKE_ASSERT(has_only_discrete_states_contained_in_one_group);
-      auto& autodiff_x0 =
+      auto& autodiff_discrete_x0 =
           autodiff_context->get_mutable_discrete_state().get_mutable_vector();
-      autodiff_x0.SetFromVector(std::get<0>(autodiff_args));
-      std::unique_ptr<DiscreteValues<AutoDiffXd>> autodiff_x1 =
-          autodiff_system->AllocateDiscreteVariables();
-      autodiff_system->CalcDiscreteVariableUpdates(*autodiff_context,
-                                                   autodiff_x1.get());
+      autodiff_discrete_x0.SetFromVector(autodiff_x0);
+      std::unique_ptr<DiscreteValues<U>> autodiff_x1 =
+          autodiff_system.AllocateDiscreteVariables();
+      autodiff_system.CalcDiscreteVariableUpdates(*autodiff_context,
+                                                  autodiff_x1.get());
       auto autodiff_x1_vec = autodiff_x1->get_vector().CopyToVector();
 
       const Eigen::MatrixXd AB =
-          math::autoDiffToGradientMatrix(autodiff_x1_vec);
+          math::autoDiffToGradientMatrix(autodiff_x1_vec, num_derivatives);
       A = AB.leftCols(num_states);
-      B = AB.rightCols(num_inputs);
+      B = AB.middleCols(num_states, num_inputs);
 
       const Eigen::VectorXd x1 = math::autoDiffToValueMatrix(autodiff_x1_vec);
 
@@ -269,10 +240,12 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
   Eigen::VectorXd y0 = Eigen::VectorXd::Zero(num_outputs);
 
   if (output_port) {
-    const auto& autodiff_y0 = output_port->Eval(*autodiff_context);
-    const Eigen::MatrixXd CD = math::autoDiffToGradientMatrix(autodiff_y0);
+    const auto& autodiff_y0 = autodiff_system.get_output_port(
+        output_port->get_index()).Eval(*autodiff_context);
+    const Eigen::MatrixXd CD =
+        math::autoDiffToGradientMatrix(autodiff_y0, num_derivatives);
     C = CD.leftCols(num_states);
-    D = CD.rightCols(num_inputs);
+    D = CD.middleCols(num_states, num_inputs);
 
     const Eigen::VectorXd y = math::autoDiffToValueMatrix(autodiff_y0);
 
@@ -286,6 +259,114 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
                                                 time_period);
 }
 
+// Implements DoFirstOrderTaylorApproximation() with AutoDiffd<N>, if `system`
+// supports it and there are at most N derivatives, or returns nullptr.
+template <int N>
+std::unique_ptr<AffineSystem<double>> MaybeDoFixedSizeTaylorApproximation(
+    const System<double>& system, const Context<double>& context,
+    const InputPort<double>* input_port,
+    const OutputPort<double>* output_port,
+    optional<double> equilibrium_check_tolerance, double time_period,
+    int num_derivatives) {
+  const SystemScalarConverter& converter =
+      system.get_system_scalar_converter();
+  if (num_derivatives > N ||
+      !converter.IsConvertible<AutoDiffd<N>, double>()) {
+    return nullptr;
+  }
+  const std::unique_ptr<System<AutoDiffd<N>>> autodiff_system =
+      converter.Convert<AutoDiffd<N>, double>(system);
+  return DoFirstOrderTaylorApproximation(
+      system, *autodiff_system, context, input_port, output_port,
+      equilibrium_check_tolerance, time_period);
+}
+
+// Helper function allows reuse for both FirstOrderTaylorApproximation and
+// Linearize.
+std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
+    const System<double>& system, const Context<double>& context,
+    int input_port_index, int output_port_index,
+    optional<double> equilibrium_check_tolerance = nullopt) {
+  DRAKE_ASSERT_VOID(system.CheckValidContext(context));
+
+  const bool has_only_discrete_states_contained_in_one_group =
+      context.has_only_discrete_state() &&
+      context.get_num_discrete_state_groups() == 1;
+  DRAKE_DEMAND(context.is_stateless() || context.has_only_continuous_state() ||
+               has_only_discrete_states_contained_in_one_group);
+
+  double time_period = 0.0;
+  if (has_only_discrete_states_contained_in_one_group) {
+    optional<PeriodicEventData> periodic_data =
+        system.GetUniquePeriodicDiscreteUpdateAttribute();
+    DRAKE_THROW_UNLESS(static_cast<bool>(periodic_data));
+    time_period = periodic_data->period_sec();
+  }
+
+  // By default, use the first input / output ports (if they exist).
+  const InputPort<double>* input_port = nullptr;
+  if (input_port_index == kUseFirstInputIfItExists) {
+    if (system.get_num_input_ports() > 0) {
+      input_port = &(system.get_input_port(0));
+    }
+  } else if (input_port_index >= 0 &&
+             input_port_index < system.get_num_input_ports()) {
+    input_port = &(system.get_input_port(input_port_index));
+  } else if (input_port_index != kNoInput) {
+    DRAKE_ABORT_MSG("Invalid input_port_index specified.");
+  }
+
+  // By default, use the first input / output ports (if they exist).
+  const OutputPort<double>* output_port = nullptr;
+  if (output_port_index == kUseFirstOutputIfItExists) {
+    if (system.get_num_output_ports() > 0) {
+      output_port = &(system.get_output_port(0));
+    }
+  } else if (output_port_index >= 0 &&
+             output_port_index < system.get_num_output_ports()) {
+    output_port = &(system.get_output_port(output_port_index));
+  } else if (output_port_index != kNoOutput) {
+    DRAKE_ABORT_MSG("Invalid output_port_index specified.");
+  }
+
+  // Verify that the input port is not abstract valued.
+  if (input_port &&
+      input_port->get_data_type() == PortDataType::kAbstractValued) {
+    throw std::logic_error(
+        "Port requested for differentiation is abstract, and differentiation "
+        "of abstract ports is not supported.");
+  }
+
+  // Differentiate with the smallest fixed-size autodiff type that fits, if
+  // the system supports one, since AutoDiffXd allocates the derivatives of
+  // every intermediate value on the heap.
+  const int num_derivatives =
+      context.get_num_total_states() + (input_port ? input_port->size() : 0);
+  std::unique_ptr<AffineSystem<double>> result =
+      MaybeDoFixedSizeTaylorApproximation<4>(
+          system, context, input_port, output_port,
+          equilibrium_check_tolerance, time_period, num_derivatives);
+  if (!result) {
+    result = MaybeDoFixedSizeTaylorApproximation<8>(
+        system, context, input_port, output_port, equilibrium_check_tolerance,
+        time_period, num_derivatives);
+  }
+  if (!result) {
+    result = MaybeDoFixedSizeTaylorApproximation<16>(
+        system, context, input_port, output_port, equilibrium_check_tolerance,
+        time_period, num_derivatives);
+  }
+  if (!result) {
+    // Create an autodiff version of the system.
+    const std::unique_ptr<System<AutoDiffXd>> autodiff_system =
+        drake::systems::System<double>::ToAutoDiffXd(system);
+    result = DoFirstOrderTaylorApproximation(
+        system, *autodiff_system, context, input_port, output_port,
+        equilibrium_check_tolerance, time_period);
+  }
+  return result;
+}
+
 }  // namespace
 
 std::unique_ptr<LinearSystem<double>> Linearize(
@@ -365,6 +446,8 @@ bool IsObservable(const LinearSystem<double>& sys, optional<double> threshold) {
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::systems::LinearSystem)
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF_SCALARS(
+    class ::drake::systems::LinearSystem)
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::systems::TimeVaryingLinearSystem)
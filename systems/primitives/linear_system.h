@@ -256,6 +256,11 @@ std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     int input_port_index = kUseFirstInputIfItExists,
     int output_port_index = kUseFirstOutputIfItExists);
 
+namespace scalar_conversion {
+template <>
+struct FixedSizeAutoDiffTraits<LinearSystem> : std::true_type {};
+}  // namespace scalar_conversion
+
 /// Returns the controllability matrix:  R = [B, AB, ..., A^{n-1}B].
 /// @ingroup control_systems
 Eigen::MatrixXd ControllabilityMatrix(const LinearSystem<double>& sys);
@@ -1,40 +1,141 @@
 #include "drake/systems/primitives/signal_log.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
 
 namespace drake {
 namespace systems {
 
 template <typename T>
-SignalLog<T>::SignalLog(int input_size, int batch_allocation_size)
+SignalLog<T>::SignalLog(int input_size, int batch_allocation_size,
+                        optional<int> max_num_samples)
     : batch_allocation_size_(batch_allocation_size),
-      sample_times_(batch_allocation_size_),
-      data_(input_size, batch_allocation_size_) {
+      max_num_samples_(max_num_samples.value_or(0)),
+      sample_times_(max_num_samples_),
+      data_(input_size, max_num_samples_) {
   DRAKE_DEMAND(input_size > 0);
   DRAKE_DEMAND(batch_allocation_size_ > 0);
+  DRAKE_THROW_UNLESS(!max_num_samples || *max_num_samples > 0);
+}
+
+template <typename T>
+void SignalLog<T>::reset() {
+  // Resetting the counters is sufficient to have all future writes and reads
+  // re-initialized to the beginning of the data.  The contiguous storage is
+  // kept for reuse.
+  num_samples_ = 0;
+  num_consolidated_ = 0;
+  ring_start_ = 0;
+  pending_chunks_.clear();
+}
+
+template <typename T>
+T& SignalLog<T>::mutable_time_at(int64_t index) {
+  DRAKE_ASSERT(index >= 0 && index < num_samples_);
+  if (is_bounded()) {
+    return sample_times_((ring_start_ + index) % max_num_samples_);
+  }
+  if (index < num_consolidated_) {
+    return sample_times_(index);
+  }
+  const int64_t pending_index = index - num_consolidated_;
+  return pending_chunks_[pending_index / batch_allocation_size_]
+      .sample_times(pending_index % batch_allocation_size_);
+}
+
+template <typename T>
+Eigen::Block<MatrixX<T>, Eigen::Dynamic, 1, true>
+SignalLog<T>::mutable_data_at(int64_t index) {
+  DRAKE_ASSERT(index >= 0 && index < num_samples_);
+  if (is_bounded()) {
+    return data_.col((ring_start_ + index) % max_num_samples_);
+  }
+  if (index < num_consolidated_) {
+    return data_.col(index);
+  }
+  const int64_t pending_index = index - num_consolidated_;
+  return pending_chunks_[pending_index / batch_allocation_size_].data.col(
+      pending_index % batch_allocation_size_);
 }
 
 template <typename T>
 void SignalLog<T>::AddData(T time, VectorX<T> sample) {
-  if (num_samples_ == 0 || time >= sample_times_(num_samples_ - 1))
+  DRAKE_DEMAND(sample.size() == get_input_size());
+  if (num_samples_ > 0 && !(time >= mutable_time_at(num_samples_ - 1))) {
+    // Overwrite the most recent sample.
+    mutable_time_at(num_samples_ - 1) = time;
+    mutable_data_at(num_samples_ - 1) = sample;
+    return;
+  }
+
+  if (is_bounded()) {
+    if (num_samples_ == max_num_samples_) {
+      // Drop the oldest sample; its storage is reused for the new one.
+      ring_start_ = (ring_start_ + 1) % max_num_samples_;
+    } else {
+      ++num_samples_;
+    }
+  } else {
+    const int64_t num_pending = num_samples_ - num_consolidated_;
+    if (num_pending ==
+        static_cast<int64_t>(pending_chunks_.size()) * batch_allocation_size_) {
+      // All chunks are full; start a new one.  The previously logged data is
+      // never copied here.
+      pending_chunks_.push_back(
+          Chunk{VectorX<T>(batch_allocation_size_),
+                MatrixX<T>(get_input_size(), batch_allocation_size_)});
+    }
     ++num_samples_;
+  }
 
-  // If num_samples exceeds the current allocation, then do a conservative
-  // resize (ouch!).
-  // TODO(russt): change to allocating on a std::vector here and moving into a
-  // single block of contiguous memory on the (first) data access, to avoid the
-  // O(n^2) complexity.
-  if (num_samples_ > sample_times_.size()) {
-    sample_times_.conservativeResize(sample_times_.size() +
-        batch_allocation_size_);
-    data_.conservativeResize(data_.rows(),
-                             data_.cols() + batch_allocation_size_);
-  }
-
-  // Record time and input to the num_samples position.
-  sample_times_(num_samples_ - 1) = time;
-  data_.col(num_samples_ - 1) = sample;
+  // Record time and input to the most recent position.
+  mutable_time_at(num_samples_ - 1) = std::move(time);
+  mutable_data_at(num_samples_ - 1) = sample;
+}
+
+template <typename T>
+void SignalLog<T>::Consolidate() const {
+  if (is_bounded()) {
+    // The buffer only wraps around once it is full; rotate it so that the
+    // oldest sample is in the first column.  Eigen's default storage is
+    // column-major, so each column is a contiguous range of the data.
+    if (ring_start_ != 0) {
+      DRAKE_ASSERT(num_samples_ == max_num_samples_);
+      const int64_t rows = data_.rows();
+      std::rotate(data_.data(), data_.data() + ring_start_ * rows,
+                  data_.data() + max_num_samples_ * rows);
+      std::rotate(sample_times_.data(), sample_times_.data() + ring_start_,
+                  sample_times_.data() + max_num_samples_);
+      ring_start_ = 0;
+    }
+    return;
+  }
+
+  if (num_consolidated_ == num_samples_) return;
+
+  // Grow the contiguous storage geometrically, so that interleaving reads with
+  // writes remains amortized O(1) per sample.
+  if (num_samples_ > data_.cols()) {
+    const int64_t new_size = std::max(num_samples_, 2 * data_.cols());
+    sample_times_.conservativeResize(new_size);
+    data_.conservativeResize(Eigen::NoChange, new_size);
+  }
+
+  int64_t index = num_consolidated_;
+  for (const Chunk& chunk : pending_chunks_) {
+    const int64_t count =
+        std::min<int64_t>(batch_allocation_size_, num_samples_ - index);
+    sample_times_.segment(index, count) = chunk.sample_times.head(count);
+    data_.middleCols(index, count) = chunk.data.leftCols(count);
+    index += count;
+  }
+  DRAKE_DEMAND(index == num_samples_);
+  pending_chunks_.clear();
+  num_consolidated_ = num_samples_;
 }
 
 }  // namespace systems
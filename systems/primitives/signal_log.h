@@ -1,6 +1,9 @@
 #pragma once
 
+#include <vector>
+
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
 
 namespace drake {
@@ -12,6 +15,17 @@ namespace systems {
  primarily intended to support the Drake System primitive SignalLogger, but can
  be used independently.
 
+ New samples are appended to a list of fixed-size chunks, so that adding a
+ sample is O(1) and never copies previously logged data. The chunks are joined
+ into a single contiguous block (which grows geometrically) the next time that
+ sample_times() or data() is called, so the total cost of logging and reading
+ is amortized O(1) per sample.
+
+ Optionally, the log can be bounded to retain only the most recent
+ `max_num_samples` samples, in which case it acts as a ring buffer of fixed
+ size. This is useful for long-running processes (e.g., hardware-in-the-loop)
+ where only recent history is of interest.
+
  @tparam T The vector element type, which must be a valid Eigen scalar.
  */
 template <typename T>
@@ -21,33 +35,46 @@ class SignalLog {
 
   /** Constructs the signal log.
    @param input_size                Dimension of the per-time step data set.
-   @param batch_allocation_size     Storage is (re)allocated in blocks of size
+   @param batch_allocation_size     New samples are stored in chunks of size
                                     (input_size X batch_allocation_size).
+   @param max_num_samples           If provided, only the most recent
+                                    `max_num_samples` samples are retained;
+                                    older samples are discarded. Storage for
+                                    all of them is allocated up front.
   */
-  explicit SignalLog(int input_size, int batch_allocation_size = 1000);
+  explicit SignalLog(int input_size, int batch_allocation_size = 1000,
+                     optional<int> max_num_samples = nullopt);
 
-  /** Returns the number of samples taken since construction or last reset(). */
+  /** Returns the number of samples taken since construction or last reset().
+   For a bounded log, this is at most max_num_samples(). */
   int num_samples() const { return num_samples_; }
 
-  /** Accesses the logged time stamps. */
+  /** Returns the maximum number of samples retained by this log, or nullopt if
+   the log is unbounded. */
+  optional<int> max_num_samples() const {
+    if (max_num_samples_ == 0) return nullopt;
+    return max_num_samples_;
+  }
+
+  /** Accesses the logged time stamps, oldest first. */
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
+    Consolidate();
     return const_cast<const VectorX<T>&>(sample_times_).head(num_samples_);
   }
 
-  /** Accesses the logged data. */
+  /** Accesses the logged data, one sample per column, oldest first. */
   Eigen::Block<const MatrixX<T>, Eigen::Dynamic, Eigen::Dynamic, true> data()
   const {
+    Consolidate();
     return const_cast<const MatrixX<T>&>(data_).leftCols(num_samples_);
   }
 
   /** Clears the logged data. */
-  void reset() {
-    // Resetting num_samples_ is sufficient to have all future writes and
-    // reads re-initialized to the beginning of the data.
-    num_samples_ = 0;
-  }
+  void reset();
 
-  /** Adds a `sample` to the data set with the associated `time` value.
+  /** Adds a `sample` to the data set with the associated `time` value. If
+   `time` precedes the time of the most recent sample, the most recent sample
+   is overwritten instead.
 
    @param time      The time value for this sample.
    @param sample    A vector of data of the declared size for this log.
@@ -58,10 +85,38 @@ class SignalLog {
   int64_t get_input_size() const { return data_.rows(); }
 
  private:
+  // A block of samples that have been logged but not yet copied into the
+  // contiguous storage.  Only used by unbounded logs.
+  struct Chunk {
+    VectorX<T> sample_times;
+    MatrixX<T> data;
+  };
+
+  bool is_bounded() const { return max_num_samples_ > 0; }
+
+  // Returns the storage for the sample with the given index (where index 0 is
+  // the oldest sample currently retained), wherever it currently lives.
+  T& mutable_time_at(int64_t index);
+  Eigen::Block<MatrixX<T>, Eigen::Dynamic, 1, true> mutable_data_at(
+      int64_t index);
+
+  // Moves all pending samples into sample_times_ and data_ so that they hold
+  // the samples contiguously and in order.
+  void Consolidate() const;
+
   const int batch_allocation_size_{1000};
+  // Zero denotes an unbounded log.
+  const int max_num_samples_{0};
 
   // Use mutable variables to hold the logged data.
   mutable int64_t num_samples_{0};
+  // For an unbounded log, the number of samples (the oldest ones) that are
+  // already stored contiguously in sample_times_ and data_; the remaining
+  // samples are stored in order in pending_chunks_.
+  mutable int64_t num_consolidated_{0};
+  mutable std::vector<Chunk> pending_chunks_;
+  // For a bounded log, the column of data_ that holds the oldest sample.
+  mutable int64_t ring_start_{0};
   mutable VectorX<T> sample_times_;
   mutable MatrixX<T> data_;
 };
@@ -6,8 +6,9 @@ namespace drake {
 namespace systems {
 
 template <typename T>
-SignalLogger<T>::SignalLogger(int input_size, int batch_allocation_size)
-    : log_(input_size, batch_allocation_size) {
+SignalLogger<T>::SignalLogger(int input_size, int batch_allocation_size,
+                              optional<int> max_num_samples)
+    : log_(input_size, batch_allocation_size, max_num_samples) {
   this->DeclareInputPort("data", kVectorValued, input_size);
 
   // Use a per-step event by default; disabled by set_publish_period() or
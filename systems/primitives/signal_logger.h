@@ -5,6 +5,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -21,7 +22,8 @@ namespace systems {
 /// data is then retrievable (e.g. after a simulation) via a handful of accessor
 /// methods. This system holds a large, mutable Eigen matrix for data storage,
 /// where each column corresponds to a data point. It saves a data point and
-/// the context time whenever it samples its input.
+/// the context time whenever it samples its input. The log may optionally be
+/// bounded to retain only the most recent samples.
 ///
 /// By default, sampling is performed every time the Simulator completes a
 /// trajectory-advancing substep (that is, via a per-step Publish event), with
@@ -62,17 +64,18 @@ class SignalLogger final : public LeafSystem<T> {
 
   /// Constructs the signal logger system.
   ///
-  /// @warning %SignalLogger may become slower and slower as the number of
-  /// log entries increases due to memory reallocations. You can avoid that by
-  /// providing a `batch_allocation_size` comparable to the total expected
-  /// number of log entries for your simulation.
+  /// Logging a sample is amortized O(1) regardless of `batch_allocation_size`;
+  /// see SignalLog for details.
   ///
   /// @param input_size Dimension of the (single) input port. This corresponds
   /// to the number of rows of the data matrix.
-  /// @param batch_allocation_size Storage is (re)allocated in blocks of
+  /// @param batch_allocation_size New samples are stored in chunks of
   /// input_size-by-batch_allocation_size.
+  /// @param max_num_samples If provided, only the most recent
+  /// `max_num_samples` samples are retained (see SignalLog).
   /// @see LogOutput() helper function for a convenient way to add %logging.
-  explicit SignalLogger(int input_size, int batch_allocation_size = 1000);
+  explicit SignalLogger(int input_size, int batch_allocation_size = 1000,
+                        optional<int> max_num_samples = nullopt);
 
   /// Sets the publishing period of this system to specify periodic sampling
   /// and disables the default per-step sampling. This method can only be called
@@ -92,6 +95,10 @@ class SignalLogger final : public LeafSystem<T> {
   /// Returns the number of samples taken since construction or last reset().
   int num_samples() const { return log_.num_samples(); }
 
+  /// Returns the maximum number of samples retained by this logger, or nullopt
+  /// if it is unbounded.
+  optional<int> max_num_samples() const { return log_.max_num_samples(); }
+
   /// Provides access to the sample times of the logged data. Time is taken
   /// from the Context when the log entry is added.
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
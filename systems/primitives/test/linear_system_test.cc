@@ -1,6 +1,8 @@
 #include "drake/systems/primitives/linear_system.h"
 
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -399,6 +401,41 @@ GTEST_TEST(TestLinearize, ThrowsWithNonPeriodicDiscreteSystem) {
   EXPECT_THROW(Linearize(system, *context), std::runtime_error);
 }
 
+// The Taylor approximation of a LinearSystem gives back its matrices, for
+// numbers of states and inputs that use each of the fixed-size autodiff
+// scalars, and the AutoDiffXd fallback when there are too many.
+GTEST_TEST(TestLinearize, FixedSizeAutoDiff) {
+  const double tol = 1e-12;
+  for (const auto& sizes : std::vector<std::pair<int, int>>{
+           {1, 1}, {3, 2}, {10, 4}, {20, 3}}) {
+    const int num_states = sizes.first;
+    const int num_inputs = sizes.second;
+    const int num_outputs = 2;
+    const Eigen::MatrixXd A = Eigen::MatrixXd::Random(num_states, num_states);
+    const Eigen::MatrixXd B = Eigen::MatrixXd::Random(num_states, num_inputs);
+    const Eigen::MatrixXd C = Eigen::MatrixXd::Random(num_outputs, num_states);
+    const Eigen::MatrixXd D = Eigen::MatrixXd::Random(num_outputs, num_inputs);
+    const LinearSystem<double> system(A, B, C, D);
+    EXPECT_TRUE((system.get_system_scalar_converter()
+                     .IsConvertible<AutoDiffd<16>, double>()));
+
+    auto context = system.CreateDefaultContext();
+    const Eigen::VectorXd x0 = Eigen::VectorXd::LinSpaced(num_states, -1, 1);
+    const Eigen::VectorXd u0 = Eigen::VectorXd::Ones(num_inputs);
+    context->FixInputPort(0, u0);
+    context->get_mutable_continuous_state_vector().SetFromVector(x0);
+    const auto taylor_sys = FirstOrderTaylorApproximation(system, *context);
+    EXPECT_TRUE(CompareMatrices(taylor_sys->A(), A, tol));
+    EXPECT_TRUE(CompareMatrices(taylor_sys->B(), B, tol));
+    EXPECT_TRUE(CompareMatrices(taylor_sys->f0(), Eigen::VectorXd::Zero(
+        num_states), tol));
+    EXPECT_TRUE(CompareMatrices(taylor_sys->C(), C, tol));
+    EXPECT_TRUE(CompareMatrices(taylor_sys->D(), D, tol));
+    EXPECT_TRUE(CompareMatrices(taylor_sys->y0(), Eigen::VectorXd::Zero(
+        num_outputs), tol));
+  }
+}
+
 // Test a few simple systems that are known to be controllable (or not).
 GTEST_TEST(TestLinearize, Controllability) {
   Eigen::Matrix2d A;
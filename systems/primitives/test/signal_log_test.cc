@@ -0,0 +1,109 @@
+#include "drake/systems/primitives/signal_log.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Returns the sample logged at time `t` by the tests below.
+Eigen::Vector2d MakeSample(double t) {
+  return Eigen::Vector2d(t, -2 * t);
+}
+
+// Logs samples spanning many chunks, reading the data back at irregular
+// intervals so that reads interleave with partially filled chunks.
+GTEST_TEST(SignalLogTest, ChunkedStorage) {
+  const int kBatchSize = 7;
+  SignalLog<double> log(2, kBatchSize);
+  EXPECT_EQ(log.num_samples(), 0);
+  EXPECT_EQ(log.data().cols(), 0);
+  EXPECT_FALSE(log.max_num_samples());
+
+  const int kNumSamples = 100;
+  for (int i = 0; i < kNumSamples; ++i) {
+    log.AddData(i, MakeSample(i));
+    if (i % 13 == 0 || i % 29 == 0) {
+      ASSERT_EQ(log.num_samples(), i + 1);
+      ASSERT_EQ(log.sample_times().size(), i + 1);
+      ASSERT_EQ(log.data().cols(), i + 1);
+      EXPECT_EQ(log.sample_times()(i), i);
+      EXPECT_TRUE(CompareMatrices(log.data().col(i), MakeSample(i)));
+    }
+  }
+
+  Eigen::VectorXd expected_times(kNumSamples);
+  Eigen::MatrixXd expected_data(2, kNumSamples);
+  for (int i = 0; i < kNumSamples; ++i) {
+    expected_times(i) = i;
+    expected_data.col(i) = MakeSample(i);
+  }
+  EXPECT_TRUE(CompareMatrices(log.sample_times(), expected_times));
+  EXPECT_TRUE(CompareMatrices(log.data(), expected_data));
+
+  // A sample that goes back in time replaces the most recent sample, whether
+  // it is pending or already consolidated.
+  log.AddData(50, MakeSample(-1));
+  EXPECT_EQ(log.num_samples(), kNumSamples);
+  EXPECT_EQ(log.sample_times()(kNumSamples - 1), 50);
+  EXPECT_TRUE(CompareMatrices(log.data().col(kNumSamples - 1), MakeSample(-1)));
+  log.AddData(kNumSamples, MakeSample(kNumSamples));
+  log.AddData(0, MakeSample(-3));
+  EXPECT_EQ(log.num_samples(), kNumSamples + 1);
+  EXPECT_EQ(log.sample_times()(kNumSamples), 0);
+  EXPECT_TRUE(CompareMatrices(log.data().col(kNumSamples), MakeSample(-3)));
+
+  log.reset();
+  EXPECT_EQ(log.num_samples(), 0);
+  EXPECT_EQ(log.data().cols(), 0);
+  log.AddData(3, MakeSample(3));
+  EXPECT_EQ(log.num_samples(), 1);
+  EXPECT_TRUE(CompareMatrices(log.data().col(0), MakeSample(3)));
+}
+
+// A bounded log keeps only the most recent samples, oldest first.
+GTEST_TEST(SignalLogTest, RingBuffer) {
+  const int kMaxNumSamples = 5;
+  SignalLog<double> log(2, 1000, kMaxNumSamples);
+  EXPECT_EQ(*log.max_num_samples(), kMaxNumSamples);
+
+  for (int i = 0; i < 3; ++i) {
+    log.AddData(i, MakeSample(i));
+  }
+  EXPECT_EQ(log.num_samples(), 3);
+  EXPECT_TRUE(CompareMatrices(log.sample_times(), Eigen::Vector3d(0, 1, 2)));
+
+  // Wrap around several times, reading in the middle of a lap.
+  for (int i = 3; i < 12; ++i) {
+    log.AddData(i, MakeSample(i));
+  }
+  EXPECT_EQ(log.num_samples(), kMaxNumSamples);
+  for (int i = 12; i < 23; ++i) {
+    log.AddData(i, MakeSample(i));
+  }
+  ASSERT_EQ(log.num_samples(), kMaxNumSamples);
+  for (int k = 0; k < kMaxNumSamples; ++k) {
+    const double t = 23 - kMaxNumSamples + k;
+    EXPECT_EQ(log.sample_times()(k), t);
+    EXPECT_TRUE(CompareMatrices(log.data().col(k), MakeSample(t)));
+  }
+
+  // Overwriting the most recent sample does not drop the oldest one.
+  log.AddData(0, MakeSample(-1));
+  EXPECT_EQ(log.sample_times()(0), 18);
+  EXPECT_EQ(log.sample_times()(kMaxNumSamples - 1), 0);
+
+  log.reset();
+  EXPECT_EQ(log.num_samples(), 0);
+  log.AddData(1, MakeSample(1));
+  EXPECT_TRUE(CompareMatrices(log.sample_times(), Vector1d(1)));
+
+  EXPECT_THROW(SignalLog<double>(2, 1000, 0), std::exception);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
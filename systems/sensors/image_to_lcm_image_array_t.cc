@@ -1,9 +1,11 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+#include <fmt/format.h>
 #include <zlib.h>
 #include "robotlocomotion/image_array_t.hpp"
 #include "robotlocomotion/image_t.hpp"
@@ -22,24 +24,36 @@ namespace {
 const int64_t kSecToMillisec = 1000000;
 
 template <PixelType kPixelType>
-void Compress(const Image<kPixelType>& image, image_t* msg) {
+void Compress(const Image<kPixelType>& image,
+              const LcmImageCompressionOptions& options, image_t* msg) {
   msg->compression_method = image_t::COMPRESSION_METHOD_ZLIB;
 
-  const int source_size = image.width() * image.height() * image.kPixelSize;
-  // The destination buf_size must be slightly larger than the source size.
-  // http://refspecs.linuxbase.org/LSB_3.0.0/LSB-PDA/LSB-PDA/zlib-compress2-1.html
-  size_t buf_size = source_size * 1.001 + 12;
-  std::unique_ptr<uint8_t[]> buf(new uint8_t[buf_size]);
-
-  auto compress_status = compress2(
-      buf.get(), &buf_size, reinterpret_cast<const Bytef*>(image.at(0, 0)),
-      source_size, Z_BEST_SPEED);
+  const bool fast =
+      options.method == LcmImageCompressionOptions::Method::kFastZlib;
+  // With the default strategy, window and memory level, this is what
+  // compress2() does.
+  z_stream stream{};
+  auto status = deflateInit2(
+      &stream, fast ? Z_BEST_SPEED : options.zlib_level, Z_DEFLATED,
+      15 /* windowBits */, 8 /* memLevel */,
+      fast ? Z_RLE : Z_DEFAULT_STRATEGY);
+  DRAKE_DEMAND(status == Z_OK);
 
-  DRAKE_DEMAND(compress_status == Z_OK);
+  const int source_size = image.width() * image.height() * image.kPixelSize;
+  // Deflate directly into the message, whose buffer keeps its capacity from
+  // one message to the next.
+  msg->data.resize(deflateBound(&stream, source_size));
+  stream.next_in =
+      const_cast<Bytef*>(reinterpret_cast<const Bytef*>(image.at(0, 0)));
+  stream.avail_in = source_size;
+  stream.next_out = msg->data.data();
+  stream.avail_out = msg->data.size();
+  status = deflate(&stream, Z_FINISH);
+  DRAKE_DEMAND(status == Z_STREAM_END);
 
-  msg->data.resize(buf_size);
-  msg->size = buf_size;
-  memcpy(&msg->data[0], buf.get(), buf_size);
+  msg->size = stream.total_out;
+  msg->data.resize(msg->size);
+  deflateEnd(&stream);
 }
 
 template <PixelType kPixelType>
@@ -53,8 +67,9 @@ void Pack(const Image<kPixelType>& image, image_t* msg) {
 }
 
 template <PixelType kPixelType>
-void PackImageToLcmImageT(const Image<kPixelType>& image, image_t* msg,
-                          bool do_compress) {
+void PackImageToLcmImageT(const Image<kPixelType>& image,
+                          const LcmImageCompressionOptions& options,
+                          image_t* msg) {
   // TODO(kunimatsu-tri) Fix seq here that is always set to zero.
   msg->header.seq = 0;
   msg->width = image.width();
@@ -65,17 +80,18 @@ void PackImageToLcmImageT(const Image<kPixelType>& image, image_t* msg,
       LcmPixelTraits<ImageTraits<kPixelType>::kPixelFormat>::kPixelFormat;
   msg->channel_type = LcmImageTraits<kPixelType>::kChannelType;
 
-  if (do_compress) {
-    Compress(image, msg);
-  } else {
+  if (options.method == LcmImageCompressionOptions::Method::kNone) {
     Pack(image, msg);
+  } else {
+    Compress(image, options, msg);
   }
 }
 
 void PackImageToLcmImageT(const AbstractValue& untyped_image,
                           PixelType pixel_type, int64_t utime,
-                          const string& frame_name, image_t* msg,
-                          bool do_compress) {
+                          const string& frame_name,
+                          const LcmImageCompressionOptions& options,
+                          image_t* msg) {
   msg->header.utime = utime;
   msg->header.frame_name = frame_name;
 
@@ -83,49 +99,49 @@ void PackImageToLcmImageT(const AbstractValue& untyped_image,
     case PixelType::kRgb8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kRgb8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, options, msg);
       break;
     }
     case PixelType::kBgr8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kBgr8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, options, msg);
       break;
     }
     case PixelType::kRgba8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kRgba8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, options, msg);
       break;
     }
     case PixelType::kBgra8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kBgra8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, options, msg);
       break;
     }
     case PixelType::kGrey8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kGrey8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, options, msg);
       break;
     }
     case PixelType::kDepth16U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kDepth16U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, options, msg);
       break;
     }
     case PixelType::kDepth32F: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kDepth32F>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, options, msg);
       break;
     }
     case PixelType::kLabel16I: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kLabel16I>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, options, msg);
       break;
     }
     case PixelType::kExpr:
@@ -133,10 +149,43 @@ void PackImageToLcmImageT(const AbstractValue& untyped_image,
   }
 }
 
+LcmImageCompressionOptions MakeCompressionOptions(bool do_compress) {
+  LcmImageCompressionOptions options;
+  options.method = do_compress ? LcmImageCompressionOptions::Method::kZlib
+                              : LcmImageCompressionOptions::Method::kNone;
+  options.zlib_level = Z_BEST_SPEED;
+  return options;
+}
+
+const LcmImageCompressionOptions& ValidateCompressionOptions(
+    const LcmImageCompressionOptions& options) {
+  if (options.zlib_level < 1 || options.zlib_level > 9) {
+    throw std::logic_error(fmt::format(
+        "ImageToLcmImageArrayT: the zlib level must be in [1, 9], not {}",
+        options.zlib_level));
+  }
+  if (options.num_threads < 1) {
+    throw std::logic_error(
+        "ImageToLcmImageArrayT: the number of threads must be positive");
+  }
+  return options;
+}
+
+std::unique_ptr<drake::internal::ThreadPool> MakeThreadPool(
+    const LcmImageCompressionOptions& options) {
+  if (options.num_threads == 1) return nullptr;
+  return std::make_unique<drake::internal::ThreadPool>(options.num_threads);
+}
+
 }  // anonymous namespace
 
 ImageToLcmImageArrayT::ImageToLcmImageArrayT(bool do_compress)
-    : do_compress_(do_compress) {
+    : ImageToLcmImageArrayT(MakeCompressionOptions(do_compress)) {}
+
+ImageToLcmImageArrayT::ImageToLcmImageArrayT(
+    const LcmImageCompressionOptions& compression_options)
+    : compression_options_(ValidateCompressionOptions(compression_options)),
+      thread_pool_(MakeThreadPool(compression_options_)) {
   image_array_t_msg_output_port_index_ =
       DeclareAbstractOutputPort(&ImageToLcmImageArrayT::CalcImageArray)
           .get_index();
@@ -146,7 +195,16 @@ ImageToLcmImageArrayT::ImageToLcmImageArrayT(const string& color_frame_name,
                                              const string& depth_frame_name,
                                              const string& label_frame_name,
                                              bool do_compress)
-    : do_compress_(do_compress) {
+    : ImageToLcmImageArrayT(color_frame_name, depth_frame_name,
+                            label_frame_name,
+                            MakeCompressionOptions(do_compress)) {}
+
+ImageToLcmImageArrayT::ImageToLcmImageArrayT(
+    const string& color_frame_name, const string& depth_frame_name,
+    const string& label_frame_name,
+    const LcmImageCompressionOptions& compression_options)
+    : compression_options_(ValidateCompressionOptions(compression_options)),
+      thread_pool_(MakeThreadPool(compression_options_)) {
   color_image_input_port_index_ =
       DeclareImageInputPort<PixelType::kRgba8U>(color_frame_name).get_index();
   depth_image_input_port_index_ =
@@ -183,19 +241,30 @@ void ImageToLcmImageArrayT::CalcImageArray(
     const systems::Context<double>& context, image_array_t* msg) const {
   msg->header.utime = static_cast<int64_t>(context.get_time() * kSecToMillisec);
   msg->header.frame_name.clear();
-  msg->num_images = 0;
-  msg->images.clear();
 
-  for (int i = 0; i < get_num_input_ports(); i++) {
-    const auto& image_value = this->get_input_port(i).
-        template Eval<AbstractValue>(context);
+  // The inputs are evaluated on this thread; only the packing is concurrent.
+  const int num_images = get_num_input_ports();
+  std::vector<const AbstractValue*> image_values(num_images);
+  for (int i = 0; i < num_images; i++) {
+    image_values[i] =
+        &this->get_input_port(i).template Eval<AbstractValue>(context);
+  }
 
-    image_t image_msg;
-    PackImageToLcmImageT(image_value, input_port_pixel_type_[i],
+  // Resizing the images of the previous message, rather than replacing them,
+  // reuses the buffers of their data.
+  msg->num_images = num_images;
+  msg->images.resize(num_images);
+  auto pack_image = [&](int i) {
+    PackImageToLcmImageT(*image_values[i], input_port_pixel_type_[i],
                          msg->header.utime, this->get_input_port(i).get_name(),
-                         &image_msg, do_compress_);
-    msg->images.push_back(image_msg);
-    msg->num_images++;
+                         compression_options_, &msg->images[i]);
+  };
+  if (thread_pool_) {
+    thread_pool_->ParallelFor(num_images, pack_image);
+  } else {
+    for (int i = 0; i < num_images; i++) {
+      pack_image(i);
+    }
   }
 }
 
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "robotlocomotion/image_array_t.hpp"
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/thread_pool.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/sensors/image.h"
 #include "drake/systems/sensors/pixel_types.h"
@@ -14,6 +16,35 @@ namespace drake {
 namespace systems {
 namespace sensors {
 
+/// How an ImageToLcmImageArrayT compresses the images of its messages.
+struct LcmImageCompressionOptions {
+  enum class Method {
+    /// The pixels are copied uncompressed
+    /// (COMPRESSION_METHOD_NOT_COMPRESSED).
+    kNone,
+    /// The pixels are deflated by zlib at `zlib_level`
+    /// (COMPRESSION_METHOD_ZLIB).
+    kZlib,
+    /// The pixels are deflated by zlib at its fastest level, with run-length
+    /// encoding only (no search for longer matches).  This is several times
+    /// faster than kZlib and still compresses the large uniform areas of
+    /// rendered depth and label images well.  The images are sent as
+    /// COMPRESSION_METHOD_ZLIB, so any receiver can decode them.
+    kFastZlib,
+  };
+
+  /// The compression method.
+  Method method{Method::kZlib};
+
+  /// The zlib compression level of Method::kZlib, from 1 (fastest) to 9
+  /// (smallest).
+  int zlib_level{1};
+
+  /// The number of threads that compress the images of one message
+  /// concurrently.
+  int num_threads{1};
+};
+
 /// An ImageToLcmImageArrayT takes as input an ImageRgba8U, ImageDepth32F and
 /// ImageLabel16I. This system outputs an AbstractValue containing a
 /// `Value<robotlocomotion::image_array_t>` LCM message that defines an array
@@ -32,13 +63,22 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   /// @param color_frame_name The frame name used for color image.
   /// @param depth_frame_name The frame name used for depth image.
   /// @param label_frame_name The frame name used for label image.
-  /// @param do_compress When true, zlib compression will be performed. The
-  /// default is false.
+  /// @param do_compress When true, zlib compression will be performed at its
+  /// fastest level. The default is false.
   ImageToLcmImageArrayT(const std::string& color_frame_name,
                         const std::string& depth_frame_name,
                         const std::string& label_frame_name,
                         bool do_compress = false);
 
+  /// Like the constructor above, but compresses the images as described by
+  /// `compression_options`, which cannot be changed afterwards.
+  /// @throws std::logic_error if `compression_options.zlib_level` is not in
+  /// [1, 9] or `compression_options.num_threads` is less than one.
+  ImageToLcmImageArrayT(const std::string& color_frame_name,
+                        const std::string& depth_frame_name,
+                        const std::string& label_frame_name,
+                        const LcmImageCompressionOptions& compression_options);
+
   /// Returns the input port containing a color image.
   /// Note: Only valid if the color/depth/label constructor is used.
   const InputPort<double>& color_image_input_port() const;
@@ -59,6 +99,17 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   /// methods to declare them.
   explicit ImageToLcmImageArrayT(bool do_compress = false);
 
+  /// Like the constructor above, but compresses the images as described by
+  /// `compression_options`, which cannot be changed afterwards.
+  /// @throws std::logic_error if `compression_options.zlib_level` is not in
+  /// [1, 9] or `compression_options.num_threads` is less than one.
+  explicit ImageToLcmImageArrayT(
+      const LcmImageCompressionOptions& compression_options);
+
+  const LcmImageCompressionOptions& compression_options() const {
+    return compression_options_;
+  }
+
   template <PixelType kPixelType>
   const InputPort<double>& DeclareImageInputPort(const std::string& name) {
     input_port_pixel_type_.push_back(kPixelType);
@@ -76,7 +127,11 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   int image_array_t_msg_output_port_index_{-1};
 
   std::vector<PixelType> input_port_pixel_type_{};
-  const bool do_compress_;
+  // These are only set on construction, so that CalcImageArray() never races
+  // with a change of options.
+  const LcmImageCompressionOptions compression_options_;
+  // Null when the images are packed on a single thread.
+  const std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
 };
 
 }  // namespace sensors
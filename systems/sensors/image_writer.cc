@@ -2,14 +2,20 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include <spruce.hh>
 #include <vtkImageData.h>
-#include <vtkNew.h>
 #include <vtkPNGWriter.h>
 #include <vtkSmartPointer.h>
 #include <vtkTIFFWriter.h>
@@ -19,30 +25,29 @@ namespace drake {
 namespace systems {
 namespace sensors {
 
+namespace {
+
+// Copies the image into a new vtkImageData, whose rows are in the opposite
+// order (VTK's origin is the bottom-left corner of the image).
 template <PixelType kPixelType>
-void SaveToFileHelper(const Image<kPixelType>& image,
-                      const std::string& file_path) {
+vtkSmartPointer<vtkImageData> MakeVtkImage(const Image<kPixelType>& image) {
   const int width = image.width();
   const int height = image.height();
   const int num_channels = Image<kPixelType>::kNumChannels;
 
-  vtkSmartPointer<vtkImageWriter> writer;
-  vtkNew<vtkImageData> vtk_image;
+  auto vtk_image = vtkSmartPointer<vtkImageData>::New();
   vtk_image->SetDimensions(width, height, 1);
 
   // NOTE: This excludes *many* of the defined `PixelType` values.
   switch (kPixelType) {
     case PixelType::kRgba8U:
       vtk_image->AllocateScalars(VTK_UNSIGNED_CHAR, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
       break;
     case PixelType::kDepth32F:
       vtk_image->AllocateScalars(VTK_FLOAT, num_channels);
-      writer = vtkSmartPointer<vtkTIFFWriter>::New();
       break;
     case PixelType::kLabel16I:
       vtk_image->AllocateScalars(VTK_UNSIGNED_SHORT, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
       break;
     default:
       throw std::logic_error(
@@ -63,12 +68,63 @@ void SaveToFileHelper(const Image<kPixelType>& image,
       image_ptr += num_scalar_components;
     }
   }
+  return vtk_image;
+}
+
+// Encodes the image made by MakeVtkImage() in the file format of the pixel
+// type, with the compression of the options, and writes it to file_path.
+void WriteVtkImage(vtkImageData* vtk_image, PixelType pixel_type,
+                   const std::string& file_path,
+                   const ImageWriterOptions& options) {
+  vtkSmartPointer<vtkImageWriter> writer;
+  switch (pixel_type) {
+    case PixelType::kRgba8U:
+    case PixelType::kLabel16I: {
+      auto png_writer = vtkSmartPointer<vtkPNGWriter>::New();
+      if (options.png_compression_level >= 0) {
+        png_writer->SetCompressionLevel(options.png_compression_level);
+      }
+      writer = png_writer;
+      break;
+    }
+    case PixelType::kDepth32F: {
+      auto tiff_writer = vtkSmartPointer<vtkTIFFWriter>::New();
+      switch (options.tiff_compression) {
+        case ImageWriterOptions::TiffCompression::kPackBits:
+          tiff_writer->SetCompressionToPackBits();
+          break;
+        case ImageWriterOptions::TiffCompression::kNone:
+          tiff_writer->SetCompressionToNoCompression();
+          break;
+        case ImageWriterOptions::TiffCompression::kDeflate:
+          tiff_writer->SetCompressionToDeflate();
+          break;
+        case ImageWriterOptions::TiffCompression::kLzw:
+          tiff_writer->SetCompressionToLZW();
+          break;
+      }
+      writer = tiff_writer;
+      break;
+    }
+    default:
+      throw std::logic_error(
+          "Unsupported image type; cannot be written to file");
+  }
 
   writer->SetFileName(file_path.c_str());
-  writer->SetInputData(vtk_image.GetPointer());
+  writer->SetInputData(vtk_image);
   writer->Write();
 }
 
+}  // namespace
+
+template <PixelType kPixelType>
+void SaveToFileHelper(const Image<kPixelType>& image,
+                      const std::string& file_path,
+                      const ImageWriterOptions& options = {}) {
+  WriteVtkImage(MakeVtkImage(image), kPixelType, file_path, options);
+}
+
 void SaveToPng(const ImageRgba8U& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
@@ -81,7 +137,157 @@ void SaveToPng(const ImageLabel16I& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
 
-ImageWriter::ImageWriter() {
+// A bounded queue of images, which are encoded and written by a fixed set of
+// threads.
+class ImageWriter::AsyncWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncWriter)
+
+  explicit AsyncWriter(const ImageWriterOptions& options) : options_(options) {
+    for (int i = 0; i < options_.num_writer_threads; ++i) {
+      threads_.emplace_back([this]() { Run(); });
+    }
+  }
+
+  // Lets the threads write the queued images, then joins them.
+  ~AsyncWriter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    not_empty_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  // Queues the image to be written to file_path, after waiting for room in
+  // the queue if it is full. Rethrows (instead) the first error of writing
+  // an earlier image, if it has not been reported yet.
+  void Push(vtkSmartPointer<vtkImageData> vtk_image, PixelType pixel_type,
+            std::string file_path) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    RethrowError();
+    if (static_cast<int>(queue_.size()) >= options_.max_queue_size) {
+      const auto start = std::chrono::steady_clock::now();
+      not_full_.wait(lock, [this]() {
+        return static_cast<int>(queue_.size()) < options_.max_queue_size;
+      });
+      ++statistics_.num_blocked;
+      statistics_.blocked_time += std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count();
+    }
+    queue_.push_back(
+        QueuedImage{std::move(vtk_image), pixel_type, std::move(file_path)});
+    ++statistics_.num_queued;
+    statistics_.peak_queue_size = std::max(statistics_.peak_queue_size,
+                                           static_cast<int>(queue_.size()));
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  // Blocks until every image queued so far has been written (or has failed
+  // to be), then rethrows the first error of writing an image, if it has not
+  // been reported yet.
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    written_.wait(lock, [this]() {
+      return statistics_.num_written == statistics_.num_queued;
+    });
+    RethrowError();
+  }
+
+  ImageWriterQueueStatistics statistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+  }
+
+ private:
+  struct QueuedImage {
+    vtkSmartPointer<vtkImageData> vtk_image;
+    PixelType pixel_type;
+    std::string file_path;
+  };
+
+  // The loop of each thread, which writes queued images until it is stopped
+  // and the queue is empty.
+  void Run() {
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_empty_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      QueuedImage image = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      not_full_.notify_one();
+
+      // An error must not escape the thread; it is reported by the next call
+      // to Push() or Wait() instead.
+      std::exception_ptr error;
+      try {
+        WriteVtkImage(image.vtk_image, image.pixel_type, image.file_path,
+                      options_);
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      lock.lock();
+      if (error && !error_) {
+        error_ = error;
+      }
+      ++statistics_.num_written;
+      lock.unlock();
+      written_.notify_all();
+    }
+  }
+
+  // Rethrows error_, if any, and clears it.
+  // @pre mutex_ is locked.
+  void RethrowError() {
+    if (error_) {
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  const ImageWriterOptions options_;
+  std::vector<std::thread> threads_;
+
+  // Guards the members below.
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::condition_variable written_;
+  std::deque<QueuedImage> queue_;
+  ImageWriterQueueStatistics statistics_;
+  bool stop_{false};
+  // The first error of writing an image that has not been reported yet.
+  std::exception_ptr error_;
+};
+
+ImageWriter::ImageWriter() : ImageWriter(ImageWriterOptions{}) {}
+
+ImageWriter::ImageWriter(const ImageWriterOptions& options)
+    : options_(options) {
+  if (options.png_compression_level < -1 ||
+      options.png_compression_level > 9) {
+    throw std::logic_error(
+        "ImageWriter: the PNG compression level must be in [-1, 9]");
+  }
+  if (options.num_writer_threads < 0) {
+    throw std::logic_error(
+        "ImageWriter: the number of writer threads cannot be negative");
+  }
+  if (options.max_queue_size <= 0) {
+    throw std::logic_error("ImageWriter: the queue size must be positive");
+  }
+  if (options.num_writer_threads > 0) {
+    async_writer_ = std::make_unique<AsyncWriter>(options);
+  }
+
   // NOTE: This excludes *many* of the defined `PixelType` values.
   labels_[PixelType::kRgba8U] = "color";
   extensions_[PixelType::kRgba8U] = ".png";
@@ -91,6 +297,21 @@ ImageWriter::ImageWriter() {
   extensions_[PixelType::kDepth32F] = ".tiff";
 }
 
+ImageWriter::~ImageWriter() = default;
+
+void ImageWriter::WaitForQueuedImages() const {
+  if (async_writer_ != nullptr) {
+    async_writer_->Wait();
+  }
+}
+
+ImageWriterQueueStatistics ImageWriter::GetQueueStatistics() const {
+  if (async_writer_ != nullptr) {
+    return async_writer_->statistics();
+  }
+  return ImageWriterQueueStatistics{};
+}
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -163,9 +384,16 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  SaveToFileHelper(
-      image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                          port.get_name(), data.count++));
+  std::string file_name = MakeFileName(data.format, data.pixel_type,
+                                       context.get_time(), port.get_name(),
+                                       data.count++);
+  if (async_writer_ != nullptr) {
+    // The conversion to VTK's layout is the only copy of the image; the
+    // writer threads take ownership of it.
+    async_writer_->Push(MakeVtkImage(image), kPixelType, std::move(file_name));
+  } else {
+    SaveToFileHelper(image, file_name, options_);
+  }
 }
 
 std::string ImageWriter::MakeFileName(const std::string& format,
@@ -6,6 +6,8 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -46,6 +48,55 @@ void SaveToPng(const ImageLabel16I& image, const std::string& file_path);
 
 //@}
 
+/** Configures how an ImageWriter encodes its images, and whether it writes
+ them within Publish() or in the background.  */
+struct ImageWriterOptions {
+  /** The compression of the TIFF files (depth images).  */
+  enum class TiffCompression { kPackBits, kNone, kDeflate, kLzw };
+
+  /** The zlib compression level of the PNG files (color and label images),
+   from 0 (no compression, the fastest) to 9 (the smallest files), or -1 for
+   the default level of the encoder.  */
+  int png_compression_level{-1};
+
+  /** The compression of the TIFF files.  */
+  TiffCompression tiff_compression{TiffCompression::kPackBits};
+
+  /** If positive, images are written asynchronously by this many background
+   threads: Publish() only copies the image into the layout of the encoder
+   and queues it with its file name, and the threads encode the queued images
+   and write their files. If zero, Publish() writes the files itself. Both
+   modes write the same files. An error of a writer thread is thrown by the
+   next Publish() or ImageWriter::WaitForQueuedImages().  */
+  int num_writer_threads{0};
+
+  /** The maximum number of images waiting to be written asynchronously. When
+   the queue is full, Publish() blocks until a writer thread takes an image
+   from it (see ImageWriter::GetQueueStatistics()).  */
+  int max_queue_size{16};
+};
+
+/** Statistics of the asynchronous writing of an ImageWriter, which tell
+ whether the writer threads keep up with the images.  */
+struct ImageWriterQueueStatistics {
+  /** The number of images queued so far.  */
+  int64_t num_queued{0};
+
+  /** The number of queued images whose file has been written (or has failed
+   to be written).  */
+  int64_t num_written{0};
+
+  /** The number of times Publish() waited for room in the full queue.  */
+  int64_t num_blocked{0};
+
+  /** The total time (in seconds) that Publish() waited for room in the full
+   queue.  */
+  double blocked_time{0};
+
+  /** The largest number of images that waited in the queue at once.  */
+  int peak_queue_size{0};
+};
+
 /** A system for periodically writing images to the file system. The system does
  not have a fixed set of input ports; the system can have an arbitrary number of
  image input ports. Each input port is independently configured with respect to:
@@ -77,7 +128,11 @@ void SaveToPng(const ImageLabel16I& image, const std::string& file_path);
  that function's documentation for elaboration on how to configure image output.
  It is important to note, that every declared image input port _must_ be
  connected; otherwise, attempting to write an image from that port, will cause
- an error in the system.  */
+ an error in the system.
+
+ By default, the images are written within Publish(), which stalls the
+ simulation while they are compressed and written to disk. See
+ ImageWriterOptions to write them from background threads instead.  */
 class ImageWriter : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter)
@@ -85,6 +140,29 @@ class ImageWriter : public LeafSystem<double> {
   /** Constructs default instance with no image ports.  */
   ImageWriter();
 
+  /** Constructs an instance with no image ports, which encodes and writes
+   images as configured by `options`.
+   @throws std::logic_error if `options.png_compression_level` is not in
+                            [-1, 9], `options.num_writer_threads` is negative
+                            or `options.max_queue_size` is not positive.  */
+  explicit ImageWriter(const ImageWriterOptions& options);
+
+  /** Waits for the queued images to be written (see
+   WaitForQueuedImages()) and stops the writer threads.  */
+  ~ImageWriter() override;
+
+  const ImageWriterOptions& options() const { return options_; }
+
+  /** Blocks until every image queued so far has been written to disk. This
+   returns immediately if images are written synchronously.
+   @throws std::exception the first error of writing a queued image, if
+   neither this method nor Publish() has thrown it yet.  */
+  void WaitForQueuedImages() const;
+
+  /** Returns the statistics of the asynchronous writes so far (all zero if
+   images are written synchronously).  */
+  ImageWriterQueueStatistics GetQueueStatistics() const;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -249,6 +327,13 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  const ImageWriterOptions options_;
+
+  // The queue and threads writing the images when
+  // options_.num_writer_threads is positive; null otherwise.
+  class AsyncWriter;
+  std::unique_ptr<AsyncWriter> async_writer_;
 };
 
 }  // namespace sensors
@@ -159,12 +159,14 @@ bool DecompressJpeg(const image_t* lcm_image, Image<kPixelType>* image) {
 template <PixelType kPixelType>
 bool DecompressZlib(const image_t* lcm_image, Image<kPixelType>* image) {
   // NOLINTNEXTLINE(runtime/int)
-  unsigned long dest_len =
+  const unsigned long image_size =
       image->width() * image->height() * image->kPixelSize;
+  // NOLINTNEXTLINE(runtime/int)
+  unsigned long dest_len = image_size;
   const int status = uncompress(
       reinterpret_cast<Bytef*>(image->at(0, 0)), &dest_len,
       lcm_image->data.data(), lcm_image->size);
-  if (status != Z_OK) {
+  if (status != Z_OK || dest_len != image_size) {
     drake::log()->error("zlib decompression failed on incoming LCM image: {}",
                         status);
     *image = Image<kPixelType>();
@@ -173,6 +175,16 @@ bool DecompressZlib(const image_t* lcm_image, Image<kPixelType>* image) {
   return true;
 }
 
+// Gives @p image the size of @p lcm_image, leaving its pixels unspecified when
+// it already has that size.
+template <PixelType kPixelType>
+void ResizeForOverwrite(const image_t* lcm_image, Image<kPixelType>* image) {
+  if (image->width() != lcm_image->width ||
+      image->height() != lcm_image->height) {
+    image->resize(lcm_image->width, lcm_image->height);
+  }
+}
+
 template <PixelType kPixelType>
 bool UnpackLcmImage(const image_t* lcm_image, Image<kPixelType>* image) {
   DRAKE_DEMAND(lcm_image->pixel_format ==
@@ -180,20 +192,34 @@ bool UnpackLcmImage(const image_t* lcm_image, Image<kPixelType>* image) {
   DRAKE_DEMAND(lcm_image->channel_type ==
                LcmImageTraits<kPixelType>::kChannelType);
 
-  image->resize(lcm_image->width, lcm_image->height);
-
   switch (lcm_image->compression_method) {
+    // These overwrite every pixel, so an image that already has the right
+    // size, e.g. the output of the previous message, is reused as is instead
+    // of being cleared first.
     case image_t::COMPRESSION_METHOD_NOT_COMPRESSED: {
-      memcpy(image->at(0, 0), lcm_image->data.data(), image->size());
+      ResizeForOverwrite(lcm_image, image);
+      const size_t image_size = image->size() * sizeof(*image->at(0, 0));
+      if (static_cast<size_t>(lcm_image->size) != image_size ||
+          lcm_image->data.size() != image_size) {
+        drake::log()->error(
+            "Malformed incoming LCM image: {} bytes of data, expected {}",
+            lcm_image->size, image_size);
+        *image = Image<kPixelType>();
+        return false;
+      }
+      memcpy(image->at(0, 0), lcm_image->data.data(), image_size);
       return true;
     }
     case image_t::COMPRESSION_METHOD_ZLIB: {
+      ResizeForOverwrite(lcm_image, image);
       return DecompressZlib(lcm_image, image);
     }
     case image_t::COMPRESSION_METHOD_JPEG: {
+      image->resize(lcm_image->width, lcm_image->height);
       return DecompressJpeg(lcm_image, image);
     }
     case image_t::COMPRESSION_METHOD_PNG: {
+      image->resize(lcm_image->width, lcm_image->height);
       return DecompressPng(lcm_image, image);
     }
     default: {
@@ -1,6 +1,11 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
 #include <gtest/gtest.h>
+#include <zlib.h>
 #include "robotlocomotion/image_array_t.hpp"
 
 #include "drake/systems/sensors/image.h"
@@ -126,6 +131,114 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
          image_t::COMPRESSION_METHOD_NOT_COMPRESSED);
 }
 
+// Returns the pixels of @p image, decompressing them if needed.
+std::vector<uint8_t> DecodeData(const image_t& image) {
+  if (image.compression_method == image_t::COMPRESSION_METHOD_NOT_COMPRESSED) {
+    return image.data;
+  }
+  EXPECT_EQ(image.compression_method, image_t::COMPRESSION_METHOD_ZLIB);
+  std::vector<uint8_t> pixels(image.row_stride * image.height);
+  // NOLINTNEXTLINE(runtime/int)
+  unsigned long size = pixels.size();
+  EXPECT_EQ(uncompress(pixels.data(), &size, image.data.data(), image.size),
+            Z_OK);
+  EXPECT_EQ(size, pixels.size());
+  return pixels;
+}
+
+template <PixelType kPixelType>
+bool HasPixels(const std::vector<uint8_t>& pixels,
+               const Image<kPixelType>& image) {
+  const int size = image.width() * image.height() * image.kPixelSize;
+  return static_cast<int>(pixels.size()) == size &&
+      std::memcmp(pixels.data(), image.at(0, 0), size) == 0;
+}
+
+GTEST_TEST(ImageToLcmImageArrayT, CompressionOptions) {
+  // Large enough images with uniform areas, like rendered ones.
+  const int width = 64;
+  const int height = 48;
+  ImageRgba8U color_image(width, height);
+  ImageDepth32F depth_image(width, height);
+  ImageLabel16I label_image(width, height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      for (int c = 0; c < 4; ++c) {
+        color_image.at(x, y)[c] = (x / 8 + y / 8 + c) % 256;
+      }
+      depth_image.at(x, y)[0] = x < width / 2 ? 1.5f : 0.25f * y;
+      label_image.at(x, y)[0] = y < height / 3 ? 7 : x % 5;
+    }
+  }
+
+  using Method = LcmImageCompressionOptions::Method;
+  struct TestCase {
+    Method method;
+    int zlib_level;
+    int num_threads;
+    uint8_t compression_method;
+  };
+  const std::vector<TestCase> test_cases{
+      {Method::kNone, 1, 1, image_t::COMPRESSION_METHOD_NOT_COMPRESSED},
+      {Method::kNone, 1, 3, image_t::COMPRESSION_METHOD_NOT_COMPRESSED},
+      {Method::kZlib, 6, 1, image_t::COMPRESSION_METHOD_ZLIB},
+      {Method::kZlib, 6, 3, image_t::COMPRESSION_METHOD_ZLIB},
+      {Method::kFastZlib, 1, 1, image_t::COMPRESSION_METHOD_ZLIB},
+      {Method::kFastZlib, 1, 3, image_t::COMPRESSION_METHOD_ZLIB},
+  };
+
+  std::vector<robotlocomotion::image_array_t> messages;
+  for (const TestCase& test_case : test_cases) {
+    LcmImageCompressionOptions options;
+    options.method = test_case.method;
+    options.zlib_level = test_case.zlib_level;
+    options.num_threads = test_case.num_threads;
+    ImageToLcmImageArrayT dut(
+        kColorFrameName, kDepthFrameName, kLabelFrameName, options);
+    EXPECT_EQ(dut.compression_options().num_threads, test_case.num_threads);
+
+    const auto message =
+        SetUpInputAndOutput(&dut, color_image, depth_image, label_image);
+    ASSERT_EQ(message.num_images, 3);
+    ASSERT_EQ(message.images.size(), 3);
+    for (const auto& image : message.images) {
+      EXPECT_EQ(image.compression_method, test_case.compression_method);
+      EXPECT_EQ(image.data.size(), image.size);
+      const std::vector<uint8_t> pixels = DecodeData(image);
+      if (image.pixel_format == image_t::PIXEL_FORMAT_RGBA) {
+        EXPECT_TRUE(HasPixels(pixels, color_image));
+      } else if (image.pixel_format == image_t::PIXEL_FORMAT_DEPTH) {
+        EXPECT_TRUE(HasPixels(pixels, depth_image));
+      } else {
+        EXPECT_EQ(image.pixel_format, image_t::PIXEL_FORMAT_LABEL);
+        EXPECT_TRUE(HasPixels(pixels, label_image));
+      }
+      if (test_case.method != Method::kNone) {
+        EXPECT_LT(image.size, image.row_stride * image.height);
+      }
+    }
+    messages.push_back(message);
+  }
+
+  // The threads do not change the message.
+  for (int i = 0; i < static_cast<int>(messages.size()); i += 2) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_EQ(messages[i].images[j].data, messages[i + 1].images[j].data);
+    }
+  }
+
+  LcmImageCompressionOptions options;
+  options.zlib_level = 0;
+  EXPECT_THROW(ImageToLcmImageArrayT{options}, std::logic_error);
+  options.zlib_level = 10;
+  EXPECT_THROW(ImageToLcmImageArrayT{options}, std::logic_error);
+  options.zlib_level = 1;
+  options.num_threads = 0;
+  EXPECT_THROW(ImageToLcmImageArrayT(kColorFrameName, kDepthFrameName,
+                                     kLabelFrameName, options),
+               std::logic_error);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -4,7 +4,9 @@
 
 #include <fstream>
 #include <set>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <spruce.hh>
@@ -283,6 +285,76 @@ class ImageWriterTest : public ::testing::Test {
     EXPECT_TRUE(MatchesFileOnDisk(expected_name, image));
   }
 
+  // Publishes the same images with a synchronous and an asynchronous writer,
+  // with the given compression options, and confirms that they write the
+  // same files.
+  template <PixelType kPixelType>
+  static void TestWritingImagesAsynchronously(ImageWriterOptions options) {
+    const int kNumImages = 5;
+    options.num_writer_threads = 0;
+    ImageWriter sync_writer(options);
+    options.num_writer_threads = 2;
+    options.max_queue_size = 1;
+    ImageWriter async_writer(options);
+    EXPECT_EQ(async_writer.options().num_writer_threads, 2);
+
+    ImageWriterTester sync_tester(sync_writer);
+    ImageWriterTester async_tester(async_writer);
+    std::vector<std::string> sync_names;
+    std::vector<std::string> async_names;
+    Image<kPixelType> image = test_image<kPixelType>();
+    // Each call writes its own files, so that the files of an earlier call
+    // (e.g., with other compression options) cannot be mistaken for ours.
+    const std::string prefix =
+        "async_test_" + std::to_string(++img_count_) + "_";
+    for (ImageWriter* writer : {&sync_writer, &async_writer}) {
+      const bool is_async = (writer == &async_writer);
+      spruce::path path(temp_dir());
+      path.append(prefix + (is_async ? "async" : "sync") +
+                  "_{image_type}_{count}");
+      const auto& port = writer->DeclareImageInputPort<kPixelType>(
+          "port", path.getStr(), 0.1, 0);
+      auto events = writer->AllocateCompositeEventCollection();
+      auto context = writer->AllocateContext();
+      context->FixInputPort(port.get_index(),
+                            AbstractValue::Make<Image<kPixelType>>(image));
+      const ImageWriterTester& tester = is_async ? async_tester : sync_tester;
+      for (int i = 0; i < kNumImages; ++i) {
+        context->set_time(0.1 * i);
+        events->Clear();
+        writer->CalcNextUpdateTime(*context, events.get());
+        const std::string name = tester.MakeFileName(
+            tester.port_format(port.get_index()), kPixelType,
+            context->get_time(), "port", tester.port_count(port.get_index()));
+        add_file_for_cleanup(name);
+        (is_async ? async_names : sync_names).push_back(name);
+        writer->Publish(*context, events->get_publish_events());
+      }
+    }
+
+    async_writer.WaitForQueuedImages();
+    const ImageWriterQueueStatistics statistics =
+        async_writer.GetQueueStatistics();
+    EXPECT_EQ(statistics.num_queued, kNumImages);
+    EXPECT_EQ(statistics.num_written, kNumImages);
+    EXPECT_EQ(statistics.peak_queue_size, 1);
+    EXPECT_GE(statistics.blocked_time, 0);
+    EXPECT_EQ(sync_writer.GetQueueStatistics().num_queued, 0);
+
+    auto read_file = [](const std::string& name) {
+      std::ifstream stream(name, std::ios::binary);
+      std::stringstream contents;
+      contents << stream.rdbuf();
+      return contents.str();
+    };
+    for (int i = 0; i < kNumImages; ++i) {
+      EXPECT_TRUE(MatchesFileOnDisk(async_names[i], image));
+      const std::string sync_contents = read_file(sync_names[i]);
+      EXPECT_FALSE(sync_contents.empty());
+      EXPECT_EQ(read_file(async_names[i]), sync_contents);
+    }
+  }
+
  private:
   // NOTE: These are static so that they are shared across the entire test
   // suite. This allows all tests to have non-conflicting names *and* get
@@ -507,6 +579,25 @@ TEST_F(ImageWriterTest, ConfigureInputPortErrors) {
                               "System .* already has an input port named .*");
 }
 
+// Confirms that out-of-range options are rejected.
+TEST_F(ImageWriterTest, OptionsErrors) {
+  ImageWriterOptions options;
+  options.png_compression_level = 10;
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter{options}, std::logic_error,
+                              ".* PNG compression level must be in .*");
+
+  options = ImageWriterOptions{};
+  options.num_writer_threads = -1;
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter{options}, std::logic_error,
+                              ".* number of writer threads cannot be .*");
+
+  options = ImageWriterOptions{};
+  options.num_writer_threads = 1;
+  options.max_queue_size = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter{options}, std::logic_error,
+                              ".* queue size must be positive");
+}
+
 // Helper function for testing the extension produced for a given pixel type.
 template <PixelType kPixelType>
 void TestPixelExtension(const std::string& folder, ImageWriter* writer,
@@ -659,6 +750,21 @@ TEST_F(ImageWriterTest, WritesDepthImage) {
   TestWritingImageOnPort<PixelType::kDepth32F>();
 }
 
+// Confirms that the images written asynchronously, with the default or with
+// no compression, match those written synchronously.
+TEST_F(ImageWriterTest, WritesImagesAsynchronously) {
+  ImageWriterOptions options;
+  TestWritingImagesAsynchronously<PixelType::kRgba8U>(options);
+  TestWritingImagesAsynchronously<PixelType::kLabel16I>(options);
+  TestWritingImagesAsynchronously<PixelType::kDepth32F>(options);
+
+  options.png_compression_level = 0;
+  options.tiff_compression = ImageWriterOptions::TiffCompression::kNone;
+  TestWritingImagesAsynchronously<PixelType::kRgba8U>(options);
+  TestWritingImagesAsynchronously<PixelType::kLabel16I>(options);
+  TestWritingImagesAsynchronously<PixelType::kDepth32F>(options);
+}
+
 // Evaluate the stand-alone test for color images.
 TEST_F(ImageWriterTest, SaveToPng_Color) {
   ImageRgba8U color_image = test_image<PixelType::kRgba8U>();
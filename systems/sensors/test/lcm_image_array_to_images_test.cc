@@ -129,6 +129,37 @@ GTEST_TEST(LcmImageArrayToImagesTest, PngTest) {
   EXPECT_EQ(depth_image.size(), 32 * 32);
 }
 
+GTEST_TEST(LcmImageArrayToImagesTest, UncompressedTest) {
+  image_t depth_image_t{};
+  depth_image_t.width = 32;
+  depth_image_t.height = 32;
+  depth_image_t.row_stride = depth_image_t.width * 4;
+  depth_image_t.bigendian = 0;
+  depth_image_t.pixel_format = image_t::PIXEL_FORMAT_DEPTH;
+  depth_image_t.channel_type = image_t::CHANNEL_TYPE_FLOAT32;
+  depth_image_t.compression_method = image_t::COMPRESSION_METHOD_NOT_COMPRESSED;
+  depth_image_t.data.resize(32 * 32 * 4, 0);
+  depth_image_t.size = depth_image_t.data.size();
+
+  image_array_t lcm_images{};
+  lcm_images.num_images = 1;
+  lcm_images.images.push_back(depth_image_t);
+
+  LcmImageArrayToImages dut;
+  ImageRgba8U color_image;
+  ImageDepth32F depth_image;
+
+  DecodeImageArray(&dut, lcm_images, &color_image, &depth_image);
+  EXPECT_EQ(depth_image.size(), 32 * 32);
+
+  // An image with fewer bytes than its width and height call for is
+  // rejected, rather than read past the end of its data.
+  lcm_images.images[0].data.resize(32 * 32);
+  lcm_images.images[0].size = lcm_images.images[0].data.size();
+  DecodeImageArray(&dut, lcm_images, &color_image, &depth_image);
+  EXPECT_EQ(depth_image.size(), 0);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
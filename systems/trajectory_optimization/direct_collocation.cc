@@ -1,6 +1,8 @@
 #include "drake/systems/trajectory_optimization/direct_collocation.h"
 
+#include <atomic>
 #include <cstddef>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -56,19 +58,31 @@ DirectCollocationConstraint::DirectCollocationConstraint(
 void DirectCollocationConstraint::dynamics(const AutoDiffVecXd& state,
                                            const AutoDiffVecXd& input,
                                            AutoDiffVecXd* xdot) const {
-  if (context_->get_num_input_ports() > 0) {
-    input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(input);
-  }
-  context_->get_mutable_continuous_state().SetFromVector(state);
-  system_->CalcTimeDerivatives(*context_, derivatives_.get());
-  *xdot = derivatives_->CopyToVector();
+  AutoDiffVecXd state_and_input(num_states_ + num_inputs_);
+  state_and_input << state, input;
+  // The state and input at a knot point depend on only some of the
+  // constraint's variables, and never on more than num_states_ + num_inputs_
+  // directions, so differentiate the system in those directions only.
+  *xdot = math::EvalWithCompressedDerivatives(
+      [this](const AutoDiffVecXd& z) {
+        if (context_->get_num_input_ports() > 0) {
+          input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(
+              z.tail(num_inputs_));
+        }
+        context_->get_mutable_continuous_state().SetFromVector(
+            z.head(num_states_));
+        system_->CalcTimeDerivatives(*context_, derivatives_.get());
+        return derivatives_->CopyToVector();
+      },
+      state_and_input);
 }
 
 void DirectCollocationConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x,
     Eigen::VectorXd* y) const {
+  // Evaluate without derivatives.
   AutoDiffVecXd y_t;
-  Eval(math::initializeAutoDiff(x), &y_t);
+  Eval(x.cast<AutoDiffXd>(), &y_t);
   *y = math::autoDiffToValueMatrix(y_t);
 }
 
@@ -94,11 +108,9 @@ void DirectCollocationConstraint::DoEval(
   // recomputed in the next constraint as {u0,x0}.
   AutoDiffVecXd xdot0;
   dynamics(x0, u0, &xdot0);
-  const Eigen::MatrixXd dxdot0 = math::autoDiffToGradientMatrix(xdot0);
 
   AutoDiffVecXd xdot1;
   dynamics(x1, u1, &xdot1);
-  const Eigen::MatrixXd dxdot1 = math::autoDiffToGradientMatrix(xdot1);
 
   // Cubic interpolation to get xcol and xdotcol.
   const AutoDiffVecXd xcol = 0.5 * (x0 + x1) + h / 8 * (xdot0 - xdot1);
@@ -116,6 +128,163 @@ void DirectCollocationConstraint::DoEval(
       "DirectCollocationConstraint does not support symbolic evaluation.");
 }
 
+DirectCollocationTrajectoryConstraint::DirectCollocationTrajectoryConstraint(
+    const System<double>& system, const Context<double>& context,
+    int num_time_samples, int num_threads)
+    : DirectCollocationTrajectoryConstraint(
+          system, context, num_time_samples, num_threads,
+          context.get_continuous_state().size(),
+          (context.get_num_input_ports() > 0 ? system.get_input_port(0).size()
+                                             : 0)) {}
+
+DirectCollocationTrajectoryConstraint::DirectCollocationTrajectoryConstraint(
+    const System<double>& system, const Context<double>& context,
+    int num_time_samples, int num_threads, int num_states, int num_inputs)
+    : Constraint((num_time_samples - 1) * num_states,
+                 (num_time_samples - 1) +
+                     num_time_samples * (num_states + num_inputs),
+                 Eigen::VectorXd::Zero((num_time_samples - 1) * num_states),
+                 Eigen::VectorXd::Zero((num_time_samples - 1) * num_states)),
+      system_(System<double>::ToAutoDiffXd(system)),
+      num_states_(num_states),
+      num_inputs_(num_inputs),
+      num_time_samples_(num_time_samples) {
+  DRAKE_THROW_UNLESS(num_time_samples >= 2);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  DRAKE_THROW_UNLESS(system_->get_num_input_ports() <= 1);
+  DRAKE_THROW_UNLESS(context.has_only_continuous_state());
+
+  for (int t = 0; t < num_threads; ++t) {
+    auto workspace = std::make_unique<Workspace>();
+    workspace->context = system_->CreateDefaultContext();
+    workspace->context->SetTimeStateAndParametersFrom(context);
+    if (context.get_num_input_ports() > 0) {
+      workspace->input_port_value = &workspace->context->FixInputPort(
+          0, system_->AllocateInputVector(system_->get_input_port(0)));
+    }
+    workspace->derivatives = system_->AllocateTimeDerivatives();
+    workspaces_.push_back(std::move(workspace));
+  }
+  if (num_threads > 1) {
+    thread_pool_ = std::make_unique<drake::internal::ThreadPool>(num_threads);
+  }
+
+  // The constraints of interval i depend on h[i], x[i], x[i+1], u[i] and
+  // u[i+1].
+  const int N = num_time_samples_;
+  std::vector<std::pair<int, int>> gradient_sparsity_pattern;
+  gradient_sparsity_pattern.reserve((N - 1) * num_states_ *
+                                    (1 + 2 * (num_states_ + num_inputs_)));
+  for (int i = 0; i < N - 1; ++i) {
+    for (int row = i * num_states_; row < (i + 1) * num_states_; ++row) {
+      gradient_sparsity_pattern.emplace_back(row, i);
+      const int x_start = (N - 1) + i * num_states_;
+      for (int j = 0; j < 2 * num_states_; ++j) {
+        gradient_sparsity_pattern.emplace_back(row, x_start + j);
+      }
+      const int u_start = (N - 1) + N * num_states_ + i * num_inputs_;
+      for (int j = 0; j < 2 * num_inputs_; ++j) {
+        gradient_sparsity_pattern.emplace_back(row, u_start + j);
+      }
+    }
+  }
+  SetGradientSparsityPattern(gradient_sparsity_pattern);
+}
+
+DirectCollocationTrajectoryConstraint::
+    ~DirectCollocationTrajectoryConstraint() = default;
+
+void DirectCollocationTrajectoryConstraint::dynamics(
+    const AutoDiffVecXd& state, const AutoDiffVecXd& input,
+    Workspace* workspace, AutoDiffVecXd* xdot) const {
+  AutoDiffVecXd state_and_input(num_states_ + num_inputs_);
+  state_and_input << state, input;
+  *xdot = math::EvalWithCompressedDerivatives(
+      [this, workspace](const AutoDiffVecXd& z) {
+        if (workspace->input_port_value != nullptr) {
+          workspace->input_port_value->GetMutableVectorData<AutoDiffXd>()
+              ->SetFromVector(z.tail(num_inputs_));
+        }
+        workspace->context->get_mutable_continuous_state().SetFromVector(
+            z.head(num_states_));
+        system_->CalcTimeDerivatives(*workspace->context,
+                                     workspace->derivatives.get());
+        return workspace->derivatives->CopyToVector();
+      },
+      state_and_input);
+}
+
+void DirectCollocationTrajectoryConstraint::ParallelFor(
+    int n, const std::function<void(int, Workspace*)>& body) const {
+  if (thread_pool_ == nullptr) {
+    for (int i = 0; i < n; ++i) {
+      body(i, workspaces_[0].get());
+    }
+    return;
+  }
+  // Each item of the pool's loop claims items of this loop with its own
+  // workspace until none are left.
+  std::atomic<int> next{0};
+  thread_pool_->ParallelFor(
+      static_cast<int>(workspaces_.size()), [&](int t) {
+        for (int i = next++; i < n; i = next++) {
+          body(i, workspaces_[t].get());
+        }
+      });
+}
+
+void DirectCollocationTrajectoryConstraint::DoEval(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
+  // Evaluate without derivatives.
+  AutoDiffVecXd y_t;
+  Eval(x.cast<AutoDiffXd>(), &y_t);
+  *y = math::autoDiffToValueMatrix(y_t);
+}
+
+void DirectCollocationTrajectoryConstraint::DoEval(
+    const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) const {
+  const int N = num_time_samples_;
+  DRAKE_ASSERT(x.size() == (N - 1) + N * (num_states_ + num_inputs_));
+  const auto h = x.head(N - 1);
+  const auto states = x.segment(N - 1, N * num_states_);
+  const auto inputs = x.tail(N * num_inputs_);
+  std::lock_guard<std::mutex> lock(workspaces_mutex_);
+
+  // The dynamics at each knot point, shared by the intervals on both sides.
+  std::vector<AutoDiffVecXd> xdot(N);
+  ParallelFor(N, [&](int k, Workspace* workspace) {
+    dynamics(states.segment(k * num_states_, num_states_),
+             inputs.segment(k * num_inputs_, num_inputs_), workspace,
+             &xdot[k]);
+  });
+
+  y->resize(num_constraints());
+  ParallelFor(N - 1, [&](int i, Workspace* workspace) {
+    const auto x0 = states.segment(i * num_states_, num_states_);
+    const auto x1 = states.segment((i + 1) * num_states_, num_states_);
+    const auto u0 = inputs.segment(i * num_inputs_, num_inputs_);
+    const auto u1 = inputs.segment((i + 1) * num_inputs_, num_inputs_);
+
+    // Cubic interpolation to get xcol and xdotcol.
+    const AutoDiffVecXd xcol =
+        0.5 * (x0 + x1) + h(i) / 8 * (xdot[i] - xdot[i + 1]);
+    const AutoDiffVecXd xdotcol =
+        -1.5 * (x0 - x1) / h(i) - .25 * (xdot[i] + xdot[i + 1]);
+
+    AutoDiffVecXd g;
+    dynamics(xcol, 0.5 * (u0 + u1), workspace, &g);
+    y->segment(i * num_states_, num_states_) = xdotcol - g;
+  });
+}
+
+void DirectCollocationTrajectoryConstraint::DoEval(
+    const Eigen::Ref<const VectorX<symbolic::Variable>>&,
+    VectorX<symbolic::Expression>*) const {
+  throw std::logic_error(
+      "DirectCollocationTrajectoryConstraint does not support symbolic "
+      "evaluation.");
+}
+
 Binding<Constraint> AddDirectCollocationConstraint(
     std::shared_ptr<DirectCollocationConstraint> constraint,
     const Eigen::Ref<const VectorXDecisionVariable>& timestep,
@@ -137,7 +306,8 @@ DirectCollocation::DirectCollocation(const System<double>* system,
                                      const Context<double>& context,
                                      int num_time_samples,
                                      double minimum_timestep,
-                                     double maximum_timestep)
+                                     double maximum_timestep,
+                                     const DirectCollocationOptions& options)
     : MultipleShooting(system->get_num_total_inputs(),
                        context.get_continuous_state().size(), num_time_samples,
                        minimum_timestep, maximum_timestep),
@@ -155,6 +325,13 @@ DirectCollocation::DirectCollocation(const System<double>* system,
   }
 
   // Add the dynamic constraints.
+  if (options.batch_collocation_constraints) {
+    auto constraint = std::make_shared<DirectCollocationTrajectoryConstraint>(
+        *system, context, N(), options.num_threads);
+    AddConstraint(constraint, {h_vars(), x_vars(), u_vars()});
+    return;
+  }
+
   auto constraint = std::make_shared<DirectCollocationConstraint>(
       *system, context);
 
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/thread_pool.h"
 #include "drake/solvers/constraint.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
@@ -13,6 +17,23 @@ namespace drake {
 namespace systems {
 namespace trajectory_optimization {
 
+/// Options for the construction of a DirectCollocation.
+struct DirectCollocationOptions {
+  /// If true, the collocation constraints of all the intervals are added as a
+  /// single DirectCollocationTrajectoryConstraint, which evaluates the
+  /// dynamics at each knot point only once and declares the sparsity pattern
+  /// of its gradient to the solvers.  If false, a DirectCollocationConstraint
+  /// is bound to each interval.
+  bool batch_collocation_constraints{false};
+
+  /// The number of threads used to evaluate the dynamics when
+  /// batch_collocation_constraints is true.  When this is greater than one,
+  /// the dynamics are evaluated concurrently on different Contexts of the same
+  /// System, so its CalcTimeDerivatives() must be safe to call from multiple
+  /// threads.
+  int num_threads{1};
+};
+
 /// DirectCollocation implements the approach to trajectory optimization as
 /// described in
 ///   C. R. Hargraves and S. W. Paris. Direct trajectory optimization using
@@ -39,9 +60,11 @@ class DirectCollocation : public MultipleShooting {
   /// @param num_time_samples The number of knot points in the trajectory.
   /// @param minimum_timestep Minimum spacing between sample times.
   /// @param maximum_timestep Maximum spacing between sample times.
-  DirectCollocation(const System<double>* system,
-                    const Context<double>& context, int num_time_samples,
-                    double minimum_timestep, double maximum_timestep);
+  /// @param options How to add the collocation constraints.
+  DirectCollocation(
+      const System<double>* system, const Context<double>& context,
+      int num_time_samples, double minimum_timestep, double maximum_timestep,
+      const DirectCollocationOptions& options = DirectCollocationOptions());
 
   // NOTE: The fixed timestep constructor, which would avoid adding h as
   // decision variables, has been removed since it complicates the API and code.
@@ -132,6 +155,91 @@ class DirectCollocationConstraint : public solvers::Constraint {
   const int num_inputs_{0};
 };
 
+/// Implements the direct collocation constraints of all the intervals of a
+/// trajectory with N knot points, i.e. the constraints of
+/// DirectCollocationConstraint for each pair of consecutive knot points, as
+/// one constraint on the variables
+///   { h[0], ..., h[N-2], x[0], ..., x[N-1], u[0], ..., u[N-1] },
+/// where h[i] is the i'th timestep, and x[i] and u[i] are the state and input
+/// at the i'th knot point.  Its N-1 blocks of num_states outputs are the
+/// constraints of the successive intervals.
+///
+/// Compared to binding a DirectCollocationConstraint to each interval, this
+/// evaluates the dynamics at each knot point once instead of twice, can spread
+/// the evaluations of the dynamics over multiple threads, and declares the
+/// sparsity pattern of its gradient (the constraints of interval i only depend
+/// on h[i], x[i], x[i+1], u[i] and u[i+1]) so that solvers evaluate and store
+/// only the entries that may be nonzero.
+///
+/// The dynamics are evaluated on Contexts owned by this constraint, one per
+/// thread, which each evaluation overwrites. Evaluations of the same
+/// constraint from several threads are therefore serialized by a mutex; to
+/// evaluate it concurrently, use a separate constraint per thread.
+class DirectCollocationTrajectoryConstraint : public solvers::Constraint {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DirectCollocationTrajectoryConstraint)
+
+  /// @param system A dynamical system, which must support
+  ///    System::ToAutoDiffXd.
+  /// @param context Describes any parameters of the system.
+  /// @param num_time_samples The number of knot points N, at least two.
+  /// @param num_threads The number of threads used to evaluate the dynamics.
+  ///    When this is greater than one, the dynamics are evaluated concurrently
+  ///    on different Contexts of the same System.
+  DirectCollocationTrajectoryConstraint(const System<double>& system,
+                                        const Context<double>& context,
+                                        int num_time_samples,
+                                        int num_threads = 1);
+
+  ~DirectCollocationTrajectoryConstraint() override;
+
+  int num_states() const { return num_states_; }
+  int num_inputs() const { return num_inputs_; }
+  int num_time_samples() const { return num_time_samples_; }
+
+ protected:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override;
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override;
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
+              VectorX<symbolic::Expression>* y) const override;
+
+ private:
+  // The Context and the derivatives used by one thread.
+  struct Workspace {
+    std::unique_ptr<Context<AutoDiffXd>> context;
+    FixedInputPortValue* input_port_value{nullptr};
+    std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives;
+  };
+
+  DirectCollocationTrajectoryConstraint(const System<double>& system,
+                                        const Context<double>& context,
+                                        int num_time_samples, int num_threads,
+                                        int num_states, int num_inputs);
+
+  void dynamics(const AutoDiffVecXd& state, const AutoDiffVecXd& input,
+                Workspace* workspace, AutoDiffVecXd* xdot) const;
+
+  // Calls body(i, workspace) for each i in [0, n), spread over the threads,
+  // each of which passes its own workspace.
+  void ParallelFor(
+      int n, const std::function<void(int, Workspace*)>& body) const;
+
+  std::unique_ptr<System<AutoDiffXd>> system_;
+  // Guards workspaces_, which every evaluation overwrites.
+  mutable std::mutex workspaces_mutex_;
+  std::vector<std::unique_ptr<Workspace>> workspaces_;
+  // Null when there is a single thread.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+
+  const int num_states_{0};
+  const int num_inputs_{0};
+  const int num_time_samples_{0};
+};
+
 // Note: The order of arguments is a compromise between GSG and the desire to
 // match the AddConstraint interfaces in MathematicalProgram.
 /// Helper method to add a DirectCollocationConstraint to the @p prog,
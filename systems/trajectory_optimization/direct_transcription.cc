@@ -48,10 +48,8 @@ class DiscreteTimeSystemConstraint : public solvers::Constraint {
     DRAKE_DEMAND(discrete_state_ != nullptr);
     DRAKE_DEMAND(context_->get_num_input_ports() == 0 ||
                  input_port_value_ != nullptr);
-
-    // Makes sure the autodiff vector is properly initialized.
-    evaluation_time_.derivatives().resize(2 * num_states_ + num_inputs_);
-    evaluation_time_.derivatives().setZero();
+    // N.B. evaluation_time_ keeps empty (i.e., zero) derivatives, which mix
+    // with derivatives of any size.
   }
 
   ~DiscreteTimeSystemConstraint() override = default;
@@ -59,8 +57,9 @@ class DiscreteTimeSystemConstraint : public solvers::Constraint {
  protected:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override {
+    // Evaluate without derivatives.
     AutoDiffVecXd y_t;
-    Eval(math::initializeAutoDiff(x), &y_t);
+    Eval(x.cast<AutoDiffXd>(), &y_t);
     *y = math::autoDiffToValueMatrix(y_t);
   }
 
@@ -71,19 +70,25 @@ class DiscreteTimeSystemConstraint : public solvers::Constraint {
     DRAKE_ASSERT(x.size() == num_inputs_ + (2 * num_states_));
 
     // Extract our input variables:
-    const auto input = x.head(num_inputs_);
-    const auto state = x.segment(num_inputs_, num_states_);
+    const auto input_and_state = x.head(num_inputs_ + num_states_);
     const auto next_state = x.tail(num_states_);
 
-    context_->set_time(evaluation_time_);
-    if (context_->get_num_input_ports() > 0) {
-      input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(
-          input);
-    }
-    context_->get_mutable_discrete_state(0).SetFromVector(state);
-
-    system_.CalcDiscreteVariableUpdates(*context_, discrete_state_);
-    *y = next_state - discrete_state_->get_vector(0).CopyToVector();
+    // The update depends on only the input and the state, so differentiate
+    // the system in at most num_inputs_ + num_states_ directions.
+    const AutoDiffVecXd update = math::EvalWithCompressedDerivatives(
+        [this](const AutoDiffVecXd& z) {
+          context_->set_time(evaluation_time_);
+          if (context_->get_num_input_ports() > 0) {
+            input_port_value_->GetMutableVectorData<AutoDiffXd>()
+                ->SetFromVector(z.head(num_inputs_));
+          }
+          context_->get_mutable_discrete_state(0).SetFromVector(
+              z.tail(num_states_));
+          system_.CalcDiscreteVariableUpdates(*context_, discrete_state_);
+          return discrete_state_->get_vector(0).CopyToVector();
+        },
+        input_and_state);
+    *y = next_state - update;
   }
 
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
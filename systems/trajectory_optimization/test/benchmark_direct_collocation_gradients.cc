@@ -0,0 +1,144 @@
+/// @file benchmark_direct_collocation_gradients.cc
+///
+/// Compares the time taken to evaluate the gradients of the direct collocation
+/// constraints of a trajectory, for an increasing number of knot points:
+///  - the per-interval DirectCollocationConstraint bindings, each with the
+///    derivatives of its own variables, as a solver evaluates them;
+///  - one DirectCollocationTrajectoryConstraint, with the derivatives of all
+///    the variables of the trajectory;
+///  - the same DirectCollocationTrajectoryConstraint, through
+///    EvalWithSparseGradient();
+///  - for reference, the evaluations of the dynamics that the
+///    DirectCollocationTrajectoryConstraint performs, but without compressing
+///    their derivatives (see math::EvalWithCompressedDerivatives()).
+/// The system is a random LinearSystem.
+///
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/trajectory_optimization/direct_collocation.h"
+
+DEFINE_int32(num_states, 8, "Number of states of the system");
+DEFINE_int32(num_inputs, 2, "Number of inputs of the system");
+DEFINE_int32(num_threads, 1,
+             "Number of threads of the DirectCollocationTrajectoryConstraint");
+DEFINE_int32(num_evaluations, 20, "Number of evaluations per measurement");
+
+namespace drake {
+namespace systems {
+namespace trajectory_optimization {
+namespace {
+
+using common::test::MeasureExecutionTime;
+
+// Returns the time taken by one evaluation of `evaluate`, in microseconds.
+template <typename F>
+double TimeEvaluation(const F& evaluate) {
+  const double time = MeasureExecutionTime([&]() {
+    for (int i = 0; i < FLAGS_num_evaluations; ++i) {
+      evaluate();
+    }
+  });
+  return time / FLAGS_num_evaluations * 1e6;
+}
+
+int do_main() {
+  const int n = FLAGS_num_states;
+  const int m = FLAGS_num_inputs;
+  std::mt19937 generator;
+  std::uniform_real_distribution<double> coefficient(-1.0, 1.0);
+  const Eigen::MatrixXd A = Eigen::MatrixXd::NullaryExpr(
+      n, n, [&]() { return coefficient(generator); });
+  const Eigen::MatrixXd B = Eigen::MatrixXd::NullaryExpr(
+      n, m, [&]() { return coefficient(generator); });
+  const LinearSystem<double> system(A, B, Eigen::MatrixXd(0, n),
+                                    Eigen::MatrixXd(0, m));
+  const auto context = system.CreateDefaultContext();
+  context->FixInputPort(0, Eigen::VectorXd::Zero(m));
+
+  std::cout << "knot_points  per-interval (us)  trajectory (us)  "
+               "trajectory sparse (us)  uncompressed dynamics (us)\n";
+  for (int num_time_samples : {5, 20, 80}) {
+    const DirectCollocation prog(&system, *context, num_time_samples, 0.01,
+                                 0.1);
+    const Eigen::VectorXd prog_values =
+        Eigen::VectorXd::LinSpaced(prog.num_vars(), 0.01, 0.1);
+
+    // The values of the variables of each per-interval binding.
+    std::vector<Eigen::VectorXd> binding_values;
+    for (const auto& binding : prog.generic_constraints()) {
+      Eigen::VectorXd values(binding.variables().size());
+      for (int i = 0; i < values.size(); ++i) {
+        values(i) = prog_values(
+            prog.FindDecisionVariableIndex(binding.variables()(i)));
+      }
+      binding_values.push_back(values);
+    }
+    const double per_interval_time = TimeEvaluation([&]() {
+      for (size_t k = 0; k < binding_values.size(); ++k) {
+        AutoDiffVecXd y;
+        prog.generic_constraints()[k].evaluator()->Eval(
+            math::initializeAutoDiff(binding_values[k]), &y);
+      }
+    });
+
+    const DirectCollocationTrajectoryConstraint constraint(
+        system, *context, num_time_samples, FLAGS_num_threads);
+    const Eigen::VectorXd z =
+        Eigen::VectorXd::LinSpaced(constraint.num_vars(), 0.01, 0.1);
+    const AutoDiffVecXd z_autodiff = math::initializeAutoDiff(z);
+    const double trajectory_time = TimeEvaluation([&]() {
+      AutoDiffVecXd y;
+      constraint.Eval(z_autodiff, &y);
+    });
+    const double sparse_time = TimeEvaluation([&]() {
+      Eigen::VectorXd y, gradient;
+      constraint.EvalWithSparseGradient(z, &y, &gradient);
+    });
+
+    // The trajectory constraint evaluates the dynamics at the knot points and
+    // at the collocation points, 2N - 1 times in all.
+    const std::unique_ptr<System<AutoDiffXd>> system_autodiff =
+        System<double>::ToAutoDiffXd(system);
+    const auto context_autodiff = system_autodiff->CreateDefaultContext();
+    auto& input = context_autodiff->FixInputPort(
+        0, system_autodiff->AllocateInputVector(
+               system_autodiff->get_input_port(0)));
+    const auto derivatives = system_autodiff->AllocateTimeDerivatives();
+    const int N = num_time_samples;
+    const double uncompressed_time = TimeEvaluation([&]() {
+      for (int k = 0; k < 2 * N - 1; ++k) {
+        const int knot = k / 2;
+        context_autodiff->get_mutable_continuous_state().SetFromVector(
+            z_autodiff.segment(N - 1 + knot * n, n));
+        input.GetMutableVectorData<AutoDiffXd>()->SetFromVector(
+            z_autodiff.segment(N - 1 + N * n + knot * m, m));
+        system_autodiff->CalcTimeDerivatives(*context_autodiff,
+                                             derivatives.get());
+      }
+    });
+
+    std::cout << num_time_samples << "  " << per_interval_time << "  "
+              << trajectory_time << "  " << sparse_time << "  "
+              << uncompressed_time << std::endl;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace trajectory_optimization
+}  // namespace systems
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::systems::trajectory_optimization::do_main();
+}
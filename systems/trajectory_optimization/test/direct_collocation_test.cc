@@ -2,12 +2,14 @@
 
 #include <cmath>
 #include <cstddef>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/solve.h"
 #include "drake/systems/primitives/linear_system.h"
@@ -313,6 +315,136 @@ GTEST_TEST(DirectCollocationTest, AddDirectCollocationConstraint) {
   EXPECT_TRUE(val.isZero());
 }
 
+// Checks the gradient of the constraint against finite differences, when the
+// constraint's variables are a few of many decision variables.
+GTEST_TEST(DirectCollocationTest, ConstraintGradient) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+  const DirectCollocationConstraint constraint(*system, *context);
+  const int num_vars = constraint.num_vars();
+  ASSERT_EQ(num_vars, 9);
+
+  Eigen::VectorXd x(num_vars);
+  x << 1, 6, 7, 8, 9, 10, 11, 12, 13;
+  // Derivatives with respect to 50 decision variables, of which the
+  // constraint's variables are every fifth one.
+  const int num_decision_variables = 50;
+  Eigen::MatrixXd x_gradient =
+      Eigen::MatrixXd::Zero(num_vars, num_decision_variables);
+  for (int i = 0; i < num_vars; ++i) {
+    x_gradient(i, 5 * i + 2) = 1;
+  }
+  AutoDiffVecXd y;
+  constraint.Eval(math::initializeAutoDiffGivenGradientMatrix(x, x_gradient),
+                  &y);
+  const Eigen::MatrixXd y_gradient = math::autoDiffToGradientMatrix(y);
+  ASSERT_EQ(y_gradient.cols(), num_decision_variables);
+
+  Eigen::VectorXd y_value;
+  constraint.Eval(x, &y_value);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y), y_value));
+  const double kDelta = 1e-6;
+  for (int i = 0; i < num_vars; ++i) {
+    Eigen::VectorXd y_perturbed;
+    constraint.Eval(x + kDelta * Eigen::VectorXd::Unit(num_vars, i),
+                    &y_perturbed);
+    EXPECT_TRUE(CompareMatrices(y_gradient.col(5 * i + 2),
+                                (y_perturbed - y_value) / kDelta, 1e-4));
+    EXPECT_TRUE(y_gradient.col(5 * i + 3).isZero());
+  }
+}
+
+// Checks that the batched collocation constraint, evaluated on two threads,
+// matches the per-interval constraints, and that its sparse gradient matches
+// its dense gradient.
+GTEST_TEST(DirectCollocationTest, TrajectoryConstraint) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+
+  const int kNumSampleTimes = 5;
+  const DirectCollocation prog(system.get(), *context, kNumSampleTimes, 0.05,
+                               0.2);
+  DirectCollocationOptions options;
+  options.batch_collocation_constraints = true;
+  options.num_threads = 2;
+  const DirectCollocation batched_prog(system.get(), *context,
+                                       kNumSampleTimes, 0.05, 0.2, options);
+  ASSERT_EQ(prog.generic_constraints().size(), kNumSampleTimes - 1);
+  ASSERT_EQ(batched_prog.generic_constraints().size(), 1);
+  ASSERT_EQ(batched_prog.num_vars(), prog.num_vars());
+
+  const Eigen::VectorXd x_val =
+      Eigen::VectorXd::LinSpaced(prog.num_vars(), 0.1, 2);
+  Eigen::VectorXd defects(2 * (kNumSampleTimes - 1));
+  for (int i = 0; i < kNumSampleTimes - 1; ++i) {
+    defects.segment<2>(2 * i) =
+        prog.EvalBinding(prog.generic_constraints()[i], x_val);
+  }
+  const auto& binding = batched_prog.generic_constraints()[0];
+  EXPECT_TRUE(
+      CompareMatrices(batched_prog.EvalBinding(binding, x_val), defects,
+                      1e-12));
+
+  const auto& constraint = *binding.evaluator();
+  Eigen::VectorXd z(constraint.num_vars());
+  for (int i = 0; i < z.size(); ++i) {
+    z(i) = x_val(
+        batched_prog.FindDecisionVariableIndex(binding.variables()(i)));
+  }
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(math::initializeAutoDiff(z), &y_autodiff);
+  const Eigen::MatrixXd dense_gradient =
+      math::autoDiffToGradientMatrix(y_autodiff, z.size());
+
+  Eigen::VectorXd y, gradient;
+  constraint.EvalWithSparseGradient(z, &y, &gradient);
+  EXPECT_TRUE(CompareMatrices(y, defects, 1e-12));
+  const auto& pattern = *constraint.gradient_sparsity_pattern();
+  ASSERT_EQ(gradient.size(), static_cast<int>(pattern.size()));
+  Eigen::MatrixXd sparse_gradient =
+      Eigen::MatrixXd::Zero(dense_gradient.rows(), dense_gradient.cols());
+  for (int k = 0; k < gradient.size(); ++k) {
+    sparse_gradient(pattern[k].first, pattern[k].second) = gradient(k);
+  }
+  EXPECT_TRUE(CompareMatrices(sparse_gradient, dense_gradient, 1e-12));
+}
+
+// Checks that the batched collocation constraint can be evaluated from several
+// threads at once, which serializes the evaluations on its Contexts.
+GTEST_TEST(DirectCollocationTest, TrajectoryConstraintConcurrentEval) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+
+  const int kNumSampleTimes = 5;
+  for (int num_threads : {1, 2}) {
+    const DirectCollocationTrajectoryConstraint constraint(
+        *system, *context, kNumSampleTimes, num_threads);
+    const Eigen::VectorXd z =
+        Eigen::VectorXd::LinSpaced(constraint.num_vars(), 0.1, 2);
+    Eigen::VectorXd expected_y;
+    constraint.Eval(z, &expected_y);
+
+    const int kNumCallers = 4;
+    std::vector<Eigen::VectorXd> y(kNumCallers);
+    std::vector<std::thread> callers;
+    for (int k = 0; k < kNumCallers; ++k) {
+      callers.emplace_back([&constraint, &z, &y, k]() {
+        for (int repeat = 0; repeat < 200; ++repeat) {
+          const Eigen::VectorXd z_k = z * (repeat % 2 == 0 ? 1.0 : 2.0);
+          constraint.Eval(z_k, &y[k]);
+        }
+      });
+    }
+    for (auto& caller : callers) caller.join();
+    // The last evaluation of each caller was at z * 2.
+    Eigen::VectorXd expected_y_last;
+    constraint.Eval(z * 2.0, &expected_y_last);
+    for (int k = 0; k < kNumCallers; ++k) {
+      EXPECT_TRUE(CompareMatrices(y[k], expected_y_last, 0));
+    }
+  }
+}
+
 }  // anonymous namespace
 }  // namespace trajectory_optimization
 }  // namespace systems